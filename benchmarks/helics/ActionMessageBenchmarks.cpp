@@ -6,8 +6,15 @@ SPDX-License-Identifier: BSD-3-Clause
 */
 
 #include "helics/core/ActionMessage.hpp"
+#include "helics/core/CompactStringTable.hpp"
 #include "helics_benchmark_main.h"
 
+#include <atomic>
+#include <cstdlib>
+#include <deque>
+#include <new>
+#include <string>
+
 using namespace helics;  // NOLINT
 
 static ActionMessage generateTestMessage1()
@@ -249,4 +256,208 @@ static void BMdepacketizeStringsJson(benchmark::State& state)
 // Register the function as a benchmark
 BENCHMARK(BMdepacketizeStringsJson);
 
+// comparisons of the full and compact serializations on typical messages
+
+static ActionMessage generatePubMessage()
+{
+    ActionMessage obj(CMD_PUB);
+    obj.source_id = GlobalFederateId(131072);
+    obj.source_handle = InterfaceHandle(12);
+    obj.dest_id = GlobalFederateId(131085);
+    obj.dest_handle = InterfaceHandle(3);
+    obj.actionTime = 15.0;
+    obj.payload = std::string(8, '\x01');
+    return obj;
+}
+
+static ActionMessage generateTimeGrantMessage()
+{
+    ActionMessage obj(CMD_TIME_GRANT);
+    obj.source_id = GlobalFederateId(131072);
+    obj.dest_id = GlobalFederateId(131085);
+    obj.actionTime = 15.0;
+    return obj;
+}
+
+static ActionMessage generateTimeRequestMessage()
+{
+    ActionMessage obj(CMD_TIME_REQUEST);
+    obj.source_id = GlobalFederateId(131072);
+    obj.dest_id = GlobalFederateId(131085);
+    obj.actionTime = 15.0;
+    obj.Te = 15.0;
+    obj.Tdemin = 16.0;
+    obj.counter = 4;
+    return obj;
+}
+
+static ActionMessage generateSendMessage()
+{
+    ActionMessage obj(CMD_SEND_MESSAGE);
+    obj.source_id = GlobalFederateId(131072);
+    obj.source_handle = InterfaceHandle(12);
+    obj.dest_id = GlobalFederateId(131085);
+    obj.dest_handle = InterfaceHandle(3);
+    obj.actionTime = 15.0;
+    obj.payload = "message data";
+    obj.setStringData("receiving_federate/endpoint",
+                      "sending_federate/endpoint",
+                      "sending_federate/endpoint");
+    return obj;
+}
+
+static void BMencodeFull(benchmark::State& state, ActionMessage (*generator)())
+{
+    auto obj = generator();
+    std::string load;
+    load.reserve(500);
+    for (auto _ : state) {
+        obj.packetize(load);
+        benchmark::DoNotOptimize(load.data());
+    }
+    state.counters["bytes"] = static_cast<double>(load.size());
+}
+
+static void BMdecodeFull(benchmark::State& state, ActionMessage (*generator)())
+{
+    auto obj = generator();
+    std::string load;
+    obj.packetize(load);
+    ActionMessage conv;
+    for (auto _ : state) {
+        conv.depacketize(load.data(), load.size());
+    }
+    state.counters["bytes"] = static_cast<double>(load.size());
+}
+
+static void BMencodeCompact(benchmark::State& state, ActionMessage (*generator)())
+{
+    auto obj = generator();
+    std::string load;
+    load.reserve(500);
+    CompactStringTable table;
+    for (auto _ : state) {
+        obj.packetize_compact(load, &table);
+        benchmark::DoNotOptimize(load.data());
+    }
+    // the steady state size, with any strings already interned
+    state.counters["bytes"] = static_cast<double>(load.size());
+}
+
+static void BMdecodeCompact(benchmark::State& state, ActionMessage (*generator)())
+{
+    auto obj = generator();
+    std::string load;
+    CompactStringTable txTable;
+    CompactStringTable rxTable;
+    ActionMessage conv;
+    // prime the tables so the loop decodes the steady state message
+    obj.packetize_compact(load, &txTable);
+    conv.depacketize(load.data(), load.size(), &rxTable);
+    obj.packetize_compact(load, &txTable);
+    for (auto _ : state) {
+        conv.depacketize(load.data(), load.size(), &rxTable);
+    }
+    state.counters["bytes"] = static_cast<double>(load.size());
+}
+
+BENCHMARK_CAPTURE(BMencodeFull, pub, &generatePubMessage);
+BENCHMARK_CAPTURE(BMencodeCompact, pub, &generatePubMessage);
+BENCHMARK_CAPTURE(BMdecodeFull, pub, &generatePubMessage);
+BENCHMARK_CAPTURE(BMdecodeCompact, pub, &generatePubMessage);
+
+BENCHMARK_CAPTURE(BMencodeFull, timeGrant, &generateTimeGrantMessage);
+BENCHMARK_CAPTURE(BMencodeCompact, timeGrant, &generateTimeGrantMessage);
+BENCHMARK_CAPTURE(BMdecodeFull, timeGrant, &generateTimeGrantMessage);
+BENCHMARK_CAPTURE(BMdecodeCompact, timeGrant, &generateTimeGrantMessage);
+
+BENCHMARK_CAPTURE(BMencodeFull, timeRequest, &generateTimeRequestMessage);
+BENCHMARK_CAPTURE(BMencodeCompact, timeRequest, &generateTimeRequestMessage);
+BENCHMARK_CAPTURE(BMdecodeFull, timeRequest, &generateTimeRequestMessage);
+BENCHMARK_CAPTURE(BMdecodeCompact, timeRequest, &generateTimeRequestMessage);
+
+BENCHMARK_CAPTURE(BMencodeFull, sendMessage, &generateSendMessage);
+BENCHMARK_CAPTURE(BMencodeCompact, sendMessage, &generateSendMessage);
+BENCHMARK_CAPTURE(BMdecodeFull, sendMessage, &generateSendMessage);
+BENCHMARK_CAPTURE(BMdecodeCompact, sendMessage, &generateSendMessage);
+
+// allocation counts for messages passing through a processing queue, build with
+// HELICS_ENABLE_BUFFER_POOL to compare the pooled allocations
+
+static std::atomic<std::size_t> allocationCount{0};
+
+void* operator new(std::size_t size)
+{
+    ++allocationCount;
+    if (void* ptr = std::malloc(size == 0 ? 1 : size)) {
+        return ptr;
+    }
+    throw std::bad_alloc();
+}
+
+void operator delete(void* ptr) noexcept
+{
+    std::free(ptr);
+}
+
+void operator delete(void* ptr, std::size_t /*size*/) noexcept
+{
+    std::free(ptr);
+}
+
+static ActionMessage generateLargePubMessage()
+{
+    auto obj = generatePubMessage();
+    obj.payload = std::string(400, '\x01');
+    return obj;
+}
+
+static ActionMessage generateLargeSendMessage()
+{
+    auto obj = generateSendMessage();
+    obj.payload = std::string(1000, 'a');
+    return obj;
+}
+
+static void BMqueuePass(benchmark::State& state, ActionMessage (*generator)())
+{
+    const auto obj = generator();
+    std::deque<ActionMessage> queue;
+    // warm up the queue and any pools
+    for (int ii = 0; ii < 100; ++ii) {
+        queue.push_back(obj);
+    }
+    queue.clear();
+    std::size_t messages{0};
+#ifdef HELICS_ENABLE_BUFFER_POOL
+    pool::resetStatistics();
+#endif
+    auto startCount = allocationCount.load();
+    for (auto _ : state) {
+        // messages are copied into the queue by the sending thread and moved out by the
+        // processing loop, which then destroys them
+        for (int ii = 0; ii < 10; ++ii) {
+            queue.push_back(obj);
+        }
+        while (!queue.empty()) {
+            ActionMessage cmd(std::move(queue.front()));
+            queue.pop_front();
+            benchmark::DoNotOptimize(cmd.payload.data());
+            ++messages;
+        }
+    }
+    auto allocations = allocationCount.load() - startCount;
+    state.counters["allocs/msg"] = static_cast<double>(allocations) / static_cast<double>(messages);
+#ifdef HELICS_ENABLE_BUFFER_POOL
+    auto stats = pool::getStatistics();
+    state.counters["pooled/msg"] = static_cast<double>(stats.poolAllocations + stats.stringReuses) /
+        static_cast<double>(messages);
+#endif
+}
+
+BENCHMARK_CAPTURE(BMqueuePass, pub, &generatePubMessage);
+BENCHMARK_CAPTURE(BMqueuePass, largePub, &generateLargePubMessage);
+BENCHMARK_CAPTURE(BMqueuePass, sendMessage, &generateSendMessage);
+BENCHMARK_CAPTURE(BMqueuePass, largeSendMessage, &generateLargeSendMessage);
+
 HELICS_BENCHMARK_MAIN(actionMessageBenchmark);
@@ -12,6 +12,7 @@ SPDX-License-Identifier: BSD-3-Clause
 #include "helics/core/ActionMessage.hpp"
 
 #include <algorithm>
+#include <chrono>
 #include <random>
 #include <string>
 #include <utility>
@@ -42,6 +43,8 @@ class WattsStrogatzFederate: public BenchmarkFederate {
     std::uniform_int_distribution<unsigned int> rand_available_link;
     std::uniform_int_distribution<unsigned int> rand_transmit_link;
 
+    std::vector<double> grantLatencies;  // the time each time request took to be granted in us
+
   private:
     helics::Endpoint* ept{nullptr};
     std::vector<std::string> links;  // links to other federates
@@ -176,6 +179,17 @@ class WattsStrogatzFederate: public BenchmarkFederate {
         ept = &fed->registerEndpoint("ept");
     }
 
+    void doAddBenchmarkResults() override
+    {
+        if (grantLatencies.empty()) {
+            return;
+        }
+        auto sorted = grantLatencies;
+        std::sort(sorted.begin(), sorted.end());
+        addResult("GRANT LATENCY P50 (us)", "p50_us", sorted[sorted.size() / 2]);
+        addResult("GRANT LATENCY P99 (us)", "p99_us", sorted[sorted.size() * 99 / 100]);
+    }
+
     void doMakeReady() override
     {
         // send initial messages
@@ -191,7 +205,11 @@ class WattsStrogatzFederate: public BenchmarkFederate {
         auto nextTime = helics::timeZero;
 
         while (nextTime < finalTime) {
+            auto start = std::chrono::steady_clock::now();
             nextTime = fed->requestTime(finalTime);
+            grantLatencies.push_back(
+                std::chrono::duration<double, std::micro>(std::chrono::steady_clock::now() - start)
+                    .count());
             while (ept->hasMessage()) {
                 // Pick a random link to pass the message along
                 auto transmit_link = links[rand_transmit_link(rand_gen)];
@@ -0,0 +1,264 @@
+/*
+Copyright (c) 2017-2022,
+Battelle Memorial Institute; Lawrence Livermore National Security, LLC; Alliance for Sustainable
+Energy, LLC.  See the top-level NOTICE for additional details. All rights reserved.
+SPDX-License-Identifier: BSD-3-Clause
+*/
+
+#include "PholdFederate.hpp"
+#include "RingTransmitFederate.hpp"
+#include "helics/application_api/CallbackFederate.hpp"
+#include "helics/application_api/Endpoints.hpp"
+#include "helics/application_api/Inputs.hpp"
+#include "helics/application_api/Publications.hpp"
+#include "helics/core/CoreFactory.hpp"
+#include "helics_benchmark_main.h"
+
+#include <benchmark/benchmark.h>
+#include <gmlc/concurrency/Barrier.hpp>
+#include <memory>
+#include <random>
+#include <string>
+#include <thread>
+#include <vector>
+
+using helics::CoreType;
+
+static const helics::Time agentDeltaTime{10, time_units::ns};
+
+/** a phold agent run from the callback threads of the core, with the same parameters as the
+PholdFederate*/
+class CallbackPhold {
+  public:
+    int evCount{0};
+
+    CallbackPhold(int index, int maxIndex, const std::shared_ptr<helics::Core>& core):
+        index_(index), maxIndex_(maxIndex),
+        fed(std::make_unique<helics::CallbackFederate>("phold_" + std::to_string(index), core)),
+        rand_gen(0xABad5eed + static_cast<unsigned int>(index)),
+        rand_exp(1.0 / (static_cast<double>(agentDeltaTime) * .9))
+    {
+        if (maxIndex_ > 1) {
+            rand_uniform_int = std::uniform_int_distribution<int>(0, maxIndex_ - 2);
+        }
+        ept = &fed->registerEndpoint("ept");
+        fed->setNextTimeCallback([this](helics::Time currentTime) {
+            if (currentTime == helics::timeZero) {
+                for (int ii = 0; ii < 16; ++ii) {
+                    createNewEvent(currentTime);
+                }
+            }
+            while (ept->hasMessage()) {
+                auto m = ept->getMessage();
+                ++evCount;
+                createNewEvent(currentTime);
+            }
+            return (currentTime < finalTime) ? finalTime : helics::Time::maxVal();
+        });
+    }
+    helics::CallbackFederate& federate() { return *fed; }
+
+  private:
+    void createNewEvent(helics::Time currentTime)
+    {
+        auto destIndex = index_;
+        if (maxIndex_ > 1 && rand_uniform_double(rand_gen) > .9) {
+            destIndex = rand_uniform_int(rand_gen);
+            if (destIndex == index_) {
+                destIndex = maxIndex_ - 1;
+            }
+        }
+        helics::Time evTime = currentTime + agentDeltaTime * .1 + helics::Time(rand_exp(rand_gen));
+        ept->sendToAt("ev", "phold_" + std::to_string(destIndex) + "/ept", evTime);
+    }
+
+    int index_{0};
+    int maxIndex_{0};
+    helics::Time finalTime{10000, time_units::ns};
+    std::unique_ptr<helics::CallbackFederate> fed;
+    helics::Endpoint* ept{nullptr};
+    std::mt19937 rand_gen;
+    std::exponential_distribution<double> rand_exp;
+    std::uniform_real_distribution<double> rand_uniform_double{0.0, 1.0};
+    std::uniform_int_distribution<int> rand_uniform_int;
+};
+
+/** a link of the transmission ring run from the callback threads of the core, with the same
+parameters as the RingTransmit federate*/
+class CallbackRingLink {
+  public:
+    int loopCount{0};
+
+    CallbackRingLink(int index, int maxIndex, const std::shared_ptr<helics::Core>& core)
+    {
+        helics::FederateInfo fi;
+        fi.setFlagOption(HELICS_FLAG_RESTRICTIVE_TIME_POLICY);
+        fed = std::make_unique<helics::CallbackFederate>("ringlink_" + std::to_string(index),
+                                                         core,
+                                                         fi);
+        pub = &fed->registerIndexedPublication<std::string>("pub", index);
+        sub = &fed->registerIndexedSubscription("pub", (index == 0) ? maxIndex - 1 : index - 1);
+        fed->setNextTimeCallback([this, index](helics::Time currentTime) {
+            if (currentTime == helics::timeZero && index == 0) {
+                pub->publish(std::string(100, '1'));
+                ++loopCount;
+            }
+            if (fed->isUpdated(*sub)) {
+                pub->publish(sub->getString());
+                ++loopCount;
+            }
+            return (currentTime < finalTime) ? finalTime : helics::Time::maxVal();
+        });
+    }
+    helics::CallbackFederate& federate() { return *fed; }
+
+  private:
+    helics::Time finalTime{5000, time_units::ns};
+    std::unique_ptr<helics::CallbackFederate> fed;
+    helics::Publication* pub{nullptr};
+    helics::Input* sub{nullptr};
+};
+
+/** run all the agents on the callback threads of a single core*/
+template<class Agent>
+static std::vector<std::unique_ptr<Agent>> runCallbackAgents(benchmark::State& state,
+                                                             int fed_count)
+{
+    auto wcore = helics::CoreFactory::create(CoreType::INPROC,
+                                             std::string("--autobroker --federates=") +
+                                                 std::to_string(fed_count));
+    std::vector<std::unique_ptr<Agent>> agents;
+    agents.reserve(fed_count);
+    for (int ii = 0; ii < fed_count; ++ii) {
+        agents.push_back(std::make_unique<Agent>(ii, fed_count, wcore));
+    }
+    state.ResumeTiming();
+    for (auto& agent : agents) {
+        agent->federate().startOperations();
+    }
+    for (auto& agent : agents) {
+        agent->federate().waitForCompletion();
+    }
+    state.PauseTiming();
+    wcore->waitForDisconnect();
+    return agents;
+}
+
+/** run all the federates on a single core with a thread for each federate*/
+template<class BenchFed>
+static std::vector<BenchFed> runThreadedFederates(benchmark::State& state, int fed_count)
+{
+    gmlc::concurrency::Barrier brr(static_cast<size_t>(fed_count));
+    auto wcore = helics::CoreFactory::create(CoreType::INPROC,
+                                             std::string("--autobroker --federates=") +
+                                                 std::to_string(fed_count));
+    std::vector<BenchFed> feds(fed_count);
+    for (int ii = 0; ii < fed_count; ++ii) {
+        std::string bmInit =
+            "--index=" + std::to_string(ii) + " --max_index=" + std::to_string(fed_count);
+        feds[ii].initialize(wcore->getIdentifier(), bmInit);
+    }
+
+    std::vector<std::thread> threadlist(static_cast<size_t>(fed_count - 1));
+    for (int ii = 0; ii < fed_count - 1; ++ii) {
+        threadlist[ii] = std::thread([&](BenchFed& f) { f.run([&brr]() { brr.wait(); }); },
+                                     std::ref(feds[ii + 1]));
+    }
+    feds[0].makeReady();
+    brr.wait();
+    state.ResumeTiming();
+    feds[0].run();
+    state.PauseTiming();
+    for (auto& thrd : threadlist) {
+        thrd.join();
+    }
+    wcore.reset();
+    return feds;
+}
+
+static void BMphold_callback(benchmark::State& state)
+{
+    for (auto _ : state) {
+        state.PauseTiming();
+        auto agents = runCallbackAgents<CallbackPhold>(state, static_cast<int>(state.range(0)));
+        int totalEvCount = 0;
+        for (auto& agent : agents) {
+            totalEvCount += agent->evCount;
+        }
+        state.counters["EvCount"] = totalEvCount;
+        agents.clear();
+        helics::cleanupHelicsLibrary();
+        state.ResumeTiming();
+    }
+}
+
+static void BMphold_threaded(benchmark::State& state)
+{
+    for (auto _ : state) {
+        state.PauseTiming();
+        auto feds = runThreadedFederates<PholdFederate>(state, static_cast<int>(state.range(0)));
+        int totalEvCount = 0;
+        for (auto& fed : feds) {
+            totalEvCount += fed.evCount;
+        }
+        state.counters["EvCount"] = totalEvCount;
+        feds.clear();
+        helics::cleanupHelicsLibrary();
+        state.ResumeTiming();
+    }
+}
+
+static void BMring_callback(benchmark::State& state)
+{
+    for (auto _ : state) {
+        state.PauseTiming();
+        auto agents = runCallbackAgents<CallbackRingLink>(state, static_cast<int>(state.range(0)));
+        state.counters["LoopCount"] = agents[0]->loopCount;
+        agents.clear();
+        helics::cleanupHelicsLibrary();
+        state.ResumeTiming();
+    }
+}
+
+static void BMring_threaded(benchmark::State& state)
+{
+    for (auto _ : state) {
+        state.PauseTiming();
+        auto feds = runThreadedFederates<RingTransmit>(state, static_cast<int>(state.range(0)));
+        state.counters["LoopCount"] = feds[0].loopCount;
+        feds.clear();
+        helics::cleanupHelicsLibrary();
+        state.ResumeTiming();
+    }
+}
+
+// the callback federates share the callback threads of the core so can scale past the thread count
+BENCHMARK(BMphold_callback)
+    ->RangeMultiplier(4)
+    ->Range(16, 4096)
+    ->Iterations(1)
+    ->Unit(benchmark::TimeUnit::kMillisecond)
+    ->UseRealTime();
+
+BENCHMARK(BMphold_threaded)
+    ->RangeMultiplier(4)
+    ->Range(16, 1024)
+    ->Iterations(1)
+    ->Unit(benchmark::TimeUnit::kMillisecond)
+    ->UseRealTime();
+
+BENCHMARK(BMring_callback)
+    ->RangeMultiplier(4)
+    ->Range(16, 4096)
+    ->Iterations(1)
+    ->Unit(benchmark::TimeUnit::kMillisecond)
+    ->UseRealTime();
+
+BENCHMARK(BMring_threaded)
+    ->RangeMultiplier(4)
+    ->Range(16, 1024)
+    ->Iterations(1)
+    ->Unit(benchmark::TimeUnit::kMillisecond)
+    ->UseRealTime();
+
+HELICS_BENCHMARK_MAIN(callbackFederateBenchmark);
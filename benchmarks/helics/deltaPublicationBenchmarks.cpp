@@ -0,0 +1,150 @@
+/*
+Copyright (c) 2017-2022,
+Battelle Memorial Institute; Lawrence Livermore National Security, LLC; Alliance for Sustainable
+Energy, LLC.  See the top-level NOTICE for additional details. All rights reserved.
+SPDX-License-Identifier: BSD-3-Clause
+*/
+
+#include "helics/application_api/Inputs.hpp"
+#include "helics/application_api/Publications.hpp"
+#include "helics/application_api/ValueFederate.hpp"
+#include "helics/application_api/helicsTypes.hpp"
+#include "helics/core/ActionMessage.hpp"
+#include "helics/core/CoreFactory.hpp"
+#include "helics/core/DeltaEncoding.hpp"
+#include "helics/core/PublicationInfo.hpp"
+#include "helics_benchmark_main.h"
+
+#include <benchmark/benchmark.h>
+#include <chrono>
+#include <future>
+#include <memory>
+#include <string>
+#include <vector>
+
+using helics::CoreType;
+
+/// the number of elements in the published vectors
+static constexpr std::size_t vectorSize{10000};
+
+/** change a spread out set of elements of a vector for a time step*/
+static void updateVector(std::vector<double>& vals, int step, int changes)
+{
+    auto stride = vals.size() / static_cast<std::size_t>(changes);
+    for (int ii = 0; ii < changes; ++ii) {
+        auto index = (static_cast<std::size_t>(ii) * stride + static_cast<std::size_t>(step)) %
+            vals.size();
+        vals[index] += 1.0;
+    }
+}
+
+/** encode and rebuild a vector value the way the publishing and receiving federates do
+@param delta use the delta encoding
+@param changes the number of elements changed each step
+*/
+static void BMdeltaEncoding(benchmark::State& state, bool delta, int changes)
+{
+    helics::GlobalHandle source(helics::GlobalFederateId(131072), helics::InterfaceHandle(0));
+    helics::PublicationInfo pub(source, "pub", "double_vector", "");
+    pub.addSubscriber(helics::GlobalHandle(helics::GlobalFederateId(131073),
+                                           helics::InterfaceHandle(0)));
+    pub.setDeltaEncoding(delta);
+    helics::DeltaDecoder decoder;
+    std::vector<double> vals(vectorSize, 1.0);
+    std::size_t bytesSent{0};
+    int step{0};
+    for (auto _ : state) {
+        updateVector(vals, ++step, changes);
+        auto value = helics::typeConvert(helics::DataType::HELICS_VECTOR, vals);
+        helics::ActionMessage mv(helics::CMD_PUB);
+        mv.setSource(source);
+        if (!delta) {
+            mv.payload = value;
+        } else {
+            pub.encodeDelta(value.to_string(), mv);
+        }
+        bytesSent += mv.payload.size();
+        decoder.decode(mv);
+        benchmark::DoNotOptimize(mv.payload.data());
+    }
+    state.counters["bytes/step"] =
+        static_cast<double>(bytesSent) / static_cast<double>(state.iterations());
+}
+
+BENCHMARK_CAPTURE(BMdeltaEncoding, full_100, false, 100);
+BENCHMARK_CAPTURE(BMdeltaEncoding, delta_100, true, 100);
+BENCHMARK_CAPTURE(BMdeltaEncoding, full_500, false, 500);
+BENCHMARK_CAPTURE(BMdeltaEncoding, delta_500, true, 500);
+BENCHMARK_CAPTURE(BMdeltaEncoding, full_5000, false, 5000);
+BENCHMARK_CAPTURE(BMdeltaEncoding, delta_5000, true, 5000);
+
+/** publish a vector from one federate to another over an inproc core
+@param delta use the delta encoding
+@param changes the number of elements changed each step
+*/
+static void BMdeltaPublication(benchmark::State& state, bool delta, int changes)
+{
+    static constexpr int steps{200};
+    std::chrono::nanoseconds cpuTime{0};
+    for (auto _ : state) {
+        state.PauseTiming();
+        auto wcore = helics::CoreFactory::create(CoreType::INPROC, "--autobroker --federates=2");
+        helics::FederateInfo fi;
+        fi.coreName = wcore->getIdentifier();
+        fi.setProperty(HELICS_PROPERTY_TIME_PERIOD, 1.0);
+        auto pubFed = std::make_unique<helics::ValueFederate>("delta_pub_fed", fi);
+        auto subFed = std::make_unique<helics::ValueFederate>("delta_sub_fed", fi);
+        auto& pub = pubFed->registerGlobalPublication<std::vector<double>>("delta_pub");
+        if (delta) {
+            pub.setOption(HELICS_HANDLE_OPTION_DELTA_ENCODING);
+        }
+        auto& input = subFed->registerSubscription("delta_pub");
+        state.ResumeTiming();
+        auto receiver = std::async(std::launch::async, [&subFed, &input]() {
+            subFed->enterExecutingMode();
+            for (int step = 1; step <= steps; ++step) {
+                subFed->requestTime(step);
+                benchmark::DoNotOptimize(input.getValueRef<std::vector<double>>().data());
+            }
+            subFed->finalize();
+        });
+        pubFed->enterExecutingMode();
+        std::vector<double> vals(vectorSize, 1.0);
+        for (int step = 1; step <= steps; ++step) {
+            updateVector(vals, step, changes);
+            auto start = std::chrono::steady_clock::now();
+            pub.publish(vals);
+            cpuTime += std::chrono::steady_clock::now() - start;
+            pubFed->requestTime(step);
+        }
+        pubFed->finalize();
+        receiver.get();
+        state.PauseTiming();
+        pubFed.reset();
+        subFed.reset();
+        wcore.reset();
+        helics::cleanupHelicsLibrary();
+        state.ResumeTiming();
+    }
+    state.counters["publish_us/step"] = static_cast<double>(cpuTime.count()) / 1000.0 /
+        static_cast<double>(state.iterations() * steps);
+}
+
+BENCHMARK_CAPTURE(BMdeltaPublication, full_100, false, 100)
+    ->Unit(benchmark::TimeUnit::kMillisecond)
+    ->Iterations(1)
+    ->UseRealTime();
+BENCHMARK_CAPTURE(BMdeltaPublication, delta_100, true, 100)
+    ->Unit(benchmark::TimeUnit::kMillisecond)
+    ->Iterations(1)
+    ->UseRealTime();
+BENCHMARK_CAPTURE(BMdeltaPublication, full_5000, false, 5000)
+    ->Unit(benchmark::TimeUnit::kMillisecond)
+    ->Iterations(1)
+    ->UseRealTime();
+BENCHMARK_CAPTURE(BMdeltaPublication, delta_5000, true, 5000)
+    ->Unit(benchmark::TimeUnit::kMillisecond)
+    ->Iterations(1)
+    ->UseRealTime();
+
+HELICS_BENCHMARK_MAIN(deltaPublicationBenchmark);
@@ -21,16 +21,18 @@ SPDX-License-Identifier: BSD-3-Clause
 
 using helics::CoreType;
 
-static void BMecho_singleCore(benchmark::State& state)
+// run all the federates on a single core with the given number of processing shards
+static void BMecho_singleCoreShards(benchmark::State& state, int shards)
 {
     for (auto _ : state) {
         state.PauseTiming();
 
         int feds = static_cast<int>(state.range(0));
         gmlc::concurrency::Barrier brr(static_cast<size_t>(feds) + 1);
-        auto wcore = helics::CoreFactory::create(CoreType::INPROC,
-                                                 std::string("--autobroker --federates=") +
-                                                     std::to_string(feds + 1));
+        auto wcore = helics::CoreFactory::create(
+            CoreType::INPROC,
+            std::string("--autobroker --federates=") + std::to_string(feds + 1) +
+                " --processing_shards=" + std::to_string(shards));
         EchoHub hub;
         hub.initialize(wcore->getIdentifier(), "--num_leafs=" + std::to_string(feds));
         std::vector<EchoLeaf> leafs(feds);
@@ -57,6 +59,11 @@ static void BMecho_singleCore(benchmark::State& state)
         state.ResumeTiming();
     }
 }
+
+static void BMecho_singleCore(benchmark::State& state)
+{
+    BMecho_singleCoreShards(state, 0);
+}
 // Register the function as a benchmark
 BENCHMARK(BMecho_singleCore)
     ->RangeMultiplier(2)
@@ -65,6 +72,14 @@ BENCHMARK(BMecho_singleCore)
     ->Iterations(1)
     ->UseRealTime();
 
+// the same with the federate commands routed by worker threads in the core
+BENCHMARK_CAPTURE(BMecho_singleCoreShards, processingShards4, 4)
+    ->RangeMultiplier(2)
+    ->Range(1, 1U << 8)
+    ->Unit(benchmark::TimeUnit::kMillisecond)
+    ->Iterations(1)
+    ->UseRealTime();
+
 static void BMecho_multiCore(benchmark::State& state, CoreType cType)
 {
     for (auto _ : state) {
@@ -151,6 +166,16 @@ BENCHMARK_CAPTURE(BMecho_multiCore, ipcCore, CoreType::IPC)
     ->Unit(benchmark::TimeUnit::kMillisecond)
     ->UseRealTime();
 
+#endif
+#ifdef HELICS_ENABLE_SHM_CORE
+// Register the shared memory ring benchmarks
+BENCHMARK_CAPTURE(BMecho_multiCore, shmCore, CoreType::SHM)
+    ->RangeMultiplier(2)
+    ->Range(1, maxscale)
+    ->Iterations(1)
+    ->Unit(benchmark::TimeUnit::kMillisecond)
+    ->UseRealTime();
+
 #endif
 
 #ifdef HELICS_ENABLE_TCP_CORE
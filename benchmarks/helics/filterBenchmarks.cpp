@@ -7,7 +7,9 @@ SPDX-License-Identifier: BSD-3-Clause
 
 #include "EchoMessageHubFederate.hpp"
 #include "EchoMessageLeafFederate.hpp"
+#include "helics/application_api/Endpoints.hpp"
 #include "helics/application_api/Filters.hpp"
+#include "helics/application_api/MessageFederate.hpp"
 #include "helics/core/BrokerFactory.hpp"
 #include "helics/core/CoreFactory.hpp"
 #include "helics/helics-config.h"
@@ -18,7 +20,10 @@ SPDX-License-Identifier: BSD-3-Clause
 #include <fstream>
 #include <gmlc/concurrency/Barrier.hpp>
 #include <iostream>
+#include <memory>
+#include <string>
 #include <thread>
+#include <vector>
 
 // static constexpr helics::Time tend = 3600.0_t;  // simulation end time
 
@@ -140,6 +145,94 @@ static void BMfilter_multiCore(benchmark::State& state, CoreType cType)
     }
 }
 
+/** send bursts of messages through network emulation filters running on the filter workers of a
+core
+@details each sender endpoint has a random delay and a random drop filter, the range is the number
+of filter workers with 0 running the filters on the core thread*/
+static void BMfilter_workers(benchmark::State& state)
+{
+    static constexpr int senders{8};
+    static constexpr int steps{10};
+    static constexpr int messagesPerStep{2000};
+    std::size_t received{0};
+    for (auto _ : state) {
+        state.PauseTiming();
+        auto wcore = helics::CoreFactory::create(
+            CoreType::INPROC,
+            std::string("--autobroker --federates=") + std::to_string(senders + 1) +
+                " --filter_workers=" + std::to_string(state.range(0)));
+        helics::FederateInfo fi;
+        fi.coreName = wcore->getIdentifier();
+        fi.setProperty(HELICS_PROPERTY_TIME_PERIOD, 1.0);
+        auto recFed = std::make_unique<helics::MessageFederate>("receiver", fi);
+        auto& sink = recFed->registerGlobalEndpoint("sink");
+        std::vector<std::unique_ptr<helics::MessageFederate>> sendFeds;
+        std::vector<std::unique_ptr<helics::Filter>> filters;
+        for (int ii = 0; ii < senders; ++ii) {
+            auto name = std::string("source") + std::to_string(ii);
+            sendFeds.push_back(
+                std::make_unique<helics::MessageFederate>("sender" + std::to_string(ii), fi));
+            sendFeds.back()->registerGlobalEndpoint(name).setDefaultDestination("sink");
+            auto delay = make_filter(helics::FilterTypes::RANDOM_DELAY, wcore.get());
+            delay->setString("distribution", "uniform");
+            delay->set("max", 0.5);
+            delay->addSourceTarget(name);
+            filters.push_back(std::move(delay));
+            auto drop = make_filter(helics::FilterTypes::RANDOM_DROP, wcore.get());
+            drop->set("prob", 0.05);
+            drop->addSourceTarget(name);
+            filters.push_back(std::move(drop));
+        }
+        std::vector<std::thread> threadlist;
+        for (auto& fed : sendFeds) {
+            threadlist.emplace_back([&fed]() {
+                auto& ept = fed->getEndpoint(0);
+                fed->enterExecutingMode();
+                for (int step = 1; step <= steps; ++step) {
+                    for (int ii = 0; ii < messagesPerStep; ++ii) {
+                        ept.send("network emulation message");
+                    }
+                    fed->requestTime(step);
+                }
+                fed->finalize();
+            });
+        }
+        state.ResumeTiming();
+        recFed->enterExecutingMode();
+        for (int step = 1; step <= steps + 1; ++step) {
+            recFed->requestTime(step);
+            while (sink.hasMessage()) {
+                auto message = sink.getMessage();
+                benchmark::DoNotOptimize(message);
+                ++received;
+            }
+        }
+        recFed->finalize();
+        for (auto& thrd : threadlist) {
+            thrd.join();
+        }
+        state.PauseTiming();
+        recFed.reset();
+        sendFeds.clear();
+        wcore.reset();
+        filters.clear();
+        helics::cleanupHelicsLibrary();
+        state.ResumeTiming();
+    }
+    state.counters["messages/run"] = static_cast<double>(senders * steps * messagesPerStep);
+    state.counters["delivered/s"] =
+        benchmark::Counter(static_cast<double>(received), benchmark::Counter::kIsRate);
+}
+// Register the filter worker benchmarks
+BENCHMARK(BMfilter_workers)
+    ->Arg(0)
+    ->Arg(1)
+    ->Arg(4)
+    ->Arg(16)
+    ->Unit(benchmark::TimeUnit::kMillisecond)
+    ->Iterations(1)
+    ->UseRealTime();
+
 static constexpr int64_t maxscale{1 << (5 + HELICS_BENCHMARK_SHIFT_FACTOR)};
 // Register the inproc core benchmarks
 BENCHMARK_CAPTURE(BMfilter_multiCore, inprocCore, CoreType::INPROC)
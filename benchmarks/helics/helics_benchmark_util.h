@@ -16,6 +16,10 @@ SPDX-License-Identifier: BSD-3-Clause
 #    include "helics/network/zmq/ZmqCommsCommon.h"
 #endif
 
+#ifndef USING_HELICS_C_SHARED_LIB
+#    include "helics/common/JsonProcessingFunctions.hpp"
+#endif
+
 #if defined(_WIN32) || defined(WIN32)
 #    include <intrin.h>
 // code modified from https://weseetips.wordpress.com/tag/c-get-cpu-name/
@@ -116,3 +120,21 @@ inline void printHELICSsystemInfo()
     std::cout << "NUM CPU:" << std::thread::hardware_concurrency() << '\n';
     std::cout << "-------------------------------------------" << std::endl;
 }
+
+#ifndef USING_HELICS_C_SHARED_LIB
+/** totals of the timing messages handled by the cores and brokers in a benchmark*/
+struct TimingMessageCounts {
+    double timingMessages{0.0};  //!< the number of time and exec requests examined
+    double coalesced{0.0};  //!< the number of requests collapsed into a later request
+
+    /** add the counts from the result of a "timing_coalescing" query*/
+    void add(const std::string& queryResult)
+    {
+        auto json = helics::fileops::loadJsonStr(queryResult);
+        if (json.isMember("timing_messages")) {
+            timingMessages += json["timing_messages"].asDouble();
+            coalesced += json["coalesced"].asDouble();
+        }
+    }
+};
+#endif
@@ -0,0 +1,121 @@
+/*
+Copyright (c) 2017-2022,
+Battelle Memorial Institute; Lawrence Livermore National Security, LLC; Alliance for Sustainable
+Energy, LLC.  See the top-level NOTICE for additional details. All rights reserved.
+SPDX-License-Identifier: BSD-3-Clause
+*/
+
+#include "helics/core/InputInfo.hpp"
+#include "helics_benchmark_main.h"
+
+#include <atomic>
+#include <chrono>
+#include <cstdlib>
+#include <memory>
+#include <new>
+#include <string>
+#include <vector>
+
+using namespace helics;  // NOLINT
+
+// allocation counts for values passing through the storage of an input
+static std::atomic<std::size_t> allocationCount{0};
+
+void* operator new(std::size_t size)
+{
+    ++allocationCount;
+    if (void* ptr = std::malloc(size == 0 ? 1 : size)) {
+        return ptr;
+    }
+    throw std::bad_alloc();
+}
+
+void operator delete(void* ptr) noexcept
+{
+    std::free(ptr);
+}
+
+void operator delete(void* ptr, std::size_t /*size*/) noexcept
+{
+    std::free(ptr);
+}
+
+/// the number of sources connected to the input
+static constexpr int sourceCount{4};
+
+/** deliver values from several sources to an input the way the federate state does and update
+the input each time step
+@param ringStorage use the ring storage for the input
+@param valueSize the size of the values in bytes
+@param holdValues keep a reference to the current values between steps like the application api
+*/
+static void BMinputStorage(benchmark::State& state,
+                           bool ringStorage,
+                           std::size_t valueSize,
+                           bool holdValues)
+{
+    InputInfo input(GlobalHandle(GlobalFederateId(131072), InterfaceHandle(1)), "input", "", "");
+    input.ring_storage = ringStorage;
+    std::vector<GlobalHandle> sources;
+    for (int ii = 0; ii < sourceCount; ++ii) {
+        sources.emplace_back(GlobalFederateId(131073 + ii), InterfaceHandle(ii));
+        input.addSource(sources.back(), "pub" + std::to_string(ii), "", "");
+    }
+    std::vector<std::shared_ptr<const SmallBuffer>> held(sourceCount);
+    SmallBuffer payload(std::string(valueSize, 'a'));
+    Time currentTime = timeZero;
+    std::size_t updates{0};
+    std::chrono::nanoseconds updateTime{0};
+
+    auto step = [&]() {
+        currentTime += 1.0;
+        for (const auto& source : sources) {
+            // values arrive in the payload of a message that is consumed when it is delivered
+            SmallBuffer message(payload);
+            if (ringStorage) {
+                input.addData(source, currentTime, 0, message);
+            } else {
+                input.addData(source,
+                              currentTime,
+                              0,
+                              std::make_shared<const SmallBuffer>(std::move(message)));
+            }
+        }
+        auto start = std::chrono::steady_clock::now();
+        input.updateTimeInclusive(currentTime);
+        updateTime += std::chrono::steady_clock::now() - start;
+        for (int ii = 0; ii < sourceCount; ++ii) {
+            if (holdValues) {
+                held[ii] = input.getData(ii);
+            }
+            benchmark::DoNotOptimize(input.getData(ii)->data());
+        }
+    };
+    // warm up the storage
+    for (int ii = 0; ii < 10; ++ii) {
+        step();
+    }
+    updateTime = std::chrono::nanoseconds{0};
+    auto startCount = allocationCount.load();
+    for (auto _ : state) {
+        step();
+        updates += sourceCount;
+    }
+    auto allocations = allocationCount.load() - startCount;
+    state.counters["allocs/update"] =
+        static_cast<double>(allocations) / static_cast<double>(updates);
+    state.counters["ns/updateTimeInclusive"] = static_cast<double>(updateTime.count()) /
+        static_cast<double>(state.iterations());
+    state.SetItemsProcessed(static_cast<int64_t>(updates));
+}
+
+BENCHMARK_CAPTURE(BMinputStorage, shared_small, false, 8, false);
+BENCHMARK_CAPTURE(BMinputStorage, ring_small, true, 8, false);
+BENCHMARK_CAPTURE(BMinputStorage, shared_small_held, false, 8, true);
+BENCHMARK_CAPTURE(BMinputStorage, ring_small_held, true, 8, true);
+BENCHMARK_CAPTURE(BMinputStorage, shared_large, false, 400, false);
+BENCHMARK_CAPTURE(BMinputStorage, ring_large, true, 400, false);
+BENCHMARK_CAPTURE(BMinputStorage, shared_large_held, false, 400, true);
+BENCHMARK_CAPTURE(BMinputStorage, ring_large_held, true, 400, true);
+
+HELICS_BENCHMARK_MAIN(inputStorageBenchmark);
@@ -0,0 +1,201 @@
+/*
+Copyright (c) 2017-2022,
+Battelle Memorial Institute; Lawrence Livermore National Security, LLC; Alliance for Sustainable
+Energy, LLC.  See the top-level NOTICE for additional details. All rights reserved.
+SPDX-License-Identifier: BSD-3-Clause
+*/
+
+#include "helics/application_api/Endpoints.hpp"
+#include "helics/application_api/MessageFederate.hpp"
+#include "helics/core/BrokerFactory.hpp"
+#include "helics/core/CoreFactory.hpp"
+#include "helics/core/EndpointInfo.hpp"
+#include "helics_benchmark_main.h"
+
+#include <algorithm>
+#include <benchmark/benchmark.h>
+#include <deque>
+#include <memory>
+#include <string>
+#include <thread>
+#include <vector>
+
+using namespace helics;  // NOLINT
+
+/// the number of sources sending messages to the collector
+static constexpr int sourceCount{8};
+
+/** generate a burst of messages for a single time from interleaved sources, the sources are
+cycled in reverse order so the messages do not arrive in the order they are delivered*/
+static std::vector<std::unique_ptr<Message>> makeBurst(int messageCount, Time time)
+{
+    std::vector<std::unique_ptr<Message>> burst;
+    burst.reserve(messageCount);
+    for (int ii = 0; ii < messageCount; ++ii) {
+        auto message = std::make_unique<Message>();
+        message->time = time;
+        message->original_source = "source" + std::to_string(sourceCount - 1 - ii % sourceCount);
+        message->source = message->original_source;
+        message->dest = "collector";
+        message->data = std::string(8, 'a');
+        burst.push_back(std::move(message));
+    }
+    return burst;
+}
+
+// deliver a burst of messages to an endpoint and drain it the way the federate state does
+static void BMendpointBurst(benchmark::State& state)
+{
+    const int messageCount = static_cast<int>(state.range(0));
+    EndpointInfo endpoint(GlobalHandle(GlobalFederateId(131072), InterfaceHandle(1)),
+                          "collector",
+                          "");
+    Time currentTime = timeZero;
+    for (auto _ : state) {
+        state.PauseTiming();
+        currentTime += 1.0;
+        auto burst = makeBurst(messageCount, currentTime);
+        state.ResumeTiming();
+        for (auto& message : burst) {
+            endpoint.addMessage(std::move(message));
+        }
+        endpoint.updateTimeInclusive(currentTime);
+        benchmark::DoNotOptimize(endpoint.queueSize(currentTime));
+        while (auto message = endpoint.getMessage(currentTime)) {
+            benchmark::DoNotOptimize(message);
+        }
+    }
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations()) * messageCount);
+}
+
+/** the former endpoint storage, sorting a deque after every message, as a reference for the
+endpoint burst*/
+static void BMsortedDequeBurst(benchmark::State& state)
+{
+    const int messageCount = static_cast<int>(state.range(0));
+    auto msgSorter = [](const auto& m1, const auto& m2) {
+        return (m1->time != m2->time) ? (m1->time < m2->time) :
+                                        (m1->original_source < m2->original_source);
+    };
+    std::deque<std::unique_ptr<Message>> queue;
+    Time currentTime = timeZero;
+    for (auto _ : state) {
+        state.PauseTiming();
+        currentTime += 1.0;
+        auto burst = makeBurst(messageCount, currentTime);
+        state.ResumeTiming();
+        for (auto& message : burst) {
+            queue.push_back(std::move(message));
+            std::stable_sort(queue.begin(), queue.end(), msgSorter);
+        }
+        while (!queue.empty()) {
+            auto message = std::move(queue.front());
+            queue.pop_front();
+            benchmark::DoNotOptimize(message);
+        }
+    }
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations()) * messageCount);
+}
+
+BENCHMARK(BMendpointBurst)->RangeMultiplier(10)->Range(1000, 100000);
+// the sorted deque takes minutes for a burst of 100000 messages
+BENCHMARK(BMsortedDequeBurst)->RangeMultiplier(10)->Range(1000, 10000);
+
+/** federates send a burst of messages in a single time step to a collector which drains its
+endpoint one message at a time or in blocks with getMessages
+@param blockSize the maximum number of messages retrieved at once, 0 to use getMessage*/
+static void BMcollectorBurst(benchmark::State& state, std::size_t blockSize)
+{
+    for (auto _ : state) {
+        state.PauseTiming();
+        const int messageCount = static_cast<int>(state.range(0));
+        const int step_count = 5;
+        auto broker = BrokerFactory::create(CoreType::INPROC,
+                                            "brokerburst",
+                                            "--federates=" + std::to_string(sourceCount + 1));
+        broker->setLoggingLevel(HELICS_LOG_LEVEL_NO_PRINT);
+        auto core = CoreFactory::create(CoreType::INPROC,
+                                        "--log_level=no_print --federates=" +
+                                            std::to_string(sourceCount + 1));
+
+        FederateInfo fi;
+        fi.setProperty(HELICS_PROPERTY_TIME_PERIOD, 1.0);
+        fi.coreName = core->getIdentifier();
+        MessageFederate collector("collector", fi);
+        auto& collectorEndpoint = collector.registerGlobalEndpoint("collector");
+        std::vector<std::unique_ptr<MessageFederate>> senders;
+        for (int ii = 0; ii < sourceCount; ++ii) {
+            senders.push_back(std::make_unique<MessageFederate>("sender" + std::to_string(ii), fi));
+            senders.back()->registerEndpoint("source");
+        }
+
+        std::vector<std::thread> threads;
+        for (auto& sender : senders) {
+            threads.emplace_back(
+                [&fed = *sender, messageCount, step_count]() {
+                    auto& source = fed.getEndpoint(0);
+                    const std::string data(8, 'a');
+                    fed.enterExecutingMode();
+                    for (int ii = 0; ii < step_count; ++ii) {
+                        for (int jj = 0; jj < messageCount / sourceCount; ++jj) {
+                            source.sendTo(data, "collector");
+                        }
+                        fed.requestNextStep();
+                    }
+                    fed.finalize();
+                });
+        }
+        collector.enterExecutingMode();
+        state.ResumeTiming();
+        std::size_t received{0};
+        for (int ii = 0; ii <= step_count; ++ii) {
+            collector.requestNextStep();
+            if (blockSize == 0) {
+                while (collectorEndpoint.hasMessage()) {
+                    auto message = collectorEndpoint.getMessage();
+                    benchmark::DoNotOptimize(message);
+                    ++received;
+                }
+            } else {
+                while (collectorEndpoint.hasMessage()) {
+                    auto messages = collectorEndpoint.getMessages(blockSize);
+                    benchmark::DoNotOptimize(messages);
+                    received += messages.size();
+                }
+            }
+        }
+        collector.finalize();
+        for (auto& thread : threads) {
+            thread.join();
+        }
+        state.PauseTiming();
+        broker->waitForDisconnect();
+        broker.reset();
+        senders.clear();
+        core.reset();
+        cleanupHelicsLibrary();
+        state.SetItemsProcessed(static_cast<int64_t>(received));
+        state.ResumeTiming();
+    }
+}
+
+// the argument is the number of messages the collector receives per time step
+// clang-format off
+BENCHMARK_CAPTURE(BMcollectorBurst, getMessage, 0)
+    // clang-format on
+    ->RangeMultiplier(10)
+    ->Range(1000, 100000)
+    ->Iterations(1)
+    ->Unit(benchmark::TimeUnit::kMillisecond)
+    ->UseRealTime();
+
+// clang-format off
+BENCHMARK_CAPTURE(BMcollectorBurst, getMessages, 1024)
+    // clang-format on
+    ->RangeMultiplier(10)
+    ->Range(1000, 100000)
+    ->Iterations(1)
+    ->Unit(benchmark::TimeUnit::kMillisecond)
+    ->UseRealTime();
+
+HELICS_BENCHMARK_MAIN(messageBurstBenchmark);
@@ -6,6 +6,8 @@ SPDX-License-Identifier: BSD-3-Clause
 */
 
 #include "MessageExchangeFederate.hpp"
+#include "helics/application_api/Endpoints.hpp"
+#include "helics/application_api/MessageFederate.hpp"
 #include "helics/core/BrokerFactory.hpp"
 #include "helics/core/CoreFactory.hpp"
 #include "helics/helics-config.h"
@@ -218,4 +220,85 @@ BENCHMARK_CAPTURE(BMsendMessage, multiCore/udpCore, CoreType::UDP)
     ->UseRealTime();
 #endif
 
+// repeatedly send messages by name to a set of endpoints on a different core, after the first
+// message to each endpoint the sending core knows its location and routes directly to it
+static void BMsendNamedMessage(benchmark::State& state, CoreType cType)
+{
+    for (auto _ : state) {
+        state.PauseTiming();
+        const int endpoint_count = static_cast<int>(state.range(0));
+        const int step_count = 20;
+        auto broker = helics::BrokerFactory::create(cType, "brokern", "--federates=2");
+        broker->setLoggingLevel(HELICS_LOG_LEVEL_NO_PRINT);
+        auto score = helics::CoreFactory::create(cType, "-f 1 --log_level=no_print");
+        auto rcore = helics::CoreFactory::create(cType, "-f 1 --log_level=no_print");
+
+        helics::FederateInfo fi;
+        fi.setProperty(HELICS_PROPERTY_TIME_PERIOD, 1.0);
+        fi.coreName = score->getIdentifier();
+        helics::MessageFederate sender("sender", fi);
+        fi.coreName = rcore->getIdentifier();
+        helics::MessageFederate receiver("receiver", fi);
+        auto& source = sender.registerEndpoint("source");
+        std::vector<std::string> names;
+        names.reserve(endpoint_count);
+        for (int ii = 0; ii < endpoint_count; ++ii) {
+            names.push_back("dest_" + std::to_string(ii));
+            receiver.registerGlobalEndpoint(names.back());
+        }
+
+        auto rthread = std::thread([&receiver, step_count]() {
+            receiver.enterExecutingMode();
+            for (int ii = 0; ii < step_count; ++ii) {
+                receiver.requestNextStep();
+                while (receiver.hasMessage()) {
+                    auto message = receiver.getMessage();
+                    benchmark::DoNotOptimize(message);
+                }
+            }
+            receiver.finalize();
+        });
+        sender.enterExecutingMode();
+        const std::string data(8, 'a');
+        state.ResumeTiming();
+        for (int ii = 0; ii < step_count; ++ii) {
+            for (const auto& name : names) {
+                source.sendTo(data, name);
+            }
+            sender.requestNextStep();
+        }
+        sender.finalize();
+        rthread.join();
+        state.PauseTiming();
+        broker->waitForDisconnect();
+        broker.reset();
+        score.reset();
+        rcore.reset();
+        helics::cleanupHelicsLibrary();
+        state.SetItemsProcessed(static_cast<int64_t>(endpoint_count) * step_count);
+        state.ResumeTiming();
+    }
+}
+
+// the argument is the number of named destination endpoints
+// clang-format off
+BENCHMARK_CAPTURE(BMsendNamedMessage, multiCore/inprocCore, CoreType::INPROC)
+    // clang-format on
+    ->RangeMultiplier(4)
+    ->Range(16, 1024)
+    ->Iterations(1)
+    ->Unit(benchmark::TimeUnit::kMillisecond)
+    ->UseRealTime();
+
+#ifdef HELICS_ENABLE_ZMQ_CORE
+// clang-format off
+BENCHMARK_CAPTURE(BMsendNamedMessage, multiCore/zmqCore, CoreType::ZMQ)
+    // clang-format on
+    ->RangeMultiplier(4)
+    ->Range(16, 1024)
+    ->Iterations(1)
+    ->Unit(benchmark::TimeUnit::kMillisecond)
+    ->UseRealTime();
+#endif
+
 HELICS_BENCHMARK_MAIN(messageSendBenchmark);
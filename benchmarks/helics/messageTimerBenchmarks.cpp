@@ -0,0 +1,191 @@
+/*
+Copyright (c) 2017-2022,
+Battelle Memorial Institute; Lawrence Livermore National Security, LLC; Alliance for Sustainable
+Energy, LLC.  See the top-level NOTICE for additional details. All rights reserved.
+SPDX-License-Identifier: BSD-3-Clause
+*/
+
+#include "helics/core/ActionMessage.hpp"
+#include "helics/core/MessageTimer.hpp"
+#include "helics_benchmark_main.h"
+
+#include <atomic>
+#include <benchmark/benchmark.h>
+#include <chrono>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <random>
+#include <thread>
+#include <utility>
+#include <vector>
+
+using namespace helics;  // NOLINT
+using namespace std::literals::chrono_literals;
+
+/// the number of active timers in each benchmark
+static constexpr int activeTimers{10000};
+
+/** the message timer as it was before the timer wheel, with an asio timer for each message*/
+class AsioMessageTimer: public std::enable_shared_from_this<AsioMessageTimer> {
+  public:
+    using time_type = decltype(std::chrono::steady_clock::now());
+    explicit AsioMessageTimer(std::function<void(ActionMessage&&)> sFunction):
+        sendFunction(std::move(sFunction)),
+        contextPtr(gmlc::networking::AsioContextManager::getContextPointer()),
+        loopHandle(contextPtr->startContextLoop())
+    {
+    }
+    int32_t addTimer(time_type expirationTime, ActionMessage mess)
+    {
+        auto timer = std::make_shared<asio::steady_timer>(contextPtr->getBaseContext());
+        timer->expires_at(expirationTime);
+
+        std::lock_guard<std::mutex> lock(timerLock);
+        auto index = static_cast<int32_t>(timers.size());
+        buffers.push_back(std::move(mess));
+        expirationTimes.push_back(expirationTime);
+        timers.push_back(std::move(timer));
+        timers.back()->async_wait([ptr = shared_from_this(), index](const std::error_code& ec) {
+            if (ec != asio::error::operation_aborted) {
+                ptr->sendMessage(index);
+            }
+        });
+        return index;
+    }
+    void updateTimer(int32_t timerIndex, time_type expirationTime, ActionMessage mess)
+    {
+        std::lock_guard<std::mutex> lock(timerLock);
+        timers[timerIndex]->expires_at(expirationTime);
+        expirationTimes[timerIndex] = expirationTime;
+        buffers[timerIndex] = std::move(mess);
+        timers[timerIndex]->async_wait(
+            [ptr = shared_from_this(), timerIndex](const std::error_code& ec) {
+                if (ec != asio::error::operation_aborted) {
+                    ptr->sendMessage(timerIndex);
+                }
+            });
+    }
+    void cancelAll()
+    {
+        std::lock_guard<std::mutex> lock(timerLock);
+        for (auto& buf : buffers) {
+            buf.setAction(CMD_IGNORE);
+        }
+        for (auto& tmr : timers) {
+            tmr->cancel();
+        }
+    }
+    void sendMessage(int32_t timerIndex)
+    {
+        std::unique_lock<std::mutex> lock(timerLock);
+        if (std::chrono::steady_clock::now() >= expirationTimes[timerIndex] &&
+            buffers[timerIndex].action() != CMD_IGNORE) {
+            ActionMessage buf = std::move(buffers[timerIndex]);
+            buffers[timerIndex].setAction(CMD_IGNORE);
+            lock.unlock();
+            sendFunction(std::move(buf));
+        }
+    }
+
+  private:
+    std::mutex timerLock;
+    std::vector<ActionMessage> buffers;
+    std::vector<time_type> expirationTimes;
+    const std::function<void(ActionMessage&&)> sendFunction;
+    std::vector<std::shared_ptr<asio::steady_timer>> timers;
+    std::shared_ptr<gmlc::networking::AsioContextManager> contextPtr;
+    decltype(contextPtr->startContextLoop()) loopHandle;
+};
+
+static ActionMessage timerMessage(int32_t index)
+{
+    ActionMessage mess(CMD_FORCE_TIME_GRANT);
+    mess.messageID = index;
+    return mess;
+}
+
+/** add 10000 timers far in the future*/
+template<class TimerType>
+static void BMtimerAdd(benchmark::State& state)
+{
+    for (auto _ : state) {
+        state.PauseTiming();
+        auto timer = std::make_shared<TimerType>([](ActionMessage&& /*mess*/) {});
+        auto expiration = std::chrono::steady_clock::now() + 1h;
+        state.ResumeTiming();
+        for (int ii = 0; ii < activeTimers; ++ii) {
+            timer->addTimer(expiration + std::chrono::microseconds(ii), timerMessage(ii));
+        }
+        state.PauseTiming();
+        timer->cancelAll();
+        state.ResumeTiming();
+    }
+    state.SetItemsProcessed(state.iterations() * activeTimers);
+}
+BENCHMARK_TEMPLATE(BMtimerAdd, MessageTimer)->Unit(benchmark::TimeUnit::kMillisecond);
+BENCHMARK_TEMPLATE(BMtimerAdd, AsioMessageTimer)->Unit(benchmark::TimeUnit::kMillisecond);
+
+/** reschedule random timers out of 10000 active timers, as the realtime and grant timeout timers
+are updated every step*/
+template<class TimerType>
+static void BMtimerUpdate(benchmark::State& state)
+{
+    auto timer = std::make_shared<TimerType>([](ActionMessage&& /*mess*/) {});
+    auto start = std::chrono::steady_clock::now();
+    for (int ii = 0; ii < activeTimers; ++ii) {
+        timer->addTimer(start + 1h + std::chrono::microseconds(ii), timerMessage(ii));
+    }
+    std::mt19937 gen(0x7135);
+    std::uniform_int_distribution<int32_t> pick(0, activeTimers - 1);
+    std::uniform_int_distribution<int> offset(0, 60000);
+    for (auto _ : state) {
+        auto index = pick(gen);
+        timer->updateTimer(index,
+                           start + 1h + std::chrono::milliseconds(offset(gen)),
+                           timerMessage(index));
+    }
+    timer->cancelAll();
+    state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK_TEMPLATE(BMtimerUpdate, MessageTimer);
+BENCHMARK_TEMPLATE(BMtimerUpdate, AsioMessageTimer);
+
+/** fire 10000 timers spread over 50 ms and wait for all the messages to be sent*/
+template<class TimerType>
+static void BMtimerFire(benchmark::State& state)
+{
+    std::vector<std::chrono::steady_clock::time_point> expirations(activeTimers);
+    std::atomic<int> fired{0};
+    std::atomic<std::int64_t> lateness{0};
+    for (auto _ : state) {
+        fired = 0;
+        lateness = 0;
+        auto timer = std::make_shared<TimerType>([&](ActionMessage&& mess) {
+            auto late = std::chrono::steady_clock::now() - expirations[mess.messageID];
+            lateness += std::chrono::duration_cast<std::chrono::microseconds>(late).count();
+            ++fired;
+        });
+        auto start = std::chrono::steady_clock::now() + 20ms;
+        for (int ii = 0; ii < activeTimers; ++ii) {
+            expirations[ii] = start + std::chrono::microseconds(ii * 5);
+            timer->addTimer(expirations[ii], timerMessage(ii));
+        }
+        while (fired.load() < activeTimers) {
+            std::this_thread::yield();
+        }
+    }
+    state.counters["late_us"] =
+        static_cast<double>(lateness.load()) / static_cast<double>(activeTimers);
+}
+BENCHMARK_TEMPLATE(BMtimerFire, MessageTimer)
+    ->Iterations(1)
+    ->Unit(benchmark::TimeUnit::kMillisecond)
+    ->UseRealTime();
+BENCHMARK_TEMPLATE(BMtimerFire, AsioMessageTimer)
+    ->Iterations(1)
+    ->Unit(benchmark::TimeUnit::kMillisecond)
+    ->UseRealTime();
+
+HELICS_BENCHMARK_MAIN(messageTimerBenchmark);
@@ -0,0 +1,108 @@
+/*
+Copyright (c) 2017-2022,
+Battelle Memorial Institute; Lawrence Livermore National Security, LLC; Alliance for Sustainable
+Energy, LLC.  See the top-level NOTICE for additional details. All rights reserved.
+SPDX-License-Identifier: BSD-3-Clause
+*/
+
+#include "helics/application_api/HelicsPrimaryTypes.hpp"
+#include "helics/application_api/ValueConverter.hpp"
+#include "helics/application_api/reductionOperations.hpp"
+#include "helics_benchmark_main.h"
+
+#include <benchmark/benchmark.h>
+#include <memory>
+#include <vector>
+
+/** generate the serialized data for a set of vector sources*/
+static std::vector<std::shared_ptr<const helics::SmallBuffer>> generateSources(int sources,
+                                                                              int elements)
+{
+    std::vector<std::shared_ptr<const helics::SmallBuffer>> data;
+    data.reserve(sources);
+    std::vector<double> val(elements);
+    for (int ii = 0; ii < sources; ++ii) {
+        for (int jj = 0; jj < elements; ++jj) {
+            val[jj] = static_cast<double>(ii) * 0.5 - static_cast<double>(jj) * 1.25;
+        }
+        data.push_back(std::make_shared<const helics::SmallBuffer>(
+            helics::ValueConverter<std::vector<double>>::convert(val)));
+    }
+    return data;
+}
+
+static void setCounters(benchmark::State& state)
+{
+    state.SetItemsProcessed(state.iterations() * state.range(0) * state.range(1));
+    state.SetBytesProcessed(state.iterations() * state.range(0) * state.range(1) *
+                            static_cast<int64_t>(sizeof(double)));
+}
+
+// decode each source into a variant then sum the elements, as done for general types
+static void BMsumGeneric(benchmark::State& state)
+{
+    auto data = generateSources(static_cast<int>(state.range(0)), static_cast<int>(state.range(1)));
+    std::vector<helics::defV> res;
+    for (auto _ : state) {
+        res.clear();
+        for (const auto& source : data) {
+            res.emplace_back();
+            helics::valueExtract(*source, helics::DataType::HELICS_VECTOR, res.back());
+            helics::valueConvert(res.back(), helics::DataType::HELICS_VECTOR);
+        }
+        double result{0.0};
+        for (const auto& val : res) {
+            for (const auto& el : std::get<std::vector<double>>(val)) {
+                result += el;
+            }
+        }
+        benchmark::DoNotOptimize(result);
+    }
+    setCounters(state);
+}
+
+// decode all sources into a contiguous buffer and use the reduction kernel
+static void BMsumContiguous(benchmark::State& state)
+{
+    auto data = generateSources(static_cast<int>(state.range(0)), static_cast<int>(state.range(1)));
+    std::vector<double> buffer;
+    for (auto _ : state) {
+        buffer.clear();
+        for (const auto& source : data) {
+            helics::reduction::appendVectorData(*source, buffer);
+        }
+        double result = helics::reduction::sum(buffer.data(), buffer.size());
+        benchmark::DoNotOptimize(result);
+    }
+    setCounters(state);
+}
+
+// the reduction kernels alone on already decoded data
+template<double (*Kernel)(const double*, std::size_t) noexcept>
+static void BMkernel(benchmark::State& state)
+{
+    std::vector<double> buffer;
+    for (const auto& source :
+         generateSources(static_cast<int>(state.range(0)), static_cast<int>(state.range(1)))) {
+        helics::reduction::appendVectorData(*source, buffer);
+    }
+    for (auto _ : state) {
+        double result = Kernel(buffer.data(), buffer.size());
+        benchmark::DoNotOptimize(result);
+    }
+    setCounters(state);
+}
+
+static void sourceArgs(benchmark::internal::Benchmark* b)
+{
+    // number of sources and the number of elements in each
+    b->Args({512, 1})->Args({512, 8})->Args({512, 64})->Args({64, 1024});
+}
+
+BENCHMARK(BMsumGeneric)->Apply(sourceArgs);
+BENCHMARK(BMsumContiguous)->Apply(sourceArgs);
+BENCHMARK_TEMPLATE(BMkernel, helics::reduction::sum)->Apply(sourceArgs);
+BENCHMARK_TEMPLATE(BMkernel, helics::reduction::max)->Apply(sourceArgs);
+BENCHMARK_TEMPLATE(BMkernel, helics::reduction::min)->Apply(sourceArgs);
+
+HELICS_BENCHMARK_MAIN(multiInputBenchmark);
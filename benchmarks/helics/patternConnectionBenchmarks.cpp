@@ -0,0 +1,176 @@
+/*
+Copyright (c) 2017-2022,
+Battelle Memorial Institute; Lawrence Livermore National Security, LLC; Alliance for Sustainable
+Energy, LLC.  See the top-level NOTICE for additional details. All rights reserved.
+SPDX-License-Identifier: BSD-3-Clause
+*/
+
+#include "helics/application_api/Inputs.hpp"
+#include "helics/application_api/Publications.hpp"
+#include "helics/application_api/ValueFederate.hpp"
+#include "helics/core/CoreFactory.hpp"
+#include "helics/core/UnknownHandleManager.hpp"
+#include "helics_benchmark_main.h"
+
+#include <benchmark/benchmark.h>
+#include <future>
+#include <memory>
+#include <string>
+#include <vector>
+
+using helics::CoreType;
+
+/// the number of interfaces each pattern matches
+static constexpr int interfacesPerPattern{1000};
+
+static std::string interfaceName(int group, int index)
+{
+    return "feeder_" + std::to_string(group) + "/bus_" + std::to_string(index) + "/voltage";
+}
+
+/** simple recursive glob match used as the baseline of checking every pattern separately*/
+static bool globMatch(const char* pattern, const char* name)
+{
+    if (*pattern == '\0') {
+        return *name == '\0';
+    }
+    if (*pattern == '*') {
+        return globMatch(pattern + 1, name) || (*name != '\0' && globMatch(pattern, name + 1));
+    }
+    if (*name == '\0') {
+        return false;
+    }
+    return (*pattern == '?' || *pattern == *name) && globMatch(pattern + 1, name + 1);
+}
+
+/** match newly registered interfaces against the patterns held by the broker*/
+static void BMpatternMatch_compiled(benchmark::State& state)
+{
+    auto count = static_cast<int>(state.range(0));
+    auto groups = count / interfacesPerPattern;
+    std::vector<std::string> names;
+    names.reserve(count);
+    for (int ii = 0; ii < count; ++ii) {
+        names.push_back(interfaceName(ii / interfacesPerPattern, ii % interfacesPerPattern));
+    }
+    for (auto _ : state) {
+        state.PauseTiming();
+        helics::UnknownHandleManager unknowns;
+        for (int jj = 0; jj < groups; ++jj) {
+            unknowns.addPublicationPattern(
+                "feeder_" + std::to_string(jj) + "/*/voltage",
+                helics::GlobalHandle{helics::GlobalFederateId{131072},
+                                     helics::InterfaceHandle{jj}},
+                0,
+                0);
+        }
+        unknowns.clearPendingPatterns();
+        state.ResumeTiming();
+        std::size_t connections{0};
+        for (const auto& name : names) {
+            connections += unknowns.checkForPublicationPatterns(name).size();
+        }
+        benchmark::DoNotOptimize(connections);
+    }
+    state.counters["patterns"] = groups;
+    state.SetItemsProcessed(state.iterations() * count);
+}
+
+/** match newly registered interfaces by checking each pattern separately*/
+static void BMpatternMatch_scan(benchmark::State& state)
+{
+    auto count = static_cast<int>(state.range(0));
+    auto groups = count / interfacesPerPattern;
+    std::vector<std::string> names;
+    names.reserve(count);
+    for (int ii = 0; ii < count; ++ii) {
+        names.push_back(interfaceName(ii / interfacesPerPattern, ii % interfacesPerPattern));
+    }
+    std::vector<std::string> patterns;
+    for (int jj = 0; jj < groups; ++jj) {
+        patterns.push_back("feeder_" + std::to_string(jj) + "/*/voltage");
+    }
+    for (auto _ : state) {
+        std::size_t connections{0};
+        for (const auto& name : names) {
+            for (const auto& pattern : patterns) {
+                if (globMatch(pattern.c_str(), name.c_str())) {
+                    ++connections;
+                }
+            }
+        }
+        benchmark::DoNotOptimize(connections);
+    }
+    state.counters["patterns"] = groups;
+    state.SetItemsProcessed(state.iterations() * count);
+}
+
+static constexpr int64_t maxInterfaces{(HELICS_BENCHMARK_SHIFT_FACTOR < 0) ? 100'000 : 1'000'000};
+
+BENCHMARK(BMpatternMatch_compiled)
+    ->RangeMultiplier(10)
+    ->Range(10'000, maxInterfaces)
+    ->Unit(benchmark::TimeUnit::kMillisecond)
+    ->Iterations(1)
+    ->UseRealTime();
+
+// the scan grows with the product of interfaces and patterns so it stops at 100k interfaces
+BENCHMARK(BMpatternMatch_scan)
+    ->RangeMultiplier(10)
+    ->Range(10'000, 100'000)
+    ->Unit(benchmark::TimeUnit::kMillisecond)
+    ->Iterations(1)
+    ->UseRealTime();
+
+/** connect a federate of publications to inputs each targeting a pattern matching a feeder
+through enterExecutingMode*/
+static void BMpatternConnect(benchmark::State& state)
+{
+    auto count = static_cast<int>(state.range(0));
+    auto groups = count / interfacesPerPattern;
+    for (auto _ : state) {
+        state.PauseTiming();
+        auto wcore = helics::CoreFactory::create(CoreType::INPROC, "--autobroker --federates=2");
+        helics::FederateInfo fi;
+        fi.coreName = wcore->getIdentifier();
+        auto pubFed = std::make_unique<helics::ValueFederate>("pattern_pub_fed", fi);
+        auto inpFed = std::make_unique<helics::ValueFederate>("pattern_inp_fed", fi);
+        std::vector<helics::ValueInterfaceDefinition> definitions;
+        definitions.reserve(count);
+        for (int ii = 0; ii < count; ++ii) {
+            definitions.push_back(
+                {false, interfaceName(ii / interfacesPerPattern, ii % interfacesPerPattern),
+                 "double", ""});
+        }
+        state.ResumeTiming();
+        auto inpReady = std::async(std::launch::async, [&inpFed, groups]() {
+            for (int jj = 0; jj < groups; ++jj) {
+                inpFed->registerInput<double>("inp_" + std::to_string(jj))
+                    .addTarget("feeder_" + std::to_string(jj) + "/*/voltage");
+            }
+            inpFed->enterExecutingMode();
+        });
+        pubFed->registerGlobalValueInterfaces(definitions);
+        pubFed->enterExecutingMode();
+        inpReady.get();
+        state.PauseTiming();
+        pubFed->finalize();
+        inpFed->finalize();
+        pubFed.reset();
+        inpFed.reset();
+        wcore.reset();
+        helics::cleanupHelicsLibrary();
+        state.ResumeTiming();
+    }
+    state.counters["patterns"] = groups;
+    state.counters["connections"] = count;
+}
+
+BENCHMARK(BMpatternConnect)
+    ->RangeMultiplier(10)
+    ->Range(10'000, maxInterfaces)
+    ->Unit(benchmark::TimeUnit::kMillisecond)
+    ->Iterations(1)
+    ->UseRealTime();
+
+HELICS_BENCHMARK_MAIN(patternConnectionBenchmark);
@@ -20,16 +20,18 @@ SPDX-License-Identifier: BSD-3-Clause
 
 using helics::CoreType;
 // static constexpr helics::Time tend = 3600.0_t;  // simulation end time
-static void BMphold_singleCore(benchmark::State& state)
+// run all the federates on a single core with the given number of processing shards
+static void BMphold_singleCoreShards(benchmark::State& state, int shards)
 {
     for (auto _ : state) {
         state.PauseTiming();
 
         int fed_count = static_cast<int>(state.range(0));
         gmlc::concurrency::Barrier brr(static_cast<size_t>(fed_count));
-        auto wcore = helics::CoreFactory::create(CoreType::INPROC,
-                                                 std::string("--autobroker --federates=") +
-                                                     std::to_string(fed_count));
+        auto wcore = helics::CoreFactory::create(
+            CoreType::INPROC,
+            std::string("--autobroker --federates=") + std::to_string(fed_count) +
+                " --processing_shards=" + std::to_string(shards));
         std::vector<PholdFederate> feds(fed_count);
         for (int ii = 0; ii < fed_count; ++ii) {
             // phold federate default seed values are deterministic, based on index
@@ -64,6 +66,11 @@ static void BMphold_singleCore(benchmark::State& state)
         state.ResumeTiming();
     }
 }
+
+static void BMphold_singleCore(benchmark::State& state)
+{
+    BMphold_singleCoreShards(state, 0);
+}
 // Register the function as a benchmark
 BENCHMARK(BMphold_singleCore)
     ->RangeMultiplier(2)
@@ -72,6 +79,14 @@ BENCHMARK(BMphold_singleCore)
     ->Iterations(1)
     ->UseRealTime();
 
+// the same with the federate commands routed by worker threads in the core
+BENCHMARK_CAPTURE(BMphold_singleCoreShards, processingShards4, 4)
+    ->RangeMultiplier(2)
+    ->Range(1, 16)
+    ->Unit(benchmark::TimeUnit::kMillisecond)
+    ->Iterations(1)
+    ->UseRealTime();
+
 static void BMphold_multiCore(benchmark::State& state, CoreType cType)
 {
     for (auto _ : state) {
@@ -0,0 +1,155 @@
+/*
+Copyright (c) 2017-2022,
+Battelle Memorial Institute; Lawrence Livermore National Security, LLC; Alliance for Sustainable
+Energy, LLC.  See the top-level NOTICE for additional details. All rights reserved.
+SPDX-License-Identifier: BSD-3-Clause
+*/
+
+#include "helics/application_api/Inputs.hpp"
+#include "helics/application_api/Publications.hpp"
+#include "helics/application_api/ValueFederate.hpp"
+#include "helics/core/CoreFactory.hpp"
+#include "helics/helics-config.h"
+#include "helics_benchmark_main.h"
+
+#include <benchmark/benchmark.h>
+#include <gmlc/concurrency/Barrier.hpp>
+#include <memory>
+#include <string>
+#include <thread>
+#include <vector>
+
+using helics::CoreType;
+
+static constexpr int fanoutSteps{100};
+
+/** federate containing a set of inputs all subscribed to the same publication*/
+class fanoutReceiver {
+  private:
+    std::unique_ptr<helics::ValueFederate> vFed;
+    std::vector<helics::Input> inputs;
+
+  public:
+    void initialize(const std::string& coreName, int index, int inputCount)
+    {
+        helics::FederateInfo fi;
+        fi.coreName = coreName;
+        fi.setProperty(HELICS_PROPERTY_TIME_PERIOD, 1.0);
+        vFed = std::make_unique<helics::ValueFederate>("fanout_rx_" + std::to_string(index), fi);
+        inputs.reserve(inputCount);
+        for (int ii = 0; ii < inputCount; ++ii) {
+            inputs.push_back(vFed->registerSubscription("fanout_source"));
+        }
+    }
+    void makeReady() { vFed->enterExecutingMode(); }
+
+    void run()
+    {
+        std::size_t updates{0};
+        for (int step = 1; step <= fanoutSteps; ++step) {
+            vFed->requestTime(step);
+            for (auto& input : inputs) {
+                if (input.isUpdated()) {
+                    ++updates;
+                    input.clearUpdate();
+                }
+            }
+        }
+        benchmark::DoNotOptimize(updates);
+        vFed->finalize();
+    }
+};
+
+/** run a publication of a vector to a set of receivers
+@param receivers the number of federates receiving the value
+@param inputsPerReceiver the number of inputs in each receiving federate
+@param vectorSize the number of elements in the published vector*/
+static void runFanout(benchmark::State& state, int receivers, int inputsPerReceiver, int vectorSize)
+{
+    for (auto _ : state) {
+        state.PauseTiming();
+        auto wcore = helics::CoreFactory::create(CoreType::INPROC,
+                                                 std::string("--autobroker --federates=") +
+                                                     std::to_string(receivers + 1));
+        helics::FederateInfo fi;
+        fi.coreName = wcore->getIdentifier();
+        fi.setProperty(HELICS_PROPERTY_TIME_PERIOD, 1.0);
+        helics::ValueFederate pubFed("fanout_source_fed", fi);
+        auto& pub = pubFed.registerGlobalPublication<std::vector<double>>("fanout_source");
+
+        std::vector<fanoutReceiver> rx(receivers);
+        for (int ii = 0; ii < receivers; ++ii) {
+            rx[ii].initialize(wcore->getIdentifier(), ii, inputsPerReceiver);
+        }
+        gmlc::concurrency::Barrier brr(static_cast<size_t>(receivers) + 1);
+        std::vector<std::thread> threadlist(static_cast<size_t>(receivers));
+        for (int ii = 0; ii < receivers; ++ii) {
+            threadlist[ii] = std::thread(
+                [&brr](fanoutReceiver& rcv) {
+                    rcv.makeReady();
+                    brr.wait();
+                    rcv.run();
+                },
+                std::ref(rx[ii]));
+        }
+        pubFed.enterExecutingMode();
+        std::vector<double> data(static_cast<size_t>(vectorSize), 0.0);
+        brr.wait();
+        state.ResumeTiming();
+        for (int step = 1; step <= fanoutSteps; ++step) {
+            data[static_cast<size_t>(step) % data.size()] = static_cast<double>(step);
+            pub.publish(data);
+            pubFed.requestTime(step);
+        }
+        pubFed.finalize();
+        for (auto& thrd : threadlist) {
+            thrd.join();
+        }
+        state.PauseTiming();
+        wcore.reset();
+        helics::cleanupHelicsLibrary();
+        state.ResumeTiming();
+    }
+    state.counters["subscribers"] = receivers * inputsPerReceiver;
+    state.SetBytesProcessed(static_cast<int64_t>(state.iterations()) * fanoutSteps * receivers *
+                            inputsPerReceiver * vectorSize * static_cast<int64_t>(sizeof(double)));
+}
+
+static constexpr int64_t maxscale{1U << (6 + HELICS_BENCHMARK_SHIFT_FACTOR)};
+
+// FanoutArguments sets up the subscriber count (powers of 4 up to maxSubscribers) and the number
+// of doubles in the published vector
+static void FanoutArguments(benchmark::internal::Benchmark* b, int64_t maxSubscribers)
+{
+    for (int64_t subs = 1; subs <= maxSubscribers; subs *= 4) {
+        for (int64_t vsize : {1000, 10000}) {
+            b->Args({subs, vsize});
+        }
+    }
+}
+
+/** all the subscribers are inputs in a single federate*/
+static void BMfanout_singleFed(benchmark::State& state)
+{
+    runFanout(state, 1, static_cast<int>(state.range(0)), static_cast<int>(state.range(1)));
+}
+
+BENCHMARK(BMfanout_singleFed)
+    ->Apply([](benchmark::internal::Benchmark* b) { FanoutArguments(b, 256); })
+    ->Unit(benchmark::TimeUnit::kMillisecond)
+    ->Iterations(1)
+    ->UseRealTime();
+
+/** each subscriber is a separate federate in the same core*/
+static void BMfanout_multiFed(benchmark::State& state)
+{
+    runFanout(state, static_cast<int>(state.range(0)), 1, static_cast<int>(state.range(1)));
+}
+
+BENCHMARK(BMfanout_multiFed)
+    ->Apply([](benchmark::internal::Benchmark* b) { FanoutArguments(b, maxscale); })
+    ->Unit(benchmark::TimeUnit::kMillisecond)
+    ->Iterations(1)
+    ->UseRealTime();
+
+HELICS_BENCHMARK_MAIN(publicationFanoutBenchmark);
@@ -0,0 +1,113 @@
+/*
+Copyright (c) 2017-2022,
+Battelle Memorial Institute; Lawrence Livermore National Security, LLC; Alliance for Sustainable
+Energy, LLC.  See the top-level NOTICE for additional details. All rights reserved.
+SPDX-License-Identifier: BSD-3-Clause
+*/
+
+#include "helics/application_api/Inputs.hpp"
+#include "helics/application_api/Publications.hpp"
+#include "helics/application_api/ValueFederate.hpp"
+#include "helics/core/CoreFactory.hpp"
+#include "helics_benchmark_main.h"
+
+#include <benchmark/benchmark.h>
+#include <future>
+#include <memory>
+#include <string>
+#include <vector>
+
+using helics::CoreType;
+
+enum class RegistrationMode { individual, block };
+
+/** register a set of publications or inputs on a federate
+@param fed the federate to register the interfaces on
+@param count the number of interfaces
+@param input true to register inputs connected to the publications of the same index
+@param mode register the interfaces one at a time or as a single block*/
+static void registerInterfaces(helics::ValueFederate& fed,
+                               int count,
+                               bool input,
+                               RegistrationMode mode)
+{
+    if (mode == RegistrationMode::individual) {
+        for (int ii = 0; ii < count; ++ii) {
+            if (input) {
+                fed.registerGlobalInput("inp_" + std::to_string(ii), "double", "V")
+                    .addTarget("pub_" + std::to_string(ii));
+            } else {
+                fed.registerGlobalPublication("pub_" + std::to_string(ii), "double", "V");
+            }
+        }
+        return;
+    }
+    std::vector<helics::ValueInterfaceDefinition> definitions;
+    definitions.reserve(count);
+    for (int ii = 0; ii < count; ++ii) {
+        definitions.push_back(
+            {input, (input ? "inp_" : "pub_") + std::to_string(ii), "double", "V"});
+    }
+    auto interfaces = fed.registerGlobalValueInterfaces(definitions);
+    if (input) {
+        for (int ii = 0; ii < count; ++ii) {
+            interfaces[ii]->addTarget("pub_" + std::to_string(ii));
+        }
+    }
+}
+
+/** time the registration of publications on one federate and connected inputs on another
+through the connection process in enterExecutingMode*/
+static void BMregistration(benchmark::State& state, RegistrationMode mode)
+{
+    auto count = static_cast<int>(state.range(0));
+    for (auto _ : state) {
+        state.PauseTiming();
+        auto wcore = helics::CoreFactory::create(CoreType::INPROC, "--autobroker --federates=2");
+        helics::FederateInfo fi;
+        fi.coreName = wcore->getIdentifier();
+        auto pubFed = std::make_unique<helics::ValueFederate>("reg_pub_fed", fi);
+        auto inpFed = std::make_unique<helics::ValueFederate>("reg_inp_fed", fi);
+        state.ResumeTiming();
+        auto inpReady = std::async(std::launch::async, [&inpFed, count, mode]() {
+            registerInterfaces(*inpFed, count, true, mode);
+            inpFed->enterExecutingMode();
+        });
+        registerInterfaces(*pubFed, count, false, mode);
+        pubFed->enterExecutingMode();
+        inpReady.get();
+        state.PauseTiming();
+        pubFed->finalize();
+        inpFed->finalize();
+        pubFed.reset();
+        inpFed.reset();
+        wcore.reset();
+        helics::cleanupHelicsLibrary();
+        state.ResumeTiming();
+    }
+    state.counters["interfaces"] = 2.0 * count;
+}
+
+static constexpr int64_t maxInterfaces{(HELICS_BENCHMARK_SHIFT_FACTOR < 0) ? 10'000 : 100'000};
+
+// RegistrationArguments sets up the number of publications and inputs (powers of 10)
+static void RegistrationArguments(benchmark::internal::Benchmark* b)
+{
+    for (int64_t count = 1000; count <= maxInterfaces; count *= 10) {
+        b->Arg(count);
+    }
+}
+
+BENCHMARK_CAPTURE(BMregistration, individual, RegistrationMode::individual)
+    ->Apply(RegistrationArguments)
+    ->Unit(benchmark::TimeUnit::kMillisecond)
+    ->Iterations(1)
+    ->UseRealTime();
+
+BENCHMARK_CAPTURE(BMregistration, block, RegistrationMode::block)
+    ->Apply(RegistrationArguments)
+    ->Unit(benchmark::TimeUnit::kMillisecond)
+    ->Iterations(1)
+    ->UseRealTime();
+
+HELICS_BENCHMARK_MAIN(registrationBenchmark);
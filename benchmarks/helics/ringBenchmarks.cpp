@@ -156,6 +156,18 @@ BENCHMARK_CAPTURE(BMring_multiCore, ipcCore, CoreType::IPC)
     ->UseRealTime();
 #endif
 
+#ifdef HELICS_ENABLE_SHM_CORE
+// Register the shared memory ring benchmarks
+BENCHMARK_CAPTURE(BMring_multiCore, shmCore, CoreType::SHM)
+    ->Unit(benchmark::TimeUnit::kMillisecond)
+    ->Arg(2)
+    ->Arg(3)
+    ->Arg(4)
+    ->Arg(6)
+    ->Arg(10)
+    ->UseRealTime();
+#endif
+
 #ifdef HELICS_ENABLE_TCP_CORE
 // Register the TCP benchmarks
 BENCHMARK_CAPTURE(BMring_multiCore, tcpCore, CoreType::TCP)
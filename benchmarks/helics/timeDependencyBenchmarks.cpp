@@ -0,0 +1,80 @@
+/*
+Copyright (c) 2017-2022,
+Battelle Memorial Institute; Lawrence Livermore National Security, LLC; Alliance for Sustainable
+Energy, LLC.  See the top-level NOTICE for additional details. All rights reserved.
+SPDX-License-Identifier: BSD-3-Clause
+*/
+
+#include "helics/core/ActionMessage.hpp"
+#include "helics/core/TimeDependencies.hpp"
+#include "helics_benchmark_main.h"
+
+#include <cstddef>
+#include <limits>
+#include <vector>
+
+using namespace helics;  // NOLINT
+
+/** generate a dependency set like that of a broker with a large number of federates*/
+static std::vector<GlobalFederateId> loadDependencies(TimeDependencies& deps, int count)
+{
+    std::vector<GlobalFederateId> ids;
+    ids.reserve(count);
+    for (int ii = 0; ii < count; ++ii) {
+        ids.emplace_back(131072 + ii);
+        deps.addDependency(ids.back());
+        deps.addDependent(ids.back());
+        deps.getDependencyInfo(ids.back())->connection = ConnectionType::child;
+    }
+    ActionMessage grant(CMD_EXEC_GRANT);
+    ActionMessage request(CMD_TIME_REQUEST);
+    for (int ii = 0; ii < count; ++ii) {
+        grant.source_id = ids[ii];
+        deps.updateTime(grant);
+        request.source_id = ids[ii];
+        request.actionTime = 1.0 + 0.001 * ii;
+        request.Te = request.actionTime;
+        request.Tdemin = request.actionTime;
+        deps.updateTime(request);
+    }
+    return ids;
+}
+
+// a single dependency update followed by the aggregate time computations of a forwarding
+// coordinator
+static void BMtimeUpdate(benchmark::State& state, bool indexed)
+{
+    TimeDependencies deps;
+    deps.setIndexThreshold(indexed ? 0 : std::numeric_limits<std::size_t>::max());
+    auto ids = loadDependencies(deps, static_cast<int>(state.range(0)));
+    ActionMessage request(CMD_TIME_REQUEST);
+    std::size_t index{0};
+    Time nextTime{2.0};
+    for (auto _ : state) {
+        request.source_id = ids[index];
+        request.actionTime = nextTime;
+        request.Te = nextTime;
+        request.Tdemin = nextTime;
+        deps.updateTime(request);
+        auto upstream =
+            generateMinTimeUpstream(deps, false, GlobalFederateId{}, NoIgnoredFederates, 0);
+        auto total = generateMinTimeTotal(deps, false, GlobalFederateId{}, NoIgnoredFederates, 0);
+        benchmark::DoNotOptimize(upstream.next);
+        benchmark::DoNotOptimize(total.Te);
+        if (++index == ids.size()) {
+            index = 0;
+            nextTime = nextTime + 1.0;
+        }
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+
+static void dependencyCounts(benchmark::internal::Benchmark* b)
+{
+    b->Arg(100)->Arg(1000)->Arg(10000);
+}
+
+BENCHMARK_CAPTURE(BMtimeUpdate, linear, false)->Apply(dependencyCounts);
+BENCHMARK_CAPTURE(BMtimeUpdate, indexed, true)->Apply(dependencyCounts);
+
+HELICS_BENCHMARK_MAIN(timeDependencyBenchmark);
@@ -7,17 +7,26 @@ SPDX-License-Identifier: BSD-3-Clause
 
 #include "TimingHubFederate.hpp"
 #include "TimingLeafFederate.hpp"
+#include "gmlc/containers/BlockingQueue.hpp"
+#include "helics/application_api/ValueFederate.hpp"
+#include "helics/common/MpscQueue.hpp"
+#include "helics/core/ActionMessage.hpp"
 #include "helics/core/BrokerFactory.hpp"
 #include "helics/core/CoreFactory.hpp"
 #include "helics/helics-config.h"
 #include "helics_benchmark_main.h"
 
+#include <algorithm>
 #include <benchmark/benchmark.h>
 #include <chrono>
 #include <fstream>
+#include <future>
 #include <gmlc/concurrency/Barrier.hpp>
 #include <iostream>
+#include <memory>
+#include <string>
 #include <thread>
+#include <vector>
 
 using helics::CoreType;
 static void BMtiming_singleCore(benchmark::State& state)
@@ -52,6 +61,10 @@ static void BMtiming_singleCore(benchmark::State& state)
         for (auto& thrd : threadlist) {
             thrd.join();
         }
+        TimingMessageCounts counts;
+        counts.add(wcore->query("core", "timing_coalescing", HELICS_SEQUENCING_MODE_FAST));
+        state.counters["timing_msgs"] = counts.timingMessages;
+        state.counters["coalesced"] = counts.coalesced;
         wcore.reset();
         helics::cleanupHelicsLibrary();
         state.ResumeTiming();
@@ -106,6 +119,14 @@ static void BMtiming_multiCore(benchmark::State& state, CoreType cType)
         for (auto& thrd : threadlist) {
             thrd.join();
         }
+        TimingMessageCounts counts;
+        counts.add(broker->query("broker", "timing_coalescing"));
+        counts.add(wcore->query("core", "timing_coalescing", HELICS_SEQUENCING_MODE_FAST));
+        for (auto& core : cores) {
+            counts.add(core->query("core", "timing_coalescing", HELICS_SEQUENCING_MODE_FAST));
+        }
+        state.counters["timing_msgs"] = counts.timingMessages;
+        state.counters["coalesced"] = counts.coalesced;
         broker->disconnect();
         broker.reset();
         cores.clear();
@@ -183,4 +204,156 @@ BENCHMARK_CAPTURE(BMtiming_multiCore, udpCore, CoreType::UDP)
     ->UseRealTime();
 #endif
 
+/** step two federates depending on each other through time and record the latency of each
+time grant with the federates using a specific wait policy, with or without the collapsing of
+superseded timing messages*/
+static void BMtiming_grantLatency(benchmark::State& state, int waitPolicy, bool coalescing)
+{
+    static constexpr int steps{5000};
+    std::vector<double> latencies;
+    latencies.reserve(steps);
+    std::string coreInit{"--autobroker --federates=2"};
+    if (!coalescing) {
+        coreInit += " --no_timing_coalescing --broker_init_string=\"--no_timing_coalescing\"";
+    }
+    TimingMessageCounts counts;
+    for (auto _ : state) {
+        state.PauseTiming();
+        auto wcore = helics::CoreFactory::create(CoreType::INPROC, coreInit);
+        helics::FederateInfo fi;
+        fi.coreName = wcore->getIdentifier();
+        fi.setProperty(HELICS_PROPERTY_INT_WAIT_POLICY, waitPolicy);
+        auto fedA = std::make_unique<helics::ValueFederate>("grant_fed_a", fi);
+        auto fedB = std::make_unique<helics::ValueFederate>("grant_fed_b", fi);
+        fedA->registerGlobalPublication<double>("grant_a");
+        fedB->registerGlobalPublication<double>("grant_b");
+        fedA->registerSubscription("grant_b");
+        fedB->registerSubscription("grant_a");
+        state.ResumeTiming();
+        auto otherFed = std::async(std::launch::async, [&fedB]() {
+            fedB->enterExecutingMode();
+            for (int ii = 1; ii <= steps; ++ii) {
+                fedB->requestTime(ii);
+            }
+            fedB->finalize();
+        });
+        fedA->enterExecutingMode();
+        for (int ii = 1; ii <= steps; ++ii) {
+            auto start = std::chrono::steady_clock::now();
+            fedA->requestTime(ii);
+            std::chrono::duration<double, std::micro> latency =
+                std::chrono::steady_clock::now() - start;
+            latencies.push_back(latency.count());
+        }
+        fedA->finalize();
+        otherFed.get();
+        state.PauseTiming();
+        counts.add(wcore->query("core", "timing_coalescing", HELICS_SEQUENCING_MODE_FAST));
+        fedA.reset();
+        fedB.reset();
+        wcore.reset();
+        helics::cleanupHelicsLibrary();
+        state.ResumeTiming();
+    }
+    std::sort(latencies.begin(), latencies.end());
+    state.counters["p50_us"] = latencies[latencies.size() / 2];
+    state.counters["p99_us"] = latencies[latencies.size() * 99 / 100];
+    state.counters["timing_msgs"] = counts.timingMessages;
+    state.counters["coalesced"] = counts.coalesced;
+}
+
+BENCHMARK_CAPTURE(BMtiming_grantLatency, block, HELICS_WAIT_POLICY_BLOCK, true)
+    ->Unit(benchmark::TimeUnit::kMillisecond)
+    ->Iterations(1)
+    ->UseRealTime();
+BENCHMARK_CAPTURE(BMtiming_grantLatency, spin, HELICS_WAIT_POLICY_SPIN, true)
+    ->Unit(benchmark::TimeUnit::kMillisecond)
+    ->Iterations(1)
+    ->UseRealTime();
+BENCHMARK_CAPTURE(BMtiming_grantLatency, spinYield, HELICS_WAIT_POLICY_SPIN_YIELD, true)
+    ->Unit(benchmark::TimeUnit::kMillisecond)
+    ->Iterations(1)
+    ->UseRealTime();
+BENCHMARK_CAPTURE(BMtiming_grantLatency, adaptive, HELICS_WAIT_POLICY_ADAPTIVE, true)
+    ->Unit(benchmark::TimeUnit::kMillisecond)
+    ->Iterations(1)
+    ->UseRealTime();
+BENCHMARK_CAPTURE(BMtiming_grantLatency, blockNoCoalescing, HELICS_WAIT_POLICY_BLOCK, false)
+    ->Unit(benchmark::TimeUnit::kMillisecond)
+    ->Iterations(1)
+    ->UseRealTime();
+
+/** send a time request through one queue and get the grant back through another, the same
+handoff a federate does with the core for each time step*/
+template<class QueueType>
+static void BMqueue_pingpong(benchmark::State& state)
+{
+    QueueType toFed;
+    QueueType toCore;
+    std::thread responder([&toFed, &toCore]() {
+        while (true) {
+            auto cmd = toCore.pop();
+            if (cmd.action() == helics::CMD_STOP) {
+                break;
+            }
+            cmd.setAction(helics::CMD_TIME_GRANT);
+            toFed.push(std::move(cmd));
+        }
+    });
+    helics::ActionMessage req(helics::CMD_TIME_REQUEST);
+    for (auto _ : state) {
+        toCore.push(req);
+        auto grant = toFed.pop();
+        benchmark::DoNotOptimize(grant);
+    }
+    toCore.push(helics::ActionMessage(helics::CMD_STOP));
+    responder.join();
+}
+
+BENCHMARK_TEMPLATE(BMqueue_pingpong, gmlc::containers::BlockingQueue<helics::ActionMessage>)
+    ->UseRealTime();
+BENCHMARK_TEMPLATE(BMqueue_pingpong, helics::MpscQueue<helics::ActionMessage>)->UseRealTime();
+
+/** multiple producers filling a queue drained by a single consumer*/
+template<class QueueType>
+static void BMqueue_multiProducer(benchmark::State& state)
+{
+    const auto producers = static_cast<int>(state.range(0));
+    static constexpr int messagesPerProducer{10000};
+    for (auto _ : state) {
+        QueueType queue;
+        std::vector<std::thread> threadlist;
+        threadlist.reserve(producers);
+        for (int ii = 0; ii < producers; ++ii) {
+            threadlist.emplace_back([&queue, ii]() {
+                helics::ActionMessage cmd(helics::CMD_PUB);
+                cmd.source_id = helics::GlobalFederateId(ii);
+                for (int jj = 0; jj < messagesPerProducer; ++jj) {
+                    cmd.counter = static_cast<uint16_t>(jj);
+                    queue.push(cmd);
+                }
+            });
+        }
+        for (int ii = 0; ii < producers * messagesPerProducer; ++ii) {
+            auto cmd = queue.pop();
+            benchmark::DoNotOptimize(cmd);
+        }
+        for (auto& thrd : threadlist) {
+            thrd.join();
+        }
+    }
+    state.SetItemsProcessed(state.iterations() * producers * messagesPerProducer);
+}
+
+BENCHMARK_TEMPLATE(BMqueue_multiProducer, gmlc::containers::BlockingQueue<helics::ActionMessage>)
+    ->RangeMultiplier(2)
+    ->Range(1, 8)
+    ->Unit(benchmark::TimeUnit::kMillisecond)
+    ->UseRealTime();
+BENCHMARK_TEMPLATE(BMqueue_multiProducer, helics::MpscQueue<helics::ActionMessage>)
+    ->RangeMultiplier(2)
+    ->Range(1, 8)
+    ->Unit(benchmark::TimeUnit::kMillisecond)
+    ->UseRealTime();
+
 HELICS_BENCHMARK_MAIN(timingBenchmark);
@@ -0,0 +1,107 @@
+/*
+Copyright (c) 2017-2022,
+Battelle Memorial Institute; Lawrence Livermore National Security, LLC; Alliance for Sustainable
+Energy, LLC.  See the top-level NOTICE for additional details. All rights reserved.
+SPDX-License-Identifier: BSD-3-Clause
+*/
+
+#include "helics/application_api/Inputs.hpp"
+#include "helics/application_api/Publications.hpp"
+#include "helics/application_api/ValueFederate.hpp"
+#include "helics/core/CoreFactory.hpp"
+#include "helics_benchmark_main.h"
+
+#include <benchmark/benchmark.h>
+#include <memory>
+#include <string>
+#include <vector>
+
+using helics::CoreType;
+
+enum class ReadMode { copy, reference, view };
+
+/** federate with a single vector publication feeding a subscription*/
+class vectorReader {
+  public:
+    std::unique_ptr<helics::ValueFederate> vFed;
+    helics::Publication* pub{nullptr};
+    helics::Input* sub{nullptr};
+    std::vector<double> value;
+    helics::Time currentTime{helics::timeZero};
+
+    explicit vectorReader(int vectorSize): value(vectorSize, 1.5)
+    {
+        auto wcore = helics::CoreFactory::create(CoreType::INPROC, "--autobroker --federates=1");
+        helics::FederateInfo fi;
+        fi.coreName = wcore->getIdentifier();
+        fi.setProperty(HELICS_PROPERTY_TIME_PERIOD, 1.0);
+        vFed = std::make_unique<helics::ValueFederate>("vector_reader", fi);
+        pub = &vFed->registerGlobalPublication<std::vector<double>>("vector_source");
+        sub = &vFed->registerSubscription("vector_source");
+        vFed->enterExecutingMode();
+    }
+    ~vectorReader() { vFed->finalize(); }
+    /** publish a new value and advance time so the input has an update*/
+    void update()
+    {
+        value.front() += 1.0;
+        pub->publish(value);
+        currentTime = vFed->requestTime(currentTime + 1.0);
+    }
+    /** read the value from the input in one of the different ways*/
+    double read(ReadMode mode)
+    {
+        switch (mode) {
+            case ReadMode::copy:
+            default: {
+                auto val = sub->getValue<std::vector<double>>();
+                return val.front();
+            }
+            case ReadMode::reference:
+                return sub->getValueRef<std::vector<double>>().front();
+            case ReadMode::view:
+                return sub->getVectorView().front();
+        }
+    }
+};
+
+// repeated reads of a value without any new data
+static void BMreadValue(benchmark::State& state, ReadMode mode)
+{
+    vectorReader reader(static_cast<int>(state.range(0)));
+    reader.update();
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(reader.read(mode));
+    }
+    state.SetBytesProcessed(state.iterations() * state.range(0) *
+                            static_cast<int64_t>(sizeof(double)));
+}
+
+// a single read of each new value received
+static void BMreadUpdate(benchmark::State& state, ReadMode mode)
+{
+    vectorReader reader(static_cast<int>(state.range(0)));
+    for (auto _ : state) {
+        state.PauseTiming();
+        reader.update();
+        state.ResumeTiming();
+        benchmark::DoNotOptimize(reader.read(mode));
+    }
+    state.SetBytesProcessed(state.iterations() * state.range(0) *
+                            static_cast<int64_t>(sizeof(double)));
+}
+
+static void vectorSizes(benchmark::internal::Benchmark* b)
+{
+    b->Arg(1000)->Arg(100000);
+}
+
+BENCHMARK_CAPTURE(BMreadValue, copy, ReadMode::copy)->Apply(vectorSizes);
+BENCHMARK_CAPTURE(BMreadValue, reference, ReadMode::reference)->Apply(vectorSizes);
+BENCHMARK_CAPTURE(BMreadValue, view, ReadMode::view)->Apply(vectorSizes);
+
+BENCHMARK_CAPTURE(BMreadUpdate, copy, ReadMode::copy)->Apply(vectorSizes);
+BENCHMARK_CAPTURE(BMreadUpdate, reference, ReadMode::reference)->Apply(vectorSizes);
+BENCHMARK_CAPTURE(BMreadUpdate, view, ReadMode::view)->Apply(vectorSizes);
+
+HELICS_BENCHMARK_MAIN(valueReadBenchmark);
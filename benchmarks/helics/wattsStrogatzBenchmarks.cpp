@@ -10,12 +10,14 @@ SPDX-License-Identifier: BSD-3-Clause
 #include "helics/core/CoreFactory.hpp"
 #include "helics_benchmark_main.h"
 
+#include <algorithm>
 #include <benchmark/benchmark.h>
 #include <chrono>
 #include <fstream>
 #include <gmlc/concurrency/Barrier.hpp>
 #include <iostream>
 #include <thread>
+#include <vector>
 
 using helics::CoreType;
 
@@ -39,6 +41,25 @@ static void WattsStrogatzArguments(benchmark::internal::Benchmark* b)
     }
 }
 
+/** report the latency of the time grants of all the federates and the timing messages handled by
+the cores and brokers*/
+static void addTimingCounters(benchmark::State& state,
+                              const std::vector<WattsStrogatzFederate>& links,
+                              const TimingMessageCounts& counts)
+{
+    std::vector<double> latencies;
+    for (const auto& link : links) {
+        latencies.insert(latencies.end(), link.grantLatencies.begin(), link.grantLatencies.end());
+    }
+    if (!latencies.empty()) {
+        std::sort(latencies.begin(), latencies.end());
+        state.counters["p50_us"] = latencies[latencies.size() / 2];
+        state.counters["p99_us"] = latencies[latencies.size() * 99 / 100];
+    }
+    state.counters["timing_msgs"] = counts.timingMessages;
+    state.counters["coalesced"] = counts.coalesced;
+}
+
 static void BM_wattsStrogatz2_singleCore(benchmark::State& state)
 {
     for (auto _ : state) {
@@ -71,6 +92,9 @@ static void BM_wattsStrogatz2_singleCore(benchmark::State& state)
         state.PauseTiming();
         rthread.join();
 
+        TimingMessageCounts counts;
+        counts.add(wcore->query("core", "timing_coalescing", HELICS_SEQUENCING_MODE_FAST));
+        addTimingCounters(state, links, counts);
         wcore.reset();
         helics::cleanupHelicsLibrary();
         state.ResumeTiming();
@@ -128,6 +152,12 @@ static void BM_wattsStrogatz_multiCore(benchmark::State& state, CoreType cType)
             thrd.join();
         }
 
+        TimingMessageCounts counts;
+        counts.add(broker->query("broker", "timing_coalescing"));
+        for (auto& core : cores) {
+            counts.add(core->query("core", "timing_coalescing", HELICS_SEQUENCING_MODE_FAST));
+        }
+        addTimingCounters(state, links, counts);
         broker->disconnect();
         broker.reset();
         cores.clear();
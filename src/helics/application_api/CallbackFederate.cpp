@@ -0,0 +1,238 @@
+/*
+Copyright (c) 2017-2022,
+Battelle Memorial Institute; Lawrence Livermore National Security, LLC; Alliance for Sustainable
+Energy, LLC.  See the top-level NOTICE for additional details. All rights reserved.
+SPDX-License-Identifier: BSD-3-Clause
+*/
+#include "CallbackFederate.hpp"
+
+#include "../core/Core.hpp"
+#include "../core/core-exceptions.hpp"
+
+#include <memory>
+#include <string>
+#include <utility>
+
+namespace helics {
+/** the operator called by the core, forwarding the calls to the federate until it is destroyed*/
+class CallbackFederate::Operator final: public FederateOperator {
+  public:
+    explicit Operator(CallbackFederate* federate): fed(federate) {}
+    virtual IterationRequest initializeOperations() override
+    {
+        std::lock_guard<std::mutex> lock(fedLock);
+        return (fed != nullptr) ? fed->initializeOperations() : IterationRequest::NO_ITERATIONS;
+    }
+    virtual std::pair<Time, IterationRequest> operate(iteration_time newTime) override
+    {
+        std::lock_guard<std::mutex> lock(fedLock);
+        if (fed == nullptr) {
+            return {Time::maxVal(), IterationRequest::NO_ITERATIONS};
+        }
+        return fed->operate(newTime);
+    }
+    virtual void finalize() override
+    {
+        std::lock_guard<std::mutex> lock(fedLock);
+        if (fed != nullptr) {
+            fed->finalizeOperations();
+        }
+    }
+    virtual void error_handler(int /*code*/, std::string_view message) override
+    {
+        std::lock_guard<std::mutex> lock(fedLock);
+        if (fed != nullptr) {
+            fed->updateFederateMode(Modes::ERROR_STATE);
+            fed->operationFailed(std::make_exception_ptr(FunctionExecutionFailure(message)));
+        }
+    }
+    /** stop forwarding calls, waiting for a call in progress to return*/
+    void detach()
+    {
+        std::lock_guard<std::mutex> lock(fedLock);
+        fed = nullptr;
+    }
+
+  private:
+    std::mutex fedLock;
+    CallbackFederate* fed{nullptr};
+};
+
+CallbackFederate::CallbackFederate(const std::string& fedName, const FederateInfo& fi):
+    Federate(fedName, fi), CombinationFederate(fedName, fi),
+    fedOperator(std::make_shared<Operator>(this))
+{
+    coreObject->setFederateOperator(getID(), fedOperator);
+}
+
+CallbackFederate::CallbackFederate(const std::string& fedName,
+                                   const std::shared_ptr<Core>& core,
+                                   const FederateInfo& fi):
+    Federate(fedName, core, fi),
+    CombinationFederate(fedName, core, fi), fedOperator(std::make_shared<Operator>(this))
+{
+    coreObject->setFederateOperator(getID(), fedOperator);
+}
+
+CallbackFederate::CallbackFederate(const std::string& fedName,
+                                   CoreApp& core,
+                                   const FederateInfo& fi):
+    Federate(fedName, core, fi),
+    CombinationFederate(fedName, core, fi), fedOperator(std::make_shared<Operator>(this))
+{
+    coreObject->setFederateOperator(getID(), fedOperator);
+}
+
+CallbackFederate::CallbackFederate(const std::string& fedName, const std::string& configString):
+    Federate(fedName, loadFederateInfo(configString)),
+    CombinationFederate(fedName, configString), fedOperator(std::make_shared<Operator>(this))
+{
+    coreObject->setFederateOperator(getID(), fedOperator);
+}
+
+CallbackFederate::CallbackFederate(const std::string& configString):
+    Federate(std::string(), loadFederateInfo(configString)),
+    CombinationFederate(configString), fedOperator(std::make_shared<Operator>(this))
+{
+    coreObject->setFederateOperator(getID(), fedOperator);
+}
+
+CallbackFederate::~CallbackFederate()
+{
+    fedOperator->detach();
+    if (!isCompleted()) {
+        // hand the federate back to the calling thread so the base class can finalize it
+        try {
+            coreObject->setFederateOperator(getID(), nullptr);
+        }
+        catch (...) {
+        }
+    }
+}
+
+void CallbackFederate::setInitializeCallback(std::function<IterationRequest()> callback)
+{
+    initializeCallback = std::move(callback);
+}
+
+void CallbackFederate::setNextTimeCallback(std::function<Time(Time)> callback)
+{
+    nextTimeCallback = std::move(callback);
+}
+
+void CallbackFederate::setNextTimeIterativeCallback(
+    std::function<std::pair<Time, IterationRequest>(iteration_time)> callback)
+{
+    nextTimeIterativeCallback = std::move(callback);
+}
+
+void CallbackFederate::setFinalizeCallback(std::function<void()> callback)
+{
+    finalizeCallback = std::move(callback);
+}
+
+void CallbackFederate::startOperations()
+{
+    if (currentMode.load() != Modes::STARTUP || started.exchange(true)) {
+        throw(InvalidFunctionCall("operations may only be started once from startup mode"));
+    }
+    try {
+        coreObject->enterInitializingMode(getID());
+    }
+    catch (const HelicsException&) {
+        updateFederateMode(Modes::ERROR_STATE);
+        throw;
+    }
+}
+
+void CallbackFederate::waitForCompletion()
+{
+    if (!started.load()) {
+        throw(InvalidFunctionCall("operations have not been started"));
+    }
+    std::unique_lock<std::mutex> lock(completionLock);
+    completion.wait(lock, [this]() { return completed; });
+    if (failure) {
+        auto err = failure;
+        failure = nullptr;
+        std::rethrow_exception(err);
+    }
+}
+
+bool CallbackFederate::isCompleted() const
+{
+    std::lock_guard<std::mutex> lock(completionLock);
+    return completed;
+}
+
+IterationRequest CallbackFederate::initializeOperations()
+{
+    if (currentMode.load() == Modes::STARTUP) {
+        initializingModeEntered();
+    } else {
+        executingModeEntered(IterationResult::ITERATING);
+    }
+    try {
+        return (initializeCallback) ? initializeCallback() : IterationRequest::NO_ITERATIONS;
+    }
+    catch (...) {
+        operationFailed(std::current_exception());
+        throw;
+    }
+}
+
+std::pair<Time, IterationRequest> CallbackFederate::operate(iteration_time newTime)
+{
+    if (currentMode.load() == Modes::INITIALIZING) {
+        executingModeEntered(newTime.state);
+    } else {
+        timeRequestReturn(newTime);
+    }
+    if (currentMode.load() != Modes::EXECUTING) {
+        return {Time::maxVal(), IterationRequest::NO_ITERATIONS};
+    }
+    std::pair<Time, IterationRequest> next{Time::maxVal(), IterationRequest::NO_ITERATIONS};
+    try {
+        if (nextTimeIterativeCallback) {
+            next = nextTimeIterativeCallback({currentTime, newTime.state});
+        } else if (nextTimeCallback) {
+            next.first = nextTimeCallback(currentTime);
+        }
+    }
+    catch (...) {
+        operationFailed(std::current_exception());
+        throw;
+    }
+    if (next.first < Time::maxVal()) {
+        timeRequestEntry(next.first, next.second);
+    }
+    return next;
+}
+
+void CallbackFederate::finalizeOperations()
+{
+    if (currentMode.load() != Modes::ERROR_STATE) {
+        updateFederateMode(Modes::FINISHED);
+    }
+    try {
+        if (finalizeCallback) {
+            finalizeCallback();
+        }
+    }
+    catch (...) {
+        operationFailed(std::current_exception());
+    }
+    std::lock_guard<std::mutex> lock(completionLock);
+    completed = true;
+    completion.notify_all();
+}
+
+void CallbackFederate::operationFailed(std::exception_ptr error)
+{
+    std::lock_guard<std::mutex> lock(completionLock);
+    if (!failure) {
+        failure = std::move(error);
+    }
+}
+
+}  // namespace helics
@@ -0,0 +1,118 @@
+/*
+Copyright (c) 2017-2022,
+Battelle Memorial Institute; Lawrence Livermore National Security, LLC; Alliance for Sustainable
+Energy, LLC.  See the top-level NOTICE for additional details. All rights reserved.
+SPDX-License-Identifier: BSD-3-Clause
+*/
+#pragma once
+
+#include "CombinationFederate.hpp"
+
+#include <atomic>
+#include <condition_variable>
+#include <exception>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <utility>
+
+namespace helics {
+/** class defining a federate that is run through callbacks from the threads of its core
+@details the federate does not need a thread of its own, once the operations are started the
+callbacks are called from the callback threads of the core for the entry to executing mode and for
+each time grant, and the federate finalizes when a callback returns Time::maxVal() or the
+co-simulation halts.  The value and message interfaces may be used from within the callbacks, the
+mode transition and time request functions of the federate should not be called directly.
+*/
+class HELICS_CXX_EXPORT CallbackFederate: public CombinationFederate {
+  public:
+    /**constructor taking a federate information structure and using the default core
+    @param fedName the name of the federate, may be left empty to use a default or one found in fi
+    @param fi  a federate information structure
+    */
+    CallbackFederate(const std::string& fedName, const FederateInfo& fi);
+
+    /**constructor taking a federate information structure and using the given core
+    @param fedName the name of the federate, may be left empty to use a default or one found in fi
+    @param core a pointer to core object which the federate can join
+    @param fi  a federate information structure
+    */
+    CallbackFederate(const std::string& fedName,
+                     const std::shared_ptr<Core>& core,
+                     const FederateInfo& fi = FederateInfo{});
+
+    /**constructor taking a federate information structure and using the given CoreApp
+    @param fedName the name of the federate, may be left empty to use a default or one found in fi
+    @param core a CoreApp object representing the core to connect to
+    @param fi  a federate information structure
+    */
+    CallbackFederate(const std::string& fedName,
+                     CoreApp& core,
+                     const FederateInfo& fi = FederateInfo{});
+
+    /**constructor taking a federate name and a file with the required information
+    @param fedName the name of the federate, can be empty to use the name from the configString
+    @param configString can be either a JSON file a TOML file (with extension TOML) or a string
+    containing JSON code or a string with command line arguments
+    */
+    CallbackFederate(const std::string& fedName, const std::string& configString);
+
+    /**constructor taking a file with the required information
+     @param configString can be either a JSON file a TOML file (with extension TOML) or a string
+    containing JSON code or a string with command line arguments
+    */
+    explicit CallbackFederate(const std::string& configString);
+
+    /** the operator of the core refers to the federate so it can't be moved*/
+    CallbackFederate(CallbackFederate&& fed) = delete;
+    CallbackFederate& operator=(CallbackFederate&& fed) = delete;
+    /** destructor*/
+    virtual ~CallbackFederate();
+
+    /** set the callback for initializing mode
+    @details called when the federate enters initializing mode and again after each iteration in
+    initializing mode, the returned value is the iteration request for entering executing mode*/
+    void setInitializeCallback(std::function<IterationRequest()> callback);
+    /** set the callback for executing mode
+    @details called with the current time when the federate enters executing mode and after each
+    time grant, the returned value is the next time to request, Time::maxVal() finalizes the
+    federate*/
+    void setNextTimeCallback(std::function<Time(Time)> callback);
+    /** set an iterative callback for executing mode
+    @details called with the granted time and iteration state in place of the next time callback
+    and returns the next time and iteration request*/
+    void setNextTimeIterativeCallback(
+        std::function<std::pair<Time, IterationRequest>(iteration_time)> callback);
+    /** set the callback called once the federate has finished*/
+    void setFinalizeCallback(std::function<void()> callback);
+
+    /** start running the federate from the core
+    @details the call returns immediately, the callbacks should be set before calling this*/
+    void startOperations();
+    /** wait until the federate has finished
+    @throw the exception thrown by a callback or a FunctionExecutionFailure if the federate
+    encountered an error*/
+    void waitForCompletion();
+    /** check if the federate has finished*/
+    bool isCompleted() const;
+
+  private:
+    class Operator;
+    IterationRequest initializeOperations();
+    std::pair<Time, IterationRequest> operate(iteration_time newTime);
+    void finalizeOperations();
+    void operationFailed(std::exception_ptr error);
+
+    std::shared_ptr<Operator> fedOperator;
+    std::function<IterationRequest()> initializeCallback;
+    std::function<Time(Time)> nextTimeCallback;
+    std::function<std::pair<Time, IterationRequest>(iteration_time)> nextTimeIterativeCallback;
+    std::function<void()> finalizeCallback;
+    std::atomic<bool> started{false};
+    mutable std::mutex completionLock;
+    std::condition_variable completion;
+    bool completed{false};
+    std::exception_ptr failure;  //!< the first error encountered by the operations
+};
+}  // namespace helics
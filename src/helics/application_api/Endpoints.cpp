@@ -151,6 +151,12 @@ std::unique_ptr<Message> Endpoint::getMessage() const
     return (fed != nullptr) ? fed->getMessage(*this) : nullptr;
 }
 
+std::vector<std::unique_ptr<Message>> Endpoint::getMessages(std::size_t maxCount) const
+{
+    return (fed != nullptr) ? fed->getMessages(*this, maxCount) :
+                              std::vector<std::unique_ptr<Message>>{};
+}
+
 /** check if there is a message available*/
 bool Endpoint::hasMessage() const
 {
@@ -13,6 +13,7 @@ SPDX-License-Identifier: BSD-3-Clause
 #include <string>
 #include <type_traits>
 #include <utility>
+#include <vector>
 
 namespace helics {
 class MessageFederate;
@@ -156,6 +157,10 @@ class HELICS_CXX_EXPORT Endpoint: public Interface {
 
     /** get an available message if there is no message the returned object is empty*/
     std::unique_ptr<Message> getMessage() const;
+    /** get the available messages in the order they would be returned by getMessage
+    @param maxCount the maximum number of messages to return
+    @return a vector of the messages, which is empty if there are no messages*/
+    std::vector<std::unique_ptr<Message>> getMessages(std::size_t maxCount) const;
     /** check if there is a message available*/
     bool hasMessage() const;
     /** Get the number of available messages*/
@@ -227,9 +227,7 @@ void Federate::enterInitializingMode()
         case Modes::STARTUP:
             try {
                 coreObject->enterInitializingMode(fedID);
-                updateFederateMode(Modes::INITIALIZING);
-                currentTime = coreObject->getCurrentTime(fedID);
-                startupToInitializeStateTransition();
+                initializingModeEntered();
             }
             catch (const HelicsException&) {
                 updateFederateMode(Modes::ERROR_STATE);
@@ -298,9 +296,7 @@ void Federate::enterInitializingModeComplete()
                 updateFederateMode(Modes::ERROR_STATE);
                 throw;
             }
-            updateFederateMode(Modes::INITIALIZING);
-            currentTime = coreObject->getCurrentTime(fedID);
-            startupToInitializeStateTransition();
+            initializingModeEntered();
         } break;
         case Modes::INITIALIZING:
             break;
@@ -324,34 +320,7 @@ IterationResult Federate::enterExecutingMode(IterationRequest iterate)
             [[fallthrough]];
         case Modes::INITIALIZING: {
             res = coreObject->enterExecutingMode(fedID, iterate);
-            switch (res) {
-                case IterationResult::NEXT_STEP:
-                    updateFederateMode(Modes::EXECUTING);
-                    if (observerMode) {
-                        currentTime = coreObject->getCurrentTime(fedID);
-                    } else {
-                        currentTime = timeZero;
-                    }
-                    if (timeUpdateCallback) {
-                        timeUpdateCallback(currentTime, false);
-                    }
-                    initializeToExecuteStateTransition(res);
-                    if (timeRequestReturnCallback) {
-                        timeRequestReturnCallback(currentTime, false);
-                    }
-                    break;
-                case IterationResult::ITERATING:
-                    updateFederateMode(Modes::INITIALIZING);
-                    currentTime = initializationTime;
-                    initializeToExecuteStateTransition(res);
-                    break;
-                case IterationResult::ERROR_RESULT:
-                    updateFederateMode(Modes::ERROR_STATE);
-                    break;
-                case IterationResult::HALTED:
-                    updateFederateMode(Modes::FINISHED);
-                    break;
-            }
+            executingModeEntered(res);
             break;
         }
         case Modes::PENDING_EXEC:
@@ -418,37 +387,7 @@ IterationResult Federate::enterExecutingModeComplete()
             auto asyncInfo = asyncCallInfo->lock();
             try {
                 auto res = asyncInfo->execFuture.get();
-                switch (res) {
-                    case IterationResult::NEXT_STEP:
-                        updateFederateMode(Modes::EXECUTING);
-                        if (observerMode) {
-                            currentTime = coreObject->getCurrentTime(fedID);
-                        } else {
-                            currentTime = timeZero;
-                        }
-                        if (timeUpdateCallback) {
-                            timeUpdateCallback(currentTime, false);
-                        }
-                        initializeToExecuteStateTransition(IterationResult::NEXT_STEP);
-                        if (timeRequestReturnCallback) {
-                            timeRequestReturnCallback(currentTime, false);
-                        }
-                        break;
-                    case IterationResult::ITERATING:
-                        updateFederateMode(Modes::INITIALIZING);
-                        currentTime = initializationTime;
-                        initializeToExecuteStateTransition(IterationResult::ITERATING);
-                        break;
-                    case IterationResult::ERROR_RESULT:
-                        // LCOV_EXCL_START
-                        updateFederateMode(Modes::ERROR_STATE);
-                        break;
-                        // LCOV_EXCL_STOP
-                    case IterationResult::HALTED:
-                        updateFederateMode(Modes::FINISHED);
-                        break;
-                }
-
+                executingModeEntered(res);
                 return res;
             }
             catch (const std::exception&) {
@@ -742,35 +681,9 @@ Time Federate::requestTime(Time nextInternalTimeStep)
 iteration_time Federate::requestTimeIterative(Time nextInternalTimeStep, IterationRequest iterate)
 {
     if (currentMode == Modes::EXECUTING) {
-        if (timeRequestEntryCallback) {
-            timeRequestEntryCallback(currentTime,
-                                     nextInternalTimeStep,
-                                     iterate != IterationRequest::NO_ITERATIONS);
-        }
+        timeRequestEntry(nextInternalTimeStep, iterate);
         auto iterativeTime = coreObject->requestTimeIterative(fedID, nextInternalTimeStep, iterate);
-        switch (iterativeTime.state) {
-            case IterationResult::NEXT_STEP:
-                updateSimulationTime(iterativeTime.grantedTime, currentTime, false);
-                if (timeRequestReturnCallback) {
-                    timeRequestReturnCallback(iterativeTime.grantedTime, false);
-                }
-                break;
-            case IterationResult::ITERATING:
-                updateSimulationTime(iterativeTime.grantedTime, currentTime, true);
-                if (timeRequestReturnCallback) {
-                    timeRequestReturnCallback(iterativeTime.grantedTime, true);
-                }
-                break;
-            case IterationResult::HALTED:
-                updateFederateMode(Modes::FINISHED);
-                updateSimulationTime(iterativeTime.grantedTime, currentTime, false);
-                break;
-            case IterationResult::ERROR_RESULT:
-                // LCOV_EXCL_START
-                updateFederateMode(Modes::ERROR_STATE);
-                break;
-                // LCOV_EXCL_STOP
-        }
+        timeRequestReturn(iterativeTime);
         return iterativeTime;
     }
     if (currentMode == Modes::FINALIZE || currentMode == Modes::FINISHED) {
@@ -800,11 +713,7 @@ void Federate::requestTimeIterativeAsync(Time nextInternalTimeStep, IterationReq
 {
     auto exp = Modes::EXECUTING;
     if (currentMode.compare_exchange_strong(exp, Modes::PENDING_ITERATIVE_TIME)) {
-        if (timeRequestEntryCallback) {
-            timeRequestEntryCallback(currentTime,
-                                     nextInternalTimeStep,
-                                     iterate != IterationRequest::NO_ITERATIONS);
-        }
+        timeRequestEntry(nextInternalTimeStep, iterate);
         auto asyncInfo = asyncCallInfo->lock();
         asyncInfo->timeRequestIterativeFuture =
             std::async(std::launch::async, [this, nextInternalTimeStep, iterate]() {
@@ -840,35 +749,88 @@ iteration_time Federate::requestTimeIterativeComplete()
     auto exp = Modes::PENDING_ITERATIVE_TIME;
     if (currentMode.compare_exchange_strong(exp, Modes::EXECUTING)) {
         auto iterativeTime = asyncInfo->timeRequestIterativeFuture.get();
-        switch (iterativeTime.state) {
-            case IterationResult::NEXT_STEP:
-                updateSimulationTime(iterativeTime.grantedTime, currentTime, false);
-                if (timeRequestReturnCallback) {
-                    timeRequestReturnCallback(iterativeTime.grantedTime, false);
-                }
-                break;
-            case IterationResult::ITERATING:
-                updateSimulationTime(iterativeTime.grantedTime, currentTime, true);
-                if (timeRequestReturnCallback) {
-                    timeRequestReturnCallback(iterativeTime.grantedTime, true);
-                }
-                break;
-            case IterationResult::HALTED:
-                updateFederateMode(Modes::FINISHED);
-                updateSimulationTime(iterativeTime.grantedTime, currentTime, false);
-                break;
-            case IterationResult::ERROR_RESULT:
-                // LCOV_EXCL_START
-                updateFederateMode(Modes::ERROR_STATE);
-                break;
-                // LCOV_EXCL_STOP
-        }
+        timeRequestReturn(iterativeTime);
         return iterativeTime;
     }
     throw(InvalidFunctionCall(
         "cannot call requestTimeIterativeComplete without first calling requestTimeIterativeAsync function"));
 }
 
+void Federate::initializingModeEntered()
+{
+    updateFederateMode(Modes::INITIALIZING);
+    currentTime = coreObject->getCurrentTime(fedID);
+    startupToInitializeStateTransition();
+}
+
+void Federate::executingModeEntered(IterationResult result)
+{
+    switch (result) {
+        case IterationResult::NEXT_STEP:
+            updateFederateMode(Modes::EXECUTING);
+            if (observerMode) {
+                currentTime = coreObject->getCurrentTime(fedID);
+            } else {
+                currentTime = timeZero;
+            }
+            if (timeUpdateCallback) {
+                timeUpdateCallback(currentTime, false);
+            }
+            initializeToExecuteStateTransition(IterationResult::NEXT_STEP);
+            if (timeRequestReturnCallback) {
+                timeRequestReturnCallback(currentTime, false);
+            }
+            break;
+        case IterationResult::ITERATING:
+            updateFederateMode(Modes::INITIALIZING);
+            currentTime = initializationTime;
+            initializeToExecuteStateTransition(IterationResult::ITERATING);
+            break;
+        case IterationResult::ERROR_RESULT:
+            // LCOV_EXCL_START
+            updateFederateMode(Modes::ERROR_STATE);
+            break;
+            // LCOV_EXCL_STOP
+        case IterationResult::HALTED:
+            updateFederateMode(Modes::FINISHED);
+            break;
+    }
+}
+
+void Federate::timeRequestEntry(Time nextTime, IterationRequest iterate)
+{
+    if (timeRequestEntryCallback) {
+        timeRequestEntryCallback(currentTime, nextTime, iterate != IterationRequest::NO_ITERATIONS);
+    }
+}
+
+void Federate::timeRequestReturn(iteration_time result)
+{
+    switch (result.state) {
+        case IterationResult::NEXT_STEP:
+            updateSimulationTime(result.grantedTime, currentTime, false);
+            if (timeRequestReturnCallback) {
+                timeRequestReturnCallback(result.grantedTime, false);
+            }
+            break;
+        case IterationResult::ITERATING:
+            updateSimulationTime(result.grantedTime, currentTime, true);
+            if (timeRequestReturnCallback) {
+                timeRequestReturnCallback(result.grantedTime, true);
+            }
+            break;
+        case IterationResult::HALTED:
+            updateFederateMode(Modes::FINISHED);
+            updateSimulationTime(result.grantedTime, currentTime, false);
+            break;
+        case IterationResult::ERROR_RESULT:
+            // LCOV_EXCL_START
+            updateFederateMode(Modes::ERROR_STATE);
+            break;
+            // LCOV_EXCL_STOP
+    }
+}
+
 void Federate::updateFederateMode(Modes newMode)
 {
     Modes oldMode = currentMode.load();
@@ -678,6 +678,16 @@ received
     /** function to generate results for a local Query
     @details should return an empty string if the query is not recognized*/
     virtual std::string localQuery(const std::string& queryStr) const;
+    /** function to deal with any operations that occur on a mode switch*/
+    void updateFederateMode(Modes newMode);
+    /** update the mode and time once the core has entered initializing mode*/
+    void initializingModeEntered();
+    /** update the mode and time once the core has returned from a request for executing mode*/
+    void executingModeEntered(IterationResult result);
+    /** run the time request entry callback before a time request is made to the core*/
+    void timeRequestEntry(Time nextTime, IterationRequest iterate);
+    /** update the mode and time once the core has returned from an iterative time request*/
+    void timeRequestReturn(iteration_time result);
 
   public:
     /** register a set of interfaces defined in a file
@@ -743,8 +753,6 @@ received
     void completeOperation();
 
   private:
-    /** function to deal with any operations that occur on a mode switch*/
-    void updateFederateMode(Modes newMode);
     /** function to deal with any operations that need to occur on a time update*/
     void updateSimulationTime(Time newTime, Time oldTime, bool iterating);
     /** register connector(filters,translators) interfaces defined in  file or string
@@ -113,7 +113,10 @@ static const std::unordered_map<std::string, int> propStringsTranslations{
     {"int_max_iterations", HELICS_PROPERTY_INT_MAX_ITERATIONS},
     {"logbuffer", HELICS_PROPERTY_INT_LOG_BUFFER},
     {"logBuffer", HELICS_PROPERTY_INT_LOG_BUFFER},
-    {"log_buffer", HELICS_PROPERTY_INT_LOG_BUFFER}};
+    {"log_buffer", HELICS_PROPERTY_INT_LOG_BUFFER},
+    {"waitpolicy", HELICS_PROPERTY_INT_WAIT_POLICY},
+    {"wait_policy", HELICS_PROPERTY_INT_WAIT_POLICY},
+    {"waitPolicy", HELICS_PROPERTY_INT_WAIT_POLICY}};
 
 static const std::unordered_map<std::string, int> flagStringsTranslations{
     {"source_only", HELICS_FLAG_SOURCE_ONLY},
@@ -236,6 +239,9 @@ static const std::unordered_map<std::string, int> optionStringsTranslations{
     {"strictinputtypechecking", HELICS_HANDLE_OPTION_STRICT_TYPE_CHECKING},
     {"strictInputTypeChecking", HELICS_HANDLE_OPTION_STRICT_TYPE_CHECKING},
     {"connections", HELICS_HANDLE_OPTION_CONNECTIONS},
+    {"delta_encoding", HELICS_HANDLE_OPTION_DELTA_ENCODING},
+    {"deltaencoding", HELICS_HANDLE_OPTION_DELTA_ENCODING},
+    {"deltaEncoding", HELICS_HANDLE_OPTION_DELTA_ENCODING},
     {"clear_priority_list", HELICS_HANDLE_OPTION_CLEAR_PRIORITY_LIST},
     {"clearPriorityList", HELICS_HANDLE_OPTION_CLEAR_PRIORITY_LIST},
     {"clearprioritylist", HELICS_HANDLE_OPTION_CLEAR_PRIORITY_LIST},
@@ -295,6 +301,12 @@ static const std::map<std::string, int> log_level_map{{"none", HELICS_LOG_LEVEL_
                                                       /** all internal messages*/
                                                       {"trace", HELICS_LOG_LEVEL_TRACE}};
 
+static const std::map<std::string, int> wait_policy_map{
+    {"block", HELICS_WAIT_POLICY_BLOCK},
+    {"spin", HELICS_WAIT_POLICY_SPIN},
+    {"spin_yield", HELICS_WAIT_POLICY_SPIN_YIELD},
+    {"adaptive", HELICS_WAIT_POLICY_ADAPTIVE}};
+
 static void loadFlags(FederateInfo& fi, const std::string& flags)
 {
     auto sflgs = gmlc::utilities::stringOps::splitline(flags);
@@ -607,6 +619,12 @@ std::unique_ptr<helicsCLI11App> FederateInfo::makeCLIApp()
 
         ->transform(CLI::IsMember(&log_level_map, CLI::ignore_case, CLI::ignore_underscore))
         ->envname("HELICS_LOG_LEVEL");
+    app->add_option_function<int>(
+           "--wait_policy",
+           [this](int val) { setProperty(HELICS_PROPERTY_INT_WAIT_POLICY, val); },
+           "how the federate waits for messages while blocked in a time or mode request (block, spin, spin_yield, adaptive)")
+        ->transform(
+            CLI::CheckedTransformer(&wait_policy_map, CLI::ignore_case, CLI::ignore_underscore));
 
     app->add_option("--separator", separator, "separator character for local federates")
         ->default_str(std::string(1, separator));
@@ -31,6 +31,8 @@ DelayFilterOperation::DelayFilterOperation(Time delayTime): delay(delayTime)
     }
     td = std::make_shared<MessageTimeOperator>(
         [this](Time messageTime) { return messageTime + delay; });
+    // the delay is atomic so the operation can run on any thread
+    td->setStateless();
 }
 
 void DelayFilterOperation::set(const std::string& property, double val)
@@ -212,6 +214,8 @@ RandomDelayFilterOperation::RandomDelayFilterOperation():
         [this](Time messageTime) { return messageTime + rdelayGen->generate(); })),
     rdelayGen(std::make_unique<randomDelayGenerator>())
 {
+    // the generators are thread local and the parameters atomic
+    td->setStateless();
 }
 RandomDelayFilterOperation::~RandomDelayFilterOperation() = default;
 
@@ -253,6 +257,7 @@ RandomDropFilterOperation::RandomDropFilterOperation():
         return (randDouble(random_dists_t::bernoulli, (1.0 - dropProb), 1.0) > 0.1);
     }))
 {
+    tcond->setStateless();
 }
 
 RandomDropFilterOperation::~RandomDropFilterOperation() = default;
@@ -278,6 +283,7 @@ RerouteFilterOperation::RerouteFilterOperation():
             return rerouteOperation(src, dest);
         }))
 {
+    op->setStateless();
 }
 
 RerouteFilterOperation::~RerouteFilterOperation() = default;
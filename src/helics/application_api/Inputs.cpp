@@ -10,6 +10,7 @@ SPDX-License-Identifier: BSD-3-Clause
 #include "../common/JsonProcessingFunctions.hpp"
 #include "../core/core-exceptions.hpp"
 #include "ValueFederate.hpp"
+#include "reductionOperations.hpp"
 #include "units/units.hpp"
 
 #include <algorithm>
@@ -396,6 +397,10 @@ bool Input::vectorDataProcess(const std::vector<std::shared_ptr<const SmallBuffe
         loadSourceInformation();
         prevInputCount = static_cast<int32_t>(dataV.size());
     }
+    defV result;
+    if (reduceDoubleData(dataV, result)) {
+        return storeMultiInputResult(result);
+    }
     std::vector<defV> res;
     res.reserve(dataV.size());
     for (size_t ii = 0; ii < dataV.size(); ++ii) {
@@ -448,7 +453,6 @@ bool Input::vectorDataProcess(const std::vector<std::shared_ptr<const SmallBuffe
     for (auto& ival : res) {
         valueConvert(ival, type);
     }
-    defV result;
     switch (inputVectorOp) {
         case MultiInputHandlingMethod::MAX_OPERATION:
             result = maxOperation(res);
@@ -497,6 +501,85 @@ bool Input::vectorDataProcess(const std::vector<std::shared_ptr<const SmallBuffe
         default:
             break;
     }
+    return storeMultiInputResult(result);
+}
+
+bool Input::reduceDoubleData(const std::vector<std::shared_ptr<const SmallBuffer>>& dataV,
+                             defV& result)
+{
+    bool scalarOnly{false};
+    switch (inputVectorOp) {
+        case MultiInputHandlingMethod::SUM_OPERATION:
+        case MultiInputHandlingMethod::AVERAGE_OPERATION:
+            break;
+        case MultiInputHandlingMethod::MAX_OPERATION:
+        case MultiInputHandlingMethod::MIN_OPERATION:
+            // vectors are compared by their norm in the general processing
+            if (targetType != DataType::HELICS_DOUBLE && targetType != DataType::HELICS_UNKNOWN) {
+                return false;
+            }
+            scalarOnly = true;
+            break;
+        case MultiInputHandlingMethod::VECTORIZE_OPERATION:
+            if (targetType == DataType::HELICS_STRING || targetType == DataType::HELICS_COMPLEX ||
+                targetType == DataType::HELICS_COMPLEX_VECTOR) {
+                return false;
+            }
+            break;
+        default:
+            return false;
+    }
+    auto sourceType = [this](std::size_t index) {
+        return (injectionType == helics::DataType::HELICS_MULTI) ? sourceTypes[index].first :
+                                                                    injectionType;
+    };
+    for (size_t ii = 0; ii < dataV.size(); ++ii) {
+        if (dataV[ii]) {
+            auto localType = sourceType(ii);
+            if (localType != DataType::HELICS_DOUBLE &&
+                (scalarOnly || localType != DataType::HELICS_VECTOR)) {
+                return false;
+            }
+        }
+    }
+    // reused between calls to avoid an allocation on each evaluation
+    thread_local std::vector<double> buffer;
+    buffer.clear();
+    for (size_t ii = 0; ii < dataV.size(); ++ii) {
+        if (!dataV[ii]) {
+            continue;
+        }
+        if (sourceType(ii) == DataType::HELICS_DOUBLE) {
+            const auto& localUnits = (multiUnits) ? sourceTypes[ii].second : inputUnits;
+            buffer.push_back(doubleExtractAndConvert(*dataV[ii], localUnits, outputUnits));
+        } else {
+            reduction::appendVectorData(*dataV[ii], buffer);
+        }
+    }
+    switch (inputVectorOp) {
+        case MultiInputHandlingMethod::SUM_OPERATION:
+            result = reduction::sum(buffer.data(), buffer.size());
+            break;
+        case MultiInputHandlingMethod::AVERAGE_OPERATION:
+            result =
+                reduction::sum(buffer.data(), buffer.size()) / static_cast<double>(buffer.size());
+            break;
+        case MultiInputHandlingMethod::MAX_OPERATION:
+            result = reduction::max(buffer.data(), buffer.size());
+            break;
+        case MultiInputHandlingMethod::MIN_OPERATION:
+            result = reduction::min(buffer.data(), buffer.size());
+            break;
+        case MultiInputHandlingMethod::VECTORIZE_OPERATION:
+        default:
+            result = std::vector<double>(buffer.begin(), buffer.end());
+            break;
+    }
+    return true;
+}
+
+bool Input::storeMultiInputResult(defV& result)
+{
     if (changeDetectionEnabled) {
         if (changeDetected(lastValue, result, delta)) {
             lastValue = result;
@@ -770,8 +853,59 @@ void integerExtractAndConvert(defV& store,
 
 data_view Input::checkAndGetFedUpdate()
 {
-    return (fed->isUpdated(*this) || allowDirectFederateUpdate()) ? (fed->getBytes(*this)) :
-                                                                    data_view{};
+    if (fed->isUpdated(*this) || allowDirectFederateUpdate()) {
+        lastValueOutdated = false;
+        return fed->getBytes(*this);
+    }
+    return data_view{};
+}
+
+data_view Input::getViewableData(DataType viewType)
+{
+    if (changeDetectionEnabled || inputVectorOp != MultiInputHandlingMethod::NO_OP) {
+        return data_view{};
+    }
+    auto dv = fed->getBytes(*this);
+    if (dv.empty()) {
+        return dv;
+    }
+    // the data is marked as read so make sure the next getValue call picks it up
+    hasUpdate = false;
+    lastValueOutdated = true;
+    if (injectionType == DataType::HELICS_UNKNOWN) {
+        loadSourceInformation();
+    }
+    return (injectionType == viewType) ? dv : data_view{};
+}
+
+array_view<double> Input::getVectorView()
+{
+    auto dv = getViewableData(DataType::HELICS_VECTOR);
+    array_view<double> view;
+    if (!dv.empty() && detail::viewBinary(dv.bytes(), dv.size(), view)) {
+        return view;
+    }
+    return getValueRef<std::vector<double>>();
+}
+
+array_view<std::complex<double>> Input::getComplexVectorView()
+{
+    auto dv = getViewableData(DataType::HELICS_COMPLEX_VECTOR);
+    array_view<std::complex<double>> view;
+    if (!dv.empty() && detail::viewBinary(dv.bytes(), dv.size(), view)) {
+        return view;
+    }
+    return getValueRef<std::vector<std::complex<double>>>();
+}
+
+std::string_view Input::getStringView()
+{
+    auto dv = getViewableData(DataType::HELICS_STRING);
+    std::string_view view;
+    if (!dv.empty() && detail::viewBinary(dv.bytes(), dv.size(), view)) {
+        return view;
+    }
+    return getValueRef<std::string>();
 }
 
 void Input::forceCoreDataUpdate()
@@ -8,10 +8,12 @@ SPDX-License-Identifier: BSD-3-Clause
 
 #include "Federate.hpp"
 #include "HelicsPrimaryTypes.hpp"
+#include "array_view.hpp"
 #include "helicsTypes.hpp"
 
 #include <memory>
 #include <string>
+#include <string_view>
 #include <utility>
 #include <vector>
 
@@ -50,6 +52,7 @@ class HELICS_CXX_EXPORT Input: public Interface {
     bool disableAssign{false};  //!< disable assignment for the object
     bool useThreshold{false};  //!< flag to indicate use a threshold for binary output
     bool multiUnits{false};  //!< flag indicating there are multiple Input Units
+    bool lastValueOutdated{false};  //!< data was read through a view without updating lastValue
     MultiInputHandlingMethod inputVectorOp{
         MultiInputHandlingMethod::NO_OP};  //!< the vector processing method to use
     int32_t prevInputCount{0};  //!< the previous number of inputs
@@ -383,6 +386,19 @@ class HELICS_CXX_EXPORT Input: public Interface {
     /** get the current value as a string*/
     const std::string& getString() { return getValueRef<std::string>(); }
 
+    /** get a view of the current value as a vector of doubles
+    @details if the publication sends a vector of doubles the view refers to the received data
+    without copying it, otherwise the value is converted as in getValue and the view refers to the
+    converted value.  The view is valid until the next time request or the next call retrieving a
+    value from the input*/
+    array_view<double> getVectorView();
+    /** get a view of the current value as a vector of complex values
+    @details follows the same rules as getVectorView for complex vector publications*/
+    array_view<std::complex<double>> getComplexVectorView();
+    /** get a view of the current value as a string
+    @details follows the same rules as getVectorView for string publications*/
+    std::string_view getStringView();
+
     /** get the raw binary data*/
     data_view getBytes();
     /** get the size of the raw data*/
@@ -415,15 +431,23 @@ class HELICS_CXX_EXPORT Input: public Interface {
   private:
     /** load some information about the data source such as type and units*/
     void loadSourceInformation();
+    /** evaluate a multi-input operation on double and vector sources using the reduction kernels
+    @return false if the sources or operation require the general processing*/
+    bool reduceDoubleData(const std::vector<std::shared_ptr<const SmallBuffer>>& dataV,
+                          defV& result);
+    /** store the result of a multi-input operation and check if it is an update*/
+    bool storeMultiInputResult(defV& result);
     /** helper class for getting a character since that is a bit odd*/
     char getValueChar();
     /** check if updates from the federate are allowed*/
     bool allowDirectFederateUpdate() const
     {
-        return hasUpdate && !changeDetectionEnabled &&
+        return (hasUpdate || lastValueOutdated) && !changeDetectionEnabled &&
             inputVectorOp == MultiInputHandlingMethod::NO_OP;
     }
     data_view checkAndGetFedUpdate();
+    /** get the latest data if the publication type matches a type that can be viewed directly*/
+    data_view getViewableData(DataType viewType);
     void forceCoreDataUpdate();
     friend class ValueFederateManager;
 };
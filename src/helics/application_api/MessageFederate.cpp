@@ -294,6 +294,15 @@ std::unique_ptr<Message> MessageFederate::getMessage(const Endpoint& ept)
     return nullptr;
 }
 
+std::vector<std::unique_ptr<Message>> MessageFederate::getMessages(const Endpoint& ept,
+                                                                   std::size_t maxCount)
+{
+    if (currentMode >= Modes::INITIALIZING) {
+        return mfManager->getMessages(ept, maxCount);
+    }
+    return {};
+}
+
 Endpoint& MessageFederate::getEndpoint(const std::string& eptName) const
 {
     auto& id = mfManager->getEndpoint(eptName);
@@ -14,6 +14,7 @@ SPDX-License-Identifier: BSD-3-Clause
 #include <memory>
 #include <string>
 #include <string_view>
+#include <vector>
 
 namespace helics {
 class MessageFederateManager;
@@ -184,6 +185,11 @@ class HELICS_CXX_EXPORT MessageFederate:
     @param ept the identifier for the endpoint
     @return a message object*/
     std::unique_ptr<Message> getMessage(const Endpoint& ept);
+    /** receive the available messages from a particular endpoint
+    @param ept the identifier for the endpoint
+    @param maxCount the maximum number of messages to return
+    @return a vector of the messages in the order they would be returned by getMessage*/
+    std::vector<std::unique_ptr<Message>> getMessages(const Endpoint& ept, std::size_t maxCount);
     /** receive a communication message for any endpoint in the federate
     @details the return order will be in order of endpoint creation then order of arrival
     all messages for the first endpoint, then all for the second, and so on
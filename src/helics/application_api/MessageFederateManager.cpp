@@ -11,6 +11,7 @@ SPDX-License-Identifier: BSD-3-Clause
 #include "../core/queryHelpers.hpp"
 #include "helics/core/core-exceptions.hpp"
 
+#include <algorithm>
 #include <cassert>
 #include <string>
 
@@ -150,6 +151,24 @@ std::unique_ptr<Message> MessageFederateManager::getMessage(const Endpoint& ept)
     return nullptr;
 }
 
+std::vector<std::unique_ptr<Message>> MessageFederateManager::getMessages(const Endpoint& ept,
+                                                                          std::size_t maxCount)
+{
+    std::vector<std::unique_ptr<Message>> messages;
+    if (ept.dataReference != nullptr) {
+        auto* eptDat = reinterpret_cast<EndpointData*>(ept.dataReference);
+        messages.reserve(std::min(maxCount, eptDat->messages.size()));
+        while (messages.size() < maxCount) {
+            auto mv = eptDat->messages.pop();
+            if (!mv) {
+                break;
+            }
+            messages.push_back(std::move(*mv));
+        }
+    }
+    return messages;
+}
+
 std::unique_ptr<Message> MessageFederateManager::getMessage()
 {
     // just start with the first endpoint and check until a queue isn't empty
@@ -68,6 +68,9 @@ class MessageFederateManager {
     @param ept the identifier for the endpoint
     @return a message object*/
     static std::unique_ptr<Message> getMessage(const Endpoint& ept);
+    /** receive up to maxCount messages from a specific endpoint*/
+    static std::vector<std::unique_ptr<Message>> getMessages(const Endpoint& ept,
+                                                             std::size_t maxCount);
     /* receive a communication message for any endpoint in the federate*/
     std::unique_ptr<Message> getMessage();
 
@@ -11,6 +11,7 @@ SPDX-License-Identifier: BSD-3-Clause
 #include "ValueFederate.hpp"
 #include "units/units.hpp"
 
+#include <cmath>
 #include <memory>
 #include <string>
 #include <utility>
@@ -185,6 +186,9 @@ void Publication::publish(const std::vector<double>& val)
 {
     bool doPublish = true;
     if (changeDetectionEnabled) {
+        if (publishDeadband(val.data(), val.size())) {
+            return;
+        }
         if (changeDetected(prevValue, val, delta)) {
             prevValue = val;
         } else {
@@ -217,6 +221,9 @@ void Publication::publish(const double* vals, int size)
 {
     bool doPublish = true;
     if (changeDetectionEnabled) {
+        if (publishDeadband(vals, static_cast<std::size_t>(size))) {
+            return;
+        }
         if (changeDetected(prevValue, vals, size, delta)) {
             prevValue = std::vector<double>(vals, vals + size);
         } else {
@@ -229,6 +236,31 @@ void Publication::publish(const double* vals, int size)
     }
 }
 
+bool Publication::publishDeadband(const double* vals, std::size_t size)
+{
+    if (prevValue.index() != vector_loc) {
+        return false;
+    }
+    auto& prevV = std::get<std::vector<double>>(prevValue);
+    // the option can be set through the configuration or directly on the core so it is read from
+    // the core rather than tracked here
+    if (prevV.size() != size || getOption(HELICS_HANDLE_OPTION_DELTA_ENCODING) == 0) {
+        return false;
+    }
+    bool changed{false};
+    for (std::size_t ii = 0; ii < size; ++ii) {
+        if (std::abs(prevV[ii] - vals[ii]) > delta) {
+            prevV[ii] = vals[ii];
+            changed = true;
+        }
+    }
+    if (changed) {
+        auto db = typeConvert(pubType, prevV);
+        fed->publishBytes(*this, db);
+    }
+    return true;
+}
+
 void Publication::publishComplex(const double* vals, int size)
 {
     if (changeDetectionEnabled) {
@@ -232,6 +232,9 @@ class HELICS_CXX_EXPORT Publication: public Interface {
     }
 
     /** set the level by which a value must have changed to actually publish the value
+    @details with delta encoding enabled the elements of vectors of doubles are compared
+    individually and only the elements that changed by more than the minimum are updated, the
+    others keep their previously published values
      */
     void setMinimumChange(double deltaV) noexcept
     {
@@ -252,6 +255,9 @@ class HELICS_CXX_EXPORT Publication: public Interface {
     virtual const std::string& getDisplayName() const override { return getName(); }
 
   private:
+    /** publish a vector of doubles applying the minimum change to each element
+    @return false if the previous value can't be used and the vector must be handled in full*/
+    bool publishDeadband(const double* vals, std::size_t size);
     /** implementation of the integer publications
     @details this is the same as the other publish function but is used in the template due to
     template overload resolution rules I wanted to be able to call this inside a template which took
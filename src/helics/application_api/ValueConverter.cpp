@@ -11,6 +11,7 @@ SPDX-License-Identifier: BSD-3-Clause
 #include "../common/frozen_map.h"
 
 #include <complex>
+#include <cstdint>
 #include <vector>
 
 namespace helics {
@@ -308,9 +309,52 @@ namespace detail {
             }
         }
     }
+
+    bool viewBinary(const std::byte* data, size_t size, array_view<std::complex<double>>& val)
+    {
+        if (size < 8 || data[0] != cvCode) {
+            return false;
+        }
+        std::size_t count = getDataSize(data);
+        if (count * sizeof(std::complex<double>) + 8U > size ||
+            reinterpret_cast<std::uintptr_t>(data + 8) % alignof(std::complex<double>) != 0) {
+            return false;
+        }
+        val = array_view<std::complex<double>>(
+            reinterpret_cast<const std::complex<double>*>(data + 8), count);
+        return true;
+    }
 #if defined(__GNUC__)
 #    pragma GCC diagnostic pop
 #endif
+
+    bool viewBinary(const std::byte* data, size_t size, array_view<double>& val)
+    {
+        // only data in the byte order of the machine can be used in place
+        if (size < 8 || data[0] != vectorCode) {
+            return false;
+        }
+        std::size_t count = getDataSize(data);
+        if (count * sizeof(double) + 8U > size ||
+            reinterpret_cast<std::uintptr_t>(data + 8) % alignof(double) != 0) {
+            return false;
+        }
+        val = array_view<double>(reinterpret_cast<const double*>(data + 8), count);
+        return true;
+    }
+
+    bool viewBinary(const std::byte* data, size_t size, std::string_view& val)
+    {
+        if (size < 8 || data[0] != stringCode) {
+            return false;
+        }
+        std::size_t count = getDataSize(data);
+        if (count + 8U > size) {
+            return false;
+        }
+        val = std::string_view(reinterpret_cast<const char*>(data) + 8, count);
+        return true;
+    }
 }  // namespace detail
 
 void ValueConverter<std::vector<std::string>>::convert(const std::vector<std::string>& val,
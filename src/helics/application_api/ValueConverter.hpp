@@ -13,12 +13,14 @@ algorithms
 */
 
 #include "../core/SmallBuffer.hpp"
+#include "array_view.hpp"
 #include "data_view.hpp"
 #include "helicsTypes.hpp"
 #include "helics_cxx_export.h"
 
 #include <cstddef>
 #include <string>
+#include <string_view>
 #include <utility>
 #include <vector>
 
@@ -106,6 +108,19 @@ namespace detail {
     @details this returns the number of elements of the specific data type  it is NOT in bytes
     */
     HELICS_CXX_EXPORT size_t getDataSize(const std::byte* data);
+
+    /** view the values in a serialized vector of doubles without copying them
+    @details this only works if the data has the vector type code, the byte order of the machine,
+    and is suitably aligned
+    @return false if the data cannot be viewed directly*/
+    HELICS_CXX_EXPORT bool viewBinary(const std::byte* data, size_t size, array_view<double>& val);
+    /** view the values in a serialized vector of complex values without copying them
+    @return false if the data cannot be viewed directly*/
+    HELICS_CXX_EXPORT bool
+        viewBinary(const std::byte* data, size_t size, array_view<std::complex<double>>& val);
+    /** view the characters of a serialized string without copying them
+    @return false if the data is not a string*/
+    HELICS_CXX_EXPORT bool viewBinary(const std::byte* data, size_t size, std::string_view& val);
 }  // namespace detail
 
 /** converter for a basic value*/
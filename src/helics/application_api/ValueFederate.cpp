@@ -19,6 +19,7 @@ SPDX-License-Identifier: BSD-3-Clause
 #include <deque>
 #include <memory>
 #include <string>
+#include <unordered_map>
 #include <utility>
 #include <vector>
 
@@ -179,6 +180,12 @@ void ValueFederate::setDefaultValue(const Input& inp, data_view block)  // NOLIN
     vfManager->setDefaultValue(inp, block);
 }
 
+std::vector<Interface*> ValueFederate::registerGlobalValueInterfaces(
+    const std::vector<ValueInterfaceDefinition>& interfaces)
+{
+    return vfManager->registerInterfaces(interfaces);
+}
+
 void ValueFederate::registerInterfaces(const std::string& configString)
 {
     registerValueInterfaces(configString);
@@ -240,70 +247,123 @@ void ValueFederate::registerValueInterfacesJson(const std::string& jsonString)
     auto doc = fileops::loadJson(jsonString);
     bool defaultGlobal = false;
     fileops::replaceIfMember(doc, "defaultglobal", defaultGlobal);
+
+    // the new interfaces are collected and registered as a single block, the options are loaded
+    // once all the interfaces exist
+    std::vector<ValueInterfaceDefinition> definitions;
+    std::unordered_map<std::string, std::size_t> pubIndex;
+    std::unordered_map<std::string, std::size_t> subIndex;
+    std::unordered_map<std::string, std::size_t> inpIndex;
+    std::vector<std::pair<Interface*, std::size_t>> pubObjects;
+    std::vector<std::pair<Interface*, std::size_t>> subObjects;
+    std::vector<std::pair<Interface*, std::size_t>> inpObjects;
+    static constexpr std::size_t existing{static_cast<std::size_t>(-1)};
+
+    auto getDefinition = [&definitions](bool input, const auto& data, std::string key) {
+        ValueInterfaceDefinition def;
+        def.input = input;
+        def.key = std::move(key);
+        def.type = fileops::getOrDefault(data, "type", emptyStr);
+        def.units = fileops::getOrDefault(data, "unit", emptyStr);
+        fileops::replaceIfMember(data, "units", def.units);
+        definitions.push_back(std::move(def));
+        return definitions.size() - 1;
+    };
+    auto localKey = [this](const std::string& name, bool global) {
+        return (global || name.empty()) ? name : (getName() + nameSegmentSeparator + name);
+    };
+
+    Json::Value pubs;
+    Json::Value subs;
+    Json::Value ipts;
     if (doc.isMember("publications")) {
-        auto pubs = doc["publications"];
+        pubs = doc["publications"];
         for (const auto& pub : pubs) {
             auto name = fileops::getName(pub);
-
             Publication* pubAct = &vfManager->getPublication(name);
-            if (!pubAct->isValid()) {
-                auto type = fileops::getOrDefault(pub, "type", emptyStr);
-                auto units = fileops::getOrDefault(pub, "unit", emptyStr);
-                fileops::replaceIfMember(pub, "units", units);
-                bool global = fileops::getOrDefault(pub, "global", defaultGlobal);
-                if (global) {
-                    pubAct = &registerGlobalPublication(name, type, units);
-                } else {
-                    pubAct = &registerPublication(name, type, units);
-                }
+            if (pubAct->isValid()) {
+                pubObjects.emplace_back(pubAct, existing);
+                continue;
             }
-
-            loadOptions(this, pub, *pubAct);
+            auto key = localKey(name, fileops::getOrDefault(pub, "global", defaultGlobal));
+            auto loc = pubIndex.find(key);
+            if (loc != pubIndex.end() && !key.empty()) {
+                pubObjects.emplace_back(nullptr, loc->second);
+                continue;
+            }
+            auto index = getDefinition(false, pub, key);
+            pubIndex.emplace(std::move(key), index);
+            pubObjects.emplace_back(nullptr, index);
         }
     }
     if (doc.isMember("subscriptions")) {
-        auto subs = doc["subscriptions"];
+        subs = doc["subscriptions"];
         for (const auto& sub : subs) {
-            bool skipNameTarget{false};
             auto name = fileops::getName(sub);
             if (name.empty()) {
                 fileops::replaceIfMember(sub, "target", name);
-                skipNameTarget = true;
             }
             auto* subAct = &vfManager->getSubscription(name);
-            if (!subAct->isValid()) {
-                auto type = fileops::getOrDefault(sub, "type", emptyStr);
-                auto units = fileops::getOrDefault(sub, "unit", emptyStr);
-                fileops::replaceIfMember(sub, "units", units);
-                subAct = &registerInput(emptyStr, type, units);
-                if (!skipNameTarget) {
-                    // this check is to prevent some warnings since targets get added later
-                    subAct->addTarget(name);
-                }
+            if (subAct->isValid()) {
+                subObjects.emplace_back(subAct, existing);
+                continue;
             }
-            loadOptions(this, sub, *subAct);
+            auto loc = subIndex.find(name);
+            if (loc != subIndex.end() && !name.empty()) {
+                subObjects.emplace_back(nullptr, loc->second);
+                continue;
+            }
+            auto index = getDefinition(true, sub, std::string{});
+            subIndex.emplace(name, index);
+            subObjects.emplace_back(nullptr, index);
         }
     }
     if (doc.isMember("inputs")) {
-        auto ipts = doc["inputs"];
+        ipts = doc["inputs"];
         for (const auto& ipt : ipts) {
             auto name = fileops::getName(ipt);
-
             Input* inp = &vfManager->getInput(name);
-            if (!inp->isValid()) {
-                auto type = fileops::getOrDefault(ipt, "type", emptyStr);
-                auto units = fileops::getOrDefault(ipt, "unit", emptyStr);
-                fileops::replaceIfMember(ipt, "units", units);
-                bool global = fileops::getOrDefault(ipt, "global", defaultGlobal);
-                if (global) {
-                    inp = &registerGlobalInput(name, type, units);
-                } else {
-                    inp = &registerInput(name, type, units);
-                }
+            if (inp->isValid()) {
+                inpObjects.emplace_back(inp, existing);
+                continue;
             }
+            auto key = localKey(name, fileops::getOrDefault(ipt, "global", defaultGlobal));
+            auto loc = inpIndex.find(key);
+            if (loc != inpIndex.end() && !key.empty()) {
+                inpObjects.emplace_back(nullptr, loc->second);
+                continue;
+            }
+            auto index = getDefinition(true, ipt, key);
+            inpIndex.emplace(std::move(key), index);
+            inpObjects.emplace_back(nullptr, index);
+        }
+    }
+    std::vector<Interface*> created;
+    if (!definitions.empty()) {
+        created = vfManager->registerInterfaces(std::move(definitions));
+    }
+    auto getObject = [&created](const std::pair<Interface*, std::size_t>& obj) {
+        return (obj.second == existing) ? obj.first : created[obj.second];
+    };
 
-            loadOptions(this, ipt, *inp);
+    std::size_t ii{0};
+    for (const auto& pub : pubs) {
+        loadOptions(this, pub, *static_cast<Publication*>(getObject(pubObjects[ii++])));
+    }
+    ii = 0;
+    for (const auto& sub : subs) {
+        const auto& obj = subObjects[ii++];
+        auto* subAct = static_cast<Input*>(getObject(obj));
+        auto name = fileops::getName(sub);
+        if (obj.second != existing && !name.empty()) {
+            // this check is to prevent some warnings since targets get added later
+            subAct->addTarget(name);
         }
+        loadOptions(this, sub, *subAct);
+    }
+    ii = 0;
+    for (const auto& ipt : ipts) {
+        loadOptions(this, ipt, *static_cast<Input*>(getObject(inpObjects[ii++])));
     }
 }
 
@@ -302,6 +302,16 @@ class HELICS_CXX_EXPORT ValueFederate:
     */
     void setDefaultValue(const Input& inp, data_view block);
 
+    /** register a block of publications and inputs in a single operation
+    @details call is only valid in startup mode, the names are used as given like the global
+    registration functions. The block is registered with the core and sent to the broker together
+    which is much faster than individual registration for large numbers of interfaces
+    @param interfaces the definitions of the publications and inputs
+    @return pointers to the Publication or Input objects in the order of the definitions
+    */
+    std::vector<Interface*>
+        registerGlobalValueInterfaces(const std::vector<ValueInterfaceDefinition>& interfaces);
+
     /** register a set of interfaces defined in a file
     @details call is only valid in startup mode to add an TOML files must have extension .toml or
     .TOML
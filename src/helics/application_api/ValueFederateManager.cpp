@@ -107,6 +107,68 @@ Input& ValueFederateManager::registerInput(const std::string& key,
     throw(RegistrationFailure("Unable to register Input"));
 }
 
+std::vector<Interface*>
+    ValueFederateManager::registerInterfaces(std::vector<ValueInterfaceDefinition> definitions)
+{
+    for (auto& def : definitions) {
+        def.type = useJsonSerialization ? jsonStringType : getCleanedTypeName(def.type);
+    }
+    auto coreIDs = coreObject->registerValueInterfaces(fedID, definitions);
+    std::vector<Interface*> interfaces(definitions.size(), nullptr);
+    {
+        auto pubHandle = publications.lock();
+        for (std::size_t ii = 0; ii < definitions.size(); ++ii) {
+            const auto& def = definitions[ii];
+            if (def.input) {
+                continue;
+            }
+            decltype(pubHandle->insert(
+                def.key, coreIDs[ii], fed, coreIDs[ii], def.key, def.type, def.units)) active;
+            if (!def.key.empty()) {
+                active = pubHandle->insert(
+                    def.key, coreIDs[ii], fed, coreIDs[ii], def.key, def.type, def.units);
+            } else {
+                active = pubHandle->insert(
+                    no_search, coreIDs[ii], fed, coreIDs[ii], def.key, def.type, def.units);
+            }
+            if (!active) {
+                throw(RegistrationFailure("Unable to register Publication"));
+            }
+            interfaces[ii] = &pubHandle->back();
+        }
+    }
+    auto inpHandle = inputs.lock();
+    auto datHandle = inputData.lock();
+    for (std::size_t ii = 0; ii < definitions.size(); ++ii) {
+        const auto& def = definitions[ii];
+        if (!def.input) {
+            continue;
+        }
+        decltype(inpHandle->insert(def.key, coreIDs[ii], fed, coreIDs[ii], def.key, def.units))
+            active;
+        if (!def.key.empty()) {
+            active = inpHandle->insert(def.key, coreIDs[ii], fed, coreIDs[ii], def.key, def.units);
+        } else {
+            active =
+                inpHandle->insert(no_search, coreIDs[ii], fed, coreIDs[ii], def.key, def.units);
+        }
+        if (!active) {
+            throw(RegistrationFailure("Unable to register Input"));
+        }
+        auto& ref = inpHandle->back();
+        auto edat = std::make_unique<input_info>(def.key, def.type, def.units);
+        // non-owning pointer
+        ref.dataReference = edat.get();
+        datHandle->push_back(std::move(edat));
+        ref.referenceIndex = static_cast<int>(datHandle->size() - 1);
+        if (useJsonSerialization) {
+            ref.targetType = DataType::HELICS_JSON;
+        }
+        interfaces[ii] = &ref;
+    }
+    return interfaces;
+}
+
 void ValueFederateManager::addAlias(const Input& inp, const std::string& shortcutName)
 {
     if (inp.isValid()) {
@@ -74,6 +74,11 @@ class ValueFederateManager {
     @details call is only valid in startup mode
     */
     Input& registerInput(const std::string& key, std::string type, const std::string& units);
+    /** register a block of publications and inputs with a single core operation
+    @details call is only valid in startup mode
+    @return pointers to the Publication or Input objects in the order of the definitions
+    */
+    std::vector<Interface*> registerInterfaces(std::vector<ValueInterfaceDefinition> definitions);
 
     /** add a shortcut for locating a subscription
     @details primarily for use in looking up an id from a different location
@@ -0,0 +1,52 @@
+/*
+Copyright (c) 2017-2022,
+Battelle Memorial Institute; Lawrence Livermore National Security, LLC; Alliance for Sustainable
+Energy, LLC.  See the top-level NOTICE for additional details. All rights reserved.
+SPDX-License-Identifier: BSD-3-Clause
+*/
+#pragma once
+
+#include <cstddef>
+#include <vector>
+
+namespace helics {
+/** class containing a constant view of a contiguous array of values
+@details the view does not own the data, it is used to access vector values without copying them
+*/
+template<class X>
+class array_view {
+  private:
+    const X* dataPtr{nullptr};  //!< pointer to the first element
+    std::size_t count{0};  //!< the number of elements
+  public:
+    using value_type = X;
+    using const_iterator = const X*;
+    /** default constructor*/
+    constexpr array_view() noexcept = default;
+    /** construct from a pointer and number of elements*/
+    constexpr array_view(const X* data, std::size_t size) noexcept: dataPtr(data), count(size) {}
+    /** construct from a vector*/
+    array_view(const std::vector<X>& vec) noexcept:  // NOLINT
+        dataPtr(vec.data()), count(vec.size())
+    {
+    }
+    /** get a pointer to the first element*/
+    constexpr const X* data() const noexcept { return dataPtr; }
+    /** get the number of elements*/
+    constexpr std::size_t size() const noexcept { return count; }
+    /** check if the view is empty*/
+    constexpr bool empty() const noexcept { return count == 0; }
+    /** random access operator*/
+    constexpr const X& operator[](std::size_t index) const { return dataPtr[index]; }
+    /** get the first element*/
+    constexpr const X& front() const { return dataPtr[0]; }
+    /** get the last element*/
+    constexpr const X& back() const { return dataPtr[count - 1]; }
+    /** begin iterator*/
+    constexpr const_iterator begin() const noexcept { return dataPtr; }
+    /** end iterator*/
+    constexpr const_iterator end() const noexcept { return dataPtr + count; }
+    /** copy the viewed values to a vector*/
+    std::vector<X> to_vector() const { return std::vector<X>(begin(), end()); }
+};
+}  // namespace helics
@@ -0,0 +1,294 @@
+/*
+Copyright (c) 2017-2022,
+Battelle Memorial Institute; Lawrence Livermore National Security, LLC; Alliance for Sustainable
+Energy, LLC.  See the top-level NOTICE for additional details. All rights reserved.
+SPDX-License-Identifier: BSD-3-Clause
+*/
+
+#include "reductionOperations.hpp"
+
+#include "ValueConverter.hpp"
+#include "helicsTypes.hpp"
+
+#if defined(__AVX__)
+#    include <immintrin.h>
+#    define HELICS_REDUCTION_AVX
+#elif defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#    include <emmintrin.h>
+#    define HELICS_REDUCTION_SSE2
+#elif defined(__ARM_NEON) && defined(__aarch64__)
+#    include <arm_neon.h>
+#    define HELICS_REDUCTION_NEON
+#endif
+
+namespace helics::reduction {
+
+double sum(const double* data, std::size_t count) noexcept
+{
+    std::size_t ii{0};
+    double result{0.0};
+#if defined(HELICS_REDUCTION_AVX)
+    if (count >= 16) {
+        __m256d acc0 = _mm256_setzero_pd();
+        __m256d acc1 = _mm256_setzero_pd();
+        __m256d acc2 = _mm256_setzero_pd();
+        __m256d acc3 = _mm256_setzero_pd();
+        for (; ii + 16 <= count; ii += 16) {
+            acc0 = _mm256_add_pd(acc0, _mm256_loadu_pd(data + ii));
+            acc1 = _mm256_add_pd(acc1, _mm256_loadu_pd(data + ii + 4));
+            acc2 = _mm256_add_pd(acc2, _mm256_loadu_pd(data + ii + 8));
+            acc3 = _mm256_add_pd(acc3, _mm256_loadu_pd(data + ii + 12));
+        }
+        acc0 = _mm256_add_pd(_mm256_add_pd(acc0, acc1), _mm256_add_pd(acc2, acc3));
+        __m128d half = _mm_add_pd(_mm256_castpd256_pd128(acc0), _mm256_extractf128_pd(acc0, 1));
+        result = _mm_cvtsd_f64(_mm_add_sd(half, _mm_unpackhi_pd(half, half)));
+    }
+#elif defined(HELICS_REDUCTION_SSE2)
+    if (count >= 8) {
+        __m128d acc0 = _mm_setzero_pd();
+        __m128d acc1 = _mm_setzero_pd();
+        __m128d acc2 = _mm_setzero_pd();
+        __m128d acc3 = _mm_setzero_pd();
+        for (; ii + 8 <= count; ii += 8) {
+            acc0 = _mm_add_pd(acc0, _mm_loadu_pd(data + ii));
+            acc1 = _mm_add_pd(acc1, _mm_loadu_pd(data + ii + 2));
+            acc2 = _mm_add_pd(acc2, _mm_loadu_pd(data + ii + 4));
+            acc3 = _mm_add_pd(acc3, _mm_loadu_pd(data + ii + 6));
+        }
+        acc0 = _mm_add_pd(_mm_add_pd(acc0, acc1), _mm_add_pd(acc2, acc3));
+        result = _mm_cvtsd_f64(_mm_add_sd(acc0, _mm_unpackhi_pd(acc0, acc0)));
+    }
+#elif defined(HELICS_REDUCTION_NEON)
+    if (count >= 8) {
+        float64x2_t acc0 = vdupq_n_f64(0.0);
+        float64x2_t acc1 = vdupq_n_f64(0.0);
+        float64x2_t acc2 = vdupq_n_f64(0.0);
+        float64x2_t acc3 = vdupq_n_f64(0.0);
+        for (; ii + 8 <= count; ii += 8) {
+            acc0 = vaddq_f64(acc0, vld1q_f64(data + ii));
+            acc1 = vaddq_f64(acc1, vld1q_f64(data + ii + 2));
+            acc2 = vaddq_f64(acc2, vld1q_f64(data + ii + 4));
+            acc3 = vaddq_f64(acc3, vld1q_f64(data + ii + 6));
+        }
+        result = vaddvq_f64(vaddq_f64(vaddq_f64(acc0, acc1), vaddq_f64(acc2, acc3)));
+    }
+#else
+    if (count >= 4) {
+        // independent accumulators break the dependency chain between additions
+        double acc0{0.0};
+        double acc1{0.0};
+        double acc2{0.0};
+        double acc3{0.0};
+        for (; ii + 4 <= count; ii += 4) {
+            acc0 += data[ii];
+            acc1 += data[ii + 1];
+            acc2 += data[ii + 2];
+            acc3 += data[ii + 3];
+        }
+        result = (acc0 + acc1) + (acc2 + acc3);
+    }
+#endif
+    for (; ii < count; ++ii) {
+        result += data[ii];
+    }
+    return result;
+}
+
+/* the vector max and min instructions return the second operand if either is NaN, and the
+accumulators are seeded with the first value, so the results match a sequential loop using >
+or < comparisons*/
+
+double max(const double* data, std::size_t count) noexcept
+{
+    if (count == 0) {
+        return invalidDouble;
+    }
+    std::size_t ii{1};
+    double result{data[0]};
+#if defined(HELICS_REDUCTION_AVX)
+    if (count >= 16) {
+        __m256d acc0 = _mm256_set1_pd(data[0]);
+        __m256d acc1 = acc0;
+        __m256d acc2 = acc0;
+        __m256d acc3 = acc0;
+        for (ii = 0; ii + 16 <= count; ii += 16) {
+            acc0 = _mm256_max_pd(_mm256_loadu_pd(data + ii), acc0);
+            acc1 = _mm256_max_pd(_mm256_loadu_pd(data + ii + 4), acc1);
+            acc2 = _mm256_max_pd(_mm256_loadu_pd(data + ii + 8), acc2);
+            acc3 = _mm256_max_pd(_mm256_loadu_pd(data + ii + 12), acc3);
+        }
+        acc0 = _mm256_max_pd(_mm256_max_pd(acc1, acc0), _mm256_max_pd(acc3, acc2));
+        __m128d half = _mm_max_pd(_mm256_extractf128_pd(acc0, 1), _mm256_castpd256_pd128(acc0));
+        result = _mm_cvtsd_f64(_mm_max_sd(_mm_unpackhi_pd(half, half), half));
+    }
+#elif defined(HELICS_REDUCTION_SSE2)
+    if (count >= 8) {
+        __m128d acc0 = _mm_set1_pd(data[0]);
+        __m128d acc1 = acc0;
+        __m128d acc2 = acc0;
+        __m128d acc3 = acc0;
+        for (ii = 0; ii + 8 <= count; ii += 8) {
+            acc0 = _mm_max_pd(_mm_loadu_pd(data + ii), acc0);
+            acc1 = _mm_max_pd(_mm_loadu_pd(data + ii + 2), acc1);
+            acc2 = _mm_max_pd(_mm_loadu_pd(data + ii + 4), acc2);
+            acc3 = _mm_max_pd(_mm_loadu_pd(data + ii + 6), acc3);
+        }
+        acc0 = _mm_max_pd(_mm_max_pd(acc1, acc0), _mm_max_pd(acc3, acc2));
+        result = _mm_cvtsd_f64(_mm_max_sd(_mm_unpackhi_pd(acc0, acc0), acc0));
+    }
+#elif defined(HELICS_REDUCTION_NEON)
+    if (count >= 8) {
+        // vmaxq_f64 propagates NaN so use a compare and select to match the scalar code
+        float64x2_t acc0 = vdupq_n_f64(data[0]);
+        float64x2_t acc1 = acc0;
+        float64x2_t acc2 = acc0;
+        float64x2_t acc3 = acc0;
+        for (ii = 0; ii + 8 <= count; ii += 8) {
+            float64x2_t val0 = vld1q_f64(data + ii);
+            float64x2_t val1 = vld1q_f64(data + ii + 2);
+            float64x2_t val2 = vld1q_f64(data + ii + 4);
+            float64x2_t val3 = vld1q_f64(data + ii + 6);
+            acc0 = vbslq_f64(vcgtq_f64(val0, acc0), val0, acc0);
+            acc1 = vbslq_f64(vcgtq_f64(val1, acc1), val1, acc1);
+            acc2 = vbslq_f64(vcgtq_f64(val2, acc2), val2, acc2);
+            acc3 = vbslq_f64(vcgtq_f64(val3, acc3), val3, acc3);
+        }
+        acc0 = vbslq_f64(vcgtq_f64(acc1, acc0), acc1, acc0);
+        acc2 = vbslq_f64(vcgtq_f64(acc3, acc2), acc3, acc2);
+        acc0 = vbslq_f64(vcgtq_f64(acc2, acc0), acc2, acc0);
+        result = vgetq_lane_f64(acc0, 0);
+        double upper = vgetq_lane_f64(acc0, 1);
+        if (upper > result) {
+            result = upper;
+        }
+    }
+#else
+    if (count >= 8) {
+        double acc0{data[0]};
+        double acc1{data[0]};
+        double acc2{data[0]};
+        double acc3{data[0]};
+        for (ii = 0; ii + 4 <= count; ii += 4) {
+            acc0 = (data[ii] > acc0) ? data[ii] : acc0;
+            acc1 = (data[ii + 1] > acc1) ? data[ii + 1] : acc1;
+            acc2 = (data[ii + 2] > acc2) ? data[ii + 2] : acc2;
+            acc3 = (data[ii + 3] > acc3) ? data[ii + 3] : acc3;
+        }
+        acc0 = (acc1 > acc0) ? acc1 : acc0;
+        acc2 = (acc3 > acc2) ? acc3 : acc2;
+        result = (acc2 > acc0) ? acc2 : acc0;
+    }
+#endif
+    for (; ii < count; ++ii) {
+        if (data[ii] > result) {
+            result = data[ii];
+        }
+    }
+    return result;
+}
+
+double min(const double* data, std::size_t count) noexcept
+{
+    if (count == 0) {
+        return invalidDouble;
+    }
+    std::size_t ii{1};
+    double result{data[0]};
+#if defined(HELICS_REDUCTION_AVX)
+    if (count >= 16) {
+        __m256d acc0 = _mm256_set1_pd(data[0]);
+        __m256d acc1 = acc0;
+        __m256d acc2 = acc0;
+        __m256d acc3 = acc0;
+        for (ii = 0; ii + 16 <= count; ii += 16) {
+            acc0 = _mm256_min_pd(_mm256_loadu_pd(data + ii), acc0);
+            acc1 = _mm256_min_pd(_mm256_loadu_pd(data + ii + 4), acc1);
+            acc2 = _mm256_min_pd(_mm256_loadu_pd(data + ii + 8), acc2);
+            acc3 = _mm256_min_pd(_mm256_loadu_pd(data + ii + 12), acc3);
+        }
+        acc0 = _mm256_min_pd(_mm256_min_pd(acc1, acc0), _mm256_min_pd(acc3, acc2));
+        __m128d half = _mm_min_pd(_mm256_extractf128_pd(acc0, 1), _mm256_castpd256_pd128(acc0));
+        result = _mm_cvtsd_f64(_mm_min_sd(_mm_unpackhi_pd(half, half), half));
+    }
+#elif defined(HELICS_REDUCTION_SSE2)
+    if (count >= 8) {
+        __m128d acc0 = _mm_set1_pd(data[0]);
+        __m128d acc1 = acc0;
+        __m128d acc2 = acc0;
+        __m128d acc3 = acc0;
+        for (ii = 0; ii + 8 <= count; ii += 8) {
+            acc0 = _mm_min_pd(_mm_loadu_pd(data + ii), acc0);
+            acc1 = _mm_min_pd(_mm_loadu_pd(data + ii + 2), acc1);
+            acc2 = _mm_min_pd(_mm_loadu_pd(data + ii + 4), acc2);
+            acc3 = _mm_min_pd(_mm_loadu_pd(data + ii + 6), acc3);
+        }
+        acc0 = _mm_min_pd(_mm_min_pd(acc1, acc0), _mm_min_pd(acc3, acc2));
+        result = _mm_cvtsd_f64(_mm_min_sd(_mm_unpackhi_pd(acc0, acc0), acc0));
+    }
+#elif defined(HELICS_REDUCTION_NEON)
+    if (count >= 8) {
+        float64x2_t acc0 = vdupq_n_f64(data[0]);
+        float64x2_t acc1 = acc0;
+        float64x2_t acc2 = acc0;
+        float64x2_t acc3 = acc0;
+        for (ii = 0; ii + 8 <= count; ii += 8) {
+            float64x2_t val0 = vld1q_f64(data + ii);
+            float64x2_t val1 = vld1q_f64(data + ii + 2);
+            float64x2_t val2 = vld1q_f64(data + ii + 4);
+            float64x2_t val3 = vld1q_f64(data + ii + 6);
+            acc0 = vbslq_f64(vcltq_f64(val0, acc0), val0, acc0);
+            acc1 = vbslq_f64(vcltq_f64(val1, acc1), val1, acc1);
+            acc2 = vbslq_f64(vcltq_f64(val2, acc2), val2, acc2);
+            acc3 = vbslq_f64(vcltq_f64(val3, acc3), val3, acc3);
+        }
+        acc0 = vbslq_f64(vcltq_f64(acc1, acc0), acc1, acc0);
+        acc2 = vbslq_f64(vcltq_f64(acc3, acc2), acc3, acc2);
+        acc0 = vbslq_f64(vcltq_f64(acc2, acc0), acc2, acc0);
+        result = vgetq_lane_f64(acc0, 0);
+        double upper = vgetq_lane_f64(acc0, 1);
+        if (upper < result) {
+            result = upper;
+        }
+    }
+#else
+    if (count >= 8) {
+        double acc0{data[0]};
+        double acc1{data[0]};
+        double acc2{data[0]};
+        double acc3{data[0]};
+        for (ii = 0; ii + 4 <= count; ii += 4) {
+            acc0 = (data[ii] < acc0) ? data[ii] : acc0;
+            acc1 = (data[ii + 1] < acc1) ? data[ii + 1] : acc1;
+            acc2 = (data[ii + 2] < acc2) ? data[ii + 2] : acc2;
+            acc3 = (data[ii + 3] < acc3) ? data[ii + 3] : acc3;
+        }
+        acc0 = (acc1 < acc0) ? acc1 : acc0;
+        acc2 = (acc3 < acc2) ? acc3 : acc2;
+        result = (acc2 < acc0) ? acc2 : acc0;
+    }
+#endif
+    for (; ii < count; ++ii) {
+        if (data[ii] < result) {
+            result = data[ii];
+        }
+    }
+    return result;
+}
+
+void appendVectorData(const data_view& data, std::vector<double>& buffer)
+{
+    if (data.size() < 8) {
+        return;
+    }
+    auto count = detail::getDataSize(data.bytes());
+    if (count * sizeof(double) + 8 > data.size()) {
+        // truncated data
+        return;
+    }
+    auto offset = buffer.size();
+    buffer.resize(offset + count);
+    if (count > 0) {
+        detail::convertFromBinary(data.bytes(), buffer.data() + offset);
+    }
+}
+}  // namespace helics::reduction
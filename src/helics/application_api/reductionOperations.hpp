@@ -0,0 +1,39 @@
+/*
+Copyright (c) 2017-2022,
+Battelle Memorial Institute; Lawrence Livermore National Security, LLC; Alliance for Sustainable
+Energy, LLC.  See the top-level NOTICE for additional details. All rights reserved.
+SPDX-License-Identifier: BSD-3-Clause
+*/
+#pragma once
+
+#include "data_view.hpp"
+#include "helics_cxx_export.h"
+
+#include <cstddef>
+#include <vector>
+
+/** @file
+@details reduction kernels for evaluating multi-input operations over a contiguous block of doubles
+the kernels use AVX, SSE2, or NEON instructions when the compiler targets them and fall back to
+scalar code with independent accumulators otherwise
+*/
+
+namespace helics::reduction {
+/** get the sum of a block of doubles
+@details the summation order differs from a simple loop so the result may differ in the last
+bits*/
+HELICS_CXX_EXPORT double sum(const double* data, std::size_t count) noexcept;
+/** get the largest value in a block of doubles
+@details NaN values are skipped unless the first value is NaN in which case NaN is returned
+@return invalidDouble if count is 0*/
+HELICS_CXX_EXPORT double max(const double* data, std::size_t count) noexcept;
+/** get the smallest value in a block of doubles
+@details NaN values are skipped unless the first value is NaN in which case NaN is returned
+@return invalidDouble if count is 0*/
+HELICS_CXX_EXPORT double min(const double* data, std::size_t count) noexcept;
+
+/** decode a serialized double or vector of doubles and append the values to a buffer
+@details the data is decoded by the same rules as ValueConverter<std::vector<double>> but without
+an intermediate vector*/
+HELICS_CXX_EXPORT void appendVectorData(const data_view& data, std::vector<double>& buffer);
+}  // namespace helics::reduction
@@ -11,6 +11,7 @@ SPDX-License-Identifier: BSD-3-Clause
 #include "../core/helicsCLI11.hpp"
 #include "../core/helicsVersion.hpp"
 #include "PrecHelper.hpp"
+#include "RecordFile.hpp"
 #include "gmlc/utilities/base64.h"
 #include "gmlc/utilities/stringOps.h"
 #include "gmlc/utilities/timeStringOps.hpp"
@@ -189,6 +190,10 @@ namespace apps {
 
     void Player::loadTextFile(const std::string& filename)
     {
+        if (isRecordFile(filename)) {
+            loadRecordFile(filename);
+            return;
+        }
         App::loadTextFile(filename);
         using namespace gmlc::utilities::stringOps;  // NOLINT
         std::ifstream infile(filename);
@@ -390,6 +395,50 @@ namespace apps {
         }
     }
 
+    void Player::loadRecordFile(const std::string& filename)
+    {
+        auto reader = std::make_shared<const RecordFileReader>(filename);
+        std::map<std::int32_t, std::string> recordTags;
+        int unknownCount{0};
+        auto complete = reader->read(
+            [this, &recordTags](const RecordedTag& tag) {
+                recordTags[tag.index] = tag.name;
+                auto& tagType = tags[std::string(tag.name)];
+                if (tagType.empty()) {
+                    tagType = tag.type;
+                }
+            },
+            [this, &recordTags, &unknownCount](const RecordedValue& value) {
+                auto fnd = recordTags.find(value.index);
+                if (fnd == recordTags.end()) {
+                    ++unknownCount;
+                    return;
+                }
+                points.emplace_back();
+                points.back().time = value.time;
+                points.back().iteration = value.iteration;
+                points.back().pubName = fnd->second;
+                points.back().rawValue = value.data;
+            },
+            [this](const RecordedMessage& message) {
+                messages.emplace_back();
+                messages.back().sendTime = message.time;
+                messages.back().mess.time = message.time;
+                messages.back().mess.source = message.source;
+                messages.back().mess.dest = message.dest;
+                messages.back().mess.data = message.data;
+            });
+        if (!complete) {
+            std::cerr << "record file " << filename
+                      << " is incomplete, loaded data up to the last complete block\n";
+        }
+        if (unknownCount > 0) {
+            std::cerr << unknownCount << " values in " << filename
+                      << " reference an undefined publication\n";
+        }
+        recordFiles.push_back(std::move(reader));
+    }
+
     void Player::loadJsonFile(const std::string& jsonString)
     {
         loadJsonFileConfiguration("player", jsonString);
@@ -637,7 +686,7 @@ namespace apps {
     {
         if (isValidIndex(pointIndex, points)) {
             while (points[pointIndex].time < sendTime) {
-                publications[points[pointIndex].index].publish(points[pointIndex].value);
+                publishPoint(points[pointIndex]);
                 ++pointIndex;
                 if (pointIndex >= points.size()) {
                     break;
@@ -646,7 +695,7 @@ namespace apps {
             if (isValidIndex(pointIndex, points)) {
                 while ((points[pointIndex].time == sendTime) &&
                        (points[pointIndex].iteration == iteration)) {
-                    publications[points[pointIndex].index].publish(points[pointIndex].value);
+                    publishPoint(points[pointIndex]);
                     ++pointIndex;
                     if (pointIndex >= points.size()) {
                         break;
@@ -665,6 +714,16 @@ namespace apps {
         }
     }
 
+    void Player::publishPoint(const ValueSetter& point)
+    {
+        if (point.rawValue.empty()) {
+            publications[point.index].publish(point.value);
+        } else {
+            // values from record files are already serialized
+            fed->publishBytes(publications[point.index], point.rawValue);
+        }
+    }
+
     void Player::runTo(Time stopTime_input)
     {
         auto md = fed->getCurrentMode();
@@ -15,10 +15,13 @@ SPDX-License-Identifier: BSD-3-Clause
 #include <memory>
 #include <set>
 #include <string>
+#include <string_view>
 #include <vector>
 
 namespace helics {
 namespace apps {
+    class RecordFileReader;
+
     struct ValueSetter {
         Time time;
         int iteration = 0;
@@ -26,6 +29,7 @@ namespace apps {
         std::string type;
         std::string pubName;
         defV value;
+        std::string_view rawValue;  //!< serialized value in a mapped record file
     };
 
     struct MessageHolder {
@@ -204,6 +208,9 @@ external protection, that will result in undefined behavior
         virtual void loadJsonFile(const std::string& jsonString) override;
         /** load a text file*/
         virtual void loadTextFile(const std::string& filename) override;
+        /** load a record file generated by the recorder
+    @details the file is memory mapped and the values are published directly from the mapping*/
+        void loadRecordFile(const std::string& filename);
         /** helper function to sort through the tags*/
         void sortTags();
         /** helper function to generate the publications*/
@@ -215,6 +222,8 @@ external protection, that will result in undefined behavior
 
         /** send all points and messages up to the specified time*/
         void sendInformation(Time sendTime, int iteration = 0);
+        /** publish the value of a single point*/
+        void publishPoint(const ValueSetter& point);
 
         /** extract a time from the string based on Player parameters
     @param str the string containing the time
@@ -229,6 +238,8 @@ external protection, that will result in undefined behavior
         std::set<std::string> epts;  //!< set of the used endpoints
         std::vector<Publication> publications;  //!< the actual publication objects
         std::vector<Endpoint> endpoints;  //!< the actual endpoint objects
+        /// the mapped record files which hold the raw values of some points
+        std::vector<std::shared_ptr<const RecordFileReader>> recordFiles;
         std::map<std::string, int> pubids;  //!< publication id map
         std::map<std::string, int> eptids;  //!< endpoint id maps
         helics::DataType defType =
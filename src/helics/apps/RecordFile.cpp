@@ -0,0 +1,421 @@
+/*
+Copyright (c) 2017-2022,
+Battelle Memorial Institute; Lawrence Livermore National Security, LLC; Alliance for Sustainable
+Energy, LLC.  See the top-level NOTICE for additional details. All rights reserved.
+SPDX-License-Identifier: BSD-3-Clause
+*/
+
+#include "RecordFile.hpp"
+
+#include <cstring>
+#include <iterator>
+#include <stdexcept>
+#include <utility>
+
+#ifndef _WIN32
+#    include <fcntl.h>
+#    include <sys/mman.h>
+#    include <sys/stat.h>
+#    include <unistd.h>
+#endif
+
+namespace helics::apps {
+static constexpr char cRecordMagic[8]{'H', 'E', 'L', 'I', 'C', 'S', 'R', 'F'};
+static constexpr std::uint32_t cRecordVersion{1};
+static constexpr std::uint32_t cByteOrderMark{0x01020304};
+static constexpr std::size_t cFileHeaderSize{16};
+static constexpr std::size_t cChunkHeaderSize{16};
+
+enum chunk_type : std::uint32_t {
+    tag_chunk = 1,
+    value_chunk = 2,
+    message_chunk = 3,
+};
+
+bool isRecordFile(std::string_view filename)
+{
+    return (filename.size() > recordFileExtension.size()) &&
+        (filename.compare(filename.size() - recordFileExtension.size(),
+                          recordFileExtension.size(),
+                          recordFileExtension) == 0);
+}
+
+/** pad a chunk to an 8 byte boundary*/
+static void padChunk(std::string& chunk)
+{
+    chunk.append((8 - chunk.size() % 8) % 8, '\0');
+}
+
+template<class X>
+static void appendColumn(std::string& chunk, const std::vector<X>& column)
+{
+    chunk.append(reinterpret_cast<const char*>(column.data()), column.size() * sizeof(X));
+    padChunk(chunk);
+}
+
+static void appendStringColumn(std::string& chunk,
+                               const std::vector<std::uint64_t>& offsets,
+                               const std::string& data)
+{
+    appendColumn(chunk, offsets);
+    chunk.append(data);
+    padChunk(chunk);
+}
+
+static void
+    addString(std::vector<std::uint64_t>& offsets, std::string& data, std::string_view str)
+{
+    data.append(str);
+    offsets.push_back(data.size());
+}
+
+static void clearStringColumn(std::vector<std::uint64_t>& offsets, std::string& data)
+{
+    offsets.resize(1);
+    data.clear();
+}
+
+RecordFileWriter::RecordFileWriter(const std::string& filename,
+                                   std::size_t maxChunkRows,
+                                   std::size_t maxChunkBytes):
+    fileName(filename),
+    outFile(filename, std::ios::out | std::ios::binary | std::ios::trunc),
+    maxRows((maxChunkRows > 0) ? maxChunkRows : 1), maxBytes(maxChunkBytes)
+{
+    if (!outFile) {
+        throw(std::runtime_error("unable to open record file " + filename));
+    }
+    char header[cFileHeaderSize];
+    std::memcpy(header, cRecordMagic, sizeof(cRecordMagic));
+    std::memcpy(header + 8, &cRecordVersion, sizeof(std::uint32_t));
+    std::memcpy(header + 12, &cByteOrderMark, sizeof(std::uint32_t));
+    outFile.write(header, cFileHeaderSize);
+}
+
+RecordFileWriter::~RecordFileWriter()
+{
+    try {
+        close();
+    }
+    catch (...) {
+    }
+}
+
+void RecordFileWriter::addTag(std::int32_t index, std::string_view name, std::string_view type)
+{
+    tagIndices.push_back(index);
+    addString(tagNameOffsets, tagNames, name);
+    addString(tagTypeOffsets, tagTypes, type);
+}
+
+void RecordFileWriter::addValue(Time time,
+                                std::int32_t iteration,
+                                std::int32_t index,
+                                std::string_view data)
+{
+    valueTimes.push_back(time.getBaseTimeCode());
+    valueIterations.push_back(iteration);
+    valueIndices.push_back(index);
+    addString(valueOffsets, valueData, data);
+    ++totalValues;
+    if ((valueTimes.size() >= maxRows) || (valueData.size() >= maxBytes)) {
+        // the tags must be in the file before any values that refer to them
+        writeTagChunk();
+        writeValueChunk();
+    }
+}
+
+void RecordFileWriter::addMessage(Time time,
+                                  std::string_view source,
+                                  std::string_view dest,
+                                  std::string_view data)
+{
+    messageTimes.push_back(time.getBaseTimeCode());
+    addString(sourceOffsets, sources, source);
+    addString(destOffsets, dests, dest);
+    addString(messageOffsets, messageData, data);
+    ++totalMessages;
+    if ((messageTimes.size() >= maxRows) || (messageData.size() >= maxBytes)) {
+        writeMessageChunk();
+    }
+}
+
+void RecordFileWriter::flush()
+{
+    if (!outFile.is_open()) {
+        return;
+    }
+    writeTagChunk();
+    writeValueChunk();
+    writeMessageChunk();
+    outFile.flush();
+}
+
+void RecordFileWriter::close()
+{
+    if (outFile.is_open()) {
+        flush();
+        outFile.close();
+    }
+}
+
+void RecordFileWriter::writeTagChunk()
+{
+    if (tagIndices.empty()) {
+        return;
+    }
+    chunk.assign(cChunkHeaderSize, '\0');
+    appendColumn(chunk, tagIndices);
+    appendStringColumn(chunk, tagNameOffsets, tagNames);
+    appendStringColumn(chunk, tagTypeOffsets, tagTypes);
+    writeChunk(tag_chunk, tagIndices.size());
+    tagIndices.clear();
+    clearStringColumn(tagNameOffsets, tagNames);
+    clearStringColumn(tagTypeOffsets, tagTypes);
+}
+
+void RecordFileWriter::writeValueChunk()
+{
+    if (valueTimes.empty()) {
+        return;
+    }
+    chunk.assign(cChunkHeaderSize, '\0');
+    appendColumn(chunk, valueTimes);
+    appendColumn(chunk, valueIterations);
+    appendColumn(chunk, valueIndices);
+    appendStringColumn(chunk, valueOffsets, valueData);
+    writeChunk(value_chunk, valueTimes.size());
+    valueTimes.clear();
+    valueIterations.clear();
+    valueIndices.clear();
+    clearStringColumn(valueOffsets, valueData);
+}
+
+void RecordFileWriter::writeMessageChunk()
+{
+    if (messageTimes.empty()) {
+        return;
+    }
+    chunk.assign(cChunkHeaderSize, '\0');
+    appendColumn(chunk, messageTimes);
+    appendStringColumn(chunk, sourceOffsets, sources);
+    appendStringColumn(chunk, destOffsets, dests);
+    appendStringColumn(chunk, messageOffsets, messageData);
+    writeChunk(message_chunk, messageTimes.size());
+    messageTimes.clear();
+    clearStringColumn(sourceOffsets, sources);
+    clearStringColumn(destOffsets, dests);
+    clearStringColumn(messageOffsets, messageData);
+}
+
+void RecordFileWriter::writeChunk(std::uint32_t chunkType, std::size_t rows)
+{
+    auto rowCount = static_cast<std::uint32_t>(rows);
+    std::uint64_t payloadSize = chunk.size() - cChunkHeaderSize;
+    std::memcpy(chunk.data(), &chunkType, sizeof(std::uint32_t));
+    std::memcpy(chunk.data() + 4, &rowCount, sizeof(std::uint32_t));
+    std::memcpy(chunk.data() + 8, &payloadSize, sizeof(std::uint64_t));
+    outFile.write(chunk.data(), static_cast<std::streamsize>(chunk.size()));
+    if (chunk.capacity() > 2 * maxBytes + 4096) {
+        // don't hold on to the memory used by an oversized value
+        std::string().swap(chunk);
+    }
+}
+
+namespace {
+    /** helper for walking through the columns of a chunk with bounds checking*/
+    class ColumnCursor {
+      public:
+        ColumnCursor(const char* data, std::size_t size): current(data), end(data + size) {}
+        /** get the start of a column of the specified size or nullptr if it doesn't fit*/
+        const char* column(std::size_t bytes)
+        {
+            auto padded = (bytes + 7U) & ~static_cast<std::size_t>(7U);
+            if ((current == nullptr) || (bytes > padded) ||
+                (static_cast<std::size_t>(end - current) < padded)) {
+                current = nullptr;
+                return nullptr;
+            }
+            const auto* col = current;
+            current += padded;
+            return col;
+        }
+
+      private:
+        const char* current;
+        const char* end;
+    };
+
+    template<class X>
+    X loadElement(const char* column, std::size_t index)
+    {
+        X val;
+        std::memcpy(&val, column + index * sizeof(X), sizeof(X));
+        return val;
+    }
+
+    /** a column of strings stored as offsets followed by the string data*/
+    class StringColumn {
+      public:
+        StringColumn(ColumnCursor& cursor, std::size_t rows)
+        {
+            offsets = cursor.column((rows + 1) * sizeof(std::uint64_t));
+            if (offsets == nullptr) {
+                return;
+            }
+            std::uint64_t previous{0};
+            for (std::size_t ii = 0; ii <= rows; ++ii) {
+                auto offset = loadElement<std::uint64_t>(offsets, ii);
+                if ((offset < previous) || ((ii == 0) && (offset != 0))) {
+                    offsets = nullptr;
+                    return;
+                }
+                previous = offset;
+            }
+            data = cursor.column(previous);
+            valid = (data != nullptr);
+        }
+        bool isValid() const { return valid; }
+        std::string_view operator[](std::size_t index) const
+        {
+            auto start = loadElement<std::uint64_t>(offsets, index);
+            auto stop = loadElement<std::uint64_t>(offsets, index + 1);
+            return {data + start, static_cast<std::size_t>(stop - start)};
+        }
+
+      private:
+        const char* offsets{nullptr};
+        const char* data{nullptr};
+        bool valid{false};
+    };
+}  // namespace
+
+RecordFileReader::RecordFileReader(const std::string& filename)
+{
+#ifndef _WIN32
+    int fd = ::open(filename.c_str(), O_RDONLY);
+    if (fd < 0) {
+        throw(std::invalid_argument("unable to open record file " + filename));
+    }
+    struct stat fileStat {};
+    if ((::fstat(fd, &fileStat) == 0) && (fileStat.st_size > 0)) {
+        auto size = static_cast<std::size_t>(fileStat.st_size);
+        void* mem = ::mmap(nullptr, size, PROT_READ, MAP_PRIVATE, fd, 0);
+        if (mem != MAP_FAILED) {
+            mapping = mem;
+            fileData = static_cast<const char*>(mem);
+            fileSize = size;
+        }
+    }
+    ::close(fd);
+#endif
+    if (fileData == nullptr) {
+        std::ifstream inFile(filename, std::ios::in | std::ios::binary);
+        if (!inFile) {
+            throw(std::invalid_argument("unable to open record file " + filename));
+        }
+        buffer.assign(std::istreambuf_iterator<char>(inFile), std::istreambuf_iterator<char>());
+        fileData = buffer.data();
+        fileSize = buffer.size();
+    }
+    bool validHeader = (fileSize >= cFileHeaderSize) &&
+        (std::memcmp(fileData, cRecordMagic, sizeof(cRecordMagic)) == 0) &&
+        (loadElement<std::uint32_t>(fileData + 8, 0) == cRecordVersion) &&
+        (loadElement<std::uint32_t>(fileData + 12, 0) == cByteOrderMark);
+    if (!validHeader) {
+#ifndef _WIN32
+        if (mapping != nullptr) {
+            ::munmap(mapping, fileSize);
+        }
+#endif
+        throw(std::invalid_argument(filename + " is not a valid record file"));
+    }
+}
+
+RecordFileReader::~RecordFileReader()
+{
+#ifndef _WIN32
+    if (mapping != nullptr) {
+        ::munmap(mapping, fileSize);
+    }
+#endif
+}
+
+bool RecordFileReader::read(const std::function<void(const RecordedTag&)>& tagCallback,
+                            const std::function<void(const RecordedValue&)>& valueCallback,
+                            const std::function<void(const RecordedMessage&)>& messageCallback) const
+{
+    std::size_t position{cFileHeaderSize};
+    while (position < fileSize) {
+        if (fileSize - position < cChunkHeaderSize) {
+            return false;
+        }
+        const char* chunkStart = fileData + position;
+        auto chunkType = loadElement<std::uint32_t>(chunkStart, 0);
+        std::size_t rows = loadElement<std::uint32_t>(chunkStart, 1);
+        auto payloadSize = loadElement<std::uint64_t>(chunkStart, 1);
+        if (payloadSize > fileSize - position - cChunkHeaderSize) {
+            return false;
+        }
+        position += cChunkHeaderSize + static_cast<std::size_t>(payloadSize);
+        ColumnCursor cursor(chunkStart + cChunkHeaderSize, static_cast<std::size_t>(payloadSize));
+        switch (chunkType) {
+            case tag_chunk: {
+                const auto* indices = cursor.column(rows * sizeof(std::int32_t));
+                StringColumn names(cursor, rows);
+                StringColumn types(cursor, rows);
+                if ((indices == nullptr) || !names.isValid() || !types.isValid()) {
+                    return false;
+                }
+                RecordedTag tag;
+                for (std::size_t ii = 0; ii < rows; ++ii) {
+                    tag.index = loadElement<std::int32_t>(indices, ii);
+                    tag.name = names[ii];
+                    tag.type = types[ii];
+                    tagCallback(tag);
+                }
+            } break;
+            case value_chunk: {
+                const auto* times = cursor.column(rows * sizeof(Time::baseType));
+                const auto* iterations = cursor.column(rows * sizeof(std::int32_t));
+                const auto* indices = cursor.column(rows * sizeof(std::int32_t));
+                StringColumn data(cursor, rows);
+                if ((times == nullptr) || (iterations == nullptr) || (indices == nullptr) ||
+                    !data.isValid()) {
+                    return false;
+                }
+                RecordedValue value;
+                for (std::size_t ii = 0; ii < rows; ++ii) {
+                    value.time.setBaseTimeCode(loadElement<Time::baseType>(times, ii));
+                    value.iteration = loadElement<std::int32_t>(iterations, ii);
+                    value.index = loadElement<std::int32_t>(indices, ii);
+                    value.data = data[ii];
+                    valueCallback(value);
+                }
+            } break;
+            case message_chunk: {
+                const auto* times = cursor.column(rows * sizeof(Time::baseType));
+                StringColumn sources(cursor, rows);
+                StringColumn dests(cursor, rows);
+                StringColumn data(cursor, rows);
+                if ((times == nullptr) || !sources.isValid() || !dests.isValid() ||
+                    !data.isValid()) {
+                    return false;
+                }
+                RecordedMessage message;
+                for (std::size_t ii = 0; ii < rows; ++ii) {
+                    message.time.setBaseTimeCode(loadElement<Time::baseType>(times, ii));
+                    message.source = sources[ii];
+                    message.dest = dests[ii];
+                    message.data = data[ii];
+                    messageCallback(message);
+                }
+            } break;
+            default:
+                // skip chunk types from newer versions
+                break;
+        }
+    }
+    return true;
+}
+}  // namespace helics::apps
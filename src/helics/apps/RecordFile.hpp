@@ -0,0 +1,152 @@
+/*
+Copyright (c) 2017-2022,
+Battelle Memorial Institute; Lawrence Livermore National Security, LLC; Alliance for Sustainable
+Energy, LLC.  See the top-level NOTICE for additional details. All rights reserved.
+SPDX-License-Identifier: BSD-3-Clause
+*/
+#pragma once
+
+#include "../core/helicsTime.hpp"
+
+#include <cstddef>
+#include <cstdint>
+#include <fstream>
+#include <functional>
+#include <string>
+#include <string_view>
+#include <vector>
+
+/** @file
+@details the record file format is a streaming binary format used by the Recorder and Player apps.
+The file is a 16 byte header followed by a sequence of independent chunks, each chunk holds a
+block of rows stored as typed columns padded to 8 byte boundaries. Values are stored as the raw
+serialized bytes received from the publication so they can be replayed without conversion. A file
+truncated in the middle of a chunk can still be read up to the last complete chunk.
+*/
+
+namespace helics::apps {
+/** the file extension used for record files*/
+constexpr std::string_view recordFileExtension{".hrec"};
+
+/** check if a filename has the record file extension*/
+bool isRecordFile(std::string_view filename);
+
+/** a tag definition read from a record file*/
+struct RecordedTag {
+    std::int32_t index{-1};  //!< the index used by the value rows
+    std::string_view name;  //!< the name of the publication
+    std::string_view type;  //!< the publication type
+};
+
+/** a value row read from a record file*/
+struct RecordedValue {
+    Time time;
+    std::int32_t iteration{0};
+    std::int32_t index{-1};  //!< index of the tag the value belongs to
+    std::string_view data;  //!< the serialized value
+};
+
+/** a message row read from a record file*/
+struct RecordedMessage {
+    Time time;
+    std::string_view source;
+    std::string_view dest;
+    std::string_view data;
+};
+
+/** class for streaming captured values and messages to a record file
+@details rows are buffered in columns and a chunk is written once the row or byte limit is reached
+so the memory used does not grow with the length of the recording*/
+class RecordFileWriter {
+  public:
+    /** open a record file for writing
+    @param filename the file to write, any existing file is overwritten
+    @param maxChunkRows the number of rows to buffer before writing a chunk
+    @param maxChunkBytes the number of data bytes to buffer before writing a chunk
+    @throw std::runtime_error if the file cannot be opened*/
+    explicit RecordFileWriter(const std::string& filename,
+                              std::size_t maxChunkRows = 4096,
+                              std::size_t maxChunkBytes = 1U << 20U);
+    /** destructor writes any buffered rows*/
+    ~RecordFileWriter();
+    RecordFileWriter(const RecordFileWriter&) = delete;
+    RecordFileWriter& operator=(const RecordFileWriter&) = delete;
+
+    /** define the name and type of the tag used by values with the given index*/
+    void addTag(std::int32_t index, std::string_view name, std::string_view type);
+    /** add a value row*/
+    void addValue(Time time, std::int32_t iteration, std::int32_t index, std::string_view data);
+    /** add a message row*/
+    void
+        addMessage(Time time, std::string_view source, std::string_view dest, std::string_view data);
+    /** write all buffered rows to the file*/
+    void flush();
+    /** flush and close the file, no more rows can be added after closing*/
+    void close();
+    /** get the name of the file being written*/
+    const std::string& getFileName() const { return fileName; }
+    /** get the total number of values added*/
+    std::size_t valueCount() const { return totalValues; }
+    /** get the total number of messages added*/
+    std::size_t messageCount() const { return totalMessages; }
+
+  private:
+    void writeTagChunk();
+    void writeValueChunk();
+    void writeMessageChunk();
+    void writeChunk(std::uint32_t chunkType, std::size_t rows);
+
+    std::string fileName;
+    std::ofstream outFile;
+    std::size_t maxRows;
+    std::size_t maxBytes;
+    std::size_t totalValues{0};
+    std::size_t totalMessages{0};
+    std::string chunk;  //!< scratch buffer for assembling a chunk
+    // tag columns
+    std::vector<std::int32_t> tagIndices;
+    std::vector<std::uint64_t> tagNameOffsets{0};
+    std::string tagNames;
+    std::vector<std::uint64_t> tagTypeOffsets{0};
+    std::string tagTypes;
+    // value columns
+    std::vector<Time::baseType> valueTimes;
+    std::vector<std::int32_t> valueIterations;
+    std::vector<std::int32_t> valueIndices;
+    std::vector<std::uint64_t> valueOffsets{0};
+    std::string valueData;
+    // message columns
+    std::vector<Time::baseType> messageTimes;
+    std::vector<std::uint64_t> sourceOffsets{0};
+    std::string sources;
+    std::vector<std::uint64_t> destOffsets{0};
+    std::string dests;
+    std::vector<std::uint64_t> messageOffsets{0};
+    std::string messageData;
+};
+
+/** class for reading a record file through a read only memory mapping
+@details the views passed to the callbacks point into the mapping and are valid as long as the
+reader exists*/
+class RecordFileReader {
+  public:
+    /** map a record file
+    @throw std::invalid_argument if the file cannot be opened or is not a record file*/
+    explicit RecordFileReader(const std::string& filename);
+    ~RecordFileReader();
+    RecordFileReader(const RecordFileReader&) = delete;
+    RecordFileReader& operator=(const RecordFileReader&) = delete;
+
+    /** process all the rows in the file in the order they were recorded
+    @return false if the file ended with an incomplete or malformed chunk*/
+    bool read(const std::function<void(const RecordedTag&)>& tagCallback,
+              const std::function<void(const RecordedValue&)>& valueCallback,
+              const std::function<void(const RecordedMessage&)>& messageCallback) const;
+
+  private:
+    const char* fileData{nullptr};
+    std::size_t fileSize{0};
+    void* mapping{nullptr};
+    std::string buffer;  //!< storage for the file contents if memory mapping is not available
+};
+}  // namespace helics::apps
@@ -14,6 +14,7 @@ SPDX-License-Identifier: BSD-3-Clause
 #include "../common/fmt_ostream.h"
 #include "../core/helicsCLI11.hpp"
 #include "PrecHelper.hpp"
+#include "RecordFile.hpp"
 #include "gmlc/utilities/base64.h"
 #include "gmlc/utilities/stringOps.h"
 
@@ -39,6 +40,15 @@ static std::string encode(std::string_view str2encode)
         ']';
 }
 
+/** get the destination to record for a message, cloned messages use the original destination*/
+static std::string_view recordedDestination(const helics::Message& mess)
+{
+    if ((mess.dest.size() < 7) || (mess.dest.compare(mess.dest.size() - 6, 6, "cloneE") != 0)) {
+        return mess.dest;
+    }
+    return mess.original_dest;
+}
+
 namespace helics::apps {
 Recorder::Recorder(const std::string& appName, FederateInfo& fi): App(appName, fi)
 {
@@ -331,6 +341,27 @@ void Recorder::writeTextFile(const std::string& filename)
     }
 }
 
+void Recorder::writeRecordFile(const std::string& filename)
+{
+    RecordFileWriter writer(filename);
+    for (auto& v : points) {
+        if (v.first) {
+            writer.addTag(v.index,
+                          subscriptions[v.index].getTarget(),
+                          subscriptions[v.index].getPublicationType());
+        }
+        // the retained values are strings so store them as serialized strings
+        writer.addValue(v.time,
+                        v.iteration,
+                        v.index,
+                        ValueConverter<std::string>::convert(v.value).to_string());
+    }
+    for (auto& m : messages) {
+        writer.addMessage(m->time, m->source, recordedDestination(*m), m->data.to_string());
+    }
+    writer.close();
+}
+
 void Recorder::initialize()
 {
     generateInterfaces();
@@ -340,6 +371,10 @@ void Recorder::initialize()
         vStat[val.second].key = val.first;
     }
 
+    if (isRecordFile(outFileName)) {
+        recordStream = std::make_unique<RecordFileWriter>(outFileName);
+    }
+
     fed->enterInitializingMode();
     captureForCurrentTime(-1.0);
 
@@ -381,11 +416,24 @@ void Recorder::captureForCurrentTime(Time currentTime, int iteration)
 {
     for (auto& sub : subscriptions) {
         if (sub.isUpdated()) {
-            auto val = sub.getValue<std::string>();
             int ii = subids[sub.getHandle()];
-            points.emplace_back(currentTime, ii, val);
-            if (iteration > 0) {
-                points.back().iteration = iteration;
+            std::string val;
+            if (recordStream) {
+                // store the raw bytes and only convert to a string if the string is used
+                auto bytes = sub.getBytes();
+                if (vStat[ii].cnt == 0) {
+                    recordStream->addTag(ii, sub.getTarget(), sub.getPublicationType());
+                }
+                recordStream->addValue(currentTime, iteration, ii, bytes.string_view());
+                if (verbose || !mapfile.empty()) {
+                    valueExtract(bytes, getTypeFromString(sub.getPublicationType()), val);
+                }
+            } else {
+                val = sub.getValue<std::string>();
+                points.emplace_back(currentTime, ii, val);
+                if (iteration > 0) {
+                    points.back().iteration = iteration;
+                }
             }
             if (verbose) {
                 std::string valstr;
@@ -412,11 +460,11 @@ void Recorder::captureForCurrentTime(Time currentTime, int iteration)
                 }
                 spdlog::info(valstr);
             }
-            if (vStat[ii].cnt == 0) {
+            if ((vStat[ii].cnt == 0) && !recordStream) {
                 points.back().first = true;
             }
             ++vStat[ii].cnt;
-            vStat[ii].lastVal = val;
+            vStat[ii].lastVal = std::move(val);
             vStat[ii].time = -1.0;
         }
     }
@@ -441,17 +489,29 @@ void Recorder::captureForCurrentTime(Time currentTime, int iteration)
                 }
                 spdlog::info(messstr);
             }
-            messages.push_back(std::move(mess));
+            storeMessage(std::move(mess));
         }
     }
     // get the clone endpoints
     if (cloneEndpoint) {
         while (cloneEndpoint->hasMessage()) {
-            messages.push_back(cloneEndpoint->getMessage());
+            storeMessage(cloneEndpoint->getMessage());
         }
     }
 }
 
+void Recorder::storeMessage(std::unique_ptr<Message> mess)
+{
+    if (recordStream) {
+        recordStream->addMessage(mess->time,
+                                 mess->source,
+                                 recordedDestination(*mess),
+                                 mess->data.to_string());
+    } else {
+        messages.push_back(std::move(mess));
+    }
+}
+
 /** run the Player until the specified time*/
 void Recorder::runTo(Time runToTime)
 {
@@ -567,6 +627,16 @@ void Recorder::addCapture(const std::string& captureDesc)
     captureInterfaces.push_back(captureDesc);
 }
 
+std::size_t Recorder::pointCount() const
+{
+    return (recordStream) ? recordStream->valueCount() : points.size();
+}
+
+std::size_t Recorder::messageCount() const
+{
+    return (recordStream) ? recordStream->messageCount() : messages.size();
+}
+
 std::tuple<Time, std::string_view, std::string> Recorder::getValue(std::size_t index) const
 {
     if (isValidIndex(index, points)) {
@@ -586,10 +656,16 @@ std::unique_ptr<Message> Recorder::getMessage(std::size_t index) const
 /** save the data to a file*/
 void Recorder::saveFile(const std::string& filename)
 {
+    if (recordStream && recordStream->getFileName() == filename) {
+        recordStream->close();
+        return;
+    }
     auto lastP = filename.find_last_of('.');
     auto ext = (lastP != std::string::npos) ? filename.substr(lastP) : std::string{};
     if ((ext == ".json") || (ext == ".JSON")) {
         writeJsonFile(filename);
+    } else if (isRecordFile(filename)) {
+        writeRecordFile(filename);
     } else {
         writeTextFile(filename);
     }
@@ -612,7 +688,10 @@ std::shared_ptr<helicsCLI11App> Recorder::buildArgParserApp()
                     mapfile,
                     "write progress to a map file for concurrent progress monitoring");
 
-    app->add_option("--output,-o", outFileName, "the output file for recording the data")
+    app->add_option("--output,-o",
+                    outFileName,
+                    "the output file for recording the data, files with a .hrec extension are "
+                    "streamed to disk as the data is captured")
         ->capture_default_str();
 
     auto* clone_group =
@@ -22,6 +22,8 @@ namespace helics {
 class CloningFilter;
 
 namespace apps {
+    class RecordFileWriter;
+
     /** class designed to capture data points from a set of subscriptions or endpoints*/
     class HELICS_CXX_EXPORT Recorder: public App {
       public:
@@ -78,12 +80,18 @@ namespace apps {
     @param captureDesc describes a federate to capture all the interfaces for
     */
         void addCapture(const std::string& captureDesc);
-        /** save the data to a file*/
+        /** save the data to a file
+    @details if the captured data is being streamed to filename the file is flushed and closed*/
         void saveFile(const std::string& filename);
+        /** set the output file for the recorder
+    @details if the file has the record file extension (.hrec) the captured values and messages are
+    streamed to the file in chunks as they arrive and are not retained in memory, this must be
+    called before the recorder is initialized*/
+        void setOutputFile(const std::string& filename) { outFileName = filename; }
         /** get the number of captured points*/
-        auto pointCount() const { return points.size(); }
+        std::size_t pointCount() const;
         /** get the number of captured messages*/
-        auto messageCount() const { return messages.size(); }
+        std::size_t messageCount() const;
         /** get a string with the value of point index
     @param index the number of the point to retrieve
     @return a tuple with Time as the first element the tag as the 2nd element and the value as the
@@ -107,10 +115,14 @@ namespace apps {
         void writeJsonFile(const std::string& filename);
         /** helper function to write the date to a text file*/
         void writeTextFile(const std::string& filename);
+        /** helper function to write the data to a record file*/
+        void writeRecordFile(const std::string& filename);
 
         virtual void initialize() override;
         void generateInterfaces();
         void captureForCurrentTime(Time currentTime, int iteration = 0);
+        /** store a captured message or write it to the record stream*/
+        void storeMessage(std::unique_ptr<Message> mess);
         void loadCaptureInterfaces();
 
         /** build the command line argument processing application*/
@@ -153,6 +165,7 @@ namespace apps {
         std::vector<std::string> targets;  //!< specified targets for the subscriptions
         std::vector<Endpoint> endpoints;  //!< the actual endpoint objects
         std::unique_ptr<Endpoint> cloneEndpoint;  //!< the endpoint for cloned message delivery
+        std::unique_ptr<RecordFileWriter> recordStream;  //!< writer for streaming the captures
         std::vector<std::unique_ptr<Message>> messages;  //!< list of messages
         std::map<helics::InterfaceHandle, int> subids;  //!< map of the subscription ids
         std::map<std::string, int> subkeys;  //!< translate subscription names to an index
@@ -0,0 +1,105 @@
+/*
+Copyright (c) 2017-2022,
+Battelle Memorial Institute; Lawrence Livermore National Security, LLC; Alliance for Sustainable
+Energy, LLC.  See the top-level NOTICE for additional details. All rights reserved.
+SPDX-License-Identifier: BSD-3-Clause
+*/
+
+#include "../common/JsonProcessingFunctions.hpp"
+#include "../common/fmt_format.h"
+#include "../core/FlightRecorder.hpp"
+#include "../core/helicsCLI11.hpp"
+
+#include <fstream>
+#include <iostream>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+/** program to convert a binary flight recorder dump generated with the --dumplog_file option of
+a broker or core into readable text or JSON*/
+
+static std::string timestampString(std::int64_t timestamp)
+{
+    return fmt::format("{}.{:09d}", timestamp / 1000000000, timestamp % 1000000000);
+}
+
+static std::string generateText(const std::vector<helics::FlightRecord>& records)
+{
+    std::string output;
+    for (const auto& rec : records) {
+        output.append(fmt::format("[{}] {} cmd:{} from {} to {}{}\n",
+                                  rec.sequence,
+                                  timestampString(rec.timestamp),
+                                  helics::prettyPrintString(rec.message),
+                                  rec.message.source_id.baseValue(),
+                                  rec.message.dest_id.baseValue(),
+                                  rec.truncated ? " (truncated)" : ""));
+    }
+    return output;
+}
+
+static std::string generateJson(const std::vector<helics::FlightRecord>& records)
+{
+    Json::Value base = Json::arrayValue;
+    for (const auto& rec : records) {
+        Json::Value entry;
+        entry["sequence"] = static_cast<Json::UInt64>(rec.sequence);
+        entry["timestamp"] = static_cast<Json::Int64>(rec.timestamp);
+        entry["truncated"] = rec.truncated;
+        entry["action"] = helics::actionMessageType(rec.message.action());
+        entry["message"] = helics::prettyPrintString(rec.message);
+        entry["fields"] = helics::fileops::loadJsonStr(rec.message.to_json_string());
+        base.append(std::move(entry));
+    }
+    return helics::fileops::generateJsonString(base);
+}
+
+int main(int argc, char* argv[])  // NOLINT
+{
+    std::string input;
+    std::string output;
+    bool json{false};
+
+    helics::helicsCLI11App cmdLine(
+        "convert a binary flight recorder dump from a broker or core to text or JSON",
+        "helics_flight_decoder");
+    cmdLine.add_option("input", input, "the flight recorder dump file")
+        ->required()
+        ->check(CLI::ExistingFile);
+    cmdLine.add_option("-o,--output", output, "the file to write to, the console if not given");
+    cmdLine.add_flag("--json", json, "generate JSON instead of text");
+    auto res = cmdLine.helics_parse(argc, argv);
+    if (res != helics::helicsCLI11App::parse_output::ok) {
+        switch (res) {
+            case helics::helicsCLI11App::parse_output::help_call:
+            case helics::helicsCLI11App::parse_output::help_all_call:
+            case helics::helicsCLI11App::parse_output::version_call:
+                return 0;
+            default:
+                return static_cast<int>(res);
+        }
+    }
+    try {
+        auto records = helics::FlightRecorder::decodeFile(input);
+        auto result = json ? generateJson(records) : generateText(records);
+        if (output.empty()) {
+            std::cout << result;
+            if (json) {
+                std::cout << '\n';
+            }
+        } else {
+            std::ofstream out(output);
+            out << result;
+            if (!out) {
+                std::cerr << "unable to write to " << output << std::endl;
+                return -3;
+            }
+        }
+    }
+    catch (const std::invalid_argument& ia) {
+        std::cerr << ia.what() << std::endl;
+        return -2;
+    }
+    return 0;
+}
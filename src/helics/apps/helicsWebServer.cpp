@@ -244,6 +244,10 @@ std::pair<return_val, std::string>
                 command = cmd::query;
                 query = "status";
             }
+            if (cmdstr == "latency") {
+                command = cmd::query;
+                query = "latency";
+            }
             if (cmdstr == "create") {
                 command = cmd::create;
             }
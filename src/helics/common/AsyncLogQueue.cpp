@@ -0,0 +1,254 @@
+/*
+Copyright (c) 2017-2022,
+Battelle Memorial Institute; Lawrence Livermore National Security, LLC; Alliance for Sustainable
+Energy, LLC.  See the top-level NOTICE for additional details. All rights reserved.
+SPDX-License-Identifier: BSD-3-Clause
+*/
+
+#include "AsyncLogQueue.hpp"
+
+#include <chrono>
+#include <utility>
+
+namespace helics {
+/// the maximum number of records written between flushes
+static constexpr std::size_t maxBatchSize{256};
+/// the longest a blocked producer waits before checking the queue again
+static constexpr std::chrono::milliseconds blockedWaitTime{10};
+
+AsyncLogQueue::AsyncLogQueue(std::size_t capacity,
+                             LogOverflowPolicy overflowPolicy,
+                             Writer writerFunction,
+                             Flusher flushFunction):
+    policy(overflowPolicy),
+    writer(std::move(writerFunction)), flusher(std::move(flushFunction))
+{
+    std::size_t cap{2};
+    while (cap < capacity) {
+        cap <<= 1U;
+    }
+    slots = std::make_unique<Slot[]>(cap);
+    for (std::size_t ii = 0; ii < cap; ++ii) {
+        slots[ii].sequence.store(ii, std::memory_order_relaxed);
+    }
+    mask = cap - 1;
+    writerThread = std::thread(&AsyncLogQueue::processQueue, this);
+}
+
+AsyncLogQueue::~AsyncLogQueue()
+{
+    stop();
+}
+
+bool AsyncLogQueue::push(int level,
+                         std::string_view header,
+                         std::string_view message,
+                         bool alwaysLog)
+{
+    if (!running.load()) {
+        // the writer is gone so write the record directly
+        LogRecord record{level, alwaysLog, std::string(header), std::string(message)};
+        if (writer) {
+            writer(record);
+        }
+        return true;
+    }
+    bool complete{true};
+    while (!tryEnqueue(level, header, message, alwaysLog)) {
+        switch (policy) {
+            case LogOverflowPolicy::drop_newest:
+                ++droppedCount;
+                return false;
+            case LogOverflowPolicy::drop_oldest: {
+                LogRecord oldest;
+                if (tryDequeue(oldest)) {
+                    ++droppedCount;
+                    complete = false;
+                }
+            } break;
+            case LogOverflowPolicy::block:
+            default: {
+                if (std::this_thread::get_id() == writerThread.get_id()) {
+                    // the writer generated a log message and can't wait on itself
+                    ++droppedCount;
+                    return false;
+                }
+                auto completed = completedPos.load();
+                notify();
+                // the writer signals the flush condition after every batch it writes
+                std::unique_lock<std::mutex> lock(parkLock);
+                flushCondition.wait_for(lock, blockedWaitTime, [this, completed] {
+                    return completedPos.load() != completed || !running.load();
+                });
+            } break;
+        }
+    }
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+    if (!running.load(std::memory_order_relaxed)) {
+        // stop() may have finished draining the queue before the record was added
+        drain();
+        return complete;
+    }
+    notify();
+    return complete;
+}
+
+void AsyncLogQueue::flush()
+{
+    if (!running.load() || std::this_thread::get_id() == writerThread.get_id()) {
+        if (flusher) {
+            flusher();
+        }
+        return;
+    }
+    auto target = enqueuePos.load();
+    std::unique_lock<std::mutex> lock(parkLock);
+    condition.notify_one();
+    flushCondition.wait(lock, [this, target] {
+        return completedPos.load() >= target || !running.load();
+    });
+}
+
+void AsyncLogQueue::stop()
+{
+    if (!running.exchange(false)) {
+        return;
+    }
+    {
+        std::lock_guard<std::mutex> lock(parkLock);
+        condition.notify_one();
+    }
+    if (writerThread.joinable()) {
+        writerThread.join();
+    }
+    // pick up records pushed while the writer thread was finishing
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+    drain();
+    std::lock_guard<std::mutex> lock(parkLock);
+    flushCondition.notify_all();
+}
+
+void AsyncLogQueue::drain()
+{
+    LogRecord record;
+    bool written{false};
+    while (tryDequeue(record)) {
+        if (writer) {
+            writer(record);
+        }
+        written = true;
+    }
+    if (written && flusher) {
+        flusher();
+    }
+}
+
+bool AsyncLogQueue::tryEnqueue(int level,
+                               std::string_view header,
+                               std::string_view message,
+                               bool alwaysLog)
+{
+    auto pos = enqueuePos.load(std::memory_order_relaxed);
+    while (true) {
+        Slot& slot = slots[pos & mask];
+        auto seq = slot.sequence.load(std::memory_order_acquire);
+        auto diff = static_cast<std::intptr_t>(seq) - static_cast<std::intptr_t>(pos);
+        if (diff == 0) {
+            if (enqueuePos.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed)) {
+                slot.record.level = level;
+                slot.record.alwaysLog = alwaysLog;
+                // assign reuses the storage left in the slot by earlier records
+                slot.record.header.assign(header.data(), header.size());
+                slot.record.message.assign(message.data(), message.size());
+                slot.sequence.store(pos + 1, std::memory_order_release);
+                return true;
+            }
+        } else if (diff < 0) {
+            // the ring is full
+            return false;
+        } else {
+            pos = enqueuePos.load(std::memory_order_relaxed);
+        }
+    }
+}
+
+bool AsyncLogQueue::tryDequeue(LogRecord& record)
+{
+    // producers dropping the oldest record also dequeue so this must handle multiple consumers
+    auto pos = dequeuePos.load(std::memory_order_relaxed);
+    while (true) {
+        Slot& slot = slots[pos & mask];
+        auto seq = slot.sequence.load(std::memory_order_acquire);
+        auto diff = static_cast<std::intptr_t>(seq) - static_cast<std::intptr_t>(pos + 1);
+        if (diff == 0) {
+            if (dequeuePos.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed)) {
+                record.level = slot.record.level;
+                record.alwaysLog = slot.record.alwaysLog;
+                record.header.assign(slot.record.header);
+                record.message.assign(slot.record.message);
+                slot.sequence.store(pos + mask + 1, std::memory_order_release);
+                return true;
+            }
+        } else if (diff < 0) {
+            return false;
+        } else {
+            pos = dequeuePos.load(std::memory_order_relaxed);
+        }
+    }
+}
+
+bool AsyncLogQueue::emptyCheck() const
+{
+    auto pos = dequeuePos.load(std::memory_order_acquire);
+    return slots[pos & mask].sequence.load(std::memory_order_acquire) != pos + 1;
+}
+
+void AsyncLogQueue::notify()
+{
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+    if (parked.load(std::memory_order_seq_cst)) {
+        std::lock_guard<std::mutex> lock(parkLock);
+        condition.notify_one();
+    }
+}
+
+void AsyncLogQueue::processQueue()
+{
+    LogRecord record;
+    while (true) {
+        std::size_t count{0};
+        while (count < maxBatchSize && tryDequeue(record)) {
+            if (writer) {
+                writer(record);
+            }
+            ++count;
+        }
+        if (count > 0 && flusher) {
+            flusher();
+        }
+        auto completed = dequeuePos.load();
+        if (completed != completedPos.load()) {
+            completedPos.store(completed);
+            std::lock_guard<std::mutex> lock(parkLock);
+            flushCondition.notify_all();
+        }
+        if (count > 0) {
+            continue;
+        }
+        if (!running.load()) {
+            if (emptyCheck()) {
+                break;
+            }
+            continue;
+        }
+        std::unique_lock<std::mutex> lock(parkLock);
+        parked.store(true, std::memory_order_seq_cst);
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+        condition.wait(lock, [this] {
+            return !emptyCheck() || !running.load() || completedPos.load() < enqueuePos.load();
+        });
+        parked.store(false, std::memory_order_relaxed);
+    }
+}
+
+}  // namespace helics
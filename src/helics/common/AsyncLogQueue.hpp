@@ -0,0 +1,105 @@
+/*
+Copyright (c) 2017-2022,
+Battelle Memorial Institute; Lawrence Livermore National Security, LLC; Alliance for Sustainable
+Energy, LLC.  See the top-level NOTICE for additional details. All rights reserved.
+SPDX-License-Identifier: BSD-3-Clause
+*/
+#pragma once
+
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <string_view>
+#include <thread>
+
+namespace helics {
+/** the action taken when a log record is pushed to a full asynchronous log queue*/
+enum class LogOverflowPolicy : std::uint8_t {
+    block = 0,  //!< wait for the writer to make room
+    drop_oldest = 1,  //!< discard the oldest queued record
+    drop_newest = 2  //!< discard the record being pushed
+};
+
+/** a log record stored in an asynchronous log queue*/
+struct LogRecord {
+    int level{0};
+    bool alwaysLog{false};
+    std::string header;
+    std::string message;
+};
+
+/** a bounded lock free queue of log records written out by a background thread
+@details records are placed into a fixed ring of slots using only atomic operations, the strings
+in a slot are reused so a steady stream of records does not allocate. The writer thread drains the
+records in batches and calls the flush function once per batch instead of once per record*/
+class AsyncLogQueue {
+  public:
+    /** function writing a single record*/
+    using Writer = std::function<void(const LogRecord& record)>;
+    /** function flushing the written records*/
+    using Flusher = std::function<void()>;
+    static constexpr std::size_t cDefaultQueueSize{8192};
+
+    /** construct the queue and start the writer thread
+    @param capacity the number of records the queue holds, rounded up to a power of 2
+    @param policy the action taken if the queue is full
+    @param writer the function called by the writer thread for each record
+    @param flusher the function called by the writer thread after each batch of records*/
+    AsyncLogQueue(std::size_t capacity, LogOverflowPolicy policy, Writer writer, Flusher flusher);
+    /** destructor writes out any queued records and stops the writer thread*/
+    ~AsyncLogQueue();
+    AsyncLogQueue(const AsyncLogQueue&) = delete;
+    AsyncLogQueue& operator=(const AsyncLogQueue&) = delete;
+
+    /** add a record to the queue
+    @return false if the record or an older record was dropped*/
+    bool push(int level, std::string_view header, std::string_view message, bool alwaysLog);
+    /** wait until all the records pushed before the call are written and flushed*/
+    void flush();
+    /** write out the queued records and stop the writer thread*/
+    void stop();
+    /** get the number of records dropped because the queue was full*/
+    std::uint64_t dropped() const { return droppedCount.load(); }
+    /** get the number of records the queue can hold*/
+    std::size_t capacity() const { return mask + 1; }
+    LogOverflowPolicy getPolicy() const { return policy; }
+
+  private:
+    static constexpr std::size_t cacheLine{64};
+    /** a single storage location in the ring*/
+    struct alignas(cacheLine) Slot {
+        std::atomic<std::size_t> sequence{0};
+        LogRecord record;
+    };
+    bool tryEnqueue(int level, std::string_view header, std::string_view message, bool alwaysLog);
+    bool tryDequeue(LogRecord& record);
+    bool emptyCheck() const;
+    /** write out any records left in the queue on the calling thread*/
+    void drain();
+    void notify();
+    void processQueue();
+
+    std::unique_ptr<Slot[]> slots;
+    std::size_t mask{0};
+    alignas(cacheLine) std::atomic<std::size_t> enqueuePos{0};
+    alignas(cacheLine) std::atomic<std::size_t> dequeuePos{0};
+    /// all records before this position have been written and flushed or dropped
+    alignas(cacheLine) std::atomic<std::size_t> completedPos{0};
+    std::atomic<std::uint64_t> droppedCount{0};
+    std::atomic<bool> parked{false};
+    std::atomic<bool> running{true};
+    LogOverflowPolicy policy;
+    Writer writer;
+    Flusher flusher;
+    std::mutex parkLock;
+    std::condition_variable condition;
+    std::condition_variable flushCondition;
+    std::thread writerThread;
+};
+
+}  // namespace helics
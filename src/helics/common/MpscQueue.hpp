@@ -0,0 +1,221 @@
+/*
+Copyright (c) 2017-2022,
+Battelle Memorial Institute; Lawrence Livermore National Security, LLC; Alliance for Sustainable
+Energy, LLC.  See the top-level NOTICE for additional details. All rights reserved.
+SPDX-License-Identifier: BSD-3-Clause
+*/
+#pragma once
+
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <thread>
+#include <utility>
+
+namespace helics {
+/** a multi-producer single consumer queue built on a bounded lock free ring buffer
+@details pushes go into a fixed size ring of slots using only atomic operations, if the ring is
+full the element is placed in a mutex protected overflow queue so a push never blocks or fails.
+The consumer spins for a short period when the queue is empty before parking on a condition
+variable, producers only touch the condition variable if the consumer is actually parked.
+Only a single thread may call pop, try_pop, or clear at a time.
+*/
+template<class T>
+class MpscQueue {
+  private:
+    /** a single storage location in the ring*/
+    struct alignas(64) Slot {
+        std::atomic<std::size_t> sequence{0};
+        std::optional<T> value;
+    };
+    static constexpr std::size_t cacheLine{64};
+
+    std::unique_ptr<Slot[]> slots;
+    std::size_t mask{0};
+    alignas(cacheLine) std::atomic<std::size_t> enqueuePos{0};
+    alignas(cacheLine) std::size_t dequeuePos{0};
+    /// elements taken from the overflow queue by the consumer waiting to be popped
+    std::deque<T> consumerOverflow;
+    alignas(cacheLine) std::atomic<bool> overflowActive{false};
+    std::atomic<bool> parked{false};
+    std::mutex overflowLock;
+    std::deque<T> overflow;
+    std::mutex parkLock;
+    std::condition_variable condition;
+    int spinCount{defaultSpinCount};
+
+  public:
+    static constexpr std::size_t defaultCapacity{1024};
+    /// the default number of loops the consumer checks for new elements before parking
+    static constexpr int defaultSpinCount{2000};
+    /** construct a queue with a ring capacity rounded up to the next power of 2*/
+    explicit MpscQueue(std::size_t capacity = defaultCapacity)
+    {
+        std::size_t cap{2};
+        while (cap < capacity) {
+            cap <<= 1U;
+        }
+        slots = std::make_unique<Slot[]>(cap);
+        for (std::size_t ii = 0; ii < cap; ++ii) {
+            slots[ii].sequence.store(ii, std::memory_order_relaxed);
+        }
+        mask = cap - 1;
+    }
+    MpscQueue(const MpscQueue&) = delete;
+    MpscQueue& operator=(const MpscQueue&) = delete;
+
+    /** get the number of slots in the lock free ring*/
+    std::size_t capacity() const { return mask + 1; }
+    /** set the number of loops the consumer will check for new elements before parking*/
+    void setSpinCount(int spins) { spinCount = spins; }
+
+    /** push an element onto the queue*/
+    template<class Z>
+    void push(Z&& val)
+    {
+        emplace(std::forward<Z>(val));
+    }
+
+    /** construct an element in place on the queue*/
+    template<class... Args>
+    void emplace(Args&&... args)
+    {
+        if (!overflowActive.load(std::memory_order_acquire)) {
+            if (tryEnqueue(std::forward<Args>(args)...)) {
+                notify();
+                return;
+            }
+        }
+        {
+            std::lock_guard<std::mutex> lock(overflowLock);
+            overflow.emplace_back(std::forward<Args>(args)...);
+            overflowActive.store(true, std::memory_order_release);
+        }
+        notify();
+    }
+
+    /** try to pop an element without waiting
+    @return an optional containing the element if one was available*/
+    std::optional<T> try_pop()
+    {
+        if (!consumerOverflow.empty()) {
+            std::optional<T> val(std::move(consumerOverflow.front()));
+            consumerOverflow.pop_front();
+            return val;
+        }
+        auto val = tryDequeue();
+        if (val) {
+            return val;
+        }
+        if (overflowActive.load(std::memory_order_acquire)) {
+            {
+                std::lock_guard<std::mutex> lock(overflowLock);
+                // anything pushed to the ring after this point must be ordered after the overflow
+                consumerOverflow.swap(overflow);
+                overflowActive.store(false, std::memory_order_release);
+            }
+            if (!consumerOverflow.empty()) {
+                std::optional<T> oval(std::move(consumerOverflow.front()));
+                consumerOverflow.pop_front();
+                return oval;
+            }
+        }
+        return std::nullopt;
+    }
+
+    /** pop an element, spinning for a short time then blocking until one is available*/
+    T pop()
+    {
+        for (int ii = 0; ii < spinCount; ++ii) {
+            auto val = try_pop();
+            if (val) {
+                return std::move(*val);
+            }
+            if ((ii & 0x3F) == 0x3F) {
+                std::this_thread::yield();
+            }
+        }
+        while (true) {
+            auto val = try_pop();
+            if (val) {
+                return std::move(*val);
+            }
+            std::unique_lock<std::mutex> lock(parkLock);
+            parked.store(true, std::memory_order_seq_cst);
+            std::atomic_thread_fence(std::memory_order_seq_cst);
+            condition.wait(lock, [this] { return !emptyCheck(); });
+            parked.store(false, std::memory_order_relaxed);
+        }
+    }
+
+    /** check if the queue is empty, only accurate from the consumer thread*/
+    bool empty() const { return consumerOverflow.empty() && emptyCheck(); }
+
+    /** remove all the elements from the queue, must be called from the consumer side*/
+    void clear()
+    {
+        while (try_pop()) {
+        }
+    }
+
+  private:
+    template<class... Args>
+    bool tryEnqueue(Args&&... args)
+    {
+        auto pos = enqueuePos.load(std::memory_order_relaxed);
+        while (true) {
+            Slot& slot = slots[pos & mask];
+            auto seq = slot.sequence.load(std::memory_order_acquire);
+            auto diff = static_cast<std::intptr_t>(seq) - static_cast<std::intptr_t>(pos);
+            if (diff == 0) {
+                if (enqueuePos.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed)) {
+                    slot.value.emplace(std::forward<Args>(args)...);
+                    slot.sequence.store(pos + 1, std::memory_order_release);
+                    return true;
+                }
+            } else if (diff < 0) {
+                // the ring is full
+                return false;
+            } else {
+                pos = enqueuePos.load(std::memory_order_relaxed);
+            }
+        }
+    }
+
+    std::optional<T> tryDequeue()
+    {
+        Slot& slot = slots[dequeuePos & mask];
+        auto seq = slot.sequence.load(std::memory_order_acquire);
+        if (seq != dequeuePos + 1) {
+            return std::nullopt;
+        }
+        std::optional<T> val(std::move(slot.value));
+        slot.value.reset();
+        slot.sequence.store(dequeuePos + mask + 1, std::memory_order_release);
+        ++dequeuePos;
+        return val;
+    }
+
+    bool emptyCheck() const
+    {
+        const Slot& slot = slots[dequeuePos & mask];
+        return slot.sequence.load(std::memory_order_acquire) != dequeuePos + 1 &&
+            !overflowActive.load(std::memory_order_acquire);
+    }
+
+    void notify()
+    {
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+        if (parked.load(std::memory_order_seq_cst)) {
+            std::lock_guard<std::mutex> lock(parkLock);
+            condition.notify_one();
+        }
+    }
+};
+
+}  // namespace helics
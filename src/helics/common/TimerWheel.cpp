@@ -0,0 +1,233 @@
+/*
+Copyright (c) 2017-2022,
+Battelle Memorial Institute; Lawrence Livermore National Security, LLC; Alliance for Sustainable
+Energy, LLC.  See the top-level NOTICE for additional details. All rights reserved.
+SPDX-License-Identifier: BSD-3-Clause
+*/
+#include "TimerWheel.hpp"
+
+#include <algorithm>
+#include <limits>
+
+namespace helics {
+
+static constexpr std::int64_t firstLevelMask{(std::int64_t{1} << TimerWheel::firstLevelBits) - 1};
+static constexpr std::int64_t levelMask{(std::int64_t{1} << TimerWheel::levelBits) - 1};
+
+static unsigned int slotLevel(std::int32_t slot)
+{
+    constexpr auto firstSlots = static_cast<std::int32_t>(1U << TimerWheel::firstLevelBits);
+    return (slot < firstSlots) ?
+        0U :
+        1U + static_cast<unsigned int>((slot - firstSlots) >> TimerWheel::levelBits);
+}
+
+TimerWheel::TimerWheel(std::chrono::nanoseconds resolution_, time_type start):
+    resolution((std::max)(resolution_, std::chrono::nanoseconds(1))), epoch(start)
+{
+    slots.fill(-1);
+}
+
+std::int64_t TimerWheel::tickFor(time_type expiration) const
+{
+    if (expiration <= epoch) {
+        return 0;
+    }
+    auto offset = std::chrono::duration_cast<std::chrono::nanoseconds>(expiration - epoch);
+    // round up so timers never expire early
+    return (offset.count() + resolution.count() - 1) / resolution.count();
+}
+
+std::int32_t TimerWheel::add(time_type expiration)
+{
+    std::int32_t id;
+    if (!freeIds.empty()) {
+        id = freeIds.back();
+        freeIds.pop_back();
+    } else {
+        id = static_cast<std::int32_t>(entries.size());
+        entries.emplace_back();
+    }
+    entries[id].inUse = true;
+    schedule(id, expiration);
+    return id;
+}
+
+void TimerWheel::update(std::int32_t id, time_type expiration)
+{
+    if (!isValid(id)) {
+        return;
+    }
+    if (entries[id].slot >= 0) {
+        unlink(id);
+    }
+    schedule(id, expiration);
+}
+
+void TimerWheel::cancel(std::int32_t id)
+{
+    if (isScheduled(id)) {
+        unlink(id);
+    }
+}
+
+void TimerWheel::release(std::int32_t id)
+{
+    if (!isValid(id)) {
+        return;
+    }
+    cancel(id);
+    entries[id].inUse = false;
+    freeIds.push_back(id);
+}
+
+void TimerWheel::schedule(std::int32_t id, time_type expiration)
+{
+    auto& entry = entries[id];
+    entry.expiration = expiration;
+    // the current tick has already been processed
+    entry.tick = (std::max)(tickFor(expiration), currentTick + 1);
+    place(id);
+}
+
+void TimerWheel::place(std::int32_t id)
+{
+    auto& entry = entries[id];
+    auto tick = entry.tick;
+    if (tick - currentTick >= wheelSpan) {
+        // keep it in the last level until it comes in range
+        tick = currentTick + wheelSpan - 1;
+    }
+    const auto delta = tick - currentTick;
+    unsigned int level{0};
+    // each level covers the ticks up to the span of a slot in the next level
+    while (level < levelCount - 1 && delta >= (std::int64_t{1} << levelShift(level + 1))) {
+        ++level;
+    }
+    const auto mask = (level == 0) ? firstLevelMask : levelMask;
+    const auto slot = static_cast<std::int32_t>(levelOffset(level)) +
+        static_cast<std::int32_t>((tick >> levelShift(level)) & mask);
+    entry.slot = slot;
+    entry.prev = -1;
+    entry.next = slots[slot];
+    if (entry.next >= 0) {
+        entries[entry.next].prev = id;
+    }
+    slots[slot] = id;
+    ++levelCounts[level];
+    ++scheduled;
+}
+
+void TimerWheel::unlink(std::int32_t id)
+{
+    auto& entry = entries[id];
+    if (entry.prev >= 0) {
+        entries[entry.prev].next = entry.next;
+    } else {
+        slots[entry.slot] = entry.next;
+    }
+    if (entry.next >= 0) {
+        entries[entry.next].prev = entry.prev;
+    }
+    --levelCounts[slotLevel(entry.slot)];
+    --scheduled;
+    entry.slot = -1;
+    entry.next = -1;
+    entry.prev = -1;
+}
+
+void TimerWheel::cascade(unsigned int level, std::size_t index)
+{
+    const auto slot = levelOffset(level) + index;
+    auto id = slots[slot];
+    while (id >= 0) {
+        auto next = entries[id].next;
+        unlink(id);
+        place(id);
+        id = next;
+    }
+}
+
+void TimerWheel::advance(time_type now, std::vector<std::int32_t>& expired)
+{
+    const auto target = (now <= epoch) ?
+        std::int64_t{0} :
+        std::chrono::duration_cast<std::chrono::nanoseconds>(now - epoch).count() /
+            resolution.count();
+    while (currentTick < target) {
+        if (scheduled == 0) {
+            currentTick = target;
+            break;
+        }
+        if (levelCounts[0] == 0) {
+            // nothing can expire before the lowest occupied level cascades
+            unsigned int level{1};
+            while (levelCounts[level] == 0) {
+                ++level;
+            }
+            const auto shift = levelShift(level);
+            const auto boundary = ((currentTick >> shift) + 1) << shift;
+            if (boundary > target) {
+                currentTick = target;
+                break;
+            }
+            currentTick = boundary - 1;
+        }
+        ++currentTick;
+        if ((currentTick & firstLevelMask) == 0) {
+            for (unsigned int level = 1; level < levelCount; ++level) {
+                const auto index =
+                    static_cast<std::size_t>((currentTick >> levelShift(level)) & levelMask);
+                cascade(level, index);
+                if (index != 0) {
+                    break;
+                }
+            }
+        }
+        auto id = slots[static_cast<std::size_t>(currentTick & firstLevelMask)];
+        while (id >= 0) {
+            auto next = entries[id].next;
+            unlink(id);
+            if (entries[id].tick <= currentTick) {
+                expired.push_back(id);
+            } else {
+                place(id);
+            }
+            id = next;
+        }
+    }
+}
+
+TimerWheel::time_type TimerWheel::nextWakeTime() const
+{
+    if (scheduled == 0) {
+        return time_type::max();
+    }
+    auto nextTick = (std::numeric_limits<std::int64_t>::max)();
+    if (levelCounts[0] > 0) {
+        for (std::int64_t tick = currentTick + 1; tick <= currentTick + firstLevelMask; ++tick) {
+            if (slots[static_cast<std::size_t>(tick & firstLevelMask)] >= 0) {
+                nextTick = tick;
+                break;
+            }
+        }
+    }
+    // the timers in the higher levels need to be cascaded before they can expire
+    for (unsigned int level = 1; level < levelCount; ++level) {
+        if (levelCounts[level] == 0) {
+            continue;
+        }
+        const auto shift = levelShift(level);
+        const auto base = currentTick >> shift;
+        for (std::int64_t step = 1; step <= levelMask + 1; ++step) {
+            const auto index = static_cast<std::size_t>((base + step) & levelMask);
+            if (slots[levelOffset(level) + index] >= 0) {
+                nextTick = (std::min)(nextTick, (base + step) << shift);
+                break;
+            }
+        }
+    }
+    return tickTime(nextTick);
+}
+
+}  // namespace helics
@@ -0,0 +1,114 @@
+/*
+Copyright (c) 2017-2022,
+Battelle Memorial Institute; Lawrence Livermore National Security, LLC; Alliance for Sustainable
+Energy, LLC.  See the top-level NOTICE for additional details. All rights reserved.
+SPDX-License-Identifier: BSD-3-Clause
+*/
+#pragma once
+
+#include <array>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace helics {
+/** hashed hierarchical timer wheel
+@details time is divided into ticks of a fixed resolution, the first level of the wheel has a slot
+for each of the next 256 ticks and each of the 3 higher levels has 64 slots each covering 64 times
+the span of a slot in the level below, so the wheel covers 2^26 ticks; timers further out are kept
+in the last level until they come in range.  Each timer is identified by an id which can be
+rescheduled and cancelled in constant time, the ids of released timers are reused by later
+timers.  Timers never expire before their expiration time but may expire up to one tick after it.
+The wheel is not thread safe.*/
+class TimerWheel {
+  public:
+    using time_type = std::chrono::steady_clock::time_point;
+    static constexpr unsigned int firstLevelBits{8};
+    static constexpr unsigned int levelBits{6};
+    static constexpr unsigned int levelCount{4};
+    /// the number of ticks covered by the wheel
+    static constexpr std::int64_t wheelSpan{std::int64_t{1}
+                                            << (firstLevelBits + levelBits * (levelCount - 1))};
+
+    /** construct the wheel
+    @param resolution the length of a tick
+    @param start the time of tick 0*/
+    explicit TimerWheel(std::chrono::nanoseconds resolution = std::chrono::milliseconds(1),
+                        time_type start = std::chrono::steady_clock::now());
+
+    /** add a timer
+    @return the id of the timer*/
+    std::int32_t add(time_type expiration);
+    /** schedule a timer for a new expiration time, the timer is rescheduled if it was cancelled
+    or has expired*/
+    void update(std::int32_t id, time_type expiration);
+    /** stop a timer from expiring, the id remains valid*/
+    void cancel(std::int32_t id);
+    /** cancel a timer and release its id for reuse by a later timer*/
+    void release(std::int32_t id);
+    /** advance the wheel to a time
+    @param now the current time
+    @param expired the ids of the timers expiring are appended to this vector*/
+    void advance(time_type now, std::vector<std::int32_t>& expired);
+
+    /** check if an id refers to a timer that has not been released*/
+    bool isValid(std::int32_t id) const
+    {
+        return id >= 0 && id < static_cast<std::int32_t>(entries.size()) && entries[id].inUse;
+    }
+    /** check if a timer is waiting to expire*/
+    bool isScheduled(std::int32_t id) const { return isValid(id) && entries[id].slot >= 0; }
+    /** get the most recent expiration time of a timer*/
+    time_type expiration(std::int32_t id) const { return entries[id].expiration; }
+    /** get the number of timers waiting to expire*/
+    std::size_t scheduledCount() const { return scheduled; }
+    /** get the number of ids that have been allocated*/
+    std::size_t capacity() const { return entries.size(); }
+    /** get the next time the wheel needs to be advanced for timers to expire on time
+    @return time_type::max() if no timers are scheduled*/
+    time_type nextWakeTime() const;
+
+  private:
+    struct Entry {
+        time_type expiration{};
+        std::int64_t tick{0};
+        std::int32_t next{-1};
+        std::int32_t prev{-1};
+        std::int32_t slot{-1};  //!< the slot holding the timer, -1 if it is not scheduled
+        bool inUse{false};
+    };
+    static constexpr std::size_t firstLevelSlots{std::size_t{1} << firstLevelBits};
+    static constexpr std::size_t levelSlots{std::size_t{1} << levelBits};
+    static constexpr std::size_t slotCount{firstLevelSlots + levelSlots * (levelCount - 1)};
+
+    /** get the bit shift of the slot index for a level*/
+    static unsigned int levelShift(unsigned int level)
+    {
+        return (level == 0) ? 0U : firstLevelBits + levelBits * (level - 1);
+    }
+    /** get the first slot of a level*/
+    static std::size_t levelOffset(unsigned int level)
+    {
+        return (level == 0) ? 0U : firstLevelSlots + levelSlots * (level - 1);
+    }
+    std::int64_t tickFor(time_type expiration) const;
+    time_type tickTime(std::int64_t tick) const { return epoch + resolution * tick; }
+    void schedule(std::int32_t id, time_type expiration);
+    /** put a scheduled timer in the slot matching its tick*/
+    void place(std::int32_t id);
+    /** remove a timer from its slot*/
+    void unlink(std::int32_t id);
+    /** move the timers in a slot of a higher level to the lower levels*/
+    void cascade(unsigned int level, std::size_t index);
+
+    std::chrono::nanoseconds resolution;
+    time_type epoch;
+    std::int64_t currentTick{0};  //!< the last tick processed
+    std::size_t scheduled{0};
+    std::array<std::int32_t, slotCount> slots;  //!< the first timer in each slot
+    std::array<std::size_t, levelCount> levelCounts{};  //!< the number of timers in each level
+    std::vector<Entry> entries;
+    std::vector<std::int32_t> freeIds;
+};
+}  // namespace helics
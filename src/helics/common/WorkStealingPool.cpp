@@ -0,0 +1,146 @@
+/*
+Copyright (c) 2017-2022,
+Battelle Memorial Institute; Lawrence Livermore National Security, LLC; Alliance for Sustainable
+Energy, LLC.  See the top-level NOTICE for additional details. All rights reserved.
+SPDX-License-Identifier: BSD-3-Clause
+*/
+
+#include "WorkStealingPool.hpp"
+
+#include <utility>
+
+namespace helics {
+/// the number of times a worker looks for tasks before parking
+static constexpr int workerSpinCount{64};
+
+/// the pool and queue index of the worker running on the current thread
+static thread_local const WorkStealingPool* currentPool{nullptr};
+static thread_local std::size_t currentWorker{0};
+
+WorkStealingPool::WorkStealingPool(std::size_t threadCount)
+{
+    if (threadCount == 0) {
+        threadCount = std::thread::hardware_concurrency();
+        if (threadCount == 0) {
+            threadCount = 1;
+        }
+    }
+    workers.reserve(threadCount);
+    for (std::size_t ii = 0; ii < threadCount; ++ii) {
+        workers.push_back(std::make_unique<Worker>());
+    }
+    for (std::size_t ii = 0; ii < threadCount; ++ii) {
+        workers[ii]->thread = std::thread(&WorkStealingPool::processWorker, this, ii);
+    }
+}
+
+WorkStealingPool::~WorkStealingPool()
+{
+    stop();
+}
+
+bool WorkStealingPool::submit(Task task)
+{
+    if (!running.load() || !task) {
+        return false;
+    }
+    auto index = (currentPool == this) ? currentWorker : (nextWorker++ % workers.size());
+    {
+        std::lock_guard<std::mutex> lock(workers[index]->lock);
+        workers[index]->tasks.push_back(std::move(task));
+    }
+    ++pending;
+    notify();
+    return true;
+}
+
+void WorkStealingPool::stop()
+{
+    if (!running.exchange(false)) {
+        return;
+    }
+    {
+        std::lock_guard<std::mutex> lock(parkLock);
+        condition.notify_all();
+    }
+    for (auto& worker : workers) {
+        if (worker->thread.joinable()) {
+            worker->thread.join();
+        }
+    }
+}
+
+bool WorkStealingPool::popTask(std::size_t index, Task& task)
+{
+    auto& worker = *workers[index];
+    std::lock_guard<std::mutex> lock(worker.lock);
+    if (worker.tasks.empty()) {
+        return false;
+    }
+    task = std::move(worker.tasks.front());
+    worker.tasks.pop_front();
+    return true;
+}
+
+bool WorkStealingPool::stealTask(std::size_t index, Task& task)
+{
+    for (std::size_t offset = 1; offset < workers.size(); ++offset) {
+        auto& victim = *workers[(index + offset) % workers.size()];
+        std::unique_lock<std::mutex> lock(victim.lock, std::try_to_lock);
+        if (!lock.owns_lock() || victim.tasks.empty()) {
+            continue;
+        }
+        task = std::move(victim.tasks.back());
+        victim.tasks.pop_back();
+        ++stolen;
+        return true;
+    }
+    return false;
+}
+
+void WorkStealingPool::notify()
+{
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+    if (parked.load(std::memory_order_seq_cst) > 0) {
+        std::lock_guard<std::mutex> lock(parkLock);
+        condition.notify_one();
+    }
+}
+
+void WorkStealingPool::processWorker(std::size_t index)
+{
+    currentPool = this;
+    currentWorker = index;
+    Task task;
+    int spins{0};
+    while (true) {
+        if (popTask(index, task) || stealTask(index, task)) {
+            --pending;
+            task();
+            task = nullptr;
+            spins = 0;
+            continue;
+        }
+        if (pending.load() > 0) {
+            // a task is queued on a worker that was locked while the queues were checked
+            std::this_thread::yield();
+            continue;
+        }
+        if (!running.load()) {
+            break;
+        }
+        if (++spins < workerSpinCount) {
+            std::this_thread::yield();
+            continue;
+        }
+        spins = 0;
+        std::unique_lock<std::mutex> lock(parkLock);
+        ++parked;
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+        condition.wait(lock, [this] { return pending.load() > 0 || !running.load(); });
+        --parked;
+    }
+    currentPool = nullptr;
+}
+
+}  // namespace helics
@@ -0,0 +1,72 @@
+/*
+Copyright (c) 2017-2022,
+Battelle Memorial Institute; Lawrence Livermore National Security, LLC; Alliance for Sustainable
+Energy, LLC.  See the top-level NOTICE for additional details. All rights reserved.
+SPDX-License-Identifier: BSD-3-Clause
+*/
+#pragma once
+
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace helics {
+/** a pool of threads running short tasks
+@details each thread has its own queue of tasks, tasks submitted by a task running on the pool go
+to the queue of that thread and other tasks are spread over the queues in turn.  A thread with an
+empty queue takes tasks from the back of the queues of the other threads before it parks, so a
+burst of tasks submitted from one thread is shared by the whole pool*/
+class WorkStealingPool {
+  public:
+    /** a task run by the pool*/
+    using Task = std::function<void()>;
+    /** construct the pool and start the threads
+    @param threadCount the number of threads, 0 to use the number of hardware threads*/
+    explicit WorkStealingPool(std::size_t threadCount);
+    /** destructor runs the queued tasks and stops the threads*/
+    ~WorkStealingPool();
+    WorkStealingPool(const WorkStealingPool&) = delete;
+    WorkStealingPool& operator=(const WorkStealingPool&) = delete;
+
+    /** add a task to the pool
+    @return false if the pool has been stopped and the task was not queued*/
+    bool submit(Task task);
+    /** run the queued tasks and stop the threads, tasks submitted after the call are dropped*/
+    void stop();
+    /** get the number of threads in the pool*/
+    std::size_t size() const { return workers.size(); }
+    /** get the number of tasks run by a thread other than the one they were queued on*/
+    std::uint64_t stolenCount() const { return stolen.load(); }
+
+  private:
+    static constexpr std::size_t cacheLine{64};
+    /** the task queue and thread of a worker*/
+    struct alignas(cacheLine) Worker {
+        std::mutex lock;
+        std::deque<Task> tasks;
+        std::thread thread;
+    };
+    bool popTask(std::size_t index, Task& task);
+    bool stealTask(std::size_t index, Task& task);
+    void notify();
+    void processWorker(std::size_t index);
+
+    std::vector<std::unique_ptr<Worker>> workers;
+    std::atomic<std::size_t> nextWorker{0};
+    /// the number of queued tasks that have not been taken by a worker
+    std::atomic<std::int64_t> pending{0};
+    std::atomic<int> parked{0};
+    std::atomic<bool> running{true};
+    std::atomic<std::uint64_t> stolen{0};
+    std::mutex parkLock;
+    std::condition_variable condition;
+};
+
+}  // namespace helics
@@ -14,6 +14,7 @@ SPDX-License-Identifier: BSD-3-Clause
 
 #include "../common/JsonProcessingFunctions.hpp"
 #include "../common/fmt_format.h"
+#include "CompactStringTable.hpp"
 #include "flagOperations.hpp"
 #include "gmlc/utilities/base64.h"
 
@@ -22,6 +23,7 @@ SPDX-License-Identifier: BSD-3-Clause
 #include <cstring>
 #include <frozen/string.h>
 #include <frozen/unordered_map.h>
+#include <optional>
 #include <ostream>
 #include <utility>
 #include <vector>
@@ -44,8 +46,8 @@ ActionMessage::ActionMessage(ActionMessage&& act) noexcept:
     messageAction(act.messageAction), messageID(act.messageID), source_id(act.source_id),
     source_handle(act.source_handle), dest_id(act.dest_id), dest_handle(act.dest_handle),
     counter(act.counter), flags(act.flags), sequenceID(act.sequenceID), actionTime(act.actionTime),
-    Te(act.Te), Tdemin(act.Tdemin), Tso(act.Tso), payload(std::move(act.payload)),
-    stringData(std::move(act.stringData))
+    Te(act.Te), Tdemin(act.Tdemin), Tso(act.Tso), trackingTime(act.trackingTime),
+    payload(std::move(act.payload)), stringData(std::move(act.stringData))
 {
 }
 
@@ -53,9 +55,13 @@ ActionMessage::ActionMessage(const ActionMessage& act):
     messageAction(act.messageAction), messageID(act.messageID), source_id(act.source_id),
     source_handle(act.source_handle), dest_id(act.dest_id), dest_handle(act.dest_handle),
     counter(act.counter), flags(act.flags), sequenceID(act.sequenceID), actionTime(act.actionTime),
-    Te(act.Te), Tdemin(act.Tdemin), Tso(act.Tso), payload(act.payload), stringData(act.stringData)
-
+    Te(act.Te), Tdemin(act.Tdemin), Tso(act.Tso), trackingTime(act.trackingTime),
+    payload(act.payload)
 {
+    if (!act.stringData.empty()) {
+        prepareStringData(act.stringData.size());
+        std::copy(act.stringData.begin(), act.stringData.end(), stringData.begin());
+    }
 }
 
 ActionMessage::ActionMessage(std::unique_ptr<Message> message):
@@ -83,7 +89,14 @@ ActionMessage::ActionMessage(const void* data, size_t size): ActionMessage()
     from_string(std::string_view(static_cast<const char*>(data), size));
 }
 
-ActionMessage::~ActionMessage() = default;
+ActionMessage::~ActionMessage()
+{
+#ifdef HELICS_ENABLE_BUFFER_POOL
+    if (stringData.capacity() > 0) {
+        pool::releaseStrings(stringData);
+    }
+#endif
+}
 
 ActionMessage& ActionMessage::operator=(const ActionMessage& act)  // NOLINT
 {
@@ -100,8 +113,10 @@ ActionMessage& ActionMessage::operator=(const ActionMessage& act)  // NOLINT
     Te = act.Te;
     Tdemin = act.Tdemin;
     Tso = act.Tso;
+    trackingTime = act.trackingTime;
     payload = act.payload;
-    stringData = act.stringData;
+    prepareStringData(act.stringData.size());
+    std::copy(act.stringData.begin(), act.stringData.end(), stringData.begin());
     return *this;
 }
 
@@ -120,7 +135,13 @@ ActionMessage& ActionMessage::operator=(ActionMessage&& act) noexcept
     Te = act.Te;
     Tdemin = act.Tdemin;
     Tso = act.Tso;
+    trackingTime = act.trackingTime;
     payload = std::move(act.payload);
+#ifdef HELICS_ENABLE_BUFFER_POOL
+    if (stringData.capacity() > 0) {
+        pool::releaseStrings(stringData);
+    }
+#endif
     stringData = std::move(act.stringData);
     return *this;
 }
@@ -388,6 +409,343 @@ void ActionMessage::to_string(std::string& data) const
     toByteArray(reinterpret_cast<std::byte*>(&(data[0])), sz);
 }
 
+// the compact serialization starts with a marker byte that can't be the first byte of the other
+// formats (the endianness byte, a json object or a packet header)
+constexpr auto COMPACT_MARKER = std::byte{0xC5};
+
+namespace compact {
+    // bits of the field mask indicating which fields are present in a compact message
+    constexpr std::uint32_t messageIdBit{0x0001U};
+    constexpr std::uint32_t sourceIdBit{0x0002U};
+    constexpr std::uint32_t sourceHandleBit{0x0004U};
+    constexpr std::uint32_t destIdBit{0x0008U};
+    constexpr std::uint32_t destHandleBit{0x0010U};
+    constexpr std::uint32_t counterBit{0x0020U};
+    constexpr std::uint32_t flagsBit{0x0040U};
+    constexpr std::uint32_t sequenceBit{0x0080U};
+    constexpr std::uint32_t actionTimeBit{0x0100U};
+    constexpr std::uint32_t teBit{0x0200U};
+    constexpr std::uint32_t tdeminBit{0x0400U};
+    constexpr std::uint32_t tsoBit{0x0800U};
+    constexpr std::uint32_t payloadBit{0x1000U};
+    constexpr std::uint32_t stringsBit{0x2000U};
+    /// the strings were encoded using a string table
+    constexpr std::uint32_t internedBit{0x4000U};
+    /// the receiver should clear its string table before reading the message
+    constexpr std::uint32_t tableResetBit{0x8000U};
+
+    constexpr std::size_t maxVarintSize{10};
+
+    inline std::uint64_t zigzag(std::int64_t val)
+    {
+        return (static_cast<std::uint64_t>(val) << 1U) ^ static_cast<std::uint64_t>(val >> 63);
+    }
+
+    inline std::int64_t unzigzag(std::uint64_t val)
+    {
+        return static_cast<std::int64_t>(val >> 1U) ^ -static_cast<std::int64_t>(val & 1U);
+    }
+
+    inline std::byte* writeVarint(std::byte* data, std::uint64_t val)
+    {
+        while (val >= 0x80U) {
+            *data = std::byte(static_cast<std::uint8_t>(val | 0x80U));
+            ++data;
+            val >>= 7U;
+        }
+        *data = std::byte(static_cast<std::uint8_t>(val));
+        return data + 1;
+    }
+
+    inline bool readVarint(const std::byte*& data, const std::byte* end, std::uint64_t& val)
+    {
+        val = 0;
+        for (unsigned int shift = 0; shift < 64U; shift += 7U) {
+            if (data >= end) {
+                return false;
+            }
+            auto byte = std::to_integer<std::uint64_t>(*data);
+            ++data;
+            val |= (byte & 0x7FU) << shift;
+            if ((byte & 0x80U) == 0) {
+                return true;
+            }
+        }
+        return false;
+    }
+
+    inline bool readSigned(const std::byte*& data, const std::byte* end, std::int64_t& val)
+    {
+        std::uint64_t raw{0};
+        if (!readVarint(data, end, raw)) {
+            return false;
+        }
+        val = unzigzag(raw);
+        return true;
+    }
+
+    /** the largest number of bytes a message could require in the compact serialization*/
+    inline std::size_t byteCountBound(const ActionMessage& cmd)
+    {
+        // marker, mask, action, 5 ids, counter, flags, sequence, 4 times, payload size, count
+        std::size_t size = 1 + 3 + 12 * maxVarintSize + 2 * 3 + 2 + cmd.payload.size();
+        for (const auto& str : cmd.getStringData()) {
+            size += maxVarintSize + str.size();
+        }
+        return size;
+    }
+
+    inline std::byte*
+        writeString(std::byte* data, std::string_view str, CompactStringTable* table)
+    {
+        if (table != nullptr) {
+            auto index = table->find(str);
+            if (index >= 0) {
+                return writeVarint(data, (static_cast<std::uint64_t>(index) << 1U) | 1U);
+            }
+            if (table->shouldIntern(str)) {
+                table->add(str);
+            }
+        }
+        data = writeVarint(data, static_cast<std::uint64_t>(str.size()) << 1U);
+        std::memcpy(data, str.data(), str.size());
+        return data + str.size();
+    }
+}  // namespace compact
+
+int ActionMessage::toCompactByteArray(std::byte* data,
+                                      std::size_t buffer_size,
+                                      CompactStringTable* table) const
+{
+    if ((data == nullptr) || buffer_size < compact::byteCountBound(*this)) {
+        return -1;
+    }
+    std::uint32_t mask{0};
+    mask |= (messageID != 0) ? compact::messageIdBit : 0U;
+    mask |= (source_id != parent_broker_id) ? compact::sourceIdBit : 0U;
+    mask |= (source_handle != InterfaceHandle{}) ? compact::sourceHandleBit : 0U;
+    mask |= (dest_id != parent_broker_id) ? compact::destIdBit : 0U;
+    mask |= (dest_handle != InterfaceHandle{}) ? compact::destHandleBit : 0U;
+    mask |= (counter != 0) ? compact::counterBit : 0U;
+    mask |= (flags != 0) ? compact::flagsBit : 0U;
+    mask |= (sequenceID != 0) ? compact::sequenceBit : 0U;
+    mask |= (actionTime != timeZero) ? compact::actionTimeBit : 0U;
+    mask |= (Te != timeZero) ? compact::teBit : 0U;
+    mask |= (Tdemin != timeZero) ? compact::tdeminBit : 0U;
+    mask |= (Tso != timeZero) ? compact::tsoBit : 0U;
+    mask |= (!payload.empty()) ? compact::payloadBit : 0U;
+    mask |= (!stringData.empty()) ? compact::stringsBit : 0U;
+    if (table != nullptr) {
+        mask |= compact::internedBit;
+        if (!table->isActive()) {
+            table->clear();
+            table->setActive();
+            mask |= compact::tableResetBit;
+        }
+    }
+    std::byte* dataStart = data;
+    *data = COMPACT_MARKER;
+    ++data;
+    data = compact::writeVarint(data, mask);
+    data = compact::writeVarint(data, compact::zigzag(messageAction));
+    if ((mask & compact::messageIdBit) != 0) {
+        data = compact::writeVarint(data, compact::zigzag(messageID));
+    }
+    if ((mask & compact::sourceIdBit) != 0) {
+        data = compact::writeVarint(data, compact::zigzag(source_id.baseValue()));
+    }
+    if ((mask & compact::sourceHandleBit) != 0) {
+        data = compact::writeVarint(data, compact::zigzag(source_handle.baseValue()));
+    }
+    if ((mask & compact::destIdBit) != 0) {
+        data = compact::writeVarint(data, compact::zigzag(dest_id.baseValue()));
+    }
+    if ((mask & compact::destHandleBit) != 0) {
+        data = compact::writeVarint(data, compact::zigzag(dest_handle.baseValue()));
+    }
+    if ((mask & compact::counterBit) != 0) {
+        data = compact::writeVarint(data, counter);
+    }
+    if ((mask & compact::flagsBit) != 0) {
+        data = compact::writeVarint(data, flags);
+    }
+    if ((mask & compact::sequenceBit) != 0) {
+        data = compact::writeVarint(data, sequenceID);
+    }
+    if ((mask & compact::actionTimeBit) != 0) {
+        data = compact::writeVarint(data, compact::zigzag(actionTime.getBaseTimeCode()));
+    }
+    if ((mask & compact::teBit) != 0) {
+        data = compact::writeVarint(data, compact::zigzag(Te.getBaseTimeCode()));
+    }
+    if ((mask & compact::tdeminBit) != 0) {
+        data = compact::writeVarint(data, compact::zigzag(Tdemin.getBaseTimeCode()));
+    }
+    if ((mask & compact::tsoBit) != 0) {
+        data = compact::writeVarint(data, compact::zigzag(Tso.getBaseTimeCode()));
+    }
+    if ((mask & compact::payloadBit) != 0) {
+        data = compact::writeVarint(data, payload.size());
+        std::memcpy(data, payload.data(), payload.size());
+        data += payload.size();
+    }
+    if ((mask & compact::stringsBit) != 0) {
+        data = compact::writeVarint(data, stringData.size());
+        for (const auto& str : stringData) {
+            data = compact::writeString(data, str, table);
+        }
+    }
+    return static_cast<int>(data - dataStart);
+}
+
+void ActionMessage::to_compact_string(std::string& data, CompactStringTable* table) const
+{
+    data.resize(compact::byteCountBound(*this));
+    auto sz = toCompactByteArray(reinterpret_cast<std::byte*>(&(data[0])), data.size(), table);
+    data.resize(static_cast<std::size_t>(sz));
+}
+
+std::string ActionMessage::to_compact_string() const
+{
+    std::string data;
+    to_compact_string(data);
+    return data;
+}
+
+void ActionMessage::packetize_compact(std::string& data, CompactStringTable* table) const
+{
+    data.resize(sizeof(uint32_t) + compact::byteCountBound(*this));
+    auto sz = toCompactByteArray(reinterpret_cast<std::byte*>(&(data[4])), data.size() - 4, table);
+    data.resize(sizeof(uint32_t) + static_cast<std::size_t>(sz));
+
+    data[0] = LEADING_CHAR;
+    // now generate a length header
+    auto dsz = static_cast<uint32_t>(data.size());
+    data[1] = static_cast<char>(((dsz >> 16U) & 0xFFU));
+    data[2] = static_cast<char>(((dsz >> 8U) & 0xFFU));
+    data[3] = static_cast<char>(dsz & 0xFFU);
+    data.push_back(TAIL_CHAR1);
+    data.push_back(TAIL_CHAR2);
+}
+
+std::size_t ActionMessage::fromCompactByteArray(const std::byte* data,
+                                                std::size_t buffer_size,
+                                                CompactStringTable* table)
+{
+    const std::byte* start = data;
+    const std::byte* end = data + buffer_size;
+    auto fail = [this]() {
+        messageAction = CMD_INVALID;
+        return std::size_t{0};
+    };
+    ++data;  // skip the marker
+    std::uint64_t mask{0};
+    std::int64_t value{0};
+    std::uint64_t uvalue{0};
+    if (!compact::readVarint(data, end, mask) || !compact::readSigned(data, end, value)) {
+        return fail();
+    }
+    messageAction = static_cast<action_message_def::action_t>(value);
+    const bool interned = (mask & compact::internedBit) != 0;
+    if ((mask & compact::tableResetBit) != 0 && table != nullptr) {
+        table->clear();
+    }
+    auto readId = [&](std::uint32_t bit, std::int32_t defValue) -> std::optional<std::int32_t> {
+        if ((mask & bit) == 0) {
+            return defValue;
+        }
+        if (!compact::readSigned(data, end, value)) {
+            return std::nullopt;
+        }
+        return static_cast<std::int32_t>(value);
+    };
+    auto readTime = [&](std::uint32_t bit, Time& time) {
+        if ((mask & bit) == 0) {
+            time = timeZero;
+            return true;
+        }
+        if (!compact::readSigned(data, end, value)) {
+            return false;
+        }
+        time.setBaseTimeCode(value);
+        return true;
+    };
+    auto readUnsigned = [&](std::uint32_t bit) -> std::optional<std::uint64_t> {
+        if ((mask & bit) == 0) {
+            return std::uint64_t{0};
+        }
+        if (!compact::readVarint(data, end, uvalue)) {
+            return std::nullopt;
+        }
+        return uvalue;
+    };
+
+    auto mid = readId(compact::messageIdBit, 0);
+    auto sid = readId(compact::sourceIdBit, parent_broker_id.baseValue());
+    auto shandle = readId(compact::sourceHandleBit, InterfaceHandle{}.baseValue());
+    auto did = readId(compact::destIdBit, parent_broker_id.baseValue());
+    auto dhandle = readId(compact::destHandleBit, InterfaceHandle{}.baseValue());
+    auto cnt = readUnsigned(compact::counterBit);
+    auto flg = readUnsigned(compact::flagsBit);
+    auto seq = readUnsigned(compact::sequenceBit);
+    if (!mid || !sid || !shandle || !did || !dhandle || !cnt || !flg || !seq) {
+        return fail();
+    }
+    messageID = *mid;
+    source_id = GlobalFederateId(*sid);
+    source_handle = InterfaceHandle(*shandle);
+    dest_id = GlobalFederateId(*did);
+    dest_handle = InterfaceHandle(*dhandle);
+    counter = static_cast<std::uint16_t>(*cnt);
+    flags = static_cast<std::uint16_t>(*flg);
+    sequenceID = static_cast<std::uint32_t>(*seq);
+    if (!readTime(compact::actionTimeBit, actionTime) || !readTime(compact::teBit, Te) ||
+        !readTime(compact::tdeminBit, Tdemin) || !readTime(compact::tsoBit, Tso)) {
+        return fail();
+    }
+    if ((mask & compact::payloadBit) != 0) {
+        if (!compact::readVarint(data, end, uvalue) ||
+            uvalue > static_cast<std::uint64_t>(end - data)) {
+            return fail();
+        }
+        payload.assign(data, static_cast<std::size_t>(uvalue));
+        data += uvalue;
+    } else {
+        payload.clear();
+    }
+    if ((mask & compact::stringsBit) != 0) {
+        if (!compact::readVarint(data, end, uvalue) || uvalue > 255U) {
+            return fail();
+        }
+        prepareStringData(static_cast<std::size_t>(uvalue));
+        for (auto& str : stringData) {
+            if (!compact::readVarint(data, end, uvalue)) {
+                return fail();
+            }
+            if ((uvalue & 1U) != 0) {
+                auto index = static_cast<std::size_t>(uvalue >> 1U);
+                if (!interned || table == nullptr || index >= table->size()) {
+                    return fail();
+                }
+                str = table->get(index);
+            } else {
+                auto len = static_cast<std::size_t>(uvalue >> 1U);
+                if (len > static_cast<std::size_t>(end - data)) {
+                    return fail();
+                }
+                str.assign(reinterpret_cast<const char*>(data), len);
+                data += len;
+                if (interned && table != nullptr && table->shouldIntern(str)) {
+                    table->add(str);
+                }
+            }
+        }
+    } else {
+        stringData.clear();
+    }
+    return static_cast<std::size_t>(data - start);
+}
+
 template<std::size_t DataSize>
 inline void swap_bytes(std::uint8_t* data)
 {
@@ -396,16 +754,21 @@ inline void swap_bytes(std::uint8_t* data)
     }
 }
 
-std::size_t ActionMessage::fromByteArray(const std::byte* data, std::size_t buffer_size)
+std::size_t ActionMessage::fromByteArray(const std::byte* data,
+                                         std::size_t buffer_size,
+                                         CompactStringTable* table)
 {
     std::size_t tsize{action_message_base_size};
     static const uint8_t littleEndian = isLittleEndian();
+    if (buffer_size > 0 && data[0] == COMPACT_MARKER) {
+        return fromCompactByteArray(data, buffer_size, table);
+    }
     if (buffer_size < tsize) {
         messageAction = CMD_INVALID;
         return (0);
     }
     if (data[0] == std::byte(LEADING_CHAR)) {
-        auto res = depacketize(data, buffer_size);
+        auto res = depacketize(data, buffer_size, table);
         if (res > 0) {
             return static_cast<int>(res);
         }
@@ -486,7 +849,7 @@ std::size_t ActionMessage::fromByteArray(const std::byte* data, std::size_t buff
     auto stringCount = std::to_integer<std::size_t>(*data);
     ++data;
     if (stringCount != 0) {
-        stringData.resize(stringCount);
+        prepareStringData(stringCount);
         tsize += 4 * stringCount;
         if (buffer_size < tsize) {
             messageAction = CMD_INVALID;
@@ -538,7 +901,9 @@ std::size_t ActionMessage::fromByteArray(const std::byte* data, std::size_t buff
     return tsize;
 }
 
-std::size_t ActionMessage::depacketize(const void* data, std::size_t buffer_size)
+std::size_t ActionMessage::depacketize(const void* data,
+                                       std::size_t buffer_size,
+                                       CompactStringTable* table)
 {
     const auto* bytes = reinterpret_cast<const std::byte*>(data);
     if (bytes[0] != std::byte(LEADING_CHAR)) {
@@ -562,7 +927,7 @@ std::size_t ActionMessage::depacketize(const void* data, std::size_t buffer_size
         return 0;
     }
 
-    std::size_t bytesUsed = fromByteArray(bytes + 4, message_size - 4);
+    std::size_t bytesUsed = fromByteArray(bytes + 4, message_size - 4, table);
     if (bytesUsed == 0U) {
         if (from_json_string(
                 std::string_view(reinterpret_cast<const char*>(bytes) + 4, message_size - 4))) {
@@ -606,7 +971,7 @@ bool ActionMessage::from_json_string(std::string_view data)
 
         payload = val["payload"].asString();
         auto stringCount = val["stringCount"].asUInt();
-        stringData.resize(stringCount);
+        prepareStringData(stringCount);
         for (Json::ArrayIndex ii = 0; ii < stringCount; ++ii) {
             setString(ii, val["strings"][ii].asString());
         }
@@ -697,7 +1062,7 @@ std::unique_ptr<Message> createMessageFromCommand(ActionMessage&& cmd)
 static constexpr char unknownStr[] = "unknown";
 
 // Map to translate the action to a description
-static constexpr frozen::unordered_map<action_message_def::action_t, frozen::string, 96>
+static constexpr frozen::unordered_map<action_message_def::action_t, frozen::string, 101>
     actionStrings = {
         // priority commands
         {action_message_def::action_t::cmd_priority_disconnect, "priority_disconnect"},
@@ -734,6 +1099,7 @@ static constexpr frozen::unordered_map<action_message_def::action_t, frozen::str
         {action_message_def::action_t::cmd_disconnect_core_ack, "disconnect core acknowledge"},
         {action_message_def::action_t::cmd_disconnect_fed_ack, "disconnect fed acknowledge"},
         {action_message_def::action_t::cmd_ack, "ack"},
+        {action_message_def::action_t::cmd_shard_release, "shard_release"},
 
         {action_message_def::action_t::cmd_stop, "stop"},
         {action_message_def::action_t::cmd_terminate_immediately, "terminate_immediately"},
@@ -744,6 +1110,7 @@ static constexpr frozen::unordered_map<action_message_def::action_t, frozen::str
         {action_message_def::action_t::cmd_time_unblock, "time_unblock"},
         {action_message_def::action_t::cmd_request_current_time, "request current time"},
         {action_message_def::action_t::cmd_pub, "pub"},
+        {action_message_def::action_t::cmd_pub_fanout, "pub fanout"},
         {action_message_def::action_t::cmd_bye, "bye"},
         {action_message_def::action_t::cmd_log, "log"},
         {action_message_def::action_t::cmd_warning, "warning"},
@@ -778,11 +1145,14 @@ static constexpr frozen::unordered_map<action_message_def::action_t, frozen::str
         {action_message_def::action_t::cmd_filter_link, "link filter"},
         {action_message_def::action_t::cmd_data_link, "data link"},
         {action_message_def::action_t::cmd_reg_input, "reg_input"},
+        {action_message_def::action_t::cmd_reg_interfaces, "reg_interfaces"},
         {action_message_def::action_t::cmd_add_subscriber, "add_subscriber"},
+        {action_message_def::action_t::cmd_delta_resync, "delta_resync"},
         {action_message_def::action_t::cmd_remove_subscriber, "remove subscriber"},
         {action_message_def::action_t::cmd_reg_end, "reg_end"},
         {action_message_def::action_t::cmd_resend, "reg_resend"},
         {action_message_def::action_t::cmd_add_endpoint, "add_endpoint"},
+        {action_message_def::action_t::cmd_endpoint_location, "endpoint_location"},
         {action_message_def::action_t::cmd_remove_endpoint, "remove endpoint"},
         {action_message_def::action_t::cmd_add_named_endpoint, "add_named_endpoint"},
         {action_message_def::action_t::cmd_add_named_input, "add_named_input"},
@@ -873,6 +1243,15 @@ std::string prettyPrintString(const ActionMessage& command)
                                    static_cast<double>(command.actionTime),
                                    command.dest_id.baseValue()));
             break;
+        case CMD_PUB_FANOUT:
+            ret.push_back(':');
+            ret.append(fmt::format("From ({}) handle({}) size {} at {} to {} destinations",
+                                   command.source_id.baseValue(),
+                                   command.source_handle.baseValue(),
+                                   command.payload.size(),
+                                   static_cast<double>(command.actionTime),
+                                   command.getString(0).size() / (2 * sizeof(std::int32_t))));
+            break;
         case CMD_REG_BROKER:
             ret.push_back(':');
             ret.append(command.name());
@@ -931,6 +1310,114 @@ int appendMessage(ActionMessage& m, const ActionMessage& newMessage)
     return (-1);
 }
 
+static void appendFanoutValue(std::string& data, std::int32_t val)
+{
+    auto uval = static_cast<std::uint32_t>(val);
+    data.push_back(static_cast<char>(uval & 0xFFU));
+    data.push_back(static_cast<char>((uval >> 8U) & 0xFFU));
+    data.push_back(static_cast<char>((uval >> 16U) & 0xFFU));
+    data.push_back(static_cast<char>((uval >> 24U) & 0xFFU));
+}
+
+static std::int32_t readFanoutValue(const char* data)
+{
+    const auto* udata = reinterpret_cast<const std::uint8_t*>(data);
+    std::uint32_t uval = static_cast<std::uint32_t>(udata[0]) |
+        (static_cast<std::uint32_t>(udata[1]) << 8U) |
+        (static_cast<std::uint32_t>(udata[2]) << 16U) |
+        (static_cast<std::uint32_t>(udata[3]) << 24U);
+    return static_cast<std::int32_t>(uval);
+}
+
+void setFanoutTargets(ActionMessage& command, const std::vector<GlobalHandle>& targets)
+{
+    std::string data;
+    data.reserve(targets.size() * 2 * sizeof(std::int32_t));
+    for (const auto& target : targets) {
+        appendFanoutValue(data, target.fed_id.baseValue());
+        appendFanoutValue(data, target.handle.baseValue());
+    }
+    command.setStringData(data);
+    if (!targets.empty()) {
+        command.dest_id = targets.front().fed_id;
+    }
+}
+
+std::vector<GlobalHandle> getFanoutTargets(const ActionMessage& command)
+{
+    static constexpr std::size_t recordSize{2 * sizeof(std::int32_t)};
+    const auto& data = command.getString(0);
+    std::vector<GlobalHandle> targets;
+    targets.reserve(data.size() / recordSize);
+    for (std::size_t ii = 0; ii + recordSize <= data.size(); ii += recordSize) {
+        targets.emplace_back(GlobalFederateId{readFanoutValue(data.data() + ii)},
+                             InterfaceHandle{readFanoutValue(data.data() + ii + 4)});
+    }
+    return targets;
+}
+
+static void appendRegistrationString(std::string& data, const std::string& str)
+{
+    appendFanoutValue(data, static_cast<std::int32_t>(str.size()));
+    data.append(str);
+}
+
+void setInterfaceRegistrations(ActionMessage& command,
+                               const std::vector<InterfaceRegistration>& interfaces)
+{
+    std::size_t size{0};
+    for (const auto& ifc : interfaces) {
+        size += 6 * sizeof(std::int32_t) + ifc.key.size() + ifc.type.size() + ifc.units.size();
+    }
+    std::string data;
+    data.reserve(size);
+    for (const auto& ifc : interfaces) {
+        appendFanoutValue(data, static_cast<std::int32_t>(ifc.action));
+        appendFanoutValue(data, ifc.handle.baseValue());
+        appendFanoutValue(data, static_cast<std::int32_t>(ifc.flags));
+        appendRegistrationString(data, ifc.key);
+        appendRegistrationString(data, ifc.type);
+        appendRegistrationString(data, ifc.units);
+    }
+    command.setStringData(data);
+    command.counter = static_cast<std::uint16_t>(std::min<std::size_t>(interfaces.size(), 0xFFFFU));
+}
+
+std::vector<InterfaceRegistration> getInterfaceRegistrations(const ActionMessage& command)
+{
+    const auto& data = command.getString(0);
+    std::vector<InterfaceRegistration> interfaces;
+    interfaces.reserve(command.counter);
+    std::size_t loc{0};
+    auto readString = [&data, &loc](std::string& str) {
+        if (loc + sizeof(std::int32_t) > data.size()) {
+            return false;
+        }
+        auto len = static_cast<std::size_t>(
+            static_cast<std::uint32_t>(readFanoutValue(data.data() + loc)));
+        loc += sizeof(std::int32_t);
+        if (len > data.size() - loc) {
+            return false;
+        }
+        str.assign(data, loc, len);
+        loc += len;
+        return true;
+    };
+    while (loc + 3 * sizeof(std::int32_t) <= data.size()) {
+        InterfaceRegistration ifc;
+        ifc.action =
+            static_cast<action_message_def::action_t>(readFanoutValue(data.data() + loc));
+        ifc.handle = InterfaceHandle{readFanoutValue(data.data() + loc + 4)};
+        ifc.flags = static_cast<std::uint16_t>(readFanoutValue(data.data() + loc + 8));
+        loc += 3 * sizeof(std::int32_t);
+        if (!readString(ifc.key) || !readString(ifc.type) || !readString(ifc.units)) {
+            break;
+        }
+        interfaces.push_back(std::move(ifc));
+    }
+    return interfaces;
+}
+
 void setIterationFlags(ActionMessage& command, IterationRequest iterate)
 {
     switch (iterate) {
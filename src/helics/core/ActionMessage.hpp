@@ -26,6 +26,8 @@ constexpr int typeOutStringLoc{1};
 
 constexpr int32_t cmd_info_basis{65536};
 
+class CompactStringTable;
+
 /** class defining the primary message object used in HELICS */
 class ActionMessage {
     // need to try to make sure this object is under 64 bytes in size to fit in cache lines NOT
@@ -45,9 +47,25 @@ class ActionMessage {
     Time Te{timeZero};  //!< 48 event time
     Time Tdemin{timeZero};  //!< 56 min dependent event time
     Time Tso{timeZero};  //!< 64 the second order dependent time
+    /// steady clock time in ns the message was queued, used by the latency tracking and not
+    /// serialized
+    std::int64_t trackingTime{0};
     SmallBuffer payload;  //!< buffer to contain the data payload
   private:
     std::vector<std::string> stringData;  //!< container for extra string data
+    /** size the string data container for a number of strings
+    @details when the buffer pool is enabled an empty container is replaced with one from the pool
+    so the strings can reuse existing allocations*/
+    void prepareStringData(std::size_t count)
+    {
+#ifdef HELICS_ENABLE_BUFFER_POOL
+        if (count > 0 && stringData.capacity() == 0) {
+            stringData = pool::acquireStrings();
+        }
+#endif
+        stringData.resize(count);
+    }
+
   public:
     /** default constructor*/
     ActionMessage() noexcept {}
@@ -113,18 +131,18 @@ class ActionMessage {
     // the payload
     void setStringData(std::string_view string1)
     {
-        stringData.resize(1);
+        prepareStringData(1);
         stringData[0] = string1;
     }
     void setStringData(std::string_view string1, std::string_view string2)
     {
-        stringData.resize(2);
+        prepareStringData(2);
         stringData[0] = string1;
         stringData[1] = string2;
     }
     void setStringData(std::string_view string1, std::string_view string2, std::string_view string3)
     {
-        stringData.resize(3);
+        prepareStringData(3);
         stringData[0] = string1;
         stringData[1] = string2;
         stringData[2] = string3;
@@ -134,7 +152,7 @@ class ActionMessage {
                        std::string_view string3,
                        std::string_view string4)
     {
-        stringData.resize(4);
+        prepareStringData(4);
         stringData[0] = string1;
         stringData[1] = string2;
         stringData[2] = string3;
@@ -184,16 +202,41 @@ class ActionMessage {
     /** packetize the message with a simple header and tail sequence using json serialization
      */
     std::string packetize_json() const;
+    /** convert a command to raw bytes using the compact serialization
+    @details fields with default values are omitted and integers and times are variable length
+    encoded, if a string table is given repeated strings are sent as an index into the table
+    @param[out] data pointer to memory to store the command
+    @param buffer_size  the size of the buffer
+    @param table the string table of the connection the message is sent on (can be nullptr)
+    @return the size of the buffer actually used or -1 if the buffer was too small
+    */
+    int toCompactByteArray(std::byte* data,
+                           std::size_t buffer_size,
+                           CompactStringTable* table = nullptr) const;
+    /** convert to a string using the compact serialization*/
+    void to_compact_string(std::string& data, CompactStringTable* table = nullptr) const;
+    /** convert to a byte string using the compact serialization*/
+    std::string to_compact_string() const;
+    /** packetize the message using the compact serialization
+    @details the packet uses the same header and tail sequence as /ref packetize so it can be read
+    by depacketize*/
+    void packetize_compact(std::string& data, CompactStringTable* table = nullptr) const;
     /** convert to a byte vector using a reference*/
     void to_vector(std::vector<char>& data) const;
     /** convert a command to a byte vector*/
     std::vector<char> to_vector() const;
-    /** generate a command from a raw data stream*/
-    std::size_t fromByteArray(const std::byte* data, std::size_t buffer_size);
+    /** generate a command from a raw data stream
+    @param table the string table of the connection the data came from, required to read compact
+    messages containing interned strings*/
+    std::size_t fromByteArray(const std::byte* data,
+                              std::size_t buffer_size,
+                              CompactStringTable* table = nullptr);
     /** load a command from a packetized stream /ref packetize
     @return the number of bytes used
     */
-    std::size_t depacketize(const void* data, std::size_t buffer_size);
+    std::size_t depacketize(const void* data,
+                            std::size_t buffer_size,
+                            CompactStringTable* table = nullptr);
     /** read a command from a string
     @return number of bytes read*/
     std::size_t from_string(std::string_view data);
@@ -205,6 +248,12 @@ class ActionMessage {
 
     friend std::unique_ptr<Message> createMessageFromCommand(const ActionMessage& cmd);
     friend std::unique_ptr<Message> createMessageFromCommand(ActionMessage&& cmd);
+
+  private:
+    /** read a command in the compact serialization*/
+    std::size_t fromCompactByteArray(const std::byte* data,
+                                     std::size_t buffer_size,
+                                     CompactStringTable* table);
 };
 
 inline bool operator<(const ActionMessage& cmd, const ActionMessage& cmd2)
@@ -355,6 +404,45 @@ std::ostream& operator<<(std::ostream& os, const ActionMessage& command);
 @return the integer location of the message in the stringData section*/
 int appendMessage(ActionMessage& m, const ActionMessage& newMessage);
 
+/** store a list of destination handles in a fanout publication message
+@details the targets are encoded into the first string data element in a byte order independent
+format so the message can be forwarded across routes
+@param command the CMD_PUB_FANOUT message to store the targets in
+@param targets the destinations of the publication
+*/
+void setFanoutTargets(ActionMessage& command, const std::vector<GlobalHandle>& targets);
+
+/** extract the destination handles from a fanout publication message
+@param command the CMD_PUB_FANOUT message containing the targets
+@return a vector of the destination handles
+*/
+std::vector<GlobalHandle> getFanoutTargets(const ActionMessage& command);
+
+/** the information describing a single interface in a bulk registration message*/
+struct InterfaceRegistration {
+    action_message_def::action_t action{CMD_REG_PUB};  //!< CMD_REG_PUB or CMD_REG_INPUT
+    InterfaceHandle handle;  //!< the handle of the interface in the registering federate
+    std::uint16_t flags{0};  //!< the interface flags
+    std::string key;
+    std::string type;
+    std::string units;
+};
+
+/** store a block of interface registrations in a bulk registration message
+@details the interfaces are packed into the first string data element in a byte order independent
+format so a single message can carry any number of interfaces
+@param command the CMD_REG_INTERFACES message to store the interfaces in
+@param interfaces the interfaces to register
+*/
+void setInterfaceRegistrations(ActionMessage& command,
+                               const std::vector<InterfaceRegistration>& interfaces);
+
+/** extract the interface registrations from a bulk registration message
+@param command the CMD_REG_INTERFACES message containing the interfaces
+@return a vector of the interfaces, truncated data is ignored
+*/
+std::vector<InterfaceRegistration> getInterfaceRegistrations(const ActionMessage& command);
+
 /** generate a string representing an error from an ActionMessage
 @param command the command to generate the error string for
 @return a string describing the error, if the string is not an error the string is empty
@@ -77,6 +77,7 @@ across different compilers*/
         cmd_exec_grant = 22,  //!< grant entry to exec mode or iterate
         cmd_exec_check = 24,  //!< command to run a check on execution entry
         cmd_ack = 254,  //!< acknowledge command to for various purposes
+        cmd_shard_release = 255,  //!< release a core command shard to route commands directly
         cmd_timing_info = 310,  //!< send some information to dependents on timing
 
         cmd_stop = 30,  //!< halt execution
@@ -96,6 +97,8 @@ across different compilers*/
         cmd_time_barrier_clear = 44,  //!< clear a global time barrier
 
         cmd_pub = 52,  //!< publish a value
+        cmd_pub_fanout = cmd_info_basis +
+            52,  //!< publish a single value to a list of destinations stored in the string data
         cmd_bye = 2000,  //!< message stating this is the last communication from a federate
         cmd_log = 55,  //!< log a message with the root broker
         cmd_remote_log = 2055,  //!< send a log message to a remote host
@@ -170,11 +173,14 @@ across different compilers*/
         cmd_reg_filter = cmd_info_basis + 60,  //!< register a filter
         cmd_add_filter = 62,  //!< notify of a destination filter
         cmd_reg_input = cmd_info_basis + 70,  //!< register an input interface
+        cmd_reg_interfaces = cmd_info_basis + 75,  //!< register a block of publications and inputs
         cmd_add_subscriber = 70,  //!< notify of a subscription
+        cmd_delta_resync = 72,  //!< request a full value from a delta encoded publication
         cmd_reg_translator = cmd_info_basis + 80,  //!< register a translator
 
         cmd_reg_end = cmd_info_basis + 90,  //!< register an endpoint
         cmd_add_endpoint = 90,  //!< notify of a source endpoint
+        cmd_endpoint_location = 94,  //!< notify a core of the resolved handle of a named endpoint
 
         cmd_add_named_input = 104,  //!< command to add a named input as a target
         cmd_add_named_filter = 105,  //!< command to add named filter as a target
@@ -274,6 +280,7 @@ across different compilers*/
 #define CMD_DEST_FILTER_RESULT action_message_def::action_t::cmd_dest_filter_result
 
 #define CMD_PUB action_message_def::action_t::cmd_pub
+#define CMD_PUB_FANOUT action_message_def::action_t::cmd_pub_fanout
 #define CMD_LOG action_message_def::action_t::cmd_log
 #define CMD_REMOTE_LOG action_message_def::action_t::cmd_remote_log
 #define CMD_WARNING action_message_def::action_t::cmd_warning
@@ -287,7 +294,9 @@ across different compilers*/
 #define CMD_REG_PUB action_message_def::action_t::cmd_reg_pub
 #define CMD_ADD_PUBLISHER action_message_def::action_t::cmd_add_publisher
 #define CMD_REG_INPUT action_message_def::action_t::cmd_reg_input
+#define CMD_REG_INTERFACES action_message_def::action_t::cmd_reg_interfaces
 #define CMD_ADD_SUBSCRIBER action_message_def::action_t::cmd_add_subscriber
+#define CMD_DELTA_RESYNC action_message_def::action_t::cmd_delta_resync
 
 #define CMD_REG_TRANSLATOR action_message_def::action_t::cmd_reg_translator
 
@@ -317,6 +326,7 @@ across different compilers*/
 
 #define CMD_REG_ENDPOINT action_message_def::action_t::cmd_reg_end
 #define CMD_ADD_ENDPOINT action_message_def::action_t::cmd_add_endpoint
+#define CMD_ENDPOINT_LOCATION action_message_def::action_t::cmd_endpoint_location
 
 #define CMD_REG_FILTER action_message_def::action_t::cmd_reg_filter
 #define CMD_ADD_FILTER action_message_def::action_t::cmd_add_filter
@@ -351,6 +361,7 @@ across different compilers*/
 #define CMD_SET_PROFILER_FLAG action_message_def::action_t::cmd_set_profiler_flag
 
 #define CMD_ACK action_message_def::action_t::cmd_ack
+#define CMD_SHARD_RELEASE action_message_def::action_t::cmd_shard_release
 #define CMD_PRIORITY_ACK action_message_def::action_t::cmd_priority_ack
 
 #define CMD_QUERY action_message_def::action_t::cmd_query
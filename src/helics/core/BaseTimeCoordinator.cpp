@@ -135,14 +135,13 @@ void BaseTimeCoordinator::generateDebuggingTimeInfo(Json::Value& base) const
 
 Json::Value BaseTimeCoordinator::grantTimeoutCheck(const ActionMessage& cmd)
 {
-    for (auto& dep : dependencies) {
-        if (dep.fedID == cmd.source_id) {
-            dep.timeoutCount = cmd.counter;
-            if (cmd.counter == 6) {
-                Json::Value base;
-                generateDebuggingTimeInfo(base);
-                return base;
-            }
+    auto* dep = dependencies.getDependencyInfo(GlobalFederateId(cmd.source_id));
+    if (dep != nullptr) {
+        dep->timeoutCount = cmd.counter;
+        if (cmd.counter == 6) {
+            Json::Value base;
+            generateDebuggingTimeInfo(base);
+            return base;
         }
     }
     return Json::nullValue;
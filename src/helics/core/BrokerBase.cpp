@@ -9,10 +9,13 @@ SPDX-License-Identifier: BSD-3-Clause
 
 #include "../common/fmt_format.h"
 #include "../common/logging.hpp"
+#include "FlightRecorder.hpp"
 #include "ForwardingTimeCoordinator.hpp"
 #include "GlobalTimeCoordinator.hpp"
+#include "LatencyTracker.hpp"
 #include "LogManager.hpp"
 #include "ProfilerBuffer.hpp"
+#include "TimingCoalescer.hpp"
 #include "flagOperations.hpp"
 #include "gmlc/libguarded/guarded.hpp"
 #include "gmlc/utilities/stringOps.h"
@@ -37,6 +40,7 @@ SPDX-License-Identifier: BSD-3-Clause
 
 #include <iostream>
 #include <map>
+#include <optional>
 #include <utility>
 #include <vector>
 
@@ -191,7 +195,25 @@ std::shared_ptr<helicsCLI11App> BrokerBase::generateBaseCLI()
     hApp->add_flag(
         "--dumplog",
         dumplog,
-        "capture a record of all messages and dump a complete log to file or console on termination");
+        "capture a record of the most recent messages in a flight recorder and dump it to the log on termination");
+    hApp
+        ->add_option("--dumplog_size",
+                     dumplogSize,
+                     "the number of messages kept by the flight recorder for the dumplog")
+        ->capture_default_str()
+        ->check(CLI::PositiveNumber);
+    hApp->add_option(
+        "--dumplog_file",
+        dumplogFile,
+        "write a binary dump of the flight recorder to this file on termination or error, the dump can be read with helics_flight_decoder");
+    hApp->add_flag(
+        "--latency_tracking",
+        enableLatencyTracking,
+        "record histograms of the time messages spend queued and being processed, available through the \"latency\" query");
+    hApp->add_flag(
+        "--no_timing_coalescing",
+        disableTimingCoalescing,
+        "process every time and exec request even if a later request from the same source is already queued");
 
     auto* timeout_group =
         hApp->add_option_group("timeouts", "Options related to network and process timeouts");
@@ -305,6 +327,15 @@ void BrokerBase::configureBase()
 
     timeCoord->setMessageSender([this](const ActionMessage& msg) { addActionMessage(msg); });
     timeCoord->setRestrictivePolicy(restrictive_time_policy);
+    if (enableLatencyTracking && !latencyTracker) {
+        latencyTracker = std::make_shared<LatencyTracker>();
+    }
+    if (dumplog && !flightRecorder) {
+        flightRecorder = std::make_shared<FlightRecorder>(dumplogSize);
+    }
+    if (!disableTimingCoalescing && !timingCoalescer) {
+        timingCoalescer = std::make_shared<TimingCoalescer>();
+    }
 
     mLogManager->setTransmitCallback([this](ActionMessage&& m) {
         if (getBrokerState() < BrokerState::terminating) {
@@ -376,6 +407,7 @@ void BrokerBase::setErrorState(int eCode, std::string_view estring)
 {
     lastErrorString.assign(estring.data(), estring.size());
     lastErrorCode.store(eCode);
+    dumpFlightRecorder();
     auto cBrokerState = brokerState.load();
     if (cBrokerState != BrokerState::errored && cBrokerState != BrokerState::connected_error) {
         if (cBrokerState > BrokerState::configured && cBrokerState < BrokerState::terminating) {
@@ -396,6 +428,20 @@ void BrokerBase::setErrorState(int eCode, std::string_view estring)
     sendToLogger(global_id.load(), HELICS_LOG_LEVEL_ERROR, identifier, estring);
 }
 
+void BrokerBase::dumpFlightRecorder() const
+{
+    auto recorder = std::atomic_load(&flightRecorder);
+    if (!recorder || dumplogFile.empty()) {
+        return;
+    }
+    if (!recorder->dumpToFile(dumplogFile)) {
+        sendToLogger(global_id.load(),
+                     LogLevels::WARNING,
+                     identifier,
+                     fmt::format("unable to write flight recorder dump to {}", dumplogFile));
+    }
+}
+
 void BrokerBase::setLoggingFile(std::string_view lfile)
 {
     mLogManager->setLoggingFile(lfile, identifier);
@@ -528,6 +574,12 @@ void BrokerBase::setLogLevels(int32_t consoleLevel, int32_t fileLevel)
 
 void BrokerBase::addActionMessage(const ActionMessage& m)
 {
+    if (latencyTracker) {
+        ActionMessage stamped(m);
+        stamped.trackingTime = LatencyTracker::now();
+        addActionMessage(std::move(stamped));
+        return;
+    }
     if (isPriorityCommand(m)) {
         actionQueue.pushPriority(m);
     } else {
@@ -538,6 +590,9 @@ void BrokerBase::addActionMessage(const ActionMessage& m)
 
 void BrokerBase::addActionMessage(ActionMessage&& m)
 {
+    if (latencyTracker) {
+        m.trackingTime = LatencyTracker::now();
+    }
     if (isPriorityCommand(m)) {
         actionQueue.emplacePriority(std::move(m));
     } else {
@@ -550,6 +605,9 @@ void BrokerBase::addActionMessage(ActionMessage&& m) const
 {
     // the queue is thread safe so can be run in a const situation without possibility of issues
     auto& lQueue = const_cast<decltype(actionQueue)&>(actionQueue);
+    if (latencyTracker) {
+        m.trackingTime = LatencyTracker::now();
+    }
     if (isPriorityCommand(m)) {
         lQueue.emplacePriority(std::move(m));
     } else {
@@ -631,7 +689,6 @@ void BrokerBase::queueProcessingLoop()
         mainLoopIsRunning.store(false);
         return;
     }
-    std::vector<ActionMessage> dumpMessages;
 #ifndef HELICS_DISABLE_ASIO
     auto serv = gmlc::networking::AsioContextManager::getContextPointer();
     auto contextLoop = serv->startContextLoop();
@@ -665,36 +722,100 @@ void BrokerBase::queueProcessingLoop()
 
     global_broker_id_local = global_id.load();
     int messagesSinceLastTick = 0;
-    auto logDump = [&, this]() {
-        if (!dumpMessages.empty()) {
-            for (auto& act : dumpMessages) {
-                mLogManager->sendToLogger(HELICS_LOG_LEVEL_DUMPLOG,
-                                          identifier,
-                                          fmt::format("|| dl cmd:{} from {} to {}",
-                                                      prettyPrintString(act),
-                                                      act.source_id.baseValue(),
-                                                      act.dest_id.baseValue()));
-            }
+    auto logDump = [this]() {
+        auto recorder = std::atomic_load(&flightRecorder);
+        if (!dumplog || !recorder) {
+            return;
+        }
+        for (auto& rec : recorder->records()) {
+            mLogManager->sendToLogger(HELICS_LOG_LEVEL_DUMPLOG,
+                                      identifier,
+                                      fmt::format("|| dl cmd:{} from {} to {}",
+                                                  prettyPrintString(rec.message),
+                                                  rec.message.source_id.baseValue(),
+                                                  rec.message.dest_id.baseValue()));
         }
+        dumpFlightRecorder();
     };
     if (haltOperations) {
         timerStop();
         mainLoopIsRunning.store(false);
         return;
     }
-    while (true) {
-        auto command = actionQueue.pop();
-        ++messageCounter;
+    // messages taken from the queue along with a timing message that are not processed yet
+    std::vector<ActionMessage> batch;
+    std::size_t batchIndex{0};
+    // a priority command found while filling a batch, it goes ahead of the rest of the batch
+    std::optional<ActionMessage> priorityCommand;
+    // messages are recorded as they leave the queue so those removed by coalescing are included
+    auto recordCommand = [this](const ActionMessage& command) {
         if (dumplog) {
-            dumpMessages.push_back(command);
+            flightRecorder->record(command);
+        }
+    };
+    auto nextCommand =
+        [this, &batch, &batchIndex, &priorityCommand, &recordCommand]() -> ActionMessage {
+        if (priorityCommand) {
+            ActionMessage command = std::move(*priorityCommand);
+            priorityCommand.reset();
+            return command;
+        }
+        if (batchIndex < batch.size()) {
+            return std::move(batch[batchIndex++]);
+        }
+        auto command = actionQueue.pop();
+        recordCommand(command);
+        if (!timingCoalescer || !TimingCoalescer::isTimingMessage(command)) {
+            return command;
+        }
+        // collapse any superseded timing messages among those already waiting
+        batch.clear();
+        batch.push_back(std::move(command));
+        while (batch.size() < TimingCoalescer::maxBatchSize) {
+            auto next = actionQueue.try_pop();
+            if (!next) {
+                break;
+            }
+            recordCommand(*next);
+            if (isPriorityCommand(*next)) {
+                // don't hold a priority command behind the batch
+                priorityCommand = std::move(next);
+                break;
+            }
+            batch.push_back(std::move(*next));
         }
+        timingCoalescer->coalesce(batch);
+        batchIndex = 1;
+        return std::move(batch.front());
+    };
+    // messages left over when the loop stops, those already taken from the queue come first
+    auto nextUnprocessed =
+        [this, &batch, &batchIndex, &priorityCommand]() -> std::optional<ActionMessage> {
+        if (priorityCommand) {
+            auto command = std::move(priorityCommand);
+            priorityCommand.reset();
+            return command;
+        }
+        if (batchIndex < batch.size()) {
+            return std::move(batch[batchIndex++]);
+        }
+        return actionQueue.try_pop();
+    };
+    while (true) {
+        auto command = nextCommand();
+        ++messageCounter;
         if (command.action() == CMD_IGNORE) {
             continue;
         }
+        std::int64_t dequeueTime{0};
+        const auto action = command.action();
+        if (latencyTracker) {
+            dequeueTime = LatencyTracker::now();
+            latencyTracker->recordQueue(action, command.trackingTime, dequeueTime);
+        }
         auto ret = commandProcessor(command);
         if (ret == CMD_IGNORE) {
             ++messagesSinceLastTick;
-            continue;
         }
         switch (ret) {
             case CMD_TICK:
@@ -798,7 +919,7 @@ void BrokerBase::queueProcessingLoop()
                 mainLoopIsRunning.store(false);
                 logDump();
                 {
-                    auto tcmd = actionQueue.try_pop();
+                    auto tcmd = nextUnprocessed();
                     while (tcmd) {
                         if (!isDisconnectCommand(*tcmd)) {
                             LOG_TRACE(global_broker_id_local,
@@ -806,7 +927,7 @@ void BrokerBase::queueProcessingLoop()
                                       std::string("TI unprocessed command ") +
                                           prettyPrintString(*tcmd));
                         }
-                        tcmd = actionQueue.try_pop();
+                        tcmd = nextUnprocessed();
                     }
                 }
                 return;  // immediate return
@@ -818,7 +939,7 @@ void BrokerBase::queueProcessingLoop()
                     logDump();
                     processDisconnect();
                 }
-                auto tcmd = actionQueue.try_pop();
+                auto tcmd = nextUnprocessed();
                 while (tcmd) {
                     if (!isDisconnectCommand(*tcmd)) {
                         LOG_TRACE(global_broker_id_local,
@@ -826,10 +947,13 @@ void BrokerBase::queueProcessingLoop()
                                   std::string("STOPPED unprocessed command ") +
                                       prettyPrintString(*tcmd));
                     }
-                    tcmd = actionQueue.try_pop();
+                    tcmd = nextUnprocessed();
                 }
                 return;
         }
+        if (dequeueTime != 0) {
+            latencyTracker->recordProcessing(action, dequeueTime, LatencyTracker::now());
+        }
     }
 }
 
@@ -889,6 +1013,10 @@ void BrokerBase::baseConfigure(ActionMessage& command)
     if (command.action() == CMD_BASE_CONFIGURE) {
         switch (command.messageID) {
             case HELICS_FLAG_DUMPLOG:
+                if (checkActionFlag(command, indicator_flag) && !flightRecorder) {
+                    std::atomic_store(&flightRecorder,
+                                      std::make_shared<FlightRecorder>(dumplogSize));
+                }
                 dumplog = checkActionFlag(command, indicator_flag);
                 break;
             case HELICS_FLAG_FORCE_LOGGING_FLUSH:
@@ -35,6 +35,9 @@ namespace helics {
 class BaseTimeCoordinator;
 class helicsCLI11App;
 class ProfilerBuffer;
+class LatencyTracker;
+class TimingCoalescer;
+class FlightRecorder;
 class LogBuffer;
 class LogManager;
 /** base class for broker like objects
@@ -94,6 +97,14 @@ class BrokerBase {
     std::atomic<bool> mainLoopIsRunning{false};
     /// flag indicating the broker should capture a dump log
     bool dumplog{false};
+    /// the number of messages kept by the flight recorder for the dump log
+    int32_t dumplogSize{8192};
+    /// file to write the binary flight recorder dump to
+    std::string dumplogFile;
+    /// flag indicating the broker should record message latency histograms
+    bool enableLatencyTracking{false};
+    /// flag indicating superseded timing messages should not be collapsed in the action queue
+    bool disableTimingCoalescing{false};
     /// flag indicating that the message queue should not be used and all functions are called
     /// directly instead of in a distinct thread
     bool queueDisabled{false};
@@ -142,6 +153,12 @@ class BrokerBase {
     /** specify that outgoing connection should use json serialization */
     bool useJsonSerialization{false};
     bool enable_profiling{false};  //!< indicator that profiling is enabled
+    /// histograms of message latencies, only created if latency tracking is enabled
+    std::shared_ptr<LatencyTracker> latencyTracker;
+    /// the most recent messages processed, only created if the dumplog is enabled
+    std::shared_ptr<FlightRecorder> flightRecorder;
+    /// collapses superseded timing messages, only created if timing coalescing is enabled
+    std::shared_ptr<TimingCoalescer> timingCoalescer;
     /// time when the error condition started; related to the errorDelay
     decltype(std::chrono::steady_clock::now()) errorTimeStart;
     /// time when the disconnect started
@@ -270,6 +287,8 @@ class BrokerBase {
     virtual std::shared_ptr<helicsCLI11App> generateCLI();
     /** set the broker error state and error string*/
     void setErrorState(int eCode, std::string_view estring);
+    /** write the flight recorder dump to the dumplog file if one was given*/
+    void dumpFlightRecorder() const;
     /** set the logging file if using the default logger*/
     void setLoggingFile(std::string_view lfile);
     /** get the value of a particular flag*/
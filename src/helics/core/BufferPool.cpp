@@ -0,0 +1,225 @@
+/*
+Copyright (c) 2017-2022,
+Battelle Memorial Institute; Lawrence Livermore National Security, LLC; Alliance for Sustainable
+Energy, LLC.  See the top-level NOTICE for additional details. All rights reserved.
+SPDX-License-Identifier: BSD-3-Clause
+*/
+#include "BufferPool.hpp"
+
+#include <array>
+#include <mutex>
+#include <utility>
+
+namespace helics::pool {
+namespace {
+    constexpr std::size_t classCount{10};  // 128 bytes to 64kB
+    /// the number of free blocks of each size a thread keeps before moving them to the depot
+    constexpr std::size_t localLimit{64};
+    /// the number of free blocks of each size kept in the shared depot
+    constexpr std::size_t depotLimit{1024};
+    /// the number of string vectors each thread keeps
+    constexpr std::size_t stringCacheLimit{256};
+    /// string vectors holding more strings or larger strings than this are not kept
+    constexpr std::size_t maxCachedStrings{8};
+    constexpr std::size_t maxCachedStringCapacity{1024};
+
+    /** get the size class for a requested size, -1 if the size is too big for the pool*/
+    int sizeClass(std::size_t size)
+    {
+        if (size > maxBlockSize) {
+            return -1;
+        }
+        int cls{0};
+        std::size_t blockSize{minBlockSize};
+        while (blockSize < size) {
+            blockSize <<= 1U;
+            ++cls;
+        }
+        return cls;
+    }
+
+    /** get the size class of an existing block, -1 if it isn't exactly a class size*/
+    int exactSizeClass(std::size_t capacity)
+    {
+        int cls = sizeClass(capacity);
+        return (cls >= 0 && (minBlockSize << static_cast<unsigned int>(cls)) == capacity) ? cls :
+                                                                                            -1;
+    }
+
+    /** storage for blocks shared between threads*/
+    struct Depot {
+        std::mutex lock;
+        std::array<std::vector<std::byte*>, classCount> blocks;
+        Depot()
+        {
+            for (auto& list : blocks) {
+                list.reserve(depotLimit);
+            }
+        }
+    };
+
+    Depot& depot()
+    {
+        // intentionally leaked so threads that outlive static destruction can still use it
+        static auto* sharedDepot = new Depot();
+        return *sharedDepot;
+    }
+
+    thread_local bool cacheDestroyed{false};
+
+    /** the free blocks and statistics for a single thread*/
+    struct LocalCache {
+        std::array<std::vector<std::byte*>, classCount> blocks;
+        std::vector<std::vector<std::string>> strings;
+        PoolStatistics stats;
+
+        LocalCache()
+        {
+            for (auto& list : blocks) {
+                list.reserve(localLimit + 1);
+            }
+            strings.reserve(stringCacheLimit);
+        }
+        LocalCache(const LocalCache&) = delete;
+        LocalCache& operator=(const LocalCache&) = delete;
+        ~LocalCache()
+        {
+            cacheDestroyed = true;
+            auto& dp = depot();
+            std::lock_guard<std::mutex> lock(dp.lock);
+            for (std::size_t cls = 0; cls < classCount; ++cls) {
+                for (auto* block : blocks[cls]) {
+                    if (dp.blocks[cls].size() < depotLimit) {
+                        dp.blocks[cls].push_back(block);
+                    } else {
+                        delete[] block;
+                    }
+                }
+            }
+        }
+    };
+
+    /** get the cache for the current thread, nullptr if the thread is shutting down*/
+    LocalCache* localCache()
+    {
+        if (cacheDestroyed) {
+            return nullptr;
+        }
+        thread_local LocalCache cache;
+        return &cache;
+    }
+}  // namespace
+
+std::byte* allocateBlock(std::size_t size, std::size_t& capacity)
+{
+    auto cls = sizeClass(size);
+    auto* cache = localCache();
+    if (cls < 0) {
+        capacity = size;
+        if (cache != nullptr) {
+            ++cache->stats.heapAllocations;
+        }
+        return new std::byte[size];
+    }
+    capacity = minBlockSize << static_cast<unsigned int>(cls);
+    if (cache == nullptr) {
+        return new std::byte[capacity];
+    }
+    auto& list = cache->blocks[cls];
+    if (list.empty()) {
+        // pick up a batch of blocks released by other threads
+        auto& dp = depot();
+        std::lock_guard<std::mutex> lock(dp.lock);
+        auto& shared = dp.blocks[cls];
+        while (!shared.empty() && list.size() < localLimit / 2) {
+            list.push_back(shared.back());
+            shared.pop_back();
+        }
+    }
+    if (!list.empty()) {
+        auto* block = list.back();
+        list.pop_back();
+        ++cache->stats.poolAllocations;
+        return block;
+    }
+    ++cache->stats.heapAllocations;
+    return new std::byte[capacity];
+}
+
+void releaseBlock(std::byte* block, std::size_t capacity) noexcept
+{
+    if (block == nullptr) {
+        return;
+    }
+    auto cls = exactSizeClass(capacity);
+    auto* cache = localCache();
+    if (cls < 0 || cache == nullptr) {
+        if (cache != nullptr) {
+            ++cache->stats.heapReleases;
+        }
+        delete[] block;
+        return;
+    }
+    auto& list = cache->blocks[cls];
+    list.push_back(block);
+    ++cache->stats.poolReleases;
+    if (list.size() > localLimit) {
+        // move half the blocks to the depot for use by other threads
+        auto& dp = depot();
+        std::lock_guard<std::mutex> lock(dp.lock);
+        auto& shared = dp.blocks[cls];
+        while (list.size() > localLimit / 2) {
+            if (shared.size() < depotLimit) {
+                shared.push_back(list.back());
+            } else {
+                delete[] list.back();
+                ++cache->stats.heapReleases;
+            }
+            list.pop_back();
+        }
+    }
+}
+
+std::vector<std::string> acquireStrings()
+{
+    auto* cache = localCache();
+    if (cache == nullptr || cache->strings.empty()) {
+        return {};
+    }
+    auto strings = std::move(cache->strings.back());
+    cache->strings.pop_back();
+    ++cache->stats.stringReuses;
+    return strings;
+}
+
+void releaseStrings(std::vector<std::string>& strings) noexcept
+{
+    auto* cache = localCache();
+    if (cache == nullptr || cache->strings.size() >= stringCacheLimit ||
+        strings.size() > maxCachedStrings) {
+        return;
+    }
+    for (const auto& str : strings) {
+        if (str.capacity() > maxCachedStringCapacity) {
+            return;
+        }
+    }
+    cache->strings.push_back(std::move(strings));
+    strings.clear();
+}
+
+PoolStatistics getStatistics()
+{
+    auto* cache = localCache();
+    return (cache != nullptr) ? cache->stats : PoolStatistics{};
+}
+
+void resetStatistics()
+{
+    auto* cache = localCache();
+    if (cache != nullptr) {
+        cache->stats = PoolStatistics{};
+    }
+}
+
+}  // namespace helics::pool
@@ -0,0 +1,57 @@
+/*
+Copyright (c) 2017-2022,
+Battelle Memorial Institute; Lawrence Livermore National Security, LLC; Alliance for Sustainable
+Energy, LLC.  See the top-level NOTICE for additional details. All rights reserved.
+SPDX-License-Identifier: BSD-3-Clause
+*/
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+/** @file
+pool of memory blocks and string containers used by SmallBuffer and ActionMessage when
+HELICS_ENABLE_BUFFER_POOL is defined.  Each thread keeps a cache of free blocks for a set of
+power of 2 size classes, excess blocks are moved to a shared depot so memory released on one
+thread (typically the core processing loop) can be picked up by threads allocating new messages.
+*/
+namespace helics::pool {
+/// the smallest block handed out by the pool
+constexpr std::size_t minBlockSize{128};
+/// requests larger than this are allocated directly from the heap
+constexpr std::size_t maxBlockSize{64 * 1024};
+
+/** allocation counts for the current thread*/
+struct PoolStatistics {
+    std::uint64_t heapAllocations{0};  //!< blocks that had to be allocated from the heap
+    std::uint64_t poolAllocations{0};  //!< blocks reused from the pool
+    std::uint64_t heapReleases{0};  //!< blocks deleted instead of being returned to the pool
+    std::uint64_t poolReleases{0};  //!< blocks returned to the pool
+    std::uint64_t stringReuses{0};  //!< string containers reused from the pool
+};
+
+/** get a block of memory of at least size bytes
+@param size the number of bytes required
+@param[out] capacity the actual size of the block
+@details blocks are allocated with new[] so can always be released with delete[]*/
+std::byte* allocateBlock(std::size_t size, std::size_t& capacity);
+
+/** return a block to the pool
+@details blocks whose capacity does not match a pool size class are deleted*/
+void releaseBlock(std::byte* block, std::size_t capacity) noexcept;
+
+/** get a vector of strings from the pool
+@details the strings in the vector retain the capacity from their previous use*/
+std::vector<std::string> acquireStrings();
+
+/** return a vector of strings to the pool, the vector is left empty if it was accepted*/
+void releaseStrings(std::vector<std::string>& strings) noexcept;
+
+/** get the allocation statistics for the current thread*/
+PoolStatistics getStatistics();
+
+/** reset the allocation statistics for the current thread*/
+void resetStatistics();
+}  // namespace helics::pool
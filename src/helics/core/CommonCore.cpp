@@ -9,6 +9,7 @@ SPDX-License-Identifier: BSD-3-Clause
 #include "../common/JsonGeneration.hpp"
 #include "../common/JsonProcessingFunctions.hpp"
 #include "../common/LogBuffer.hpp"
+#include "../common/WorkStealingPool.hpp"
 #include "../common/fmt_format.h"
 #include "../common/logging.hpp"
 #include "ActionMessage.hpp"
@@ -17,14 +18,18 @@ SPDX-License-Identifier: BSD-3-Clause
 #include "CoreFactory.hpp"
 #include "CoreFederateInfo.hpp"
 #include "EndpointInfo.hpp"
+#include "FederateCommandShards.hpp"
 #include "FederateState.hpp"
 #include "FilterCoordinator.hpp"
 #include "FilterFederate.hpp"
 #include "FilterInfo.hpp"
+#include "FlightRecorder.hpp"
 #include "InputInfo.hpp"
+#include "LatencyTracker.hpp"
 #include "LogManager.hpp"
 #include "PublicationInfo.hpp"
 #include "TimeoutMonitor.h"
+#include "TimingCoalescer.hpp"
 #include "TranslatorFederate.hpp"
 #include "core-exceptions.hpp"
 #include "coreTypeOperations.hpp"
@@ -32,6 +37,7 @@ SPDX-License-Identifier: BSD-3-Clause
 #include "gmlc/concurrency/DelayedObjects.hpp"
 #include "gmlc/utilities/stringOps.h"
 #include "gmlc/utilities/string_viewConversion.h"
+#include "helicsCLI11.hpp"
 #include "helicsVersion.hpp"
 #include "helics_definitions.hpp"
 #include "loggingHelper.hpp"
@@ -48,6 +54,8 @@ SPDX-License-Identifier: BSD-3-Clause
 #include <memory>
 #include <set>
 #include <string>
+#include <string_view>
+#include <unordered_set>
 #include <utility>
 #include <vector>
 
@@ -127,6 +135,31 @@ void CommonCore::configureFromVector(std::vector<std::string> args)
     }
 }
 
+std::shared_ptr<helicsCLI11App> CommonCore::generateCLI()
+{
+    auto app = BrokerBase::generateCLI();
+    app->add_option(
+           "--processing_shards",
+           processingShards,
+           "the number of worker threads routing the values and timing messages of the local federates, 0 to route everything through the main processing loop")
+        ->check(CLI::NonNegativeNumber);
+    app->add_flag(
+        "--input_ring_storage",
+        inputRingStorage,
+        "store the values queued for inputs in rings of reusable buffers instead of shared buffers allocated for each value");
+    app->add_option(
+           "--filter_workers",
+           filterWorkers,
+           "the number of worker threads running the stateless filter operations of the core, 0 to run all filters on the main processing loop")
+        ->check(CLI::NonNegativeNumber);
+    app->add_option(
+           "--callback_threads",
+           callbackThreads,
+           "the number of threads running the federates that use a federate operator instead of a thread of their own, 0 to use the number of hardware threads")
+        ->check(CLI::NonNegativeNumber);
+    return app;
+}
+
 bool CommonCore::connect()
 {
     auto cBrokerState = getBrokerState();
@@ -161,6 +194,14 @@ bool CommonCore::connect()
                     setActionFlag(m, observer_flag);
                 }
                 transmit(parent_route_id, m);
+                if (processingShards > 0 && !commandShards) {
+                    commandShards = std::make_unique<FederateCommandShards>(
+                        static_cast<std::size_t>(processingShards),
+                        [this](ActionMessage& command, const ShardRoutingTable& table) {
+                            return routeShardCommand(command, table);
+                        },
+                        [this](ActionMessage&& command) { addActionMessage(std::move(command)); });
+                }
                 setBrokerState(BrokerState::connected);
                 disconnection.activate();
             } else {
@@ -217,6 +258,9 @@ void CommonCore::processDisconnect(bool skipUnregister)
             addActionMessage(CMD_STOP);
             return;
         }
+        if (commandShards) {
+            commandShards->stop();
+        }
         brokerDisconnect();
     }
     setBrokerState(BrokerState::terminated);
@@ -285,6 +329,12 @@ void CommonCore::unregister()
 }
 CommonCore::~CommonCore()
 {
+    if (callbackPool) {
+        callbackPool->stop();
+    }
+    if (commandShards) {
+        commandShards->stop();
+    }
     joinAllThreads();
 }
 
@@ -478,7 +528,7 @@ void CommonCore::finalize(LocalFederateId federateID)
             ActionMessage bye(CMD_DISCONNECT);
             bye.source_id = fed->global_id.load();
             bye.dest_id = bye.source_id;
-            addActionMessage(bye);
+            addFederateCommand(federateID, std::move(bye));
         } break;
     }
 
@@ -579,6 +629,11 @@ void CommonCore::enterInitializingMode(LocalFederateId federateID)
         m.source_id = fed->global_id.load();
         addActionMessage(m);
 
+        if (fed->isCallbackFederate()) {
+            // the federate operator is called from the callback pool once the request is granted
+            fed->startCallbackOperations();
+            return;
+        }
         auto check = fed->enterInitializingMode();
         if (check != IterationResult::NEXT_STEP) {
             fed->init_requested = false;
@@ -687,6 +742,9 @@ LocalFederateId CommonCore::registerFederate(const std::string& name, const Core
     if (enable_profiling) {
         fed->setOptionFlag(defs::PROFILING, true);
     }
+    if (inputRingStorage) {
+        fed->interfaces().setInputRingStorage(true);
+    }
     ActionMessage m(CMD_REG_FED);
     m.name(name);
     if (observer || fed->getOptionFlag(HELICS_FLAG_OBSERVER)) {
@@ -1014,6 +1072,10 @@ void CommonCore::setFlagOption(LocalFederateId federateID, int32_t flag, bool fl
     if (fed == nullptr) {
         throw(InvalidIdentifier("federateID not valid (setFlag)"));
     }
+    if (flag == defs::Flags::REALTIME && flagValue && fed->isCallbackFederate()) {
+        // the realtime delay would block a thread shared with other callback federates
+        throw(InvalidParameter("realtime mode is not supported for callback federates"));
+    }
     ActionMessage cmd(CMD_FED_CONFIGURE_FLAG);
     cmd.messageID = flag;
     if (flagValue) {
@@ -1118,6 +1180,85 @@ InterfaceHandle CommonCore::getInput(LocalFederateId federateID, const std::stri
     return ci->getInterfaceHandle();
 }
 
+std::vector<InterfaceHandle>
+    CommonCore::registerValueInterfaces(LocalFederateId federateID,
+                                        const std::vector<ValueInterfaceDefinition>& interfaces)
+{
+    auto* fed = getFederateAt(federateID);
+    if (fed == nullptr) {
+        throw(InvalidIdentifier("federateID not valid (registerValueInterfaces)"));
+    }
+    std::size_t inputCount{0};
+    for (const auto& ifc : interfaces) {
+        if (ifc.input) {
+            ++inputCount;
+        }
+    }
+    auto flags = fed->getInterfaceFlags();
+    std::vector<InterfaceRegistration> registrations;
+    registrations.reserve(interfaces.size());
+    handles.modify([&](auto& hand) {
+        // check all the names before adding anything so a failure leaves no partial block
+        std::unordered_set<std::string_view> pubNames;
+        std::unordered_set<std::string_view> inputNames;
+        for (const auto& ifc : interfaces) {
+            if (ifc.key.empty()) {
+                continue;
+            }
+            if (ifc.input) {
+                if (hand.getInput(ifc.key) != nullptr || !inputNames.insert(ifc.key).second) {
+                    throw(RegistrationFailure(
+                        fmt::format("named Input {} already exists", ifc.key)));
+                }
+            } else if (hand.getPublication(ifc.key) != nullptr ||
+                       !pubNames.insert(ifc.key).second) {
+                throw(RegistrationFailure(
+                    fmt::format("Publication key {} already exists", ifc.key)));
+            }
+        }
+        hand.reserve(interfaces.size() - inputCount, inputCount);
+        for (const auto& ifc : interfaces) {
+            auto& hndl = hand.addHandle(fed->global_id,
+                                        ifc.input ? InterfaceType::INPUT :
+                                                    InterfaceType::PUBLICATION,
+                                        ifc.key,
+                                        ifc.type,
+                                        ifc.units);
+            hndl.local_fed_id = fed->local_id;
+            hndl.flags = flags;
+            registrations.push_back({ifc.input ? CMD_REG_INPUT : CMD_REG_PUB,
+                                     hndl.getInterfaceHandle(),
+                                     flags,
+                                     ifc.key,
+                                     ifc.type,
+                                     ifc.units});
+        }
+    });
+    std::vector<InterfaceHandle> ids;
+    ids.reserve(registrations.size());
+    for (const auto& reg : registrations) {
+        fed->createInterface((reg.action == CMD_REG_INPUT) ? InterfaceType::INPUT :
+                                                             InterfaceType::PUBLICATION,
+                             reg.handle,
+                             reg.key,
+                             reg.type,
+                             reg.units,
+                             flags);
+        ids.push_back(reg.handle);
+    }
+    LOG_INTERFACES(parent_broker_id,
+                   fed->getIdentifier(),
+                   fmt::format("registering {} value interfaces", registrations.size()));
+    if (!registrations.empty()) {
+        ActionMessage m(CMD_REG_INTERFACES);
+        m.source_id = fed->global_id.load();
+        m.flags = flags;
+        setInterfaceRegistrations(m, registrations);
+        actionQueue.push(std::move(m));
+    }
+    return ids;
+}
+
 InterfaceHandle CommonCore::registerPublication(LocalFederateId federateID,
                                                 const std::string& key,
                                                 const std::string& type,
@@ -1575,45 +1716,23 @@ void CommonCore::setValue(InterfaceHandle handle, const char* data, uint64_t len
                             fed->getIdentifier(),
                             fmt::format("setting value for {} size {}", handleInfo->key, len));
         }
-        auto subs = fed->getSubscribers(handle);
+        ActionMessage mv(CMD_PUB);
+        auto subs = fed->getSubscribers(handle, std::string_view(data, len), mv);
         if (subs.empty()) {
             return;
         }
-        if (subs.size() == 1) {
-            ActionMessage mv(CMD_PUB);
-            mv.source_id = handleInfo->getFederateId();
-            mv.source_handle = handle;
-            mv.setDestination(subs[0]);
-            mv.counter = static_cast<uint16_t>(fed->getCurrentIteration());
-            mv.payload.assign(data, len);
-            mv.actionTime = fed->nextAllowedSendTime();
-            actionQueue.push(std::move(mv));
-            return;
-        }
-        ActionMessage package(CMD_MULTI_MESSAGE);
-        package.source_id = handleInfo->getFederateId();
-        package.source_handle = handle;
-
-        ActionMessage mv(CMD_PUB);
         mv.source_id = handleInfo->getFederateId();
         mv.source_handle = handle;
         mv.counter = static_cast<uint16_t>(fed->getCurrentIteration());
-        mv.payload.assign(data, len);
         mv.actionTime = fed->nextAllowedSendTime();
-
-        for (auto& target : subs) {
-            mv.setDestination(target);
-            auto res = appendMessage(package, mv);
-            if (res < 0)  // deal with max package size if there are a lot of subscribers
-            {
-                actionQueue.push(std::move(package));
-                package = ActionMessage(CMD_MULTI_MESSAGE);
-                package.source_id = handleInfo->getFederateId();
-                package.source_handle = handle;
-                appendMessage(package, mv);
-            }
+        if (subs.size() == 1) {
+            mv.setDestination(subs[0]);
+        } else {
+            // the payload is copied once and shared by all the destinations
+            mv.setAction(CMD_PUB_FANOUT);
+            setFanoutTargets(mv, subs);
         }
-        actionQueue.push(std::move(package));
+        addFederateCommand(handleInfo->local_fed_id, std::move(mv));
     }
 }
 
@@ -1965,7 +2084,7 @@ void CommonCore::sendTo(InterfaceHandle sourceHandle,
     m.payload.assign(data, length);
     m.setStringData(destination, hndl->key, hndl->key);
     m.actionTime = fed->nextAllowedSendTime();
-    addActionMessage(std::move(m));
+    addFederateCommand(hndl->local_fed_id, std::move(m));
 }
 
 void CommonCore::sendToAt(InterfaceHandle sourceHandle,
@@ -2010,10 +2129,11 @@ void CommonCore::sendToAt(InterfaceHandle sourceHandle,
     m.payload.assign(data, length);
     m.setStringData(destination, hndl->key, hndl->key);
 
-    addActionMessage(std::move(m));
+    addFederateCommand(hndl->local_fed_id, std::move(m));
 }
 
 void CommonCore::generateMessages(
+    LocalFederateId federateID,
     ActionMessage& message,
     const std::vector<std::pair<GlobalHandle, std::string_view>>& targets)
 {
@@ -2021,7 +2141,7 @@ void CommonCore::generateMessages(
     if (targets.size() == 1) {
         message.setDestination(targets.front().first);
         message.setString(0, targets.front().second);
-        actionQueue.push(std::move(message));
+        addFederateCommand(federateID, std::move(message));
         return;
     }
     /** now generate a multimessage*/
@@ -2035,14 +2155,14 @@ void CommonCore::generateMessages(
         auto res = appendMessage(package, message);
         if (res < 0)  // deal with max package size if there are a lot of subscribers
         {
-            actionQueue.push(std::move(package));
+            addFederateCommand(federateID, std::move(package));
             package = ActionMessage(CMD_MULTI_MESSAGE);
             package.source_id = message.source_id;
             package.source_handle = message.source_handle;
             appendMessage(package, message);
         }
     }
-    actionQueue.push(std::move(package));
+    addFederateCommand(federateID, std::move(package));
 }
 
 void CommonCore::send(InterfaceHandle sourceHandle, const void* data, uint64_t length)
@@ -2067,7 +2187,7 @@ void CommonCore::send(InterfaceHandle sourceHandle, const void* data, uint64_t l
     m.payload.assign(data, length);
     m.messageID = ++messageCounter;
     m.setStringData("", hndl->key, hndl->key);
-    generateMessages(m, targets);
+    generateMessages(hndl->local_fed_id, m, targets);
 }
 
 void CommonCore::sendAt(InterfaceHandle sourceHandle, const void* data, uint64_t length, Time time)
@@ -2093,7 +2213,7 @@ void CommonCore::sendAt(InterfaceHandle sourceHandle, const void* data, uint64_t
     m.payload.assign(data, length);
     m.messageID = ++messageCounter;
     m.setStringData("", hndl->key, hndl->key);
-    generateMessages(m, targets);
+    generateMessages(hndl->local_fed_id, m, targets);
 }
 
 void CommonCore::sendMessage(InterfaceHandle sourceHandle, std::unique_ptr<Message> message)
@@ -2141,7 +2261,7 @@ void CommonCore::sendMessage(InterfaceHandle sourceHandle, std::unique_ptr<Messa
             if (targets.empty()) {
                 return;
             }
-            generateMessages(m, targets);
+            generateMessages(hndl->local_fed_id, m, targets);
         } else {
             throw(InvalidParameter("no destination specified in message"));
         }
@@ -2157,7 +2277,7 @@ void CommonCore::sendMessage(InterfaceHandle sourceHandle, std::unique_ptr<Messa
                 throw(InvalidParameter("targeted endpoint destination not in target list"));
             }
         }
-        addActionMessage(std::move(m));
+        addFederateCommand(hndl->local_fed_id, std::move(m));
     }
 }
 
@@ -2170,14 +2290,53 @@ void CommonCore::deliverMessage(ActionMessage& message)
                 loopHandles.getEndpoint(message.getString(targetStringLoc)) :
                 loopHandles.findHandle(message.getDest());
             if (localP == nullptr) {
+                if (message.dest_id != parent_broker_id) {
+                    if (!isLocal(message.dest_id)) {
+                        transmit(getRoute(message.dest_id), message);
+                        return;
+                    }
+                    // the sender used a stale location for the endpoint so clear it and route
+                    // the message by name again
+                    invalidateEndpointLocation(message);
+                    const auto& target = message.getString(targetStringLoc);
+                    if (target.empty()) {
+                        auto warnString =
+                            fmt::format("destination endpoint no longer exists, message from {} "
+                                        "dropped",
+                                        message.getString(sourceStringLoc));
+                        LOG_WARNING(global_broker_id_local, getIdentifier(), warnString);
+                        ActionMessage warn(CMD_WARNING, global_broker_id_local, message.source_id);
+                        warn.payload = std::move(warnString);
+                        warn.messageID = HELICS_LOG_LEVEL_WARNING;
+                        warn.setString(0, getIdentifier());
+                        routeMessage(warn);
+                        return;
+                    }
+                    auto kfnd = knownExternalEndpoints.find(target);
+                    if (kfnd != knownExternalEndpoints.end() &&
+                        kfnd->second == message.getDest()) {
+                        knownExternalEndpoints.erase(kfnd);
+                    }
+                    message.dest_id = parent_broker_id;
+                    message.dest_handle = InterfaceHandle();
+                    deliverMessage(message);
+                    return;
+                }
                 auto kfnd = knownExternalEndpoints.find(message.getString(targetStringLoc));
-                if (kfnd != knownExternalEndpoints.end()) {  // destination is known
-                    transmit(kfnd->second, message);
+                if (kfnd != knownExternalEndpoints.end() &&
+                    kfnd->second.handle.isValid()) {  // destination is known
+                    message.setDestination(kfnd->second);
+                    transmit(getRoute(message.dest_id), message);
                 } else {
+                    ++namedRoutingCount;
                     transmit(parent_route_id, message);
                 }
                 return;
             }
+            if (checkActionFlag(*localP, disconnected_flag) &&
+                message.dest_id != parent_broker_id) {
+                invalidateEndpointLocation(message);
+            }
             // now we deal with local processing
             if (checkActionFlag(*localP, has_dest_filter_flag)) {
                 if (!filterFed->destinationProcessMessage(message, localP)) {
@@ -2212,6 +2371,69 @@ void CommonCore::deliverMessage(ActionMessage& message)
     }
 }
 
+void CommonCore::invalidateEndpointLocation(const ActionMessage& message)
+{
+    const auto& target = message.getString(targetStringLoc);
+    if (target.empty()) {
+        return;
+    }
+    // the sender routed the message by a location that is not usable for later messages
+    ActionMessage location(CMD_ENDPOINT_LOCATION);
+    location.source_id = global_broker_id_local;
+    location.dest_id = message.source_id;
+    location.name(target);
+    if (isLocal(location.dest_id)) {
+        processEndpointLocation(location);
+    } else {
+        transmit(getRoute(location.dest_id), location);
+    }
+}
+
+void CommonCore::processEndpointLocation(const ActionMessage& command)
+{
+    if (command.dest_id != global_broker_id_local && !isLocal(command.dest_id)) {
+        routeMessage(command);
+        return;
+    }
+    if (!command.source_handle.isValid()) {
+        // later messages go through the broker which knows if the endpoint still exists
+        knownExternalEndpoints.erase(std::string(command.name()));
+        return;
+    }
+    knownExternalEndpoints.insert_or_assign(std::string(command.name()), command.getSource());
+}
+
+void CommonCore::evictEndpointLocations(GlobalFederateId fedID)
+{
+    if (knownExternalEndpoints.empty()) {
+        return;
+    }
+    // a disconnecting core or broker takes the endpoints of the federates routed through it along
+    const bool viaBroker = fedID.isBroker();
+    const auto route = getRoute(fedID);
+    if (viaBroker && route == parent_route_id) {
+        return;
+    }
+    for (auto it = knownExternalEndpoints.begin(); it != knownExternalEndpoints.end();) {
+        const auto eptFed = it->second.fed_id;
+        if (eptFed == fedID || (viaBroker && getRoute(eptFed) == route)) {
+            it = knownExternalEndpoints.erase(it);
+        } else {
+            ++it;
+        }
+    }
+}
+
+void CommonCore::evictEndpointLocation(GlobalHandle endpoint)
+{
+    for (auto it = knownExternalEndpoints.begin(); it != knownExternalEndpoints.end(); ++it) {
+        if (it->second == endpoint) {
+            knownExternalEndpoints.erase(it);
+            return;
+        }
+    }
+}
+
 uint64_t CommonCore::receiveCount(InterfaceHandle destination)
 {
     auto* fed = getHandleFederate(destination);
@@ -2443,6 +2665,30 @@ void CommonCore::setQueryCallback(LocalFederateId federateID,
     fed->setQueryCallback(std::move(queryFunction));
 }
 
+void CommonCore::setFederateOperator(LocalFederateId federateID,
+                                     std::shared_ptr<FederateOperator> callback)
+{
+    auto* fed = getFederateAt(federateID);
+    if (fed == nullptr) {
+        throw(InvalidIdentifier("FederateID is invalid (setFederateOperator)"));
+    }
+    if (!callback) {
+        fed->setFederateOperator(nullptr, nullptr);
+        return;
+    }
+    if (fed->getState() != HELICS_CREATED) {
+        throw(InvalidFunctionCall("federate operator may only be set in startup mode"));
+    }
+    if (fed->getOptionFlag(defs::Flags::REALTIME)) {
+        throw(InvalidParameter("realtime mode is not supported for callback federates"));
+    }
+    std::call_once(callbackPoolCreation, [this]() {
+        callbackPool =
+            std::make_unique<WorkStealingPool>(static_cast<std::size_t>(callbackThreads));
+    });
+    fed->setFederateOperator(std::move(callback), callbackPool.get());
+}
+
 std::string CommonCore::filteredEndpointQuery(const FederateState* fed) const
 {
     Json::Value base;
@@ -2543,7 +2789,12 @@ static const std::set<std::string> querySet{"isinit",
                                             "global_state",
                                             "global_flush",
                                             "current_state",
-                                            "logs"};
+                                            "latency",
+                                            "flight_recorder",
+                                            "timing_coalescing",
+                                            "endpoint_locations",
+                                            "logs",
+                                            "dropped_logs"};
 
 std::string CommonCore::quickCoreQueries(const std::string& queryStr) const
 {
@@ -2562,6 +2813,34 @@ std::string CommonCore::quickCoreQueries(const std::string& queryStr) const
     if (queryStr == "version") {
         return std::string{"\""} + versionString + '"';
     }
+    if (queryStr == "latency") {
+        Json::Value base;
+        addBaseInformation(base, true);
+        base["enabled"] = static_cast<bool>(latencyTracker);
+        if (latencyTracker) {
+            latencyTracker->loadJson(base);
+        }
+        return fileops::generateJsonString(base);
+    }
+    if (queryStr == "flight_recorder") {
+        Json::Value base;
+        addBaseInformation(base, true);
+        auto recorder = std::atomic_load(&flightRecorder);
+        base["enabled"] = static_cast<bool>(recorder);
+        if (recorder) {
+            recorder->loadJson(base);
+        }
+        return fileops::generateJsonString(base);
+    }
+    if (queryStr == "timing_coalescing") {
+        Json::Value base;
+        addBaseInformation(base, true);
+        base["enabled"] = static_cast<bool>(timingCoalescer);
+        if (timingCoalescer) {
+            timingCoalescer->loadJson(base);
+        }
+        return fileops::generateJsonString(base);
+    }
     return std::string{};
 }
 
@@ -2741,6 +3020,9 @@ std::string CommonCore::coreQuery(const std::string& queryStr, bool force_orderi
         bufferToJson(mLogManager->getLogBuffer(), base);
         return fileops::generateJsonString(base);
     }
+    if (queryStr == "dropped_logs") {
+        return std::to_string(mLogManager->getDroppedLogCount());
+    }
     if (queryStr == "address") {
         return Json::valueToQuotedString(getAddress().c_str());
     }
@@ -2771,6 +3053,19 @@ std::string CommonCore::coreQuery(const std::string& queryStr, bool force_orderi
 
         return fileops::generateJsonString(base);
     }
+    if (queryStr == "endpoint_locations") {
+        Json::Value base;
+        addBaseInformation(base, true);
+        base["routed_by_name"] = static_cast<Json::UInt64>(namedRoutingCount);
+        base["locations"] = Json::objectValue;
+        for (const auto& location : knownExternalEndpoints) {
+            Json::Value loc;
+            loc["federate"] = location.second.fed_id.baseValue();
+            loc["handle"] = location.second.handle.baseValue();
+            base["locations"][location.first] = loc;
+        }
+        return fileops::generateJsonString(base);
+    }
     if (queryStr == "interfaces") {
         Json::Value base;
         loadBasicJsonInfo(base, [this](Json::Value& val, const FedInfo& fed) {
@@ -3089,6 +3384,7 @@ void CommonCore::processPriorityCommand(ActionMessage&& command)
                     if (!keyFed.isValid()) {
                         keyFed = fed->global_id;
                     }
+                    updateShardRoutes();
                 }
 
                 // push the command to the local queue
@@ -3457,8 +3753,12 @@ void CommonCore::processCommand(ActionMessage&& command)
             //  }
             break;
         case CMD_PUB:
+        case CMD_DELTA_RESYNC:
             routeMessage(command);
             break;
+        case CMD_PUB_FANOUT:
+            routeFanoutMessage(command);
+            break;
         case CMD_LOG:
         case CMD_REMOTE_LOG:
         case CMD_WARNING:
@@ -3538,6 +3838,9 @@ void CommonCore::processCommand(ActionMessage&& command)
         case CMD_REG_TRANSLATOR:
             registerInterface(command);
             break;
+        case CMD_REG_INTERFACES:
+            registerInterfaceBlock(command);
+            break;
         case CMD_ADD_NAMED_ENDPOINT:
         case CMD_ADD_NAMED_PUBLICATION:
         case CMD_ADD_NAMED_INPUT:
@@ -3560,6 +3863,9 @@ void CommonCore::processCommand(ActionMessage&& command)
         case CMD_REMOVE_SUBSCRIBER:
         case CMD_REMOVE_FILTER:
         case CMD_REMOVE_ENDPOINT:
+            if (command.action() == CMD_REMOVE_ENDPOINT) {
+                evictEndpointLocation(command.getSource());
+            }
             removeTargetFromInterface(command);
             break;
         case CMD_CLOSE_INTERFACE:
@@ -3646,6 +3952,14 @@ void CommonCore::processCommand(ActionMessage&& command)
                 deliverMessage(command);
             }
 
+            break;
+        case CMD_ENDPOINT_LOCATION:
+            processEndpointLocation(command);
+            break;
+        case CMD_SHARD_RELEASE:
+            if (commandShards) {
+                commandShards->release(command);
+            }
             break;
         case CMD_PROFILER_DATA:
             if (enable_profiling) {
@@ -3774,6 +4088,27 @@ void CommonCore::registerInterface(ActionMessage& command)
     }
 }
 
+void CommonCore::registerInterfaceBlock(ActionMessage& command)
+{
+    if (command.dest_id != parent_broker_id) {
+        routeMessage(std::move(command));
+        return;
+    }
+    auto interfaces = getInterfaceRegistrations(command);
+    auto& lH = loopHandles;
+    handles.read([&interfaces, &lH](auto& hand) {
+        for (const auto& ifc : interfaces) {
+            const auto* info = hand.getHandleInfo(ifc.handle.baseValue());
+            if (info != nullptr) {
+                lH.addHandleAtIndex(*info, ifc.handle.baseValue());
+            }
+        }
+    });
+    if (!interfaces.empty()) {
+        transmit(parent_route_id, std::move(command));
+    }
+}
+
 void CommonCore::generateTranslatorFederate()
 {
     auto fid = translatorFedID.load();
@@ -3819,7 +4154,9 @@ void CommonCore::generateFilterFederate()
                             [this](ActionMessage&& m) { addActionMessage(std::move(m)); },
                             [this](const ActionMessage& m) { routeMessage(m); },
                             [this](ActionMessage&& m) { routeMessage(std::move(m)); });
+    filterFed->setWorkerCount(filterWorkers);
     hasFilters = true;
+    updateShardRoutes();
 
     filterFed->setHandleManager(&loopHandles);
     filterFed->setLogger([this](int level, const std::string& name, const std::string& message) {
@@ -4462,6 +4799,7 @@ void CommonCore::processDisconnectCommand(ActionMessage& cmd)
             // be forwarded or processed
             break;
         case CMD_BROADCAST_DISCONNECT:
+            evictEndpointLocations(cmd.source_id);
             timeCoord->processTimeMessage(cmd);
             loopFederates.apply([&cmd](auto& fed) { fed->addAction(cmd); });
             checkAndProcessDisconnect();
@@ -4563,6 +4901,9 @@ void CommonCore::processDisconnectCommand(ActionMessage& cmd)
             break;
         case CMD_DISCONNECT:
         case CMD_DISCONNECT_FED:
+            if (!isLocal(cmd.source_id)) {
+                evictEndpointLocations(cmd.source_id);
+            }
             if (cmd.dest_id == parent_broker_id) {
                 if (getBrokerState() < BrokerState::terminating) {
                     auto fed = loopFederates.find(cmd.source_id);
@@ -5200,6 +5541,240 @@ void CommonCore::routeMessage(ActionMessage&& cmd)
     }
 }  // namespace helics
 
+void CommonCore::addFederateCommand(LocalFederateId federateID, ActionMessage&& command)
+{
+    if (commandShards && commandShards->addCommand(federateID, std::move(command))) {
+        return;
+    }
+    addActionMessage(std::move(command));
+}
+
+bool CommonCore::routeShardCommand(ActionMessage& command, const ShardRoutingTable& table)
+{
+    const auto action = command.action();
+    switch (action) {
+        case CMD_PUB:
+            break;
+        case CMD_PUB_FANOUT:
+            return routeShardFanout(command, table);
+        case CMD_TIME_REQUEST:
+        case CMD_TIME_GRANT:
+        case CMD_EXEC_REQUEST:
+        case CMD_EXEC_GRANT:
+            // filters can place blocks on the timing messages which only the main loop handles
+            if (!table.timingMessages) {
+                return false;
+            }
+            break;
+        default:
+            return false;
+    }
+    const auto dest = command.dest_id;
+    if (!dest.isValid() || dest == table.coreId || dest == filterFedID.load() ||
+        dest == translatorFedID.load()) {
+        return false;
+    }
+    const bool keyGrant = (action == CMD_TIME_GRANT || action == CMD_EXEC_GRANT) &&
+        command.source_id == table.keyFederate;
+    const double grantTime =
+        (action == CMD_TIME_GRANT) ? static_cast<double>(command.actionTime) : 0.0;
+    if (dest == parent_broker_id) {
+        transmit(parent_route_id, std::move(command));
+    } else {
+        auto fed = table.federates.find(dest);
+        if (fed != table.federates.end()) {
+            auto state = fed->second->getState();
+            if (state == FederateStates::HELICS_FINISHED ||
+                state == FederateStates::HELICS_ERROR) {
+                return false;
+            }
+            fed->second->addAction(std::move(command));
+        } else {
+            transmit(getRoute(dest), std::move(command));
+        }
+    }
+    if (keyGrant) {
+        simTime.store(grantTime);
+    }
+    return true;
+}
+
+bool CommonCore::routeShardFanout(ActionMessage& command, const ShardRoutingTable& table)
+{
+    auto targets = getFanoutTargets(command);
+    // keep the targets for each federate together
+    std::stable_sort(targets.begin(), targets.end(), [](GlobalHandle a, GlobalHandle b) {
+        return a.fed_id < b.fed_id;
+    });
+    std::vector<std::pair<FederateState*, std::vector<GlobalHandle>>> localTargets;
+    std::vector<std::pair<route_id, std::vector<GlobalHandle>>> remoteTargets;
+    for (const auto& target : targets) {
+        const auto dest = target.fed_id;
+        if (!dest.isValid() || dest == table.coreId || dest == filterFedID.load() ||
+            dest == translatorFedID.load()) {
+            return false;
+        }
+        auto fed = table.federates.find(dest);
+        if (fed != table.federates.end()) {
+            auto state = fed->second->getState();
+            if (state == FederateStates::HELICS_FINISHED ||
+                state == FederateStates::HELICS_ERROR) {
+                return false;
+            }
+            if (localTargets.empty() || localTargets.back().first != fed->second) {
+                localTargets.emplace_back(fed->second, std::vector<GlobalHandle>{});
+            }
+            localTargets.back().second.push_back(target);
+        } else {
+            auto route = getRoute(dest);
+            auto fnd = std::find_if(remoteTargets.begin(),
+                                    remoteTargets.end(),
+                                    [route](const auto& rt) { return rt.first == route; });
+            if (fnd == remoteTargets.end()) {
+                remoteTargets.emplace_back(route, std::vector<GlobalHandle>{target});
+            } else {
+                fnd->second.push_back(target);
+            }
+        }
+    }
+    for (auto& remote : remoteTargets) {
+        transmitFanout(command, remote.first, remote.second);
+    }
+    if (!localTargets.empty()) {
+        auto sharedData = std::make_shared<const SmallBuffer>(std::move(command.payload));
+        for (auto& local : localTargets) {
+            sendSharedFanout(command, local.first, local.second, sharedData);
+        }
+    }
+    return true;
+}
+
+void CommonCore::updateShardRoutes()
+{
+    if (!commandShards) {
+        return;
+    }
+    auto table = std::make_shared<ShardRoutingTable>();
+    for (const auto& fed : loopFederates) {
+        auto fid = fed->global_id.load();
+        if (fid.isValid()) {
+            table->federates.emplace(fid, fed.fed);
+        }
+    }
+    table->coreId = global_broker_id_local;
+    table->keyFederate = keyFed;
+    table->timingMessages = !hasFilters;
+    commandShards->updateRoutingTable(std::move(table));
+}
+
+/** generate a publication for a single target of a fanout publication*/
+static ActionMessage generateFanoutPub(const ActionMessage& cmd, GlobalHandle target)
+{
+    ActionMessage mv(CMD_PUB);
+    mv.source_id = cmd.source_id;
+    mv.source_handle = cmd.source_handle;
+    mv.setDestination(target);
+    mv.messageID = cmd.messageID;
+    mv.counter = cmd.counter;
+    mv.flags = cmd.flags;
+    mv.actionTime = cmd.actionTime;
+    mv.payload = cmd.payload;
+    return mv;
+}
+
+void CommonCore::routeFanoutMessage(ActionMessage& cmd)
+{
+    auto targets = getFanoutTargets(cmd);
+    if (targets.empty()) {
+        return;
+    }
+    // keep the targets for each federate together
+    std::stable_sort(targets.begin(), targets.end(), [](GlobalHandle a, GlobalHandle b) {
+        return a.fed_id < b.fed_id;
+    });
+    std::vector<GlobalHandle> localTargets;
+    std::vector<std::pair<route_id, std::vector<GlobalHandle>>> remoteTargets;
+    for (const auto& target : targets) {
+        if (isLocal(target.fed_id)) {
+            localTargets.push_back(target);
+        } else if ((target.fed_id == filterFedID.load()) ||
+                   (target.fed_id == translatorFedID.load()) ||
+                   (target.fed_id == global_broker_id_local)) {
+            routeMessage(generateFanoutPub(cmd, target));
+        } else {
+            auto route = getRoute(target.fed_id);
+            auto fnd = std::find_if(remoteTargets.begin(),
+                                    remoteTargets.end(),
+                                    [route](const auto& rt) { return rt.first == route; });
+            if (fnd == remoteTargets.end()) {
+                remoteTargets.emplace_back(route, std::vector<GlobalHandle>{target});
+            } else {
+                fnd->second.push_back(target);
+            }
+        }
+    }
+    // the payload is serialized once per remote route
+    for (auto& remote : remoteTargets) {
+        transmitFanout(cmd, remote.first, remote.second);
+    }
+    if (localTargets.empty()) {
+        return;
+    }
+    // all the local destinations share a single copy of the payload
+    auto sharedData = std::make_shared<const SmallBuffer>(std::move(cmd.payload));
+    auto start = localTargets.begin();
+    while (start != localTargets.end()) {
+        auto fedID = start->fed_id;
+        auto end = std::find_if(start, localTargets.end(), [fedID](GlobalHandle hnd) {
+            return hnd.fed_id != fedID;
+        });
+        auto* fed = getFederateCore(fedID);
+        if (fed != nullptr) {
+            auto fedState = fed->getState();
+            if ((fedState != FederateStates::HELICS_FINISHED) &&
+                (fedState != FederateStates::HELICS_ERROR)) {
+                sendSharedFanout(cmd, fed, std::vector<GlobalHandle>(start, end), sharedData);
+            } else {
+                for (auto it = start; it != end; ++it) {
+                    auto mv = generateFanoutPub(cmd, *it);
+                    mv.payload = *sharedData;
+                    routeMessage(std::move(mv));
+                }
+            }
+        }
+        start = end;
+    }
+}
+
+void CommonCore::transmitFanout(const ActionMessage& cmd,
+                                route_id route,
+                                const std::vector<GlobalHandle>& targets)
+{
+    if (targets.size() == 1) {
+        transmit(route, generateFanoutPub(cmd, targets.front()));
+    } else {
+        ActionMessage fanout(cmd);
+        setFanoutTargets(fanout, targets);
+        transmit(route, std::move(fanout));
+    }
+}
+
+void CommonCore::sendSharedFanout(const ActionMessage& cmd,
+                                  FederateState* fed,
+                                  const std::vector<GlobalHandle>& targets,
+                                  const std::shared_ptr<const SmallBuffer>& data)
+{
+    ActionMessage fanout(CMD_PUB_FANOUT);
+    fanout.source_id = cmd.source_id;
+    fanout.source_handle = cmd.source_handle;
+    fanout.counter = cmd.counter;
+    fanout.flags = cmd.flags;
+    fanout.actionTime = cmd.actionTime;
+    fanout.sequenceID = ++sharedPayloadCounter;
+    setFanoutTargets(fanout, targets);
+    fed->addSharedValueAction(std::move(fanout), data);
+}
+
 // Checks for filter operations
 ActionMessage& CommonCore::processMessage(ActionMessage& m)
 {
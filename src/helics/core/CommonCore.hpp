@@ -31,6 +31,7 @@ SPDX-License-Identifier: BSD-3-Clause
 #include <deque>
 #include <map>
 #include <memory>
+#include <mutex>
 #include <set>
 #include <string>
 #include <tuple>
@@ -48,6 +49,9 @@ class FilterInfo;
 class FilterFederate;
 class TranslatorFederate;
 class TimeoutMonitor;
+class FederateCommandShards;
+class WorkStealingPool;
+struct ShardRoutingTable;
 enum class InterfaceType : char;
 /** enumeration of possible operating conditions for a federate*/
 enum class OperatingState : std::uint8_t { OPERATING = 0, ERROR_STATE = 5, DISCONNECTED = 10 };
@@ -143,6 +147,10 @@ class CommonCore: public Core, public BrokerBase {
     virtual InterfaceHandle getInput(LocalFederateId federateID,
                                      const std::string& key) const override final;
 
+    virtual std::vector<InterfaceHandle> registerValueInterfaces(
+        LocalFederateId federateID,
+        const std::vector<ValueInterfaceDefinition>& interfaces) override final;
+
     virtual const std::string& getHandleName(InterfaceHandle handle) const override final;
 
     virtual void setHandleOption(InterfaceHandle handle,
@@ -253,6 +261,8 @@ class CommonCore: public Core, public BrokerBase {
     virtual void
         setQueryCallback(LocalFederateId federateID,
                          std::function<std::string(std::string_view)> queryFunction) override;
+    virtual void setFederateOperator(LocalFederateId federateID,
+                                     std::shared_ptr<FederateOperator> callback) override;
     virtual void setGlobal(const std::string& valueName, const std::string& value) override;
     virtual void sendCommand(const std::string& target,
                              const std::string& commandStr,
@@ -272,6 +282,10 @@ class CommonCore: public Core, public BrokerBase {
     /**TODO(PT): figure out how to make this non-public, it needs to be called in a lambda function,
      * may need a helper class of some sort*/
     virtual void processDisconnect(bool skipUnregister = false) override final;
+    /** add a command generated by a local federate
+    @details if the core uses processing shards the command is routed by the shard of the federate
+    otherwise it is added to the main processing queue*/
+    void addFederateCommand(LocalFederateId federateID, ActionMessage&& command);
 
     /** check to make sure there are no inflight queries that need to be resolved before
      * disconnect*/
@@ -305,6 +319,8 @@ class CommonCore: public Core, public BrokerBase {
   protected:
     virtual void processCommand(ActionMessage&& command) override final;
 
+    virtual std::shared_ptr<helicsCLI11App> generateCLI() override;
+
     virtual void processPriorityCommand(ActionMessage&& command) override final;
 
     /** transit an ActionMessage to another core or broker
@@ -366,12 +382,26 @@ class CommonCore: public Core, public BrokerBase {
     gmlc::containers::SimpleQueue<ActionMessage>
         delayTransmitQueue;  //!< FIFO queue for transmissions to the root that need to be delayed
                              //!< for a certain time
-    std::unordered_map<std::string, route_id>
-        knownExternalEndpoints;  //!< external map for all known external endpoints with names and
-                                 //!< route
+    /// map of the resolved handles of external endpoints messages were sent to by name
+    std::unordered_map<std::string, GlobalHandle> knownExternalEndpoints;
+    /// the number of messages to external endpoints routed through the broker by name
+    std::uint64_t namedRoutingCount{0};
     std::vector<std::pair<std::string, std::string>> tags;  //!< storage for user defined tags
     std::unique_ptr<TimeoutMonitor>
         timeoutMon;  //!< class to handle timeouts and disconnection notices
+    /// the number of worker threads used to route federate commands, 0 to use only the main loop
+    int processingShards{0};
+    /// store the values queued for the inputs of the local federates in rings of reusable buffers
+    bool inputRingStorage{false};
+    /// the number of threads running stateless filter operations, 0 to use only the main loop
+    int filterWorkers{0};
+    /// the workers routing federate commands when processing shards are used
+    std::unique_ptr<FederateCommandShards> commandShards;
+    /// the number of threads running the callback federates, 0 to use the hardware concurrency
+    int callbackThreads{0};
+    /// the threads running the local federates that use a federate operator
+    std::unique_ptr<WorkStealingPool> callbackPool;
+    std::once_flag callbackPoolCreation;
     /** actually transmit messages that were delayed until the core was actually registered*/
     void transmitDelayedMessages();
     /** respond to delayed message with an error*/
@@ -392,6 +422,18 @@ class CommonCore: public Core, public BrokerBase {
     /** function for routing a message from based on the destination specified in the
      * ActionMessage*/
     void routeMessage(ActionMessage&& cmd);
+    /** route a publication with multiple destinations, local destinations share a single copy of
+     * the payload and remote destinations receive one message per route*/
+    void routeFanoutMessage(ActionMessage& cmd);
+    /** send a publication to the fanout targets reached through a single route*/
+    void transmitFanout(const ActionMessage& cmd,
+                        route_id route,
+                        const std::vector<GlobalHandle>& targets);
+    /** give the fanout targets of a local federate a shared copy of the payload*/
+    void sendSharedFanout(const ActionMessage& cmd,
+                          FederateState* fed,
+                          const std::vector<GlobalHandle>& targets,
+                          const std::shared_ptr<const SmallBuffer>& data);
 
     /** check if we can remove some dependencies*/
     void checkDependencies();
@@ -453,6 +495,8 @@ class CommonCore: public Core, public BrokerBase {
     /** counter for the number of messages that have been sent, nothing magical about 54 just a
      * number bigger than 1 to prevent confusion */
     std::atomic<int32_t> messageCounter{54};
+    /// counter for generating keys to the payloads shared with local federates
+    std::atomic<std::uint32_t> sharedPayloadCounter{0};
     ordered_guarded<HandleManager> handles;  //!< local handle information;
     HandleManager loopHandles;  //!< copy of handles to use in the primary processing loop without
                                 //!< thread protection
@@ -493,10 +537,27 @@ class CommonCore: public Core, public BrokerBase {
     /** wait for the core to be registered with the broker*/
     bool waitCoreRegistration();
     /** generate the messages to a set of destinations*/
-    void generateMessages(ActionMessage& message,
+    void generateMessages(LocalFederateId federateID,
+                          ActionMessage& message,
                           const std::vector<std::pair<GlobalHandle, std::string_view>>& targets);
     /** deliver a message to the appropriate location*/
     void deliverMessage(ActionMessage& message);
+    /** notify the sender of a message that the location it was routed by is no longer usable*/
+    void invalidateEndpointLocation(const ActionMessage& message);
+    /** update the known location of an external endpoint*/
+    void processEndpointLocation(const ActionMessage& command);
+    /** drop the known locations of the endpoints of a disconnected federate, core, or broker*/
+    void evictEndpointLocations(GlobalFederateId fedID);
+    /** drop the known location of an endpoint that was closed*/
+    void evictEndpointLocation(GlobalHandle endpoint);
+    /** route a federate command on a shard worker thread
+    @return false if the command needs to be processed by the main loop*/
+    bool routeShardCommand(ActionMessage& command, const ShardRoutingTable& table);
+    /** route a publication with multiple destinations on a shard worker thread
+    @return false if any of the destinations needs the main loop*/
+    bool routeShardFanout(ActionMessage& command, const ShardRoutingTable& table);
+    /** update the routing information used by the processing shards*/
+    void updateShardRoutes();
     /** function to deal with a source filters*/
     ActionMessage& processMessage(ActionMessage& message);
     /** add a new handle to the generic structure
@@ -527,6 +588,8 @@ class CommonCore: public Core, public BrokerBase {
     void setAsUsed(BasicHandleInfo* hand);
     /** function to consolidate the registration of interfaces in the core*/
     void registerInterface(ActionMessage& command);
+    /** handle a block of interface registrations in the core*/
+    void registerInterfaceBlock(ActionMessage& command);
     /** function to handle adding a target to an interface*/
     void addTargetToInterface(ActionMessage& command);
     /** function to deal with removing a target from an interface*/
@@ -0,0 +1,74 @@
+/*
+Copyright (c) 2017-2022,
+Battelle Memorial Institute; Lawrence Livermore National Security, LLC; Alliance for Sustainable
+Energy, LLC.  See the top-level NOTICE for additional details. All rights reserved.
+SPDX-License-Identifier: BSD-3-Clause
+*/
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+
+namespace helics {
+/** table of strings interned on a single connection for the compact ActionMessage serialization
+@details the sending and receiving side of a connection each hold a table, the sender adds a string
+the first time it is sent as a literal and refers to it by index afterwards, the receiver mirrors the
+additions so messages must be decoded in the same order they were encoded*/
+class CompactStringTable {
+  public:
+    /// the maximum number of strings stored in a table
+    static constexpr std::size_t maxEntries{4096};
+    /// strings shorter than this are always sent as literals
+    static constexpr std::size_t minInternLength{4};
+    /// strings longer than this are always sent as literals
+    static constexpr std::size_t maxInternLength{256};
+
+    CompactStringTable() = default;
+    CompactStringTable(const CompactStringTable&) = delete;
+    CompactStringTable& operator=(const CompactStringTable&) = delete;
+
+    /** find the index of an interned string
+    @return the index or -1 if the string is not in the table*/
+    std::int32_t find(std::string_view str) const
+    {
+        auto fnd = lookup.find(str);
+        return (fnd != lookup.end()) ? static_cast<std::int32_t>(fnd->second) : -1;
+    }
+    /** check if a string sent as a literal gets added to the table*/
+    bool shouldIntern(std::string_view str) const
+    {
+        return str.size() >= minInternLength && str.size() <= maxInternLength &&
+            strings.size() < maxEntries;
+    }
+    /** add a string to the table*/
+    void add(std::string_view str)
+    {
+        // deque elements are not moved on insertion so the views in the lookup remain valid
+        const auto& stored = strings.emplace_back(str);
+        lookup.emplace(stored, static_cast<std::uint32_t>(strings.size() - 1));
+    }
+    /** get an interned string, the index must be less than size()*/
+    const std::string& get(std::size_t index) const { return strings[index]; }
+    /** get the number of interned strings*/
+    std::size_t size() const { return strings.size(); }
+    /** remove all the strings from the table*/
+    void clear()
+    {
+        lookup.clear();
+        strings.clear();
+    }
+    /** check whether the table has been used for a message yet
+    @details the first message encoded with a table instructs the receiver to reset its copy*/
+    bool isActive() const { return active; }
+    void setActive() { active = true; }
+
+  private:
+    std::deque<std::string> strings;
+    std::unordered_map<std::string_view, std::uint32_t> lookup;
+    bool active{false};
+};
+}  // namespace helics
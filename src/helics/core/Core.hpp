@@ -157,6 +157,8 @@ class Core {
      * Change the federate state to the Initializing state.
      *
      * May only be invoked in Created state otherwise an error is thrown
+     * For a federate with a federate operator the call returns once the request is sent and the
+     * operator is called from the core pool when the federate enters initializing mode.
      */
     virtual void enterInitializingMode(LocalFederateId federateID) = 0;
 
@@ -365,6 +367,20 @@ class Core {
     @return a handle to identify the input*/
     virtual InterfaceHandle getInput(LocalFederateId federateID, const std::string& key) const = 0;
 
+    /**
+     * Register a block of publications and inputs for the specified federate.
+     *
+     * May only be invoked in the initialize state.  The interfaces are registered together and
+     * sent to the broker in a single message, if any of the names is already in use none of the
+     * interfaces are registered.
+     * @param federateID the identifier for the federate to register the interfaces on
+     * @param interfaces the definitions of the interfaces
+     * @return the handles of the interfaces in the same order as the definitions
+     */
+    virtual std::vector<InterfaceHandle>
+        registerValueInterfaces(LocalFederateId federateID,
+                                const std::vector<ValueInterfaceDefinition>& interfaces) = 0;
+
     /**
      * Returns the name or identifier for a specified handle
      */
@@ -821,6 +837,17 @@ class Core {
     virtual void setQueryCallback(LocalFederateId federateID,
                                   std::function<std::string(std::string_view)> queryFunction) = 0;
 
+    /** set an operator to run a federate from the threads of the core
+    @details the federate needs no thread of its own, the operator is called for the entry to
+    executing mode and for each time grant once enterInitializingMode is called and the federate
+    finalizes when the operator requests Time::maxVal() or the co-simulation halts
+    @param federateID the identifier for the federate
+    @param callback pointer to the operator class running the federate, nullptr to go back to
+    processing the federate from the calling threads
+    */
+    virtual void setFederateOperator(LocalFederateId federateID,
+                                     std::shared_ptr<FederateOperator> callback) = 0;
+
     /**
      * setter for the interface information
      * @param handle the identifiers for the interface to set the info data on
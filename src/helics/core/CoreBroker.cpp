@@ -13,8 +13,12 @@ SPDX-License-Identifier: BSD-3-Clause
 #include "../common/logging.hpp"
 #include "BaseTimeCoordinator.hpp"
 #include "BrokerFactory.hpp"
+#include "FlightRecorder.hpp"
+#include "LatencyTracker.hpp"
 #include "LogManager.hpp"
 #include "TimeoutMonitor.h"
+#include "TimingCoalescer.hpp"
+#include "WildcardMatcher.hpp"
 #include "fileConnections.hpp"
 #include "gmlc/utilities/stringConversion.h"
 #include "gmlc/utilities/string_viewConversion.h"
@@ -25,6 +29,7 @@ SPDX-License-Identifier: BSD-3-Clause
 #include "loggingHelper.hpp"
 #include "queryHelpers.hpp"
 
+#include <algorithm>
 #include <iostream>
 #include <limits>
 #include <set>
@@ -1283,6 +1288,20 @@ void CoreBroker::processCommand(ActionMessage&& command)
                     }
 
                 } else {
+                    if (command.action() == CMD_SEND_MESSAGE &&
+                        command.dest_id != parent_broker_id) {
+                        // the sending core routes by name only when it has no location for the
+                        // endpoint, so let it know where the endpoint is unless it is going away
+                        auto fed = mFederates.find(command.dest_id);
+                        if (fed != mFederates.end() &&
+                            fed->state < connection_state::disconnected) {
+                            ActionMessage location(CMD_ENDPOINT_LOCATION);
+                            location.setSource(command.getDest());
+                            location.dest_id = command.source_id;
+                            location.name(command.getString(targetStringLoc));
+                            transmit(getRoute(location.dest_id), location);
+                        }
+                    }
                     transmit(route, command);
                 }
             } else {
@@ -1305,6 +1324,9 @@ void CoreBroker::processCommand(ActionMessage&& command)
         case CMD_PUB:
             transmit(getRoute(command.dest_id), command);
             break;
+        case CMD_PUB_FANOUT:
+            routeFanoutMessage(command);
+            break;
 
         case CMD_LOG:
         case CMD_REMOTE_LOG:
@@ -1338,6 +1360,13 @@ void CoreBroker::processCommand(ActionMessage&& command)
             }
             addInput(command);
             break;
+        case CMD_REG_INTERFACES:
+            if ((!isRootc) && (command.dest_id != parent_broker_id)) {
+                routeMessage(command);
+                // break;
+            }
+            addInterfaceBlock(command);
+            break;
         case CMD_REG_ENDPOINT:
             if ((!isRootc) && (command.dest_id != parent_broker_id)) {
                 routeMessage(command);
@@ -1693,14 +1722,31 @@ void CoreBroker::checkForNamedInterface(ActionMessage& command)
         if (isRootc) {
             switch (command.action()) {
                 case CMD_ADD_NAMED_PUBLICATION:
+                    if (WildcardMatcher::isPattern(command.name())) {
+                        unknownHandles.addPublicationPattern(std::string(command.name()),
+                                                             command.getSource(),
+                                                             command.flags,
+                                                             handles.size());
+                        if (getBrokerState() >= BrokerState::operating) {
+                            connectPendingPatterns();
+                        }
+                        break;
+                    }
                     unknownHandles.addUnknownPublication(std::string(command.name()),
                                                          command.getSource(),
                                                          command.flags);
                     break;
                 case CMD_ADD_NAMED_INPUT:
-                    unknownHandles.addUnknownInput(std::string(command.name()),
-                                                   command.getSource(),
-                                                   command.flags);
+                    if (WildcardMatcher::isPattern(command.name())) {
+                        unknownHandles.addInputPattern(std::string(command.name()),
+                                                       command.getSource(),
+                                                       command.flags,
+                                                       handles.size());
+                    } else {
+                        unknownHandles.addUnknownInput(std::string(command.name()),
+                                                       command.getSource(),
+                                                       command.flags);
+                    }
                     if (!command.getStringData().empty()) {
                         auto* pub = handles.findHandle(command.getSource());
                         if (pub == nullptr) {
@@ -1715,6 +1761,10 @@ void CoreBroker::checkForNamedInterface(ActionMessage& command)
                             addLocalInfo(apub, command);
                         }
                     }
+                    if (WildcardMatcher::isPattern(command.name()) &&
+                        getBrokerState() >= BrokerState::operating) {
+                        connectPendingPatterns();
+                    }
                     break;
                 case CMD_ADD_NAMED_ENDPOINT:
                     unknownHandles.addUnknownEndpoint(std::string(command.name()),
@@ -1904,6 +1954,67 @@ void CoreBroker::addInput(ActionMessage& m)
     }
 }
 
+void CoreBroker::addInterfaceBlock(ActionMessage& m)
+{
+    auto interfaces = getInterfaceRegistrations(m);
+    auto inputCount = static_cast<std::size_t>(
+        std::count_if(interfaces.begin(), interfaces.end(), [](const auto& ifc) {
+            return ifc.action == CMD_REG_INPUT;
+        }));
+    handles.reserve(interfaces.size() - inputCount, inputCount);
+    std::vector<BasicHandleInfo*> added;
+    added.reserve(interfaces.size());
+    std::vector<bool> rejected(interfaces.size(), false);
+    for (std::size_t ii = 0; ii < interfaces.size(); ++ii) {
+        const auto& ifc = interfaces[ii];
+        const bool input = (ifc.action == CMD_REG_INPUT);
+        // detect duplicate names
+        if ((input ? handles.getInput(ifc.key) : handles.getPublication(ifc.key)) != nullptr) {
+            ActionMessage eret(CMD_LOCAL_ERROR, global_broker_id_local, m.source_id);
+            eret.dest_handle = ifc.handle;
+            eret.messageID = defs::Errors::REGISTRATION_FAILURE;
+            eret.payload = input ? fmt::format("Duplicate input names ({})", ifc.key) :
+                                   fmt::format("Duplicate PUBLICATION names ({})", ifc.key);
+            propagateError(std::move(eret));
+            rejected[ii] = true;
+            continue;
+        }
+        auto& info = handles.addHandle(m.source_id,
+                                       ifc.handle,
+                                       input ? InterfaceType::INPUT : InterfaceType::PUBLICATION,
+                                       ifc.key,
+                                       ifc.type,
+                                       ifc.units);
+        addLocalInfo(info, m);
+        info.flags = ifc.flags;
+        added.push_back(&info);
+    }
+    if (!isRootc) {
+        if (added.size() != interfaces.size()) {
+            std::vector<InterfaceRegistration> accepted;
+            accepted.reserve(added.size());
+            for (std::size_t ii = 0; ii < interfaces.size(); ++ii) {
+                if (!rejected[ii]) {
+                    accepted.push_back(std::move(interfaces[ii]));
+                }
+            }
+            interfaces = std::move(accepted);
+            setInterfaceRegistrations(m, interfaces);
+        }
+        if (!interfaces.empty()) {
+            transmit(parent_route_id, m);
+        }
+    } else {
+        for (auto* info : added) {
+            if (info->handleType == InterfaceType::INPUT) {
+                FindandNotifyInputTargets(*info);
+            } else {
+                FindandNotifyPublicationTargets(*info);
+            }
+        }
+    }
+}
+
 void CoreBroker::addEndpoint(ActionMessage& m)
 {
     // detect duplicate endpoints
@@ -2403,6 +2514,42 @@ void CoreBroker::routeMessage(ActionMessage&& cmd)
     }
 }
 
+void CoreBroker::routeFanoutMessage(ActionMessage& cmd)
+{
+    std::vector<std::pair<route_id, std::vector<GlobalHandle>>> routes;
+    for (const auto& target : getFanoutTargets(cmd)) {
+        auto route = getRoute(target.fed_id);
+        auto fnd = std::find_if(routes.begin(), routes.end(), [route](const auto& rt) {
+            return rt.first == route;
+        });
+        if (fnd == routes.end()) {
+            routes.emplace_back(route, std::vector<GlobalHandle>{target});
+        } else {
+            fnd->second.push_back(target);
+        }
+    }
+    for (auto& rt : routes) {
+        if (rt.second.size() == 1) {
+            ActionMessage mv(CMD_PUB);
+            mv.source_id = cmd.source_id;
+            mv.source_handle = cmd.source_handle;
+            mv.setDestination(rt.second.front());
+            mv.messageID = cmd.messageID;
+            mv.counter = cmd.counter;
+            mv.flags = cmd.flags;
+            mv.actionTime = cmd.actionTime;
+            mv.payload = cmd.payload;
+            transmit(rt.first, std::move(mv));
+        } else if (routes.size() == 1) {
+            transmit(rt.first, std::move(cmd));
+        } else {
+            ActionMessage fanout(cmd);
+            setFanoutTargets(fanout, rt.second);
+            transmit(rt.first, std::move(fanout));
+        }
+    }
+}
+
 void CoreBroker::broadcast(ActionMessage& cmd)
 {
     for (const auto& broker : mBrokers) {
@@ -2422,6 +2569,7 @@ void CoreBroker::executeInitializationOperations()
     if (!mTimeMonitorFederate.empty()) {
         loadTimeMonitor(true, std::string{});
     }
+    connectPendingPatterns();
     if (unknownHandles.hasUnknowns()) {
         if (unknownHandles.hasNonOptionalUnknowns()) {
             if (unknownHandles.hasRequiredUnknowns()) {
@@ -2555,6 +2703,9 @@ void CoreBroker::FindandNotifyInputTargets(BasicHandleInfo& handleInfo)
     if (!Handles.empty()) {
         unknownHandles.clearInput(handleInfo.key);
     }
+    connectPatternTargets(handleInfo,
+                          CMD_ADD_NAMED_INPUT,
+                          unknownHandles.checkForInputPatterns(handleInfo.key));
 }
 
 void CoreBroker::FindandNotifyPublicationTargets(BasicHandleInfo& handleInfo)
@@ -2589,6 +2740,53 @@ void CoreBroker::FindandNotifyPublicationTargets(BasicHandleInfo& handleInfo)
     if (!(subHandles.empty() && Pubtargets.empty())) {
         unknownHandles.clearPublication(handleInfo.key);
     }
+    connectPatternTargets(handleInfo,
+                          CMD_ADD_NAMED_PUBLICATION,
+                          unknownHandles.checkForPublicationPatterns(handleInfo.key));
+}
+
+void CoreBroker::connectPatternTargets(
+    const BasicHandleInfo& handleInfo,
+    action_message_def::action_t action,
+    const std::vector<UnknownHandleManager::targetInfo>& targets)
+{
+    for (const auto& target : targets) {
+        // the pattern target now acts like a target naming the matching interface
+        ActionMessage m(action);
+        m.setSource(target.first);
+        m.flags = target.second;
+        m.name(handleInfo.key);
+        checkForNamedInterface(m);
+    }
+}
+
+void CoreBroker::connectPendingPatterns()
+{
+    if (!unknownHandles.hasPendingPatterns()) {
+        return;
+    }
+    // connections don't add handles but iterate by index so the check doesn't rely on that
+    const auto count = handles.size();
+    for (std::size_t index = 0; index < count; ++index) {
+        const auto& handle = handles[index];
+        if (handle.key.empty()) {
+            continue;
+        }
+        if (handle.handleType == InterfaceType::PUBLICATION ||
+            handle.handleType == InterfaceType::TRANSLATOR) {
+            connectPatternTargets(handle,
+                                  CMD_ADD_NAMED_PUBLICATION,
+                                  unknownHandles.checkPendingPublicationPatterns(handle.key,
+                                                                                 index));
+        }
+        if (handle.handleType == InterfaceType::INPUT ||
+            handle.handleType == InterfaceType::TRANSLATOR) {
+            connectPatternTargets(handle,
+                                  CMD_ADD_NAMED_INPUT,
+                                  unknownHandles.checkPendingInputPatterns(handle.key, index));
+        }
+    }
+    unknownHandles.clearPendingPatterns();
 }
 
 void CoreBroker::FindandNotifyEndpointTargets(BasicHandleInfo& handleInfo)
@@ -2988,6 +3186,9 @@ std::string CoreBroker::query(const std::string& target,
                 bufferToJson(mLogManager->getLogBuffer(), base);
                 return fileops::generateJsonString(base);
             }
+            if (queryStr == "dropped_logs") {
+                return std::to_string(mLogManager->getDroppedLogCount());
+            }
         }
         return generateJsonErrorResponse(JsonErrorCodes::DISCONNECTED, "Broker has terminated");
     }
@@ -3127,7 +3328,11 @@ static const std::set<std::string> querySet{"isinit",
                                             "global_state",
                                             "global_flush",
                                             "current_state",
-                                            "logs"};
+                                            "latency",
+                                            "flight_recorder",
+                                            "timing_coalescing",
+                                            "logs",
+                                            "dropped_logs"};
 
 static const std::map<std::string, std::pair<std::uint16_t, bool>> mapIndex{
     {"global_time", {CURRENT_TIME_MAP, true}},
@@ -3174,6 +3379,34 @@ std::string CoreBroker::quickBrokerQueries(const std::string& request) const
         base["status"] = isConnected();
         return fileops::generateJsonString(base);
     }
+    if (request == "latency") {
+        Json::Value base;
+        addBaseInformation(base, !isRootc);
+        base["enabled"] = static_cast<bool>(latencyTracker);
+        if (latencyTracker) {
+            latencyTracker->loadJson(base);
+        }
+        return fileops::generateJsonString(base);
+    }
+    if (request == "flight_recorder") {
+        Json::Value base;
+        addBaseInformation(base, !isRootc);
+        auto recorder = std::atomic_load(&flightRecorder);
+        base["enabled"] = static_cast<bool>(recorder);
+        if (recorder) {
+            recorder->loadJson(base);
+        }
+        return fileops::generateJsonString(base);
+    }
+    if (request == "timing_coalescing") {
+        Json::Value base;
+        addBaseInformation(base, !isRootc);
+        base["enabled"] = static_cast<bool>(timingCoalescer);
+        if (timingCoalescer) {
+            timingCoalescer->loadJson(base);
+        }
+        return fileops::generateJsonString(base);
+    }
     return {};
 }
 
@@ -3220,6 +3453,9 @@ std::string CoreBroker::generateQueryAnswer(const std::string& request, bool for
         bufferToJson(mLogManager->getLogBuffer(), base);
         return fileops::generateJsonString(base);
     }
+    if (request == "dropped_logs") {
+        return std::to_string(mLogManager->getDroppedLogCount());
+    }
     if (request == "federates") {
         return generateStringVector(mFederates, [](auto& fed) { return fed.name; });
     }
@@ -173,6 +173,8 @@ class CoreBroker: public Broker, public BrokerBase {
      * ActionMessage*/
     void routeMessage(const ActionMessage& cmd);
     void routeMessage(ActionMessage&& cmd);
+    /** route a publication with multiple destinations, generating one message per route*/
+    void routeFanoutMessage(ActionMessage& cmd);
     /** transmit a message to the parent or root */
     void transmitToParent(ActionMessage&& cmd);
     /** propagate an error message or escalate it depending on settings*/
@@ -329,6 +331,15 @@ class CoreBroker: public Broker, public BrokerBase {
     /** find any existing publishers for a subscription*/
     void FindandNotifyInputTargets(BasicHandleInfo& handleInfo);
     void FindandNotifyPublicationTargets(BasicHandleInfo& handleInfo);
+    /** connect an interface to the targets of the patterns it matched
+    @param handleInfo the publication or input matching the patterns
+    @param action CMD_ADD_NAMED_PUBLICATION or CMD_ADD_NAMED_INPUT depending on the pattern type
+    @param targets the interfaces targeting the patterns*/
+    void connectPatternTargets(const BasicHandleInfo& handleInfo,
+                               action_message_def::action_t action,
+                               const std::vector<UnknownHandleManager::targetInfo>& targets);
+    /** match the patterns added since the last check against the interfaces existing before them*/
+    void connectPendingPatterns();
 
     void FindandNotifyFilterTargets(BasicHandleInfo& handleInfo);
     void FindandNotifyEndpointTargets(BasicHandleInfo& handleInfo);
@@ -380,6 +391,8 @@ class CoreBroker: public Broker, public BrokerBase {
     void addLocalInfo(BasicHandleInfo& handleInfo, const ActionMessage& m);
     void addPublication(ActionMessage& m);
     void addInput(ActionMessage& m);
+    /** add a block of publications and inputs from a bulk registration message*/
+    void addInterfaceBlock(ActionMessage& m);
     void addEndpoint(ActionMessage& m);
     void addFilter(ActionMessage& m);
     void addTranslator(ActionMessage& m);
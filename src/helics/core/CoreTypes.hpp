@@ -54,6 +54,7 @@ enum class CoreType : int {
     HTTP = HELICS_CORE_TYPE_HTTP,  //!< core/broker using web traffic
     WEBSOCKET = HELICS_CORE_TYPE_WEBSOCKET,  //!< core/broker using web sockets
     INPROC = HELICS_CORE_TYPE_INPROC,  //!< core/broker using a stripped down in process core type
+    SHM = HELICS_CORE_TYPE_SHM,  //!< core/broker using shared memory rings on the same machine
     NULLCORE = HELICS_CORE_TYPE_NULL,  //!< explicit core type that doesn't exist
     EMPTY = HELICS_CORE_TYPE_EMPTY,  //!< core type that does nothing and can't communicate
     UNRECOGNIZED = 22,  //!< unknown
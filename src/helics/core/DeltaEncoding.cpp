@@ -0,0 +1,180 @@
+/*
+Copyright (c) 2017-2022,
+Battelle Memorial Institute; Lawrence Livermore National Security, LLC; Alliance for Sustainable
+Energy, LLC.  See the top-level NOTICE for additional details. All rights reserved.
+SPDX-License-Identifier: BSD-3-Clause
+*/
+#include "DeltaEncoding.hpp"
+
+#include "ActionMessage.hpp"
+#include "flagOperations.hpp"
+
+#include <algorithm>
+#include <cstring>
+#include <limits>
+
+namespace helics {
+/// the size of the blocks compared between values
+static constexpr std::size_t wordSize{8};
+/// the size of the value length and base sequence number at the start of a patch
+static constexpr std::size_t patchHeaderSize{8};
+/// the size of the start word and word count at the start of each run of a patch
+static constexpr std::size_t runHeaderSize{8};
+
+static void writeUint32(std::byte* location, std::uint32_t value)
+{
+    for (int ii = 0; ii < 4; ++ii) {
+        location[ii] = static_cast<std::byte>((value >> (8 * ii)) & 0xFFU);
+    }
+}
+
+static std::uint32_t readUint32(const char* location)
+{
+    std::uint32_t value{0};
+    for (int ii = 0; ii < 4; ++ii) {
+        value |= static_cast<std::uint32_t>(static_cast<unsigned char>(location[ii])) << (8 * ii);
+    }
+    return value;
+}
+
+bool encodeValuePatch(std::string_view previous,
+                      std::string_view value,
+                      std::uint32_t baseSequence,
+                      SmallBuffer& patch)
+{
+    const auto size = value.size();
+    if (previous.size() != size || size <= patchHeaderSize ||
+        size > std::numeric_limits<std::uint32_t>::max()) {
+        return false;
+    }
+    const auto words = (size + wordSize - 1) / wordSize;
+    const auto fullWords = size / wordSize;
+    auto sameWord = [&previous, &value, size, fullWords](std::size_t word) {
+        auto start = word * wordSize;
+        if (word < fullWords) {
+            std::uint64_t previousWord;
+            std::uint64_t valueWord;
+            std::memcpy(&previousWord, previous.data() + start, wordSize);
+            std::memcpy(&valueWord, value.data() + start, wordSize);
+            return previousWord == valueWord;
+        }
+        return std::memcmp(previous.data() + start, value.data() + start, size - start) == 0;
+    };
+    // a patch is only used when it is smaller than the value
+    patch.reserve(size);
+    patch.resize(patchHeaderSize);
+    writeUint32(patch.data(), static_cast<std::uint32_t>(size));
+    writeUint32(patch.data() + 4, baseSequence);
+    std::size_t word{0};
+    while (word < words) {
+        if (sameWord(word)) {
+            ++word;
+            continue;
+        }
+        // a gap of a single word costs the same as the header of a new run so merge across it
+        auto end = word + 1;
+        while (end < words) {
+            if (!sameWord(end)) {
+                ++end;
+            } else if (end + 1 < words && !sameWord(end + 1)) {
+                end += 2;
+            } else {
+                break;
+            }
+        }
+        auto byteStart = word * wordSize;
+        auto byteCount = std::min(end * wordSize, size) - byteStart;
+        auto location = patch.size();
+        if (location + runHeaderSize + byteCount >= size) {
+            return false;
+        }
+        patch.resize(location + runHeaderSize + byteCount);
+        writeUint32(patch.data() + location, static_cast<std::uint32_t>(word));
+        writeUint32(patch.data() + location + 4, static_cast<std::uint32_t>(end - word));
+        std::memcpy(patch.data() + location + runHeaderSize, value.data() + byteStart, byteCount);
+        word = end;
+    }
+    return true;
+}
+
+bool applyValuePatch(SmallBuffer& value, std::string_view patch)
+{
+    if (patch.size() < patchHeaderSize || readUint32(patch.data()) != value.size()) {
+        return false;
+    }
+    const auto size = value.size();
+    std::size_t location{patchHeaderSize};
+    while (location < patch.size()) {
+        if (patch.size() - location < runHeaderSize) {
+            return false;
+        }
+        auto byteStart = static_cast<std::size_t>(readUint32(patch.data() + location)) * wordSize;
+        auto words = static_cast<std::size_t>(readUint32(patch.data() + location + 4));
+        location += runHeaderSize;
+        if (words == 0 || byteStart >= size) {
+            return false;
+        }
+        auto byteCount = std::min(words * wordSize, size - byteStart);
+        if (patch.size() - location < byteCount) {
+            return false;
+        }
+        std::memcpy(value.data() + byteStart, patch.data() + location, byteCount);
+        location += byteCount;
+    }
+    return true;
+}
+
+bool DeltaDecoder::isDeltaEncoded(uint16_t flags)
+{
+    return checkActionFlag(flags, delta_patch_flag) || checkActionFlag(flags, delta_base_flag);
+}
+
+std::uint32_t DeltaDecoder::getSequence(const ActionMessage& cmd)
+{
+    return static_cast<std::uint32_t>(cmd.messageID);
+}
+
+bool DeltaDecoder::decode(GlobalHandle source,
+                          uint16_t flags,
+                          std::uint32_t sequence,
+                          SmallBuffer& payload)
+{
+    if (!isDeltaEncoded(flags)) {
+        return true;
+    }
+    auto fnd = std::find_if(bases.begin(), bases.end(), [source](const auto& base) {
+        return base.source == source;
+    });
+    if (!checkActionFlag(flags, delta_patch_flag)) {
+        if (fnd == bases.end()) {
+            bases.push_back(BaseValue{source, sequence, payload});
+        } else {
+            fnd->sequence = sequence;
+            fnd->value = payload;
+        }
+        return true;
+    }
+    if (fnd == bases.end()) {
+        return false;
+    }
+    // a patch against any value other than the one held here would corrupt it, as would a
+    // partially applied patch, so nothing is left to apply later patches to
+    if (payload.size() < patchHeaderSize ||
+        readUint32(payload.to_string().data() + 4) != fnd->sequence ||
+        !applyValuePatch(fnd->value, payload.to_string())) {
+        bases.erase(fnd);
+        return false;
+    }
+    fnd->sequence = sequence;
+    payload = fnd->value;
+    return true;
+}
+
+bool DeltaDecoder::decode(ActionMessage& cmd)
+{
+    auto result = decode(cmd.getSource(), cmd.flags, getSequence(cmd), cmd.payload);
+    clearActionFlag(cmd, delta_patch_flag);
+    clearActionFlag(cmd, delta_base_flag);
+    return result;
+}
+}  // namespace helics
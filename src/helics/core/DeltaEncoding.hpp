@@ -0,0 +1,68 @@
+/*
+Copyright (c) 2017-2022,
+Battelle Memorial Institute; Lawrence Livermore National Security, LLC; Alliance for Sustainable
+Energy, LLC.  See the top-level NOTICE for additional details. All rights reserved.
+SPDX-License-Identifier: BSD-3-Clause
+*/
+#pragma once
+
+#include "GlobalFederateId.hpp"
+#include "SmallBuffer.hpp"
+
+#include <cstdint>
+#include <string_view>
+#include <vector>
+
+namespace helics {
+class ActionMessage;
+
+/** generate a patch that transforms a previous value into a new value
+@details the patch lists the runs of 8 byte words that differ between the values, which matches
+the layout of serialized vectors of doubles.  A patch can only be generated between values of the
+same size
+@param previous the value the receiver already has
+@param value the new value
+@param baseSequence the sequence number of the previous value, stored in the patch header
+@param patch the buffer to place the patch in
+@return false if a patch is not possible or would not be smaller than the value itself, in which
+case the contents of patch are unspecified*/
+bool encodeValuePatch(std::string_view previous,
+                      std::string_view value,
+                      std::uint32_t baseSequence,
+                      SmallBuffer& patch);
+
+/** apply a patch generated by encodeValuePatch to a value in place
+@return false if the patch is malformed or does not match the size of the value*/
+bool applyValuePatch(SmallBuffer& value, std::string_view patch);
+
+/** reconstruct the values of publications that use delta encoding
+@details keeps the last full value received from each source and its sequence number so patches
+can be applied to it*/
+class DeltaDecoder {
+  public:
+    /** decode a payload received from a source
+    @param source the publication that sent the payload
+    @param flags the flags of the message carrying the payload
+    @param sequence the sequence number of the value carried by the payload
+    @param payload the payload, replaced by the full value if it was a patch
+    @return false if the payload is a patch that could not be applied, the source must then send
+    a full value before later patches can be used*/
+    bool decode(GlobalHandle source, uint16_t flags, std::uint32_t sequence, SmallBuffer& payload);
+    /** decode the payload of a message and clear the delta encoding flags
+    @return false if the payload is a patch that could not be applied*/
+    bool decode(ActionMessage& cmd);
+    /** check if the flags of a message indicate a delta encoded publication*/
+    static bool isDeltaEncoded(uint16_t flags);
+    /** get the sequence number of a delta encoded value from the message carrying it*/
+    static std::uint32_t getSequence(const ActionMessage& cmd);
+
+  private:
+    /** the last value received from a source*/
+    struct BaseValue {
+        GlobalHandle source;
+        std::uint32_t sequence{0};
+        SmallBuffer value;
+    };
+    std::vector<BaseValue> bases;
+};
+}  // namespace helics
@@ -193,6 +193,13 @@ InterfaceHandle EmptyCore::registerInput(LocalFederateId /*federateID*/,
     return {};
 }
 
+std::vector<InterfaceHandle>
+    EmptyCore::registerValueInterfaces(LocalFederateId /*federateID*/,
+                                       const std::vector<ValueInterfaceDefinition>& interfaces)
+{
+    return std::vector<InterfaceHandle>(interfaces.size());
+}
+
 InterfaceHandle EmptyCore::registerTranslator(std::string_view /*translatorName*/,
                                               std::string_view /*message_type*/,
                                               std::string_view /*units*/)
@@ -463,6 +470,10 @@ void EmptyCore::setQueryCallback(LocalFederateId /*federateID*/,
                                  std::function<std::string(std::string_view)> /*queryFunction*/)
 {
 }
+void EmptyCore::setFederateOperator(LocalFederateId /*federateID*/,
+                                    std::shared_ptr<FederateOperator> /*callback*/)
+{
+}
 
 static std::string quickCoreQueries(const std::string& queryStr)
 {
@@ -78,6 +78,9 @@ class EmptyCore: public Core {
 
     virtual InterfaceHandle getInput(LocalFederateId federateID,
                                      const std::string& key) const override;
+    virtual std::vector<InterfaceHandle>
+        registerValueInterfaces(LocalFederateId federateID,
+                                const std::vector<ValueInterfaceDefinition>& interfaces) override;
 
     virtual InterfaceHandle registerTranslator(std::string_view translatorName,
                                                std::string_view message_type,
@@ -180,6 +183,8 @@ class EmptyCore: public Core {
     virtual void
         setQueryCallback(LocalFederateId federateID,
                          std::function<std::string(std::string_view)> queryFunction) override;
+    virtual void setFederateOperator(LocalFederateId federateID,
+                                     std::shared_ptr<FederateOperator> callback) override;
     virtual void setGlobal(const std::string& valueName, const std::string& value) override;
     virtual void sendCommand(const std::string& target,
                              const std::string& commandStr,
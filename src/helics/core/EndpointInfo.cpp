@@ -18,18 +18,7 @@ namespace helics {
 
 bool EndpointInfo::updateTimeUpTo(Time newTime)
 {
-    int index{0};
-    auto handle = message_queue.lock();
-
-    auto cv = handle.begin();
-    auto it_final = handle.end();
-    while (cv != it_final) {
-        if ((*cv)->time >= newTime) {
-            break;
-        }
-        ++index;
-        ++cv;
-    }
+    auto index = message_queue.lock_shared()->countBefore(newTime);
     if (index != mAvailableMessages.load()) {
         mAvailableMessages.store(index);
         return true;
@@ -39,18 +28,7 @@ bool EndpointInfo::updateTimeUpTo(Time newTime)
 
 bool EndpointInfo::updateTimeNextIteration(Time newTime)
 {
-    int index{0};
-    auto handle = message_queue.lock();
-
-    auto cv = handle.begin();
-    auto it_final = handle.end();
-    while (cv != it_final) {
-        if ((*cv)->time > newTime) {
-            break;
-        }
-        ++index;
-        ++cv;
-    }
+    auto index = message_queue.lock_shared()->countThrough(newTime);
     if (index != mAvailableMessages.load()) {
         mAvailableMessages.store(index);
         return true;
@@ -60,18 +38,7 @@ bool EndpointInfo::updateTimeNextIteration(Time newTime)
 
 bool EndpointInfo::updateTimeInclusive(Time newTime)
 {
-    int index{0};
-    auto handle = message_queue.lock();
-
-    auto cv = handle.begin();
-    auto it_final = handle.end();
-    while (cv != it_final) {
-        if ((*cv)->time > newTime) {
-            break;
-        }
-        ++index;
-        ++cv;
-    }
+    auto index = message_queue.lock_shared()->countThrough(newTime);
     if (index != mAvailableMessages.load()) {
         mAvailableMessages.store(index);
         return true;
@@ -83,16 +50,11 @@ std::unique_ptr<Message> EndpointInfo::getMessage(Time maxTime)
 {
     if (mAvailableMessages.load() > 0) {
         auto handle = message_queue.lock();
-        if (handle->empty()) {
-            return nullptr;
-        }
-        if (handle->front()->time <= maxTime) {
+        if (handle->firstTime() <= maxTime) {
             if (mAvailableMessages > 0) {
                 --mAvailableMessages;
             }
-            auto msg = std::move(handle->front());
-            handle->pop_front();
-            return msg;
+            return handle->pop();
         }
     }
     return nullptr;
@@ -100,22 +62,12 @@ std::unique_ptr<Message> EndpointInfo::getMessage(Time maxTime)
 
 Time EndpointInfo::firstMessageTime() const
 {
-    auto handle = message_queue.lock_shared();
-    return (handle->empty()) ? Time::maxVal() : handle->front()->time;
+    return message_queue.lock_shared()->firstTime();
 }
 
-// this is the function which determines message order
-static auto msgSorter = [](const auto& m1, const auto& m2) {
-    // first by time
-    return (m1->time != m2->time) ? (m1->time < m2->time) :
-                                    (m1->original_source < m2->original_source);
-};
-
 void EndpointInfo::addMessage(std::unique_ptr<Message> message)
 {
-    auto handle = message_queue.lock();
-    handle->push_back(std::move(message));
-    std::stable_sort(handle->begin(), handle->end(), msgSorter);
+    message_queue.lock()->push(std::move(message));
 }
 
 void EndpointInfo::clearQueue()
@@ -131,30 +83,12 @@ int32_t EndpointInfo::availableMessages() const
 
 int32_t EndpointInfo::queueSize(Time maxTime) const
 {
-    auto handle = message_queue.lock_shared();
-    int32_t cnt = 0;
-    for (auto& msg : *handle) {
-        if (msg->time <= maxTime) {
-            ++cnt;
-        } else {
-            break;
-        }
-    }
-    return cnt;
+    return message_queue.lock_shared()->countThrough(maxTime);
 }
 /** get the number of messages available prior to a specific time*/
 int32_t EndpointInfo::queueSizeUpTo(Time maxTime) const
 {
-    auto handle = message_queue.lock_shared();
-    int32_t cnt = 0;
-    for (auto& msg : *handle) {
-        if (msg->time < maxTime) {
-            ++cnt;
-        } else {
-            break;
-        }
-    }
-    return cnt;
+    return message_queue.lock_shared()->countBefore(maxTime);
 }
 
 void EndpointInfo::addDestination(GlobalHandle dest,
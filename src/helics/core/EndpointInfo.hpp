@@ -7,10 +7,11 @@ SPDX-License-Identifier: BSD-3-Clause
 #pragma once
 
 #include "../common/GuardedTypes.hpp"
+#include "DeltaEncoding.hpp"
+#include "MessageBucketQueue.hpp"
 #include "basic_CoreTypes.hpp"
 
 #include <atomic>
-#include <deque>
 #include <memory>
 #include <string>
 #include <utility>
@@ -42,7 +43,7 @@ class EndpointInfo {
     const std::string type;  //!< type of the endpoint
   private:
     /// storage for the messages
-    shared_guarded<std::deque<std::unique_ptr<Message>>> message_queue;
+    shared_guarded<MessageBucketQueue> message_queue;
     std::atomic<int32_t> mAvailableMessages{0};  //!< indicator of how many message are available
 
     std::vector<EndpointInformation> sourceInformation;
@@ -55,6 +56,8 @@ class EndpointInfo {
     bool hasFilter{false};  //!< indicator that the message has a filter
     bool required{false};
     bool targetedEndpoint{false};  //!< indicator that the endpoint is a targeted endpoint only
+    /// rebuilds the values of publications using delta encoding that target the endpoint
+    DeltaDecoder deltaValues;
     /** get the next message up to the specified time*/
     std::unique_ptr<Message> getMessage(Time maxTime);
     /** get the number of messages in the queue up to the specified time*/
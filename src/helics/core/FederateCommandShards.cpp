@@ -0,0 +1,169 @@
+/*
+Copyright (c) 2017-2022,
+Battelle Memorial Institute; Lawrence Livermore National Security, LLC; Alliance for Sustainable
+Energy, LLC.  See the top-level NOTICE for additional details. All rights reserved.
+SPDX-License-Identifier: BSD-3-Clause
+*/
+
+#include "FederateCommandShards.hpp"
+
+#include <chrono>
+#include <utility>
+
+namespace helics {
+/// the number of commands of a group forwarded to the control path before a release is requested
+static constexpr std::uint32_t maxForwardedRun{64};
+/// the time a shard waits for a release before forwarding a command
+static constexpr std::chrono::microseconds maxReleaseWait{200};
+
+FederateCommandShards::FederateCommandShards(std::size_t shardCount,
+                                             Router routerFunction,
+                                             ControlPath controlFunction):
+    router(std::move(routerFunction)),
+    control(std::move(controlFunction))
+{
+    if (shardCount == 0) {
+        shardCount = 1;
+    }
+    shards.reserve(shardCount);
+    for (std::size_t ii = 0; ii < shardCount; ++ii) {
+        shards.push_back(std::make_unique<Shard>());
+    }
+    for (std::size_t ii = 0; ii < shardCount; ++ii) {
+        shards[ii]->worker = std::thread(&FederateCommandShards::processShard, this, ii);
+    }
+}
+
+FederateCommandShards::~FederateCommandShards()
+{
+    stop();
+}
+
+void FederateCommandShards::updateRoutingTable(std::shared_ptr<const ShardRoutingTable> newTable)
+{
+    table.store(std::move(newTable));
+    ++tableVersion;
+}
+
+bool FederateCommandShards::addCommand(LocalFederateId federate, ActionMessage&& command)
+{
+    if (!running.load() || !federate.isValid()) {
+        return false;
+    }
+    auto index = static_cast<std::size_t>(federate.baseValue()) % shards.size();
+    shards[index]->queue.emplace(federate.baseValue(), std::move(command));
+    return true;
+}
+
+void FederateCommandShards::release(const ActionMessage& command)
+{
+    auto shardIndex = static_cast<std::size_t>(command.messageID);
+    auto group = static_cast<std::size_t>(command.counter);
+    if (shardIndex < shards.size() && group < holdGroups) {
+        auto& shard = *shards[shardIndex];
+        if (--shard.holds[group] == 0) {
+            {
+                // taking the lock orders the notification after a check made by the worker
+                std::lock_guard<std::mutex> lock(shard.holdLock);
+            }
+            shard.holdReleased.notify_one();
+        }
+    }
+}
+
+void FederateCommandShards::stop()
+{
+    if (!running.exchange(false)) {
+        return;
+    }
+    for (auto& shard : shards) {
+        {
+            std::lock_guard<std::mutex> lock(shard->holdLock);
+        }
+        shard->holdReleased.notify_all();
+        shard->queue.emplace(0, ActionMessage(CMD_TERMINATE_IMMEDIATELY));
+    }
+    for (auto& shard : shards) {
+        if (shard->worker.joinable()) {
+            shard->worker.join();
+        }
+    }
+}
+
+std::uint64_t FederateCommandShards::routedCount() const
+{
+    std::uint64_t count{0};
+    for (const auto& shard : shards) {
+        count += shard->routed.load();
+    }
+    return count;
+}
+
+std::uint64_t FederateCommandShards::forwardedCount() const
+{
+    std::uint64_t count{0};
+    for (const auto& shard : shards) {
+        count += shard->forwarded.load();
+    }
+    return count;
+}
+
+void FederateCommandShards::processShard(std::size_t index)
+{
+    auto& shard = *shards[index];
+    std::shared_ptr<const ShardRoutingTable> localTable;
+    std::uint32_t localVersion{0};
+    // the number of commands of each group forwarded since the last release command
+    std::array<std::uint32_t, holdGroups> forwardedRun{};
+    // the action of the last command forwarded for each group
+    std::array<action_message_def::action_t, holdGroups> lastForwarded{};
+
+    auto sendRelease = [this, &shard, &forwardedRun, index](std::size_t group) {
+        ActionMessage releaseGroup(CMD_SHARD_RELEASE);
+        releaseGroup.messageID = static_cast<std::int32_t>(index);
+        releaseGroup.counter = static_cast<std::uint16_t>(group);
+        ++shard.holds[group];
+        forwardedRun[group] = 0;
+        control(std::move(releaseGroup));
+    };
+    while (true) {
+        auto item = shard.queue.pop();
+        auto& command = item.second;
+        if (command.action() == CMD_TERMINATE_IMMEDIATELY && !running.load()) {
+            break;
+        }
+        auto group = holdGroup(item.first);
+        // a run of similar commands is likely to need the control path as well
+        if (forwardedRun[group] > 0 && command.action() != lastForwarded[group]) {
+            sendRelease(group);
+        }
+        if (forwardedRun[group] == 0) {
+            // commands can only be routed directly if nothing from the group is in the control
+            // path, the control path is usually quick so wait for it briefly
+            if (shard.holds[group].load() > 0) {
+                std::unique_lock<std::mutex> lock(shard.holdLock);
+                shard.holdReleased.wait_for(lock, maxReleaseWait, [&shard, group, this] {
+                    return shard.holds[group].load() == 0 || !running.load();
+                });
+            }
+            if (shard.holds[group].load() == 0) {
+                auto version = tableVersion.load();
+                if (version != localVersion || !localTable) {
+                    localTable = table.load();
+                    localVersion = version;
+                }
+                if (localTable && router(command, *localTable)) {
+                    ++shard.routed;
+                    continue;
+                }
+            }
+        }
+        lastForwarded[group] = command.action();
+        control(std::move(command));
+        ++shard.forwarded;
+        if (++forwardedRun[group] >= maxForwardedRun || shard.queue.empty()) {
+            sendRelease(group);
+        }
+    }
+}
+}  // namespace helics
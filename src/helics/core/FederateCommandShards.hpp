@@ -0,0 +1,112 @@
+/*
+Copyright (c) 2017-2022,
+Battelle Memorial Institute; Lawrence Livermore National Security, LLC; Alliance for Sustainable
+Energy, LLC.  See the top-level NOTICE for additional details. All rights reserved.
+SPDX-License-Identifier: BSD-3-Clause
+*/
+#pragma once
+
+#include "../common/GuardedTypes.hpp"
+#include "ActionMessage.hpp"
+#include "GlobalFederateId.hpp"
+#include "LocalFederateId.hpp"
+#include "gmlc/containers/BlockingQueue.hpp"
+
+#include <array>
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <utility>
+#include <vector>
+
+namespace helics {
+class FederateState;
+
+/** the routing information a core shares with its command shards*/
+struct ShardRoutingTable {
+    /// the local federates commands can be delivered to directly
+    std::map<GlobalFederateId, FederateState*> federates;
+    GlobalBrokerId coreId;  //!< the global id of the core
+    GlobalFederateId keyFederate;  //!< the federate whose grants define the core simulation time
+    /// timing messages can be routed directly since there are no filters that could block time
+    bool timingMessages{true};
+};
+
+/** class routing the commands generated by the local federates of a core on a set of worker threads
+@details each federate is assigned to a shard by its local id so the commands of a federate are
+routed in the order they were generated. Commands the router can't handle are forwarded to the
+ordered control path of the core, the later commands of the same federate are forwarded as well
+until the control path releases the federate so no command can overtake an earlier one*/
+class FederateCommandShards {
+  public:
+    /** function routing a command directly, it returns false without acting on the command if it
+     * must go through the control path*/
+    using Router = std::function<bool(ActionMessage& command, const ShardRoutingTable& table)>;
+    /** function adding a command to the control path*/
+    using ControlPath = std::function<void(ActionMessage&& command)>;
+
+    /** construct and start the shard workers
+    @param shardCount the number of worker threads
+    @param router the function routing the commands on the worker threads
+    @param control the function forwarding commands to the control path*/
+    FederateCommandShards(std::size_t shardCount, Router router, ControlPath control);
+    /** destructor stops the shard workers*/
+    ~FederateCommandShards();
+    FederateCommandShards(const FederateCommandShards&) = delete;
+    FederateCommandShards& operator=(const FederateCommandShards&) = delete;
+
+    /** update the routing information used by the workers*/
+    void updateRoutingTable(std::shared_ptr<const ShardRoutingTable> newTable);
+    /** add a command generated by a local federate
+    @return false if the shards are stopped, the command is not moved in that case*/
+    bool addCommand(LocalFederateId federate, ActionMessage&& command);
+    /** release the federates of a shard once the control path has processed the commands
+    forwarded before the release command
+    @param command the CMD_SHARD_RELEASE command generated by the shard*/
+    void release(const ActionMessage& command);
+    /** stop the workers after they process the commands already queued*/
+    void stop();
+    /** get the number of shards*/
+    std::size_t size() const { return shards.size(); }
+    /** get the number of commands routed by the workers*/
+    std::uint64_t routedCount() const;
+    /** get the number of commands forwarded to the control path*/
+    std::uint64_t forwardedCount() const;
+
+  private:
+    /// the number of groups the federates of a shard are divided into for ordering holds
+    static constexpr std::size_t holdGroups{64};
+    /** the queue and state of a single worker*/
+    struct Shard {
+        /// the commands paired with the local id of the federate that generated them
+        gmlc::containers::BlockingQueue<std::pair<std::int32_t, ActionMessage>> queue;
+        /// the number of release commands for each federate group sent to the control path that
+        /// have not been processed
+        std::array<std::atomic<std::int32_t>, holdGroups> holds{};
+        std::mutex holdLock;  //!< lock for waiting on the holds to be released
+        std::condition_variable holdReleased;  //!< notified when a group has no more holds
+        std::atomic<std::uint64_t> routed{0};
+        std::atomic<std::uint64_t> forwarded{0};
+        std::thread worker;
+    };
+    void processShard(std::size_t index);
+    /** get the hold group of a federate within its shard*/
+    std::size_t holdGroup(std::int32_t federate) const
+    {
+        return (static_cast<std::size_t>(federate) / shards.size()) % holdGroups;
+    }
+
+    Router router;
+    ControlPath control;
+    std::vector<std::unique_ptr<Shard>> shards;
+    atomic_guarded<std::shared_ptr<const ShardRoutingTable>> table;
+    std::atomic<std::uint32_t> tableVersion{0};
+    std::atomic<bool> running{true};
+};
+}  // namespace helics
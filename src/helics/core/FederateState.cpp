@@ -9,6 +9,7 @@ SPDX-License-Identifier: BSD-3-Clause
 #include "../common/JsonGeneration.hpp"
 #include "../common/JsonProcessingFunctions.hpp"
 #include "../common/LogBuffer.hpp"
+#include "../common/WorkStealingPool.hpp"
 #include "../common/logging.hpp"
 #include "CommonCore.hpp"
 #include "CoreFederateInfo.hpp"
@@ -131,7 +132,15 @@ void FederateState::setState(FederateStates newState)
     }
     switch (newState) {
         case HELICS_ERROR:
-        case HELICS_FINISHED:
+        case HELICS_FINISHED: {
+            {
+                auto payloads = sharedPayloads.lock();
+                state = newState;
+                // fanouts still queued will not be delivered so release the payloads they reference
+                payloads->clear();
+            }
+            releaseTimers();
+        } break;
         case HELICS_CREATED:
         case HELICS_TERMINATING:
             state = newState;
@@ -160,6 +169,8 @@ void FederateState::reset()
     state = HELICS_CREATED;
     queue.clear();
     delayQueues.clear();
+    sharedPayloads.lock()->clear();
+    releaseTimers();
     // TODO(PT): this probably needs to do a lot more
 }
 /** reset the federate to the initializing state*/
@@ -168,6 +179,8 @@ void FederateState::reInit()
     state = HELICS_INITIALIZING;
     queue.clear();
     delayQueues.clear();
+    sharedPayloads.lock()->clear();
+    releaseTimers();
     // TODO(PT): this needs to reset a bunch of stuff as well as check a few things
 }
 FederateStates FederateState::getState() const
@@ -286,7 +299,7 @@ void FederateState::routeMessage(const ActionMessage& msg)
         if (msg.action() == CMD_TIME_GRANT) {
             requestingMode.store(false);
         }
-        parent_->addActionMessage(msg);
+        parent_->addFederateCommand(local_id, ActionMessage(msg));
     } else {
         queue.push(msg);
     }
@@ -296,6 +309,9 @@ void FederateState::addAction(const ActionMessage& action)
 {
     if (action.action() != CMD_IGNORE) {
         queue.push(action);
+        if (callbackBased.load()) {
+            scheduleCallbackProcessing();
+        }
     }
 }
 
@@ -303,6 +319,27 @@ void FederateState::addAction(ActionMessage&& action)
 {
     if (action.action() != CMD_IGNORE) {
         queue.push(std::move(action));
+        if (callbackBased.load()) {
+            scheduleCallbackProcessing();
+        }
+    }
+}
+
+void FederateState::addSharedValueAction(ActionMessage&& action,
+                                         std::shared_ptr<const SmallBuffer> payload)
+{
+    {
+        auto payloads = sharedPayloads.lock();
+        auto currentState = state.load();
+        if (currentState == HELICS_ERROR || currentState == HELICS_FINISHED) {
+            // the fanout would never be processed and release the payload
+            return;
+        }
+        payloads->emplace(action.sequenceID, std::move(payload));
+    }
+    queue.push(std::move(action));
+    if (callbackBased.load()) {
+        scheduleCallbackProcessing();
     }
 }
 
@@ -513,50 +550,9 @@ IterationResult FederateState::enterExecutingMode(IterationRequest iterate, bool
         }
 
         auto ret = processQueue();
-        ++mGrantCount;
-        if (ret == MessageProcessingResult::NEXT_STEP) {
-            time_granted = timeCoord->getGrantedTime();
-            allowed_send_time = timeCoord->allowedSendTime();
-        } else if (ret == MessageProcessingResult::ITERATING) {
-            time_granted = initializationTime;
-            allowed_send_time = initializationTime;
-        }
-        if (ret != MessageProcessingResult::ERROR_RESULT) {
-            switch (iterate) {
-                case IterationRequest::FORCE_ITERATION:
-                    fillEventVectorNextIteration(time_granted);
-                    break;
-                case IterationRequest::ITERATE_IF_NEEDED:
-                    if (ret == MessageProcessingResult::NEXT_STEP) {
-                        fillEventVectorUpTo(time_granted);
-                    } else {
-                        fillEventVectorNextIteration(time_granted);
-                    }
-                    break;
-                case IterationRequest::NO_ITERATIONS:
-                    if (wait_for_current_time) {
-                        fillEventVectorInclusive(time_granted);
-                    } else {
-                        fillEventVectorUpTo(time_granted);
-                    }
-                    break;
-            }
-        }
+        completeExecRequest(ret, iterate);
         unlock();
-#ifndef HELICS_DISABLE_ASIO
-        if ((realtime) && (ret == MessageProcessingResult::NEXT_STEP)) {
-            if (!mTimer) {
-                mTimer = std::make_shared<MessageTimer>(
-                    [this](ActionMessage&& mess) { return this->addAction(std::move(mess)); });
-            }
-            start_clock_time = std::chrono::steady_clock::now();
-        } else if (grantTimeOutPeriod > timeZero) {
-            if (!mTimer) {
-                mTimer = std::make_shared<MessageTimer>(
-                    [this](ActionMessage&& mess) { return this->addAction(std::move(mess)); });
-            }
-        }
-#endif
+        startExecTimers(ret);
         return static_cast<IterationResult>(ret);
     }
 
@@ -593,6 +589,76 @@ IterationResult FederateState::enterExecutingMode(IterationRequest iterate, bool
     return ret;
 }
 
+void FederateState::completeExecRequest(MessageProcessingResult ret, IterationRequest iterate)
+{
+    ++mGrantCount;
+    if (ret == MessageProcessingResult::NEXT_STEP) {
+        time_granted = timeCoord->getGrantedTime();
+        allowed_send_time = timeCoord->allowedSendTime();
+    } else if (ret == MessageProcessingResult::ITERATING) {
+        time_granted = initializationTime;
+        allowed_send_time = initializationTime;
+    }
+    if (ret != MessageProcessingResult::ERROR_RESULT) {
+        switch (iterate) {
+            case IterationRequest::FORCE_ITERATION:
+                fillEventVectorNextIteration(time_granted);
+                break;
+            case IterationRequest::ITERATE_IF_NEEDED:
+                if (ret == MessageProcessingResult::NEXT_STEP) {
+                    fillEventVectorUpTo(time_granted);
+                } else {
+                    fillEventVectorNextIteration(time_granted);
+                }
+                break;
+            case IterationRequest::NO_ITERATIONS:
+                if (wait_for_current_time) {
+                    fillEventVectorInclusive(time_granted);
+                } else {
+                    fillEventVectorUpTo(time_granted);
+                }
+                break;
+        }
+    }
+}
+
+void FederateState::startExecTimers(MessageProcessingResult ret)
+{
+#ifndef HELICS_DISABLE_ASIO
+    if ((realtime) && (ret == MessageProcessingResult::NEXT_STEP)) {
+        if (!mTimer) {
+            mTimer = std::make_shared<MessageTimer>(
+                [this](ActionMessage&& mess) { return this->addAction(std::move(mess)); });
+        }
+        start_clock_time = std::chrono::steady_clock::now();
+    } else if (grantTimeOutPeriod > timeZero) {
+        if (!mTimer) {
+            mTimer = std::make_shared<MessageTimer>(
+                [this](ActionMessage&& mess) { return this->addAction(std::move(mess)); });
+        }
+    }
+#else
+    (void)ret;
+#endif
+}
+
+void FederateState::releaseTimers()
+{
+#ifndef HELICS_DISABLE_ASIO
+    if (!mTimer) {
+        return;
+    }
+    if (realTimeTimerIndex >= 0) {
+        mTimer->releaseTimer(realTimeTimerIndex);
+        realTimeTimerIndex = -1;
+    }
+    if (grantTimeoutTimeIndex >= 0) {
+        mTimer->releaseTimer(grantTimeoutTimeIndex);
+        grantTimeoutTimeIndex = -1;
+    }
+#endif
+}
+
 std::vector<GlobalHandle> FederateState::getSubscribers(InterfaceHandle handle)
 {
     std::lock_guard<FederateState> fedlock(*this);
@@ -603,6 +669,22 @@ std::vector<GlobalHandle> FederateState::getSubscribers(InterfaceHandle handle)
     return {};
 }
 
+std::vector<GlobalHandle>
+    FederateState::getSubscribers(InterfaceHandle handle, std::string_view value, ActionMessage& mv)
+{
+    std::lock_guard<FederateState> fedlock(*this);
+    auto* pubInfo = interfaceInformation.getPublication(handle);
+    if (pubInfo == nullptr || pubInfo->subscribers.empty()) {
+        return {};
+    }
+    if (!pubInfo->delta_encoding) {
+        mv.payload = value;
+    } else {
+        pubInfo->encodeDelta(value, mv);
+    }
+    return pubInfo->subscribers;
+}
+
 std::vector<std::pair<GlobalHandle, std::string_view>>
     FederateState::getMessageDestinations(InterfaceHandle handle)
 {
@@ -630,109 +712,11 @@ iteration_time FederateState::requestTime(Time nextTime, IterationRequest iterat
             addAction(treq);
             LOG_TRACE(timeCoord->printTimeStatus());
         }
-
-// timeCoord->timeRequest (nextTime, iterate, nextValueTime (), nextMessageTime ());
-#ifndef HELICS_DISABLE_ASIO
-        if ((realtime) && (rt_lag < Time::maxVal())) {
-            auto current_clock_time = std::chrono::steady_clock::now();
-            auto timegap = current_clock_time - start_clock_time;
-            auto current_lead = (nextTime + rt_lag).to_ns() - timegap;
-            if (current_lead > std::chrono::milliseconds(0)) {
-                ActionMessage tforce(CMD_FORCE_TIME_GRANT);
-                tforce.source_id = global_id.load();
-                tforce.actionTime = nextTime;
-                if (realTimeTimerIndex < 0) {
-                    realTimeTimerIndex =
-                        mTimer->addTimer(current_clock_time + current_lead, std::move(tforce));
-                } else {
-                    mTimer->updateTimer(realTimeTimerIndex,
-                                        current_clock_time + current_lead,
-                                        std::move(tforce));
-                }
-            } else {
-                ActionMessage tforce(CMD_FORCE_TIME_GRANT);
-                tforce.source_id = global_id.load();
-                tforce.actionTime = nextTime;
-                addAction(tforce);
-            }
-        } else if (grantTimeOutPeriod > timeZero) {
-            ActionMessage grantCheck(CMD_GRANT_TIMEOUT_CHECK);
-            grantCheck.setExtraData(static_cast<std::int32_t>(mGrantCount));
-            grantCheck.counter = 0;
-            if (grantTimeoutTimeIndex < 0) {
-                grantTimeoutTimeIndex =
-                    mTimer->addTimerFromNow(grantTimeOutPeriod.to_ms(), std::move(grantCheck));
-            } else {
-                mTimer->updateTimerFromNow(realTimeTimerIndex,
-                                           grantTimeOutPeriod.to_ms(),
-                                           std::move(grantCheck));
-            }
-        }
-#endif
+        prepareTimeRequest(nextTime);
         auto ret = processQueue();
-        ++mGrantCount;
-        if (ret == MessageProcessingResult::HALTED) {
-            time_granted = Time::maxVal();
-            allowed_send_time = Time::maxVal();
-            iterating = false;
-        } else {
-            time_granted = timeCoord->getGrantedTime();
-            allowed_send_time = timeCoord->allowedSendTime();
-            iterating = (ret == MessageProcessingResult::ITERATING);
-        }
-
-        iteration_time retTime = {time_granted, static_cast<IterationResult>(ret)};
-        // now fill the event vector so external systems know what has been updated
-        switch (iterate) {
-            case IterationRequest::FORCE_ITERATION:
-                fillEventVectorNextIteration(time_granted);
-                break;
-            case IterationRequest::ITERATE_IF_NEEDED:
-                if (time_granted < nextTime || wait_for_current_time) {
-                    fillEventVectorNextIteration(time_granted);
-                } else {
-                    fillEventVectorUpTo(time_granted);
-                }
-                break;
-            case IterationRequest::NO_ITERATIONS:
-                if (time_granted < nextTime || wait_for_current_time) {
-                    fillEventVectorInclusive(time_granted);
-                } else {
-                    fillEventVectorUpTo(time_granted);
-                }
-
-                break;
-        }
-#ifndef HELICS_DISABLE_ASIO
-        if (realtime) {
-            if (rt_lag < Time::maxVal()) {
-                mTimer->cancelTimer(realTimeTimerIndex);
-            }
-            if (ret == MessageProcessingResult::NEXT_STEP) {
-                auto current_clock_time = std::chrono::steady_clock::now();
-                auto timegap = current_clock_time - start_clock_time;
-                if (time_granted - Time(timegap) > rt_lead) {
-                    auto current_lead = (time_granted - rt_lead).to_ns() - timegap;
-                    if (current_lead > std::chrono::milliseconds(5)) {
-                        std::this_thread::sleep_for(current_lead);
-                    }
-                }
-            }
-        } else if (grantTimeOutPeriod > timeZero) {
-            mTimer->cancelTimer(grantTimeoutTimeIndex);
-        }
-#endif
-
+        auto retTime = completeTimeRequest(ret, nextTime, iterate);
         unlock();
-        if (retTime.grantedTime > nextTime && nextTime > lastTime &&
-            retTime.grantedTime < Time::maxVal()) {
-            if (!ignore_time_mismatch_warnings) {
-                LOG_WARNING(fmt::format(
-                    "Time mismatch detected: granted time greater than requested time {} vs {}",
-                    static_cast<double>(retTime.grantedTime),
-                    static_cast<double>(nextTime)));
-            }
-        }
+        checkTimeMismatch(lastTime, nextTime, retTime.grantedTime);
         return retTime;
     }
 
@@ -757,6 +741,120 @@ iteration_time FederateState::requestTime(Time nextTime, IterationRequest iterat
     return {time_granted, ret};
 }
 
+void FederateState::prepareTimeRequest(Time nextTime)
+{
+#ifndef HELICS_DISABLE_ASIO
+    if ((realtime) && (rt_lag < Time::maxVal())) {
+        auto current_clock_time = std::chrono::steady_clock::now();
+        auto timegap = current_clock_time - start_clock_time;
+        auto current_lead = (nextTime + rt_lag).to_ns() - timegap;
+        if (current_lead > std::chrono::milliseconds(0)) {
+            ActionMessage tforce(CMD_FORCE_TIME_GRANT);
+            tforce.source_id = global_id.load();
+            tforce.actionTime = nextTime;
+            if (realTimeTimerIndex < 0) {
+                realTimeTimerIndex =
+                    mTimer->addTimer(current_clock_time + current_lead, std::move(tforce));
+            } else {
+                mTimer->updateTimer(realTimeTimerIndex,
+                                    current_clock_time + current_lead,
+                                    std::move(tforce));
+            }
+        } else {
+            ActionMessage tforce(CMD_FORCE_TIME_GRANT);
+            tforce.source_id = global_id.load();
+            tforce.actionTime = nextTime;
+            addAction(tforce);
+        }
+    } else if (grantTimeOutPeriod > timeZero) {
+        ActionMessage grantCheck(CMD_GRANT_TIMEOUT_CHECK);
+        grantCheck.setExtraData(static_cast<std::int32_t>(mGrantCount));
+        grantCheck.counter = 0;
+        if (grantTimeoutTimeIndex < 0) {
+            grantTimeoutTimeIndex =
+                mTimer->addTimerFromNow(grantTimeOutPeriod.to_ms(), std::move(grantCheck));
+        } else {
+            mTimer->updateTimerFromNow(realTimeTimerIndex,
+                                       grantTimeOutPeriod.to_ms(),
+                                       std::move(grantCheck));
+        }
+    }
+#else
+    (void)nextTime;
+#endif
+}
+
+iteration_time FederateState::completeTimeRequest(MessageProcessingResult ret,
+                                                  Time nextTime,
+                                                  IterationRequest iterate)
+{
+    ++mGrantCount;
+    if (ret == MessageProcessingResult::HALTED) {
+        time_granted = Time::maxVal();
+        allowed_send_time = Time::maxVal();
+        iterating = false;
+    } else {
+        time_granted = timeCoord->getGrantedTime();
+        allowed_send_time = timeCoord->allowedSendTime();
+        iterating = (ret == MessageProcessingResult::ITERATING);
+    }
+
+    iteration_time retTime = {time_granted, static_cast<IterationResult>(ret)};
+    // now fill the event vector so external systems know what has been updated
+    switch (iterate) {
+        case IterationRequest::FORCE_ITERATION:
+            fillEventVectorNextIteration(time_granted);
+            break;
+        case IterationRequest::ITERATE_IF_NEEDED:
+            if (time_granted < nextTime || wait_for_current_time) {
+                fillEventVectorNextIteration(time_granted);
+            } else {
+                fillEventVectorUpTo(time_granted);
+            }
+            break;
+        case IterationRequest::NO_ITERATIONS:
+            if (time_granted < nextTime || wait_for_current_time) {
+                fillEventVectorInclusive(time_granted);
+            } else {
+                fillEventVectorUpTo(time_granted);
+            }
+
+            break;
+    }
+#ifndef HELICS_DISABLE_ASIO
+    if (realtime) {
+        if (rt_lag < Time::maxVal()) {
+            mTimer->cancelTimer(realTimeTimerIndex);
+        }
+        if (ret == MessageProcessingResult::NEXT_STEP) {
+            auto current_clock_time = std::chrono::steady_clock::now();
+            auto timegap = current_clock_time - start_clock_time;
+            if (time_granted - Time(timegap) > rt_lead) {
+                auto current_lead = (time_granted - rt_lead).to_ns() - timegap;
+                if (current_lead > std::chrono::milliseconds(5)) {
+                    std::this_thread::sleep_for(current_lead);
+                }
+            }
+        }
+    } else if (grantTimeOutPeriod > timeZero) {
+        mTimer->cancelTimer(grantTimeoutTimeIndex);
+    }
+#endif
+    return retTime;
+}
+
+void FederateState::checkTimeMismatch(Time lastTime, Time nextTime, Time grantedTime)
+{
+    if (grantedTime > nextTime && nextTime > lastTime && grantedTime < Time::maxVal()) {
+        if (!ignore_time_mismatch_warnings) {
+            LOG_WARNING(fmt::format(
+                "Time mismatch detected: granted time greater than requested time {} vs {}",
+                static_cast<double>(grantedTime),
+                static_cast<double>(nextTime)));
+        }
+    }
+}
+
 void FederateState::fillEventVectorUpTo(Time currentTime)
 {
     events.clear();
@@ -910,6 +1008,244 @@ void FederateState::processCommunications(std::chrono::milliseconds period)
     }
 }
 
+void FederateState::setFederateOperator(std::shared_ptr<FederateOperator> op,
+                                        WorkStealingPool* pool)
+{
+    std::lock_guard<FederateState> fedlock(*this);
+    fedOperator = std::move(op);
+    if (pool != nullptr) {
+        callbackPool = pool;
+    }
+    callbackBased.store(fedOperator && callbackPool != nullptr);
+}
+
+void FederateState::startCallbackOperations()
+{
+    if (!callbackBased.load()) {
+        return;
+    }
+    {
+        std::lock_guard<FederateState> fedlock(*this);
+        if (callbackStage.load() != CallbackStage::IDLE) {
+            return;
+        }
+        callbackDelayCheck = true;
+        callbackStage.store(CallbackStage::INITIALIZING);
+    }
+    scheduleCallbackProcessing();
+}
+
+void FederateState::scheduleCallbackProcessing()
+{
+    // only a single task processes the federate at a time, a message arriving while the task is
+    // running is picked up by that task before it releases the federate
+    callbackPending.store(true);
+    if (!callbackScheduled.exchange(true)) {
+        if (!callbackPool->submit([this]() { callbackProcessing(); })) {
+            callbackScheduled.store(false);
+        }
+    }
+}
+
+void FederateState::callbackProcessing() noexcept
+{
+    while (true) {
+        // anything queued before this point is drained by the processing below
+        callbackPending.store(false);
+        auto stage = callbackStage.load();
+        if (stage != CallbackStage::IDLE && stage != CallbackStage::COMPLETE) {
+            sleeplock();
+            runCallbackStages();
+            unlock();
+        }
+        callbackScheduled.store(false);
+        // check for messages that arrived while the federate was still marked as scheduled, the
+        // queue itself is only inspected by the task holding the schedule flag
+        stage = callbackStage.load();
+        if (stage == CallbackStage::IDLE || stage == CallbackStage::COMPLETE ||
+            !callbackBased.load() || !callbackPending.load() ||
+            callbackScheduled.exchange(true)) {
+            return;
+        }
+    }
+}
+
+void FederateState::runCallbackStages()
+{
+    while (callbackBased.load()) {
+        auto stage = callbackStage.load();
+        if (stage == CallbackStage::IDLE || stage == CallbackStage::COMPLETE) {
+            return;
+        }
+        auto ret = processAvailableQueue(callbackDelayCheck);
+        callbackDelayCheck = false;
+        if (!returnableResult(ret)) {
+            return;
+        }
+        advanceCallbackStage(ret);
+    }
+}
+
+void FederateState::advanceCallbackStage(MessageProcessingResult ret)
+{
+    const auto stage = callbackStage.load();
+    if (ret == MessageProcessingResult::HALTED || ret == MessageProcessingResult::ERROR_RESULT) {
+        if (stage == CallbackStage::TIME_REQUEST) {
+            completeTimeRequest(ret, callbackRequestTime, callbackIterate);
+        }
+        callbackComplete(ret);
+        return;
+    }
+    if (ret != MessageProcessingResult::NEXT_STEP && ret != MessageProcessingResult::ITERATING) {
+        return;
+    }
+    switch (stage) {
+        case CallbackStage::INITIALIZING:
+            if (ret == MessageProcessingResult::NEXT_STEP) {
+                time_granted = initialTime;
+                allowed_send_time = initialTime;
+                callbackInitialize();
+            }
+            break;
+        case CallbackStage::EXECUTING:
+            completeExecRequest(ret, callbackIterate);
+            startExecTimers(ret);
+            if (ret == MessageProcessingResult::NEXT_STEP) {
+                callbackOperate({time_granted, IterationResult::NEXT_STEP});
+            } else {
+                callbackInitialize();
+            }
+            break;
+        case CallbackStage::TIME_REQUEST: {
+            auto grant = completeTimeRequest(ret, callbackRequestTime, callbackIterate);
+            checkTimeMismatch(callbackLastTime, callbackRequestTime, grant.grantedTime);
+            callbackOperate(grant);
+        } break;
+        default:
+            break;
+    }
+}
+
+void FederateState::callbackInitialize()
+{
+    auto op = fedOperator;
+    IterationRequest iterate{IterationRequest::NO_ITERATIONS};
+    std::optional<std::string> errorMessage;
+    // the operator calls into the federate interfaces so the processing lock is released
+    unlock();
+    try {
+        iterate = op->initializeOperations();
+    }
+    catch (const std::exception& e) {
+        errorMessage = e.what();
+    }
+    catch (...) {
+        errorMessage = "unknown exception";
+    }
+    sleeplock();
+    if (!callbackBased.load()) {
+        return;
+    }
+    if (errorMessage) {
+        LOG_ERROR(fmt::format("federate operator failed in initialization: {}", *errorMessage));
+        callbackFinalize();
+        return;
+    }
+    callbackIterate = iterate;
+    callbackDelayCheck = true;
+    callbackStage.store(CallbackStage::EXECUTING);
+    // process previously received messages so the federate can't get in a deadlocked state
+    addAction(ActionMessage(CMD_EXEC_CHECK));
+
+    ActionMessage exec(CMD_EXEC_REQUEST);
+    exec.source_id = global_id.load();
+    exec.dest_id = global_id.load();
+    setIterationFlags(exec, iterate);
+    setActionFlag(exec, indicator_flag);
+    parent_->addActionMessage(exec);
+}
+
+void FederateState::callbackOperate(iteration_time grantedTime)
+{
+    if (grantedTime.grantedTime >= Time::maxVal()) {
+        callbackFinalize();
+        return;
+    }
+    auto op = fedOperator;
+    std::pair<Time, IterationRequest> next{Time::maxVal(), IterationRequest::NO_ITERATIONS};
+    std::optional<std::string> errorMessage;
+    unlock();
+    try {
+        next = op->operate(grantedTime);
+    }
+    catch (const std::exception& e) {
+        errorMessage = e.what();
+    }
+    catch (...) {
+        errorMessage = "unknown exception";
+    }
+    sleeplock();
+    if (!callbackBased.load()) {
+        return;
+    }
+    if (errorMessage) {
+        LOG_ERROR(fmt::format("federate operator failed at time {}: {}",
+                              static_cast<double>(grantedTime.grantedTime),
+                              *errorMessage));
+        next.first = Time::maxVal();
+    }
+    if (next.first >= Time::maxVal()) {
+        callbackFinalize();
+        return;
+    }
+    callbackRequestTime = next.first;
+    callbackIterate = next.second;
+    callbackLastTime = timeCoord->getGrantedTime();
+    callbackDelayCheck = true;
+    callbackStage.store(CallbackStage::TIME_REQUEST);
+    events.clear();
+    prepareTimeRequest(next.first);
+
+    ActionMessage treq(CMD_TIME_REQUEST);
+    treq.source_id = global_id.load();
+    treq.dest_id = global_id.load();
+    treq.actionTime = next.first;
+    setIterationFlags(treq, next.second);
+    setActionFlag(treq, indicator_flag);
+    parent_->addActionMessage(treq);
+}
+
+void FederateState::callbackFinalize()
+{
+    callbackStage.store(CallbackStage::FINALIZING);
+    ActionMessage bye(CMD_DISCONNECT);
+    bye.source_id = global_id.load();
+    bye.dest_id = bye.source_id;
+    parent_->addFederateCommand(local_id, std::move(bye));
+}
+
+void FederateState::callbackComplete(MessageProcessingResult ret)
+{
+    callbackStage.store(CallbackStage::COMPLETE);
+    auto op = fedOperator;
+    const int code = errorCode;
+    const std::string message = errorString;
+    unlock();
+    try {
+        if (ret == MessageProcessingResult::ERROR_RESULT) {
+            op->error_handler(code, message);
+        }
+        op->finalize();
+    }
+    catch (const std::exception& e) {
+        LOG_ERROR(fmt::format("federate operator failed in finalize: {}", e.what()));
+    }
+    catch (...) {
+        LOG_ERROR("federate operator failed in finalize");
+    }
+    sleeplock();
+}
+
 const std::vector<InterfaceHandle> emptyHandles;
 
 const std::vector<InterfaceHandle>& FederateState::getEvents() const
@@ -1046,22 +1382,61 @@ MessageProcessingResult FederateState::processQueue() noexcept
     auto ret_code = processDelayQueue();
 
     while (!(returnableResult(ret_code))) {
-        auto cmd = queue.pop();
-        if (messageShouldBeDelayed(cmd)) {
-            delayQueues[cmd.source_id].push_back(cmd);
-            continue;
-        }
-        //    messLog.push_back(cmd);
-        ret_code = processActionMessage(cmd);
-        if (ret_code == MessageProcessingResult::DELAY_MESSAGE) {
-            delayQueues[static_cast<GlobalFederateId>(cmd.source_id)].push_back(cmd);
-        }
-        if (ret_code == MessageProcessingResult::ERROR_RESULT && cmd.action() == CMD_GLOBAL_ERROR) {
-            error_cmd = true;
+        auto cmd = waitPolicy.pop(queue);
+        ret_code = processQueuedMessage(cmd, error_cmd);
+    }
+    return finishQueueProcessing(ret_code, initError, error_cmd, profilerActive);
+}
+
+MessageProcessingResult FederateState::processAvailableQueue(bool processDelayed) noexcept
+{
+    if (state == HELICS_FINISHED) {
+        return MessageProcessingResult::HALTED;
+    }
+    auto initError = (state == HELICS_ERROR);
+    bool error_cmd{false};
+    bool profilerActive{mProfilerActive};
+    queueProcessing.store(true);
+    if (profilerActive) {
+        generateProfilingMessage(true);
+    }
+    auto ret_code = (processDelayed) ? processDelayQueue() :
+                                       MessageProcessingResult::CONTINUE_PROCESSING;
+
+    while (!(returnableResult(ret_code))) {
+        auto cmd = queue.try_pop();
+        if (!cmd) {
+            break;
         }
+        ret_code = processQueuedMessage(*cmd, error_cmd);
+    }
+    return finishQueueProcessing(ret_code, initError, error_cmd, profilerActive);
+}
+
+MessageProcessingResult FederateState::processQueuedMessage(ActionMessage& cmd, bool& errorCommand)
+{
+    if (messageShouldBeDelayed(cmd)) {
+        delayQueues[cmd.source_id].push_back(cmd);
+        return MessageProcessingResult::CONTINUE_PROCESSING;
+    }
+    //    messLog.push_back(cmd);
+    auto ret_code = processActionMessage(cmd);
+    if (ret_code == MessageProcessingResult::DELAY_MESSAGE) {
+        delayQueues[static_cast<GlobalFederateId>(cmd.source_id)].push_back(cmd);
     }
+    if (ret_code == MessageProcessingResult::ERROR_RESULT && cmd.action() == CMD_GLOBAL_ERROR) {
+        errorCommand = true;
+    }
+    return ret_code;
+}
+
+MessageProcessingResult FederateState::finishQueueProcessing(MessageProcessingResult ret_code,
+                                                             bool initError,
+                                                             bool errorCommand,
+                                                             bool profilerActive)
+{
     if (ret_code == MessageProcessingResult::ERROR_RESULT && state == HELICS_ERROR) {
-        if (!initError && !error_cmd) {
+        if (!initError && !errorCommand) {
             if (parent_ != nullptr) {
                 ActionMessage gError(CMD_LOCAL_ERROR);
                 if (terminate_on_error) {
@@ -1283,46 +1658,85 @@ MessageProcessingResult FederateState::processActionMessage(ActionMessage& cmd)
             if (subI == nullptr) {
                 auto* eptI = interfaceInformation.getEndpoint(cmd.dest_handle);
                 if (eptI != nullptr) {
-                    // if (!epi->not_interruptible)
-                    {
-                        timeCoord->updateMessageTime(cmd.actionTime, !timeGranted_mode);
-                    }
-                    LOG_DATA(fmt::format("receive_message {}", prettyPrintString(cmd)));
-                    if (cmd.actionTime < time_granted) {
-                        LOG_WARNING(fmt::format(
-                            "received message {} at time({}) earlier than granted time({})",
-                            prettyPrintString(cmd),
-                            cmd.actionTime,
-                            time_granted));
-                    }
-                    auto mess = std::make_unique<Message>();
-                    mess->data = std::move(cmd.payload);
-                    mess->dest = eptI->key;
-                    mess->flags = cmd.flags;
-                    mess->time = cmd.actionTime;
-                    mess->counter = cmd.counter;
-                    mess->messageID = cmd.messageID;
-                    mess->original_dest = eptI->key;
-                    eptI->addMessage(std::move(mess));
+                    processEndpointValue(eptI, cmd);
                     if (state <= HELICS_EXECUTING) {
                         timeCoord->processTimeMessage(cmd);
                     }
                 }
                 break;
             }
-            for (auto& src : subI->input_sources) {
-                if ((cmd.source_id == src.fed_id) && (cmd.source_handle == src.handle)) {
-                    subI->addData(src,
-                                  cmd.actionTime,
-                                  cmd.counter,
-                                  std::make_shared<const SmallBuffer>(std::move(cmd.payload)));
-                    if (!subI->not_interruptible) {
-                        timeCoord->updateValueTime(cmd.actionTime, !timeGranted_mode);
-                        LOG_TRACE(timeCoord->printTimeStatus());
+            if (!subI->delta_values.decode(cmd)) {
+                LOG_WARNING(fmt::format("unable to apply value patch {} to input {}",
+                                        prettyPrintString(cmd),
+                                        subI->key));
+                requestDeltaResync(cmd, subI->id.handle);
+            } else if (subI->ring_storage) {
+                processValueUpdate(subI, cmd, cmd.payload);
+            } else {
+                processValueUpdate(subI,
+                                   cmd,
+                                   std::make_shared<const SmallBuffer>(std::move(cmd.payload)));
+            }
+            if (state <= HELICS_EXECUTING) {
+                timeCoord->processTimeMessage(cmd);
+            }
+        } break;
+        case CMD_PUB_FANOUT: {
+            std::shared_ptr<const SmallBuffer> data;
+            {
+                auto payloads = sharedPayloads.lock();
+                auto fnd = payloads->find(cmd.sequenceID);
+                if (fnd != payloads->end()) {
+                    data = std::move(fnd->second);
+                    payloads->erase(fnd);
+                }
+            }
+            if (!data && (state == HELICS_ERROR || state == HELICS_FINISHED)) {
+                // the shared payload was released when the federate stopped
+                break;
+            }
+            if (!data) {
+                data = std::make_shared<const SmallBuffer>(std::move(cmd.payload));
+            }
+            auto fedID = global_id.load();
+            for (const auto& target : getFanoutTargets(cmd)) {
+                if (target.fed_id != fedID) {
+                    continue;
+                }
+                auto* subI = interfaceInformation.getInput(target.handle);
+                if (subI != nullptr && DeltaDecoder::isDeltaEncoded(cmd.flags)) {
+                    // each input rebuilds the value from its own copy of the previous value
+                    SmallBuffer value(*data);
+                    if (subI->delta_values.decode(cmd.getSource(),
+                                                  cmd.flags,
+                                                  DeltaDecoder::getSequence(cmd),
+                                                  value)) {
+                        processValueUpdate(subI,
+                                           cmd,
+                                           std::make_shared<const SmallBuffer>(std::move(value)));
+                    } else {
+                        LOG_WARNING(fmt::format("unable to apply value patch {} to input {}",
+                                                prettyPrintString(cmd),
+                                                subI->key));
+                        requestDeltaResync(cmd, target.handle);
+                    }
+                } else if (subI != nullptr) {
+                    processValueUpdate(subI, cmd, data);
+                } else {
+                    auto* eptI = interfaceInformation.getEndpoint(target.handle);
+                    if (eptI != nullptr) {
+                        // the time of the fanout is processed once for all the targets below
+                        ActionMessage mv(CMD_PUB);
+                        mv.source_id = cmd.source_id;
+                        mv.source_handle = cmd.source_handle;
+                        mv.setDestination(target);
+                        mv.messageID = cmd.messageID;
+                        mv.counter = cmd.counter;
+                        mv.flags = cmd.flags;
+                        mv.actionTime = cmd.actionTime;
+                        mv.payload = *data;
+                        processEndpointValue(eptI, mv);
                     }
-                    LOG_DATA(fmt::format("receive PUBLICATION {} from {}",
-                                         prettyPrintString(cmd),
-                                         subI->getSourceName(src)));
                 }
             }
             if (state <= HELICS_EXECUTING) {
@@ -1459,6 +1873,12 @@ MessageProcessingResult FederateState::processActionMessage(ActionMessage& cmd)
                 pubI->removeSubscriber(cmd.getSource());
             }
         } break;
+        case CMD_DELTA_RESYNC: {
+            auto* pubI = interfaceInformation.getPublication(cmd.dest_handle);
+            if (pubI != nullptr) {
+                pubI->requestDeltaResync();
+            }
+        } break;
         case CMD_REMOVE_ENDPOINT:
             break;
         case CMD_SET_PROFILER_FLAG:
@@ -1525,6 +1945,79 @@ MessageProcessingResult FederateState::processActionMessage(ActionMessage& cmd)
     return MessageProcessingResult::CONTINUE_PROCESSING;
 }
 
+void FederateState::processValueUpdate(InputInfo* input,
+                                       const ActionMessage& cmd,
+                                       const std::shared_ptr<const SmallBuffer>& data)
+{
+    for (auto& src : input->input_sources) {
+        if ((cmd.source_id == src.fed_id) && (cmd.source_handle == src.handle)) {
+            input->addData(src, cmd.actionTime, cmd.counter, data);
+            valueUpdateReceived(input, cmd, src);
+        }
+    }
+}
+
+void FederateState::processValueUpdate(InputInfo* input,
+                                       const ActionMessage& cmd,
+                                       const SmallBuffer& data)
+{
+    for (auto& src : input->input_sources) {
+        if ((cmd.source_id == src.fed_id) && (cmd.source_handle == src.handle)) {
+            input->addData(src, cmd.actionTime, cmd.counter, data);
+            valueUpdateReceived(input, cmd, src);
+        }
+    }
+}
+
+void FederateState::processEndpointValue(EndpointInfo* ept, ActionMessage& cmd)
+{
+    timeCoord->updateMessageTime(cmd.actionTime, !timeGranted_mode);
+    LOG_DATA(fmt::format("receive_message {}", prettyPrintString(cmd)));
+    if (cmd.actionTime < time_granted) {
+        LOG_WARNING(fmt::format("received message {} at time({}) earlier than granted time({})",
+                                prettyPrintString(cmd),
+                                cmd.actionTime,
+                                time_granted));
+    }
+    if (ept->deltaValues.decode(cmd)) {
+        auto mess = std::make_unique<Message>();
+        mess->data = std::move(cmd.payload);
+        mess->dest = ept->key;
+        mess->flags = cmd.flags;
+        mess->time = cmd.actionTime;
+        mess->counter = cmd.counter;
+        mess->messageID = cmd.messageID;
+        mess->original_dest = ept->key;
+        ept->addMessage(std::move(mess));
+    } else {
+        LOG_WARNING(fmt::format("unable to apply value patch {} to endpoint {}",
+                                prettyPrintString(cmd),
+                                ept->key));
+        requestDeltaResync(cmd, ept->id.handle);
+    }
+}
+
+void FederateState::requestDeltaResync(const ActionMessage& cmd, InterfaceHandle target)
+{
+    ActionMessage resync(CMD_DELTA_RESYNC);
+    resync.setSource(GlobalHandle{global_id.load(), target});
+    resync.setDestination(cmd.getSource());
+    routeMessage(resync);
+}
+
+void FederateState::valueUpdateReceived(InputInfo* input,
+                                        const ActionMessage& cmd,
+                                        GlobalHandle source)
+{
+    if (!input->not_interruptible) {
+        timeCoord->updateValueTime(cmd.actionTime, !timeGranted_mode);
+        LOG_TRACE(timeCoord->printTimeStatus());
+    }
+    LOG_DATA(fmt::format("receive PUBLICATION {} from {}",
+                         prettyPrintString(cmd),
+                         input->getSourceName(source)));
+}
+
 void FederateState::setProperties(const ActionMessage& cmd)
 {
     if (state == HELICS_CREATED) {
@@ -1670,7 +2163,9 @@ void FederateState::setProperty(int timeProperty, Time propertyVal)
                     }
                 }
             } else if (grantTimeOutPeriod <= timeZero && grantTimeoutTimeIndex >= 0) {
-                mTimer->cancelTimer(grantTimeoutTimeIndex);
+                // the timer is not used again unless the timeout is set again
+                mTimer->releaseTimer(grantTimeoutTimeIndex);
+                grantTimeoutTimeIndex = -1;
             }
 #else
             grantTimeOutPeriod = propertyVal;
@@ -1705,6 +2200,18 @@ void FederateState::setProperty(int intProperty, int propertyVal)
             mLogManager->getLogBuffer().resize(
                 (propertyVal <= 0) ? 0UL : static_cast<std::size_t>(propertyVal));
             break;
+        case defs::Properties::WAIT_POLICY:
+            if (!waitPolicy.setPolicy(propertyVal)) {
+                LOG_WARNING(fmt::format("unrecognized wait policy {}", propertyVal));
+                break;
+            }
+#ifdef HELICS_ENABLE_LOCKFREE_FEDERATE_QUEUE
+            // the wait policy replaces the fixed spin of the queue
+            queue.setSpinCount((propertyVal == HELICS_WAIT_POLICY_BLOCK) ?
+                                   MpscQueue<ActionMessage>::defaultSpinCount :
+                                   0);
+#endif
+            break;
         default:
             timeCoord->setProperty(intProperty, propertyVal);
     }
@@ -1884,6 +2391,8 @@ int FederateState::getIntegerProperty(int intProperty) const
             return mLogManager->getConsoleLevel();
         case defs::Properties::LOG_BUFFER:
             return static_cast<int>(mLogManager->getLogBuffer().capacity());
+        case defs::Properties::WAIT_POLICY:
+            return waitPolicy.getPolicy();
         default:
             return timeCoord->getIntegerProperty(intProperty);
     }
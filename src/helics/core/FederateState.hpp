@@ -11,9 +11,14 @@ SPDX-License-Identifier: BSD-3-Clause
 #include "BasicHandleInfo.hpp"
 #include "CoreTypes.hpp"
 #include "InterfaceInfo.hpp"
+#include "WaitPolicy.hpp"
 #include "core-data.hpp"
 #include "gmlc/containers/BlockingQueue.hpp"
+#include "helics/helics-config.h"
 #include "helicsTime.hpp"
+#ifdef HELICS_ENABLE_LOCKFREE_FEDERATE_QUEUE
+#    include "../common/MpscQueue.hpp"
+#endif
 
 #include <atomic>
 #include <chrono>
@@ -36,6 +41,7 @@ class CoreFederateInfo;
 class TimeCoordinator;
 class MessageTimer;
 class LogManager;
+class WorkStealingPool;
 
 constexpr Time startupTime = Time::minVal();
 constexpr Time initialTime{-1000000.0};
@@ -117,9 +123,18 @@ class FederateState {
     /** message timer object for real time operations and timeouts */
     std::shared_ptr<MessageTimer> mTimer;
     /** processing queue for messages incoming to a federate */
+#ifdef HELICS_ENABLE_LOCKFREE_FEDERATE_QUEUE
+    MpscQueue<ActionMessage> queue;
+#else
     gmlc::containers::BlockingQueue<ActionMessage> queue;
+#endif
+    /** the policy for waiting on the queue while blocked in a request */
+    WaitPolicy waitPolicy;
     /** processing queue for commands incoming to a federate */
     gmlc::containers::BlockingQueue<std::pair<std::string, std::string>> commandQueue;
+    /** storage for payloads shared among several destinations keyed by the sequenceID of the
+     * fanout publication referencing them*/
+    guarded<std::map<std::uint32_t, std::shared_ptr<const SmallBuffer>>> sharedPayloads;
     /** current defaults for operational flags of interfaces for this federate */
     std::atomic<uint16_t> interfaceFlags{0};
     /** queue for delaying processing of messages for a time */
@@ -136,6 +151,32 @@ class FederateState {
 
     std::vector<std::pair<std::string, std::string>> tags;  //!< storage for user defined tags
     std::atomic<bool> queueProcessing{false};
+
+    /** the stages of a federate run through a federate operator*/
+    enum class CallbackStage : std::uint8_t {
+        IDLE,  //!< the operations have not been started
+        INITIALIZING,  //!< waiting for entry to initializing mode
+        EXECUTING,  //!< waiting for entry to executing mode
+        TIME_REQUEST,  //!< waiting for a time grant
+        FINALIZING,  //!< waiting for the disconnect to complete
+        COMPLETE  //!< the operator has been finalized
+    };
+    /// the operator running the federate steps when the federate has no thread of its own
+    std::shared_ptr<FederateOperator> fedOperator;
+    /// the pool running the queue processing for a callback federate
+    WorkStealingPool* callbackPool{nullptr};
+    std::atomic<bool> callbackBased{false};  //!< the federate is run through fedOperator
+    /// set while a task processing the queue of a callback federate is queued or running
+    std::atomic<bool> callbackScheduled{false};
+    /// set when a message is queued for a callback federate, cleared by the processing task
+    std::atomic<bool> callbackPending{false};
+    std::atomic<CallbackStage> callbackStage{CallbackStage::IDLE};
+    /// the iteration request of the pending callback request
+    IterationRequest callbackIterate{IterationRequest::NO_ITERATIONS};
+    Time callbackRequestTime{timeZero};  //!< the time of the pending callback time request
+    Time callbackLastTime{timeZero};  //!< the granted time before the pending time request
+    /// the delayed messages should be checked before processing the queue
+    bool callbackDelayCheck{false};
     /** find the next Value Event*/
     Time nextValueTime() const;
     /** find the next Message Event*/
@@ -193,6 +234,12 @@ class FederateState {
      */
     const std::vector<std::shared_ptr<const SmallBuffer>>& getAllValues(InterfaceHandle handle);
 
+    /** add a fanout publication to the processing queue along with its shared payload
+    @details the payload is retrieved through the sequenceID of the action when the action is
+    processed so a single buffer can be shared by all the local destinations of a publication
+    */
+    void addSharedValueAction(ActionMessage&& action, std::shared_ptr<const SmallBuffer> payload);
+
     /** set the CommonCore object that is managing this Federate*/
     void setParent(CommonCore* coreObject) { parent_ = coreObject; }
     /** update the info structure
@@ -280,6 +327,50 @@ class FederateState {
     @return a convergence state value with an indicator of return reason and state of convergence
     */
     MessageProcessingResult processQueue() noexcept;
+    /** process the messages available in the federate queue without waiting
+    @param processDelayed set to true to process the delayed Message queue first
+    @return a returnable result or CONTINUE_PROCESSING if the queue was emptied*/
+    MessageProcessingResult processAvailableQueue(bool processDelayed) noexcept;
+    /** process a single message taken from the queue, delaying it if required*/
+    MessageProcessingResult processQueuedMessage(ActionMessage& cmd, bool& errorCommand);
+    /** report errors and close out the profiling after processing the queue*/
+    MessageProcessingResult finishQueueProcessing(MessageProcessingResult ret_code,
+                                                  bool initError,
+                                                  bool errorCommand,
+                                                  bool profilerActive);
+    /** start the timers for a time request*/
+    void prepareTimeRequest(Time nextTime);
+    /** update the granted time and events after processing a time request
+    @details must be called with the processing lock held*/
+    iteration_time
+        completeTimeRequest(MessageProcessingResult ret, Time nextTime, IterationRequest iterate);
+    /** log a warning if the granted time is beyond the requested time*/
+    void checkTimeMismatch(Time lastTime, Time nextTime, Time grantedTime);
+    /** update the granted time and events after processing an exec request
+    @details must be called with the processing lock held*/
+    void completeExecRequest(MessageProcessingResult ret, IterationRequest iterate);
+    /** start the timers used in executing mode*/
+    void startExecTimers(MessageProcessingResult ret);
+    /** release the realtime and grant timeout timers so their slots can be reused*/
+    void releaseTimers();
+
+    /** queue the processing of a callback federate on the callback pool if it is not queued*/
+    void scheduleCallbackProcessing();
+    /** process the queue of a callback federate on a pool thread*/
+    void callbackProcessing() noexcept;
+    /** run the callback stages until the queue is empty or the operations are complete
+    @details must be called with the processing lock held*/
+    void runCallbackStages();
+    /** act on a returnable result for the current callback stage*/
+    void advanceCallbackStage(MessageProcessingResult ret);
+    /** call the initialization operations and request executing mode*/
+    void callbackInitialize();
+    /** call the operator for a granted time and request the next time*/
+    void callbackOperate(iteration_time grantedTime);
+    /** send the disconnect for a callback federate*/
+    void callbackFinalize();
+    /** finish the operator after the federate halted or encountered an error*/
+    void callbackComplete(MessageProcessingResult ret);
 
     /** process the federate delayed Message queue until a returnable event or it is empty
     @details processQueue will process messages until one of 3 things occur
@@ -295,6 +386,26 @@ class FederateState {
     @return a convergence state value with an indicator of return reason and state of convergence
     */
     MessageProcessingResult processActionMessage(ActionMessage& cmd);
+    /** deliver a value from a publication message to an input
+    @param input the input receiving the value
+    @param cmd the CMD_PUB or CMD_PUB_FANOUT message with the source and time information
+    @param data the value payload to deliver
+    */
+    void processValueUpdate(InputInfo* input,
+                            const ActionMessage& cmd,
+                            const std::shared_ptr<const SmallBuffer>& data);
+    /** deliver a value from a publication message to an input by copying the payload
+    @details used for inputs with ring storage so no shared buffer is allocated for the value*/
+    void processValueUpdate(InputInfo* input, const ActionMessage& cmd, const SmallBuffer& data);
+    /** deliver a value from a CMD_PUB message to an endpoint as a message
+    @details the time coordinator is notified of the message time through updateMessageTime*/
+    void processEndpointValue(EndpointInfo* ept, ActionMessage& cmd);
+    /** ask the publication that sent a value patch which could not be applied for a full value
+    @param cmd the message carrying the patch
+    @param target the local interface the patch was sent to*/
+    void requestDeltaResync(const ActionMessage& cmd, InterfaceHandle target);
+    /** update the time coordination and log after a value was delivered to an input*/
+    void valueUpdateReceived(InputInfo* input, const ActionMessage& cmd, GlobalHandle source);
     /** fill event list
     @param currentTime the time of the update
     */
@@ -345,6 +456,16 @@ class FederateState {
     /** set the managing core object */
     void setCoreObject(CommonCore* parent);
     // the next 5 functions are the processing functions that actually process the queue
+    /** set an operator to run the federate steps from a pool instead of a user thread
+    @param op the operator to call, nullptr to detach the operator
+    @param pool the pool running the queue processing of the federate*/
+    void setFederateOperator(std::shared_ptr<FederateOperator> op, WorkStealingPool* pool);
+    /** check if the federate is run through a federate operator*/
+    bool isCallbackFederate() const { return callbackBased.load(); }
+    /** start running a callback federate after the initialization request was sent
+    @details the operator is called for each grant from the pool threads until the federate
+    finalizes*/
+    void startCallbackOperations();
     /** process until the federate has verified its membership and assigned a global id number*/
     IterationResult waitSetup();
     /** process until the initialization state has been entered or there is a failure*/
@@ -368,6 +489,15 @@ class FederateState {
     @param handle the publication handle to use
     */
     std::vector<GlobalHandle> getSubscribers(InterfaceHandle handle);
+    /** get a list of current subscribers to a publication and fill the payload of a value message
+    @details publications using delta encoding place a patch against the previously transmitted
+    value in the payload when it is smaller than the value and mark the message accordingly
+    @param handle the publication handle to use
+    @param value the value to transmit
+    @param mv the message to place the payload in
+    */
+    std::vector<GlobalHandle>
+        getSubscribers(InterfaceHandle handle, std::string_view value, ActionMessage& mv);
 
     /** get a list of the endpoints a message should be sent to
     @param handle the endpoint handle to use
@@ -8,6 +8,7 @@ SPDX-License-Identifier: BSD-3-Clause
 
 #include "../common/JsonProcessingFunctions.hpp"
 #include "BasicHandleInfo.hpp"
+#include "FilterWorkers.hpp"
 #include "HandleManager.hpp"
 #include "TimeCoordinatorProcessing.hpp"
 #include "coreTypeOperations.hpp"
@@ -35,6 +36,8 @@ FilterFederate::FilterFederate(GlobalFederateId fedID,
 
 FilterFederate::~FilterFederate()
 {
+    // the workers return their results through the callbacks so they must stop first
+    workers.reset();
     mHandles = {nullptr};
     current_state = {HELICS_CREATED};
     /// map of all local filters
@@ -265,6 +268,12 @@ void FilterFederate::processFilterReturn(ActionMessage& cmd)
             if (checkActionFlag(*filt, disconnected_flag)) {
                 continue;
             }
+            if (useWorkers(filt)) {
+                cmd.counter = static_cast<uint16_t>(ii);
+                sendToWorkers(cmd, filt, handle);
+                needToSendMessage = false;
+                break;
+            }
 
             auto press = executeFilter(cmd, filt);
             if (!press.second) {
@@ -287,6 +296,11 @@ void FilterFederate::processFilterReturn(ActionMessage& cmd)
         }
         acceptProcessReturn(fid, mid);
         if (needToSendMessage) {
+            if (cmd.action() == CMD_SEND_MESSAGE) {
+                // the result was addressed to the source endpoint
+                cmd.dest_id = parent_broker_id;
+                cmd.dest_handle = InterfaceHandle();
+            }
             mDeliverMessage(cmd);
         }
     }
@@ -365,6 +379,37 @@ std::pair<ActionMessage&, bool> FilterFederate::executeFilter(ActionMessage& com
     return {command, true};
 }
 
+bool FilterFederate::useWorkers(const FilterInfo* filt) const
+{
+    return workers && filt->core_id == mFedID && !filt->cloning && filt->filterOp &&
+        filt->filterOp->isStateless();
+}
+
+void FilterFederate::sendToWorkers(ActionMessage& command,
+                                   const FilterInfo* filt,
+                                   const BasicHandleInfo* handle)
+{
+    mCoord.triggered = true;
+    command.setAction(CMD_SEND_FOR_FILTER_AND_RETURN);
+    command.sequenceID = messageCounter++;
+    command.setSource(handle->handle);
+    generateProcessMarker(handle->getFederateId(), command.sequenceID, command.actionTime);
+    workers->addMessage(GlobalHandle(mFedID, filt->handle), filt->filterOp, std::move(command));
+    command = CMD_IGNORE;
+}
+
+void FilterFederate::setWorkerCount(int count)
+{
+    if (count <= 0) {
+        workers.reset();
+        return;
+    }
+    workers = std::make_unique<FilterWorkers>(static_cast<std::size_t>(count),
+                                              [this](ActionMessage&& result) {
+                                                  mQueueMessageMove(std::move(result));
+                                              });
+}
+
 ActionMessage& FilterFederate::processMessage(ActionMessage& command, const BasicHandleInfo* handle)
 {
     auto* filtFunc = getFilterCoordinator(handle->getInterfaceHandle());
@@ -378,6 +423,11 @@ ActionMessage& FilterFederate::processMessage(ActionMessage& command, const Basi
             if (checkActionFlag(*filt, disconnected_flag)) {
                 continue;
             }
+            if (useWorkers(filt)) {
+                command.counter = static_cast<uint16_t>(ii);
+                sendToWorkers(command, filt, handle);
+                return command;
+            }
             auto press = executeFilter(command, filt);
             if (!press.second) {
                 if (command.action() == CMD_IGNORE) {
@@ -428,7 +478,18 @@ bool FilterFederate::destinationProcessMessage(ActionMessage& command,
                     return false;
                 }
                 // the filter is part of this core
-
+                if (useWorkers(ffunc->destFilter)) {
+                    // the workers respond like a filter on another core
+                    auto mid = ++messageCounter;
+                    generateDestProcessMarker(handle->getFederateId(), mid, command.actionTime);
+                    command.setAction(CMD_SEND_FOR_DEST_FILTER_AND_RETURN);
+                    command.sequenceID = mid;
+                    command.setSource(handle->handle);
+                    workers->addMessage(GlobalHandle(mFedID, ffunc->destFilter->handle),
+                                        ffunc->destFilter->filterOp,
+                                        std::move(command));
+                    return false;
+                }
                 if (ffunc->destFilter->filterOp) {
                     auto tempMessage = createMessageFromCommand(std::move(command));
                     auto odest = tempMessage->dest;
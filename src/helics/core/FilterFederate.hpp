@@ -29,6 +29,7 @@ namespace helics {
 class HandleManager;
 class ActionMessage;
 class BasicHandleInfo;
+class FilterWorkers;
 
 class FilterFederate {
   private:
@@ -65,6 +66,8 @@ class FilterFederate {
     bool usingGlobalTime{false};
     /// storage for all the filters
     gmlc::containers::MappedPointerVector<FilterInfo, GlobalHandle> filters;
+    /// the workers running stateless filter operations off the core thread
+    std::unique_ptr<FilterWorkers> workers;
     // bool hasTiming{false};
 
   public:
@@ -133,6 +136,9 @@ class FilterFederate {
         usingGlobalTime = value;
         mCoord.globalTime = value;
     }
+    /** set the number of worker threads running stateless filter operations
+    @details must be called after the callbacks are set, 0 runs all the filters on the core thread*/
+    void setWorkerCount(int count);
 
   private:
     void routeMessage(const ActionMessage& msg);
@@ -150,6 +156,13 @@ class FilterFederate {
     void clearTimeReturn(int32_t id);
 
     std::pair<ActionMessage&, bool> executeFilter(ActionMessage& command, FilterInfo* filt);
+    /** check if a filter operation can be run on the filter workers*/
+    bool useWorkers(const FilterInfo* filt) const;
+    /** send a message to the filter workers for a source filter and block the time of the
+    federate sending it until the result returns, command is left as CMD_IGNORE*/
+    void sendToWorkers(ActionMessage& command,
+                       const FilterInfo* filt,
+                       const BasicHandleInfo* handle);
     void generateProcessMarker(GlobalFederateId fid, uint32_t pid, Time returnTime);
     void acceptProcessReturn(GlobalFederateId fid, uint32_t pid);
 
@@ -0,0 +1,115 @@
+/*
+Copyright (c) 2017-2022,
+Battelle Memorial Institute; Lawrence Livermore National Security, LLC; Alliance for Sustainable
+Energy, LLC.  See the top-level NOTICE for additional details. All rights reserved.
+SPDX-License-Identifier: BSD-3-Clause
+*/
+
+#include "FilterWorkers.hpp"
+
+#include "core-data.hpp"
+
+#include <utility>
+
+namespace helics {
+FilterWorkers::FilterWorkers(std::size_t workerCount, ResultPath resultFunction):
+    result(std::move(resultFunction))
+{
+    if (workerCount == 0) {
+        workerCount = 1;
+    }
+    workers.reserve(workerCount);
+    for (std::size_t ii = 0; ii < workerCount; ++ii) {
+        workers.push_back(std::make_unique<Worker>());
+    }
+    for (std::size_t ii = 0; ii < workerCount; ++ii) {
+        workers[ii]->thread = std::thread(&FilterWorkers::processWorker, this, ii);
+    }
+}
+
+FilterWorkers::~FilterWorkers()
+{
+    stop();
+}
+
+bool FilterWorkers::addMessage(GlobalHandle filterHandle,
+                               std::shared_ptr<FilterOperator> filterOp,
+                               ActionMessage&& command)
+{
+    if (!running.load() || !filterOp) {
+        return false;
+    }
+    // the messages of an endpoint always go to the same worker so they stay in order
+    auto index = static_cast<std::size_t>(command.source_handle.baseValue()) % workers.size();
+    workers[index]->queue.push(FilterTask{filterHandle, std::move(filterOp), std::move(command)});
+    return true;
+}
+
+void FilterWorkers::stop()
+{
+    if (!running.exchange(false)) {
+        return;
+    }
+    for (auto& worker : workers) {
+        // a task without an operation stops the worker
+        worker->queue.push(FilterTask{GlobalHandle{}, nullptr, ActionMessage{}});
+    }
+    for (auto& worker : workers) {
+        if (worker->thread.joinable()) {
+            worker->thread.join();
+        }
+    }
+}
+
+std::uint64_t FilterWorkers::processedCount() const
+{
+    std::uint64_t count{0};
+    for (const auto& worker : workers) {
+        count += worker->processed.load();
+    }
+    return count;
+}
+
+void FilterWorkers::processWorker(std::size_t index)
+{
+    auto& worker = *workers[index];
+    while (true) {
+        auto task = worker.queue.pop();
+        if (!task.filterOp) {
+            break;
+        }
+        runFilter(task);
+        ++worker.processed;
+    }
+}
+
+void FilterWorkers::runFilter(FilterTask& task)
+{
+    auto& command = task.command;
+    const bool destFilter = (command.action() == CMD_SEND_FOR_DEST_FILTER_AND_RETURN);
+    auto endpoint = command.getSource();
+    auto filterCounter = command.counter;
+    auto seqID = command.sequenceID;
+
+    auto message = createMessageFromCommand(std::move(command));
+    auto dest = message->dest;
+    message = task.filterOp->process(std::move(message));
+
+    ActionMessage response(destFilter ? CMD_NULL_DEST_MESSAGE : CMD_NULL_MESSAGE);
+    if (message) {
+        if (destFilter && message->dest != dest) {
+            // the destination was altered so the message needs to be delivered again, the null
+            // message sent after it releases the original destination
+            result(ActionMessage(std::move(message)));
+        } else {
+            response = ActionMessage(std::move(message));
+            response.setAction(destFilter ? CMD_DEST_FILTER_RESULT : CMD_FILTER_RESULT);
+        }
+    }
+    response.setDestination(endpoint);
+    response.setSource(task.filterHandle);
+    response.counter = filterCounter;
+    response.sequenceID = seqID;
+    result(std::move(response));
+}
+}  // namespace helics
@@ -0,0 +1,82 @@
+/*
+Copyright (c) 2017-2022,
+Battelle Memorial Institute; Lawrence Livermore National Security, LLC; Alliance for Sustainable
+Energy, LLC.  See the top-level NOTICE for additional details. All rights reserved.
+SPDX-License-Identifier: BSD-3-Clause
+*/
+#pragma once
+
+#include "ActionMessage.hpp"
+#include "GlobalFederateId.hpp"
+#include "gmlc/containers/BlockingQueue.hpp"
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <thread>
+#include <utility>
+#include <vector>
+
+namespace helics {
+class FilterOperator;
+
+/** class running stateless filter operations on a set of worker threads
+@details each endpoint is assigned to a worker by its handle so the messages of an endpoint are
+filtered in the order they were sent.  The messages are sent to the workers the same way they are
+sent to a filter on another core, as a CMD_SEND_FOR_FILTER_AND_RETURN or
+CMD_SEND_FOR_DEST_FILTER_AND_RETURN command with the endpoint as the source, and the workers
+respond the same way a remote filter does with a CMD_FILTER_RESULT or CMD_NULL_MESSAGE (or the
+destination filter equivalents) addressed to the endpoint*/
+class FilterWorkers {
+  public:
+    /** function returning the results to the core*/
+    using ResultPath = std::function<void(ActionMessage&& result)>;
+
+    /** construct and start the workers
+    @param workerCount the number of worker threads
+    @param result the function returning the filtered messages to the core*/
+    FilterWorkers(std::size_t workerCount, ResultPath result);
+    /** destructor stops the workers*/
+    ~FilterWorkers();
+    FilterWorkers(const FilterWorkers&) = delete;
+    FilterWorkers& operator=(const FilterWorkers&) = delete;
+
+    /** filter a message on the worker assigned to its endpoint
+    @param filterHandle the handle of the filter the results are reported from
+    @param filterOp the operation to run on the message
+    @param command the message to filter
+    @return false if the workers are stopped, the command is not moved in that case*/
+    bool addMessage(GlobalHandle filterHandle,
+                    std::shared_ptr<FilterOperator> filterOp,
+                    ActionMessage&& command);
+    /** stop the workers after they process the messages already queued*/
+    void stop();
+    /** get the number of workers*/
+    std::size_t size() const { return workers.size(); }
+    /** get the number of messages filtered by the workers*/
+    std::uint64_t processedCount() const;
+
+  private:
+    /** a message waiting to be filtered*/
+    struct FilterTask {
+        GlobalHandle filterHandle;
+        std::shared_ptr<FilterOperator> filterOp;
+        ActionMessage command;
+    };
+    /** the queue and thread of a single worker*/
+    struct Worker {
+        gmlc::containers::BlockingQueue<FilterTask> queue;
+        std::atomic<std::uint64_t> processed{0};
+        std::thread thread;
+    };
+    void processWorker(std::size_t index);
+    /** run a filter operation and return the result to the core*/
+    void runFilter(FilterTask& task);
+
+    ResultPath result;
+    std::vector<std::unique_ptr<Worker>> workers;
+    std::atomic<bool> running{true};
+};
+}  // namespace helics
@@ -0,0 +1,262 @@
+/*
+Copyright (c) 2017-2022,
+Battelle Memorial Institute; Lawrence Livermore National Security, LLC; Alliance for Sustainable
+Energy, LLC.  See the top-level NOTICE for additional details. All rights reserved.
+SPDX-License-Identifier: BSD-3-Clause
+*/
+#include "FlightRecorder.hpp"
+
+#include "json/json.h"
+#include <algorithm>
+#include <chrono>
+#include <cstring>
+#include <fstream>
+#include <iterator>
+#include <stdexcept>
+
+namespace helics {
+
+/// the flag in a record indicating the message was truncated to fit in a slot
+static constexpr std::uint32_t truncatedFlag{0x01U};
+static constexpr char dumpMagic[4] = {'H', 'F', 'R', '1'};
+static constexpr std::size_t dumpHeaderSize{24};
+static constexpr std::size_t recordHeaderSize{24};
+
+struct FlightRecorder::Slot {
+    /// 0 if empty, odd while the slot is being written, otherwise 2*(position+1)
+    std::atomic<std::uint64_t> sequence{0};
+    std::atomic<std::int64_t> timestamp{0};
+    std::atomic<std::uint32_t> size{0};
+    std::atomic<std::uint32_t> flags{0};
+};
+
+static void appendLE(std::string& data, std::uint64_t value, std::size_t bytes)
+{
+    for (std::size_t ii = 0; ii < bytes; ++ii) {
+        data.push_back(static_cast<char>((value >> (8U * ii)) & 0xFFU));
+    }
+}
+
+static std::uint64_t readLE(std::string_view data, std::size_t offset, std::size_t bytes)
+{
+    std::uint64_t value{0};
+    for (std::size_t ii = 0; ii < bytes; ++ii) {
+        value |= static_cast<std::uint64_t>(static_cast<unsigned char>(data[offset + ii]))
+            << (8U * ii);
+    }
+    return value;
+}
+
+FlightRecorder::FlightRecorder(std::size_t slotCount_, std::size_t slotSize_):
+    slotCount((std::max)(slotCount_, std::size_t{1})),
+    slotBytes(
+        (std::min)(((std::max)(slotSize_, minSlotSize) + 7U) & ~std::size_t{7U}, maxSlotSize)),
+    slotWords(slotBytes / sizeof(std::uint64_t)), slots(std::make_unique<Slot[]>(slotCount)),
+    words(std::make_unique<std::atomic<std::uint64_t>[]>(slotCount * slotWords)),
+    scratch(slotBytes)
+{
+}
+
+FlightRecorder::~FlightRecorder() = default;
+
+void FlightRecorder::record(const ActionMessage& command)
+{
+    std::uint32_t flags{0};
+    int size{-1};
+    // toByteArray does not count the string data against the buffer size so check it here
+    if (static_cast<std::size_t>(command.serializedByteCount()) <= slotBytes) {
+        size = command.toByteArray(scratch.data(), slotBytes);
+    }
+    if (size < 0) {
+        // keep the header and as much of the payload as fits
+        ActionMessage cut(command);
+        cut.clearStringData();
+        cut.payload.resize(0);
+        const auto overhead = static_cast<std::size_t>(cut.serializedByteCount());
+        if (overhead >= slotBytes) {
+            return;
+        }
+        cut.payload = command.payload.to_string().substr(0, slotBytes - overhead);
+        size = cut.toByteArray(scratch.data(), slotBytes);
+        if (size < 0) {
+            return;
+        }
+        flags |= truncatedFlag;
+    }
+    const auto position = head.load(std::memory_order_relaxed);
+    auto& slot = slots[position % slotCount];
+    auto* data = &words[(position % slotCount) * slotWords];
+
+    slot.sequence.store((position << 1U) | 1U, std::memory_order_relaxed);
+    std::atomic_thread_fence(std::memory_order_release);
+    slot.timestamp.store(std::chrono::duration_cast<std::chrono::nanoseconds>(
+                             std::chrono::system_clock::now().time_since_epoch())
+                             .count(),
+                         std::memory_order_relaxed);
+    slot.size.store(static_cast<std::uint32_t>(size), std::memory_order_relaxed);
+    slot.flags.store(flags, std::memory_order_relaxed);
+    const auto wordCount = (static_cast<std::size_t>(size) + 7U) / 8U;
+    for (std::size_t ii = 0; ii < wordCount; ++ii) {
+        std::uint64_t word{0};
+        std::memcpy(&word,
+                    scratch.data() + ii * 8U,
+                    (std::min)(std::size_t{8U}, static_cast<std::size_t>(size) - ii * 8U));
+        data[ii].store(word, std::memory_order_relaxed);
+    }
+    slot.sequence.store((position + 1U) << 1U, std::memory_order_release);
+    head.store(position + 1U, std::memory_order_release);
+}
+
+bool FlightRecorder::readSlot(std::uint64_t position,
+                              std::int64_t& timestamp,
+                              std::uint32_t& flags,
+                              std::vector<std::byte>& bytes) const
+{
+    const auto& slot = slots[position % slotCount];
+    const auto* data = &words[(position % slotCount) * slotWords];
+    const auto expected = (position + 1U) << 1U;
+    if (slot.sequence.load(std::memory_order_acquire) != expected) {
+        return false;
+    }
+    timestamp = slot.timestamp.load(std::memory_order_relaxed);
+    flags = slot.flags.load(std::memory_order_relaxed);
+    const auto size =
+        (std::min)(static_cast<std::size_t>(slot.size.load(std::memory_order_relaxed)), slotBytes);
+    bytes.resize(size);
+    const auto wordCount = (size + 7U) / 8U;
+    for (std::size_t ii = 0; ii < wordCount; ++ii) {
+        auto word = data[ii].load(std::memory_order_relaxed);
+        std::memcpy(bytes.data() + ii * 8U, &word, (std::min)(std::size_t{8U}, size - ii * 8U));
+    }
+    std::atomic_thread_fence(std::memory_order_acquire);
+    return slot.sequence.load(std::memory_order_relaxed) == expected;
+}
+
+std::vector<FlightRecord> FlightRecorder::records() const
+{
+    std::vector<FlightRecord> result;
+    const auto end = recordedCount();
+    const auto start = (end > slotCount) ? end - slotCount : std::uint64_t{0};
+    result.reserve(static_cast<std::size_t>(end - start));
+    std::vector<std::byte> bytes;
+    for (auto position = start; position < end; ++position) {
+        FlightRecord rec;
+        std::uint32_t flags{0};
+        if (!readSlot(position, rec.timestamp, flags, bytes)) {
+            continue;
+        }
+        if (rec.message.fromByteArray(bytes.data(), bytes.size()) == 0) {
+            continue;
+        }
+        rec.sequence = position;
+        rec.truncated = (flags & truncatedFlag) != 0;
+        result.push_back(std::move(rec));
+    }
+    return result;
+}
+
+std::string FlightRecorder::dump() const
+{
+    const auto end = recordedCount();
+    const auto start = (end > slotCount) ? end - slotCount : std::uint64_t{0};
+    std::string data(dumpMagic, sizeof(dumpMagic));
+    appendLE(data, slotBytes, 4);
+    appendLE(data, end, 8);
+    // the record count is filled in at the end since overwritten slots are skipped
+    appendLE(data, 0, 8);
+    std::uint64_t count{0};
+    std::vector<std::byte> bytes;
+    for (auto position = start; position < end; ++position) {
+        std::int64_t timestamp{0};
+        std::uint32_t flags{0};
+        if (!readSlot(position, timestamp, flags, bytes)) {
+            continue;
+        }
+        appendLE(data, position, 8);
+        appendLE(data, static_cast<std::uint64_t>(timestamp), 8);
+        appendLE(data, bytes.size(), 4);
+        appendLE(data, flags, 4);
+        data.append(reinterpret_cast<const char*>(bytes.data()), bytes.size());
+        ++count;
+    }
+    for (std::size_t ii = 0; ii < 8; ++ii) {
+        data[16 + ii] = static_cast<char>((count >> (8U * ii)) & 0xFFU);
+    }
+    return data;
+}
+
+bool FlightRecorder::dumpToFile(const std::string& fileName) const
+{
+    std::ofstream out(fileName, std::ios::binary | std::ios::trunc);
+    if (!out) {
+        return false;
+    }
+    auto data = dump();
+    out.write(data.data(), static_cast<std::streamsize>(data.size()));
+    return static_cast<bool>(out);
+}
+
+void FlightRecorder::loadJson(Json::Value& base) const
+{
+    base["capacity"] = static_cast<Json::UInt64>(slotCount);
+    base["slot_size"] = static_cast<Json::UInt64>(slotBytes);
+    base["recorded"] = static_cast<Json::UInt64>(recordedCount());
+    auto& messages = base["messages"];
+    messages = Json::arrayValue;
+    for (const auto& rec : records()) {
+        Json::Value entry;
+        entry["sequence"] = static_cast<Json::UInt64>(rec.sequence);
+        entry["timestamp"] = static_cast<Json::Int64>(rec.timestamp);
+        entry["action"] = actionMessageType(rec.message.action());
+        entry["source"] = rec.message.source_id.baseValue();
+        entry["dest"] = rec.message.dest_id.baseValue();
+        entry["message"] = prettyPrintString(rec.message);
+        if (rec.truncated) {
+            entry["truncated"] = true;
+        }
+        messages.append(std::move(entry));
+    }
+}
+
+std::vector<FlightRecord> FlightRecorder::decode(std::string_view data)
+{
+    if (data.size() < dumpHeaderSize || data.compare(0, 4, dumpMagic, sizeof(dumpMagic)) != 0) {
+        throw(std::invalid_argument("data is not a flight recorder dump"));
+    }
+    const auto count = readLE(data, 16, 8);
+    std::vector<FlightRecord> result;
+    std::size_t offset{dumpHeaderSize};
+    for (std::uint64_t ii = 0; ii < count; ++ii) {
+        if (data.size() < offset + recordHeaderSize) {
+            throw(std::invalid_argument("flight recorder dump is truncated"));
+        }
+        FlightRecord rec;
+        rec.sequence = readLE(data, offset, 8);
+        rec.timestamp = static_cast<std::int64_t>(readLE(data, offset + 8, 8));
+        const auto size = static_cast<std::size_t>(readLE(data, offset + 16, 4));
+        rec.truncated = (readLE(data, offset + 20, 4) & truncatedFlag) != 0;
+        offset += recordHeaderSize;
+        if (data.size() < offset + size) {
+            throw(std::invalid_argument("flight recorder dump is truncated"));
+        }
+        if (rec.message.fromByteArray(reinterpret_cast<const std::byte*>(data.data() + offset),
+                                      size) == 0) {
+            throw(std::invalid_argument("invalid message in flight recorder dump"));
+        }
+        offset += size;
+        result.push_back(std::move(rec));
+    }
+    return result;
+}
+
+std::vector<FlightRecord> FlightRecorder::decodeFile(const std::string& fileName)
+{
+    std::ifstream in(fileName, std::ios::binary);
+    if (!in) {
+        throw(std::invalid_argument("unable to open " + fileName));
+    }
+    std::string data((std::istreambuf_iterator<char>(in)), std::istreambuf_iterator<char>());
+    return decode(data);
+}
+
+}  // namespace helics
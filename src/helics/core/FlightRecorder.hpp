@@ -0,0 +1,106 @@
+/*
+Copyright (c) 2017-2022,
+Battelle Memorial Institute; Lawrence Livermore National Security, LLC; Alliance for Sustainable
+Energy, LLC.  See the top-level NOTICE for additional details. All rights reserved.
+SPDX-License-Identifier: BSD-3-Clause
+*/
+#pragma once
+
+#include "ActionMessage.hpp"
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <string_view>
+#include <vector>
+
+/** forward declare Json::Value*/
+namespace Json {
+class Value;
+}
+
+namespace helics {
+/** a single message recovered from a flight recorder*/
+struct FlightRecord {
+    std::uint64_t sequence{0};  //!< the position of the message in the recorded stream
+    std::int64_t timestamp{0};  //!< the system time the message was recorded in ns since epoch
+    bool truncated{false};  //!< the string data and part of the payload did not fit in a slot
+    ActionMessage message;  //!< the recorded message
+};
+
+/** fixed size ring of serialized messages keeping the most recent messages processed by a broker
+or core
+@details the messages are recorded by a single thread, the processing loop, and the ring can be
+read from any thread without locking; each slot is guarded by a sequence number so a reader skips
+slots that are overwritten while it copies them.  Messages that do not fit in a slot are recorded
+without their string data and with the payload cut off.
+
+The dump format is a 24 byte header, the characters "HFR1", the slot size, the total number of
+recorded messages, and the number of records in the dump, followed by the records, each a 24 byte
+header with the sequence number, timestamp, size and flags, followed by the serialized message.
+All integers in the headers are little endian.*/
+class FlightRecorder {
+  public:
+    static constexpr std::size_t defaultSlotCount{8192};
+    static constexpr std::size_t defaultSlotSize{256};
+    /// the smallest slot size allowed, enough for any message without payload or string data
+    static constexpr std::size_t minSlotSize{96};
+    /// the largest slot size allowed
+    static constexpr std::size_t maxSlotSize{65536};
+
+    /** construct a recorder
+    @param slotCount the number of messages kept
+    @param slotSize the number of bytes available to each serialized message, rounded up to a
+    multiple of 8*/
+    explicit FlightRecorder(std::size_t slotCount = defaultSlotCount,
+                            std::size_t slotSize = defaultSlotSize);
+    ~FlightRecorder();
+    FlightRecorder(const FlightRecorder&) = delete;
+    FlightRecorder& operator=(const FlightRecorder&) = delete;
+
+    /** record a message, only a single thread may record messages*/
+    void record(const ActionMessage& command);
+    /** get the number of messages the recorder keeps*/
+    std::size_t capacity() const noexcept { return slotCount; }
+    /** get the number of bytes available to each message*/
+    std::size_t slotSize() const noexcept { return slotBytes; }
+    /** get the total number of messages recorded*/
+    std::uint64_t recordedCount() const noexcept { return head.load(std::memory_order_acquire); }
+
+    /** get the messages currently held in the recorder, oldest first*/
+    std::vector<FlightRecord> records() const;
+    /** generate a binary dump of the messages currently held in the recorder*/
+    std::string dump() const;
+    /** write a binary dump to a file
+    @return true if the file was written*/
+    bool dumpToFile(const std::string& fileName) const;
+    /** load a summary of the recorder and the recorded messages into a json object*/
+    void loadJson(Json::Value& base) const;
+
+    /** decode a binary dump generated by a flight recorder
+    @throw std::invalid_argument if the data is not a flight recorder dump*/
+    static std::vector<FlightRecord> decode(std::string_view data);
+    /** read and decode a binary dump file
+    @throw std::invalid_argument if the file can't be read or is not a flight recorder dump*/
+    static std::vector<FlightRecord> decodeFile(const std::string& fileName);
+
+  private:
+    struct Slot;
+    /** copy the raw bytes of the slot at a position
+    @return false if the slot does not hold the message at that position*/
+    bool readSlot(std::uint64_t position,
+                  std::int64_t& timestamp,
+                  std::uint32_t& flags,
+                  std::vector<std::byte>& bytes) const;
+
+    std::size_t slotCount;
+    std::size_t slotBytes;
+    std::size_t slotWords;
+    std::unique_ptr<Slot[]> slots;
+    std::unique_ptr<std::atomic<std::uint64_t>[]> words;
+    std::atomic<std::uint64_t> head{0};
+    std::vector<std::byte> scratch;  //!< serialization buffer used by the recording thread
+};
+}  // namespace helics
@@ -128,7 +128,7 @@ MessageProcessingResult ForwardingTimeCoordinator::checkExecEntry(GlobalFederate
         bool allowed{false};
         if (downstream.mTimeState == TimeState::exec_requested_iterative) {
             allowed = true;
-            for (auto& dep : dependencies) {
+            for (const auto& dep : dependencies) {
                 if (dep.dependency) {
                     if (dep.minFed != mSourceId) {
                         allowed = false;
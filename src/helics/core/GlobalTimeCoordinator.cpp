@@ -61,12 +61,13 @@ void GlobalTimeCoordinator::sendTimeUpdateRequest(Time triggerTime)
 {
     ActionMessage updateTime(CMD_REQUEST_CURRENT_TIME, mSourceId, mSourceId);
     updateTime.counter = sequenceCounter;
-    for (auto& dep : dependencies) {
+    for (const auto& dep : dependencies) {
         if (dep.next <= triggerTime && dep.next < cBigTime) {
             updateTime.dest_id = dep.fedID;
             updateTime.setExtraDestData(dep.sequenceCounter);
-            dep.updateRequested = true;
-            dep.grantedIteration = sequenceCounter;
+            auto* depInfo = dependencies.getDependencyInfo(dep.fedID);
+            depInfo->updateRequested = true;
+            depInfo->grantedIteration = sequenceCounter;
             sendMessageFunction(updateTime);
         }
     }
@@ -127,7 +128,7 @@ bool GlobalTimeCoordinator::updateTimeFactors()
                 currentMinTime = timeStream.Te;
                 nextEvent = timeStream.Te;
             } else {
-                for (auto& dep : dependencies) {
+                for (const auto& dep : dependencies) {
                     if (dep.updateRequested) {
                         continue;
                     }
@@ -177,7 +178,7 @@ MessageProcessingResult GlobalTimeCoordinator::checkExecEntry(GlobalFederateId /
         bool allowed{false};
         if (currentTimeState == TimeState::exec_requested_iterative) {
             allowed = true;
-            for (auto& dep : dependencies) {
+            for (const auto& dep : dependencies) {
                 if (dep.dependency) {
                     if (dep.minFed != mSourceId) {
                         allowed = false;
@@ -41,6 +41,13 @@ void HandleManager::addHandle(const BasicHandleInfo& otherHandle)
     addSearchFields(handles.back(), index);
 }
 
+void HandleManager::reserve(std::size_t publicationCount, std::size_t inputCount)
+{
+    publications.reserve(publications.size() + publicationCount);
+    inputs.reserve(inputs.size() + inputCount);
+    unique_ids.reserve(unique_ids.size() + publicationCount + inputCount);
+}
+
 void HandleManager::removeHandle(GlobalHandle handle)
 {
     auto key = static_cast<uint64_t>(handle);
@@ -55,6 +55,10 @@ class HandleManager {
                                std::string_view units);
 
     void addHandle(const BasicHandleInfo& otherHandle);
+    /** reserve space in the search structures for a block of handles about to be added
+    @param publicationCount the number of publications in the block
+    @param inputCount the number of inputs in the block*/
+    void reserve(std::size_t publicationCount, std::size_t inputCount);
     /** add a handle at the specified index*/
     void addHandleAtIndex(const BasicHandleInfo& otherHandle, int32_t index);
     /** remove the information at the specified handle*/
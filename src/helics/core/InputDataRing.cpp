@@ -0,0 +1,73 @@
+/*
+Copyright (c) 2017-2022,
+Battelle Memorial Institute; Lawrence Livermore National Security, LLC; Alliance for Sustainable
+Energy, LLC.  See the top-level NOTICE for additional details. All rights reserved.
+SPDX-License-Identifier: BSD-3-Clause
+*/
+#include "InputDataRing.hpp"
+
+#include <algorithm>
+#include <utility>
+
+namespace helics {
+/// the number of slots allocated for the first record
+static constexpr std::size_t initialSlots{4};
+
+void InputDataRing::grow()
+{
+    std::vector<Record> newSlots(std::max(initialSlots, slots.size() * 2));
+    for (std::size_t ii = 0; ii < count; ++ii) {
+        newSlots[ii] = std::move(slot(ii));
+    }
+    slots.swap(newSlots);
+    head = 0;
+    mask = slots.size() - 1;
+}
+
+void InputDataRing::insert(Time time, unsigned int iteration, const SmallBuffer& data)
+{
+    if (count == slots.size()) {
+        grow();
+    }
+    // values almost always arrive in order so check the back before searching
+    std::size_t position{count};
+    if (count > 0 &&
+        (time < back().time || (time == back().time && iteration < back().iteration))) {
+        std::size_t low{0};
+        std::size_t high{count};
+        while (low < high) {
+            auto mid = (low + high) / 2;
+            const auto& rec = (*this)[mid];
+            if (time < rec.time || (time == rec.time && iteration < rec.iteration)) {
+                high = mid;
+            } else {
+                low = mid + 1;
+            }
+        }
+        position = low;
+        // move the later records back one slot, the spare slot ends up at the insert position
+        for (std::size_t ii = count; ii > position; --ii) {
+            std::swap(slot(ii), slot(ii - 1));
+        }
+    }
+    auto& rec = slot(position);
+    rec.time = time;
+    rec.iteration = iteration;
+    rec.data = data;
+    ++count;
+}
+
+void InputDataRing::popFront(std::size_t records)
+{
+    records = std::min(records, count);
+    head = (head + records) & mask;
+    count -= records;
+}
+
+void InputDataRing::popBack()
+{
+    if (count > 0) {
+        --count;
+    }
+}
+}  // namespace helics
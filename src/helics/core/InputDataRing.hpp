@@ -0,0 +1,57 @@
+/*
+Copyright (c) 2017-2022,
+Battelle Memorial Institute; Lawrence Livermore National Security, LLC; Alliance for Sustainable
+Energy, LLC.  See the top-level NOTICE for additional details. All rights reserved.
+SPDX-License-Identifier: BSD-3-Clause
+*/
+#pragma once
+
+#include "SmallBuffer.hpp"
+#include "helicsTime.hpp"
+
+#include <cstddef>
+#include <vector>
+
+namespace helics {
+/** storage for the values an input receives from a single source ordered by time
+@details the records are held in a ring of slots that are reused as values arrive and are
+consumed.  Values that fit in the inline storage of a SmallBuffer are stored without allocating
+and larger values reuse the capacity left in a slot by earlier values.  Removing records from the
+front only moves the head of the ring*/
+class InputDataRing {
+  public:
+    /** a value recorded from a publication*/
+    struct Record {
+        Time time{Time::minVal()};  //!< the time of the value
+        unsigned int iteration{0};  //!< the iteration number of the value
+        SmallBuffer data;  //!< the value
+    };
+    /** check if there are no records*/
+    bool empty() const { return count == 0; }
+    /** get the number of records*/
+    std::size_t size() const { return count; }
+    /** get the number of slots allocated*/
+    std::size_t capacity() const { return slots.size(); }
+    /** get a record by its position from the front*/
+    const Record& operator[](std::size_t index) const { return slots[(head + index) & mask]; }
+    const Record& front() const { return (*this)[0]; }
+    const Record& back() const { return (*this)[count - 1]; }
+    /** add a value keeping the records ordered by time and iteration*/
+    void insert(Time time, unsigned int iteration, const SmallBuffer& data);
+    /** remove records from the front*/
+    void popFront(std::size_t records);
+    /** remove the last record*/
+    void popBack();
+    /** remove all the records, the slots are kept for reuse*/
+    void clear() { count = 0; }
+
+  private:
+    Record& slot(std::size_t index) { return slots[(head + index) & mask]; }
+    void grow();
+
+    std::vector<Record> slots;
+    std::size_t head{0};
+    std::size_t count{0};
+    std::size_t mask{0};
+};
+}  // namespace helics
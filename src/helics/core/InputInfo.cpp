@@ -80,23 +80,30 @@ static auto recordComparison = [](const InputInfo::dataRecord& rec1,
         ((rec1.time == rec2.time) ? (rec1.iteration < rec2.iteration) : false);
 };
 
-void InputInfo::addData(GlobalHandle source_id,
-                        Time valueTime,
-                        unsigned int iteration,
-                        std::shared_ptr<const SmallBuffer> data)
+int InputInfo::findSource(GlobalHandle source_id, Time valueTime) const
 {
-    int index;
-    bool found = false;
-    for (index = 0; index < static_cast<int>(input_sources.size()); ++index) {
+    for (int index = 0; index < static_cast<int>(input_sources.size()); ++index) {
         if (input_sources[index] == source_id) {
             if (valueTime > deactivated[index]) {
-                return;
+                return -1;
             }
-            found = true;
-            break;
+            return index;
         }
     }
-    if (!found) {
+    return -1;
+}
+
+void InputInfo::addData(GlobalHandle source_id,
+                        Time valueTime,
+                        unsigned int iteration,
+                        std::shared_ptr<const SmallBuffer> data)
+{
+    if (ring_storage) {
+        addData(source_id, valueTime, iteration, *data);
+        return;
+    }
+    auto index = findSource(source_id, valueTime);
+    if (index < 0) {
         return;
     }
     if ((data_queues[index].empty()) || (valueTime > data_queues[index].back().time)) {
@@ -111,6 +118,21 @@ void InputInfo::addData(GlobalHandle source_id,
     }
 }
 
+void InputInfo::addData(GlobalHandle source_id,
+                        Time valueTime,
+                        unsigned int iteration,
+                        const SmallBuffer& data)
+{
+    if (!ring_storage) {
+        addData(source_id, valueTime, iteration, std::make_shared<const SmallBuffer>(data));
+        return;
+    }
+    auto index = findSource(source_id, valueTime);
+    if (index >= 0) {
+        data_rings[index].insert(valueTime, iteration, data);
+    }
+}
+
 bool InputInfo::addSource(GlobalHandle newSource,
                           std::string_view sourceName,
                           std::string_view stype,
@@ -126,7 +148,11 @@ bool InputInfo::addSource(GlobalHandle newSource,
     inputType.clear();
     input_sources.push_back(newSource);
     source_info.emplace_back(sourceName, stype, sunits);
-    data_queues.resize(input_sources.size());
+    if (ring_storage) {
+        data_rings.resize(input_sources.size());
+    } else {
+        data_queues.resize(input_sources.size());
+    }
     current_data.resize(input_sources.size());
     current_data_time.resize(input_sources.size(), {Time::minVal(), 0});
     deactivated.push_back(Time::maxVal());
@@ -141,8 +167,14 @@ void InputInfo::removeSource(GlobalHandle sourceToRemove, Time minTime)
     inputType.clear();
     for (size_t ii = 0; ii < input_sources.size(); ++ii) {
         if (input_sources[ii] == sourceToRemove) {
-            while ((!data_queues[ii].empty()) && (data_queues[ii].back().time > minTime)) {
-                data_queues[ii].pop_back();
+            if (ring_storage) {
+                while ((!data_rings[ii].empty()) && (data_rings[ii].back().time > minTime)) {
+                    data_rings[ii].popBack();
+                }
+            } else {
+                while ((!data_queues[ii].empty()) && (data_queues[ii].back().time > minTime)) {
+                    data_queues[ii].pop_back();
+                }
             }
             if (minTime < deactivated[ii]) {
                 deactivated[ii] = minTime;
@@ -158,8 +190,14 @@ void InputInfo::removeSource(std::string_view sourceName, Time minTime)
     inputType.clear();
     for (size_t ii = 0; ii < source_info.size(); ++ii) {
         if (source_info[ii].key == sourceName) {
-            while ((!data_queues[ii].empty()) && (data_queues[ii].back().time > minTime)) {
-                data_queues[ii].pop_back();
+            if (ring_storage) {
+                while ((!data_rings[ii].empty()) && (data_rings[ii].back().time > minTime)) {
+                    data_rings[ii].popBack();
+                }
+            } else {
+                while ((!data_queues[ii].empty()) && (data_queues[ii].back().time > minTime)) {
+                    data_queues[ii].pop_back();
+                }
             }
             if (minTime < deactivated[ii]) {
                 deactivated[ii] = minTime;
@@ -174,6 +212,9 @@ void InputInfo::clearFutureData()
     for (auto& vec : data_queues) {
         vec.clear();
     }
+    for (auto& ring : data_rings) {
+        ring.clear();
+    }
 }
 
 const std::string& InputInfo::getInjectionType() const
@@ -261,6 +302,9 @@ const std::string& InputInfo::getTargets() const
 
 bool InputInfo::updateTimeUpTo(Time newTime)
 {
+    if (ring_storage) {
+        return updateRings(newTime, UpdateMode::up_to);
+    }
     int index{0};
     bool updated{false};
     for (auto& data_queue : data_queues) {
@@ -294,6 +338,9 @@ bool InputInfo::updateTimeUpTo(Time newTime)
 
 bool InputInfo::updateTimeNextIteration(Time newTime)
 {
+    if (ring_storage) {
+        return updateRings(newTime, UpdateMode::next_iteration);
+    }
     int index{0};
     bool updated{false};
     for (auto& data_queue : data_queues) {
@@ -336,6 +383,9 @@ bool InputInfo::updateTimeNextIteration(Time newTime)
 
 bool InputInfo::updateTimeInclusive(Time newTime)
 {
+    if (ring_storage) {
+        return updateRings(newTime, UpdateMode::inclusive);
+    }
     int index = 0;
     bool updated = false;
     for (auto& data_queue : data_queues) {
@@ -386,6 +436,81 @@ bool InputInfo::updateData(dataRecord&& update, int index)
     return false;
 }
 
+bool InputInfo::updateRings(Time newTime, UpdateMode mode)
+{
+    auto before = [mode, newTime](Time valueTime) {
+        return (mode == UpdateMode::inclusive) ? (valueTime <= newTime) : (valueTime < newTime);
+    };
+    int index{0};
+    bool updated{false};
+    for (auto& ring : data_rings) {
+        if (ring.empty() || ring.front().time > newTime ||
+            (mode == UpdateMode::up_to && ring.front().time == newTime)) {
+            ++index;
+            continue;
+        }
+        std::size_t last{0};
+        std::size_t current{1};
+        while (current < ring.size() && before(ring[current].time)) {
+            last = current;
+            ++current;
+        }
+        if (mode == UpdateMode::next_iteration && current < ring.size() &&
+            ring[current].time == newTime) {
+            auto cindex = ring[last].iteration;
+            while (current < ring.size() && ring[current].time == newTime &&
+                   ring[current].iteration == cindex) {
+                last = current;
+                ++current;
+            }
+        }
+        if (updateRingData(ring[last], index)) {
+            updated = true;
+        }
+        ring.popFront(current);
+        ++index;
+    }
+    return updated;
+}
+
+bool InputInfo::updateRingData(const InputDataRing::Record& update, int index)
+{
+    auto& current = current_data[index];
+    if (only_update_on_change && current && *current == update.data) {
+        if (current_data_time[index].first == update.time) {
+            // this is for bookkeeping purposes should still return false
+            current_data_time[index].second = update.iteration;
+        }
+        return false;
+    }
+    // buffers created for ring storage are never const objects, so a buffer that nothing outside
+    // the input holds any longer can be reused for a new value
+    if (current && current.use_count() == 1) {
+        const_cast<SmallBuffer&>(*current) = update.data;  // NOLINT
+    } else {
+        std::shared_ptr<const SmallBuffer> buffer;
+        for (auto& spare : spare_data) {
+            if (spare.use_count() == 1) {
+                buffer = std::move(spare);
+                spare = std::move(current);
+                break;
+            }
+        }
+        if (buffer) {
+            const_cast<SmallBuffer&>(*buffer) = update.data;  // NOLINT
+        } else {
+            // keep the value still in use to reuse once it is released
+            if (current && spare_data.size() < 2 * input_sources.size()) {
+                spare_data.push_back(std::move(current));
+            }
+            buffer = std::make_shared<SmallBuffer>(update.data);
+        }
+        current = std::move(buffer);
+    }
+    current_data_time[index] = {update.time, update.iteration};
+    return true;
+}
+
 Time InputInfo::nextValueTime() const
 {
     Time nvtime = Time::maxVal();
@@ -399,6 +524,11 @@ Time InputInfo::nextValueTime() const
             }
         }
     }
+    for (const auto& ring : data_rings) {
+        if (!ring.empty() && ring.front().time < nvtime) {
+            nvtime = ring.front().time;
+        }
+    }
     return nvtime;
 }
 
@@ -6,6 +6,8 @@ SPDX-License-Identifier: BSD-3-Clause
 */
 #pragma once
 
+#include "DeltaEncoding.hpp"
+#include "InputDataRing.hpp"
 #include "basic_CoreTypes.hpp"
 
 #include <memory>
@@ -74,6 +76,8 @@ class InputInfo {
     bool strict_type_matching{
         false};  //!< indicator that the handle need to have strict type matching
     bool ignore_unit_mismatch{false};  //!< ignore unit mismatches
+    /// store the queued values in rings of reusable buffers, must be set before adding sources
+    bool ring_storage{false};
     int32_t required_connnections{0};  //!< an exact number of connections required
     std::vector<std::pair<helics::Time, unsigned int>>
         current_data_time;  //!< the most recent published data times
@@ -83,8 +87,12 @@ class InputInfo {
     std::vector<Time> deactivated;  //!< indicator that the source has been deactivated
     std::vector<sourceInformation> source_info;  //!< the name,type,units of the sources
     std::vector<int32_t> priority_sources;  //!< the list of priority inputs;
+    DeltaDecoder delta_values;  //!< rebuilds the values of sources using delta encoding
   private:
     std::vector<std::vector<dataRecord>> data_queues;  //!< queue of the data
+    std::vector<InputDataRing> data_rings;  //!< queue of the data when using ring storage
+    /// previous values held outside the input that can be reused when released with ring storage
+    std::vector<std::shared_ptr<const SmallBuffer>> spare_data;
 
   public:
     /** get all the current data*/
@@ -98,6 +106,12 @@ class InputInfo {
                  Time valueTime,
                  unsigned int iteration,
                  std::shared_ptr<const SmallBuffer> data);
+    /** add a data block into the queue by copying the value
+    @details with ring storage the value is copied into a reusable slot without allocating*/
+    void addData(GlobalHandle source_id,
+                 Time valueTime,
+                 unsigned int iteration,
+                 const SmallBuffer& data);
 
     /** update current data not including data at the specified time
     @param newTime the time to move the subscription to
@@ -138,7 +152,12 @@ class InputInfo {
     const std::string& getTargets() const;
 
   private:
+    /** the criteria for selecting the values to update with*/
+    enum class UpdateMode { up_to, inclusive, next_iteration };
+    int findSource(GlobalHandle source_id, Time valueTime) const;
     bool updateData(dataRecord&& update, int index);
+    bool updateRingData(const InputDataRing::Record& update, int index);
+    bool updateRings(Time newTime, UpdateMode mode);
     mutable std::string inputUnits;
     mutable std::string inputType;
     mutable std::string sourceTargets;
@@ -32,6 +32,7 @@ void InterfaceInfo::createInput(InterfaceHandle handle,
     auto ciHandle = inputs.lock();
     ciHandle->insert(key, handle, GlobalHandle{global_id, handle}, key, type, units);
     ciHandle->back()->only_update_on_change = only_update_on_change;
+    ciHandle->back()->ring_storage = input_ring_storage;
 }
 
 void InterfaceInfo::createEndpoint(InterfaceHandle handle,
@@ -190,6 +191,9 @@ bool InterfaceInfo::setPublicationProperty(InterfaceHandle id, int32_t option, i
         case defs::Options::CONNECTIONS:
             pub->required_connections = value;
             break;
+        case defs::Options::DELTA_ENCODING:
+            pub->setDeltaEncoding(bvalue);
+            break;
         default:
             return false;
             break;
@@ -288,6 +292,9 @@ int32_t InterfaceInfo::getPublicationProperty(InterfaceHandle id, int32_t option
             break;
         case defs::Options::CONNECTIONS:
             return static_cast<int32_t>(pub->subscribers.size());
+        case defs::Options::DELTA_ENCODING:
+            flagval = pub->delta_encoding;
+            break;
         default:
             break;
     }
@@ -66,6 +66,8 @@ class InterfaceInfo {
     void setChangeUpdateFlag(bool updateFlag);
     /** get the current value of the change update flag*/
     bool getChangeUpdateFlag() const { return only_update_on_change; }
+    /** set inputs created after this call to store queued values in rings of reusable buffers*/
+    void setInputRingStorage(bool ringStorage) { input_ring_storage = ringStorage; }
     /** set a property on a specific interface*/
     bool setInputProperty(InterfaceHandle id, int32_t option, int32_t value);
     bool setPublicationProperty(InterfaceHandle id, int32_t option, int32_t value);
@@ -86,6 +88,7 @@ class InterfaceInfo {
     std::atomic<GlobalFederateId> global_id;
     bool only_update_on_change{
         false};  //!< flag indicating that subscriptions values should only be updated on change
+    bool input_ring_storage{false};  //!< flag indicating new inputs should use ring storage
     shared_guarded<
         gmlc::containers::DualMappedPointerVector<PublicationInfo, std::string, InterfaceHandle>>
         publications;  //!< storage for all the publications
@@ -0,0 +1,225 @@
+/*
+Copyright (c) 2017-2022,
+Battelle Memorial Institute; Lawrence Livermore National Security, LLC; Alliance for Sustainable
+Energy, LLC.  See the top-level NOTICE for additional details. All rights reserved.
+SPDX-License-Identifier: BSD-3-Clause
+*/
+#include "LatencyTracker.hpp"
+
+#include "json/json.h"
+#include <chrono>
+#include <cmath>
+#include <string>
+
+namespace helics {
+
+std::size_t LatencyHistogram::bucketIndex(std::uint64_t value) noexcept
+{
+    if (value < subBucketCount) {
+        return static_cast<std::size_t>(value);
+    }
+    if (value >= (std::uint64_t{1} << maxExponent)) {
+        return bucketCount - 1;
+    }
+    unsigned int exponent{subBucketBits};
+    while ((value >> (exponent + 1U)) != 0U) {
+        ++exponent;
+    }
+    auto sub = (value >> (exponent - subBucketBits)) & (subBucketCount - 1U);
+    return (static_cast<std::size_t>(exponent - subBucketBits + 1U) << subBucketBits) +
+        static_cast<std::size_t>(sub);
+}
+
+std::uint64_t LatencyHistogram::bucketUpperBound(std::size_t index) noexcept
+{
+    if (index < subBucketCount) {
+        return index;
+    }
+    auto exponent = static_cast<unsigned int>(index >> subBucketBits) + subBucketBits - 1U;
+    auto sub = static_cast<std::uint64_t>(index & (subBucketCount - 1U));
+    auto shift = exponent - subBucketBits;
+    return ((subBucketCount + sub + 1U) << shift) - 1U;
+}
+
+void LatencyHistogram::record(std::int64_t nanoseconds) noexcept
+{
+    auto value = (nanoseconds > 0) ? static_cast<std::uint64_t>(nanoseconds) : std::uint64_t{0};
+    buckets[bucketIndex(value)].fetch_add(1, std::memory_order_relaxed);
+    total.fetch_add(1, std::memory_order_relaxed);
+    sum.fetch_add(value, std::memory_order_relaxed);
+    auto currentMax = maxValue.load(std::memory_order_relaxed);
+    while (value > currentMax &&
+           !maxValue.compare_exchange_weak(currentMax, value, std::memory_order_relaxed)) {
+    }
+}
+
+double LatencyHistogram::mean() const noexcept
+{
+    auto cnt = count();
+    return (cnt > 0) ?
+        static_cast<double>(sum.load(std::memory_order_relaxed)) / static_cast<double>(cnt) :
+        0.0;
+}
+
+std::int64_t LatencyHistogram::percentile(double fraction) const noexcept
+{
+    auto cnt = count();
+    if (cnt == 0) {
+        return 0;
+    }
+    auto target = static_cast<std::uint64_t>(std::ceil(fraction * static_cast<double>(cnt)));
+    if (target == 0) {
+        target = 1;
+    }
+    std::uint64_t accumulated{0};
+    for (std::size_t ii = 0; ii < bucketCount; ++ii) {
+        accumulated += buckets[ii].load(std::memory_order_relaxed);
+        if (accumulated >= target) {
+            // the bucket bound can't be larger than any actual value seen
+            auto bound = static_cast<std::int64_t>(bucketUpperBound(ii));
+            return (bound < max()) ? bound : max();
+        }
+    }
+    return max();
+}
+
+void LatencyHistogram::reset() noexcept
+{
+    for (auto& bucket : buckets) {
+        bucket.store(0, std::memory_order_relaxed);
+    }
+    total.store(0, std::memory_order_relaxed);
+    sum.store(0, std::memory_order_relaxed);
+    maxValue.store(0, std::memory_order_relaxed);
+}
+
+LatencyHistogramSet::LatencyHistogramSet() noexcept
+{
+    for (std::size_t ii = 0; ii < maxKeys; ++ii) {
+        keys[ii].store(emptyKey, std::memory_order_relaxed);
+        histograms[ii].store(nullptr, std::memory_order_relaxed);
+    }
+}
+
+LatencyHistogramSet::~LatencyHistogramSet()
+{
+    for (auto& hist : histograms) {
+        delete hist.load();
+    }
+}
+
+LatencyHistogram* LatencyHistogramSet::get(std::int32_t key)
+{
+    auto start = static_cast<std::size_t>(static_cast<std::uint32_t>(key) * 2654435761U) % maxKeys;
+    for (std::size_t probe = 0; probe < maxKeys; ++probe) {
+        auto slot = (start + probe) % maxKeys;
+        auto current = keys[slot].load(std::memory_order_acquire);
+        if (current == emptyKey) {
+            if (keys[slot].compare_exchange_strong(current, key, std::memory_order_acq_rel)) {
+                auto* hist = new LatencyHistogram();
+                histograms[slot].store(hist, std::memory_order_release);
+                return hist;
+            }
+            // another thread claimed the slot, current now holds its key
+        }
+        if (current == key) {
+            LatencyHistogram* hist{nullptr};
+            // the claiming thread may not have stored the histogram yet
+            while ((hist = histograms[slot].load(std::memory_order_acquire)) == nullptr) {
+            }
+            return hist;
+        }
+    }
+    return nullptr;
+}
+
+void LatencyHistogramSet::reset() noexcept
+{
+    forEach([](std::int32_t /*key*/, LatencyHistogram& hist) { hist.reset(); });
+}
+
+std::int64_t LatencyTracker::now() noexcept
+{
+    return std::chrono::duration_cast<std::chrono::nanoseconds>(
+               std::chrono::steady_clock::now().time_since_epoch())
+        .count();
+}
+
+void LatencyTracker::recordQueue(action_message_def::action_t action,
+                                 std::int64_t enqueueTime,
+                                 std::int64_t dequeueTime)
+{
+    if (enqueueTime == 0) {
+        return;
+    }
+    auto* hist = queueLatency.get(static_cast<std::int32_t>(action));
+    if (hist != nullptr) {
+        hist->record(dequeueTime - enqueueTime);
+    }
+}
+
+void LatencyTracker::recordProcessing(action_message_def::action_t action,
+                                      std::int64_t startTime,
+                                      std::int64_t endTime)
+{
+    auto* hist = processingLatency.get(static_cast<std::int32_t>(action));
+    if (hist != nullptr) {
+        hist->record(endTime - startTime);
+    }
+}
+
+void LatencyTracker::recordTransmit(route_id rid, std::int64_t enqueueTime, std::int64_t sendTime)
+{
+    if (enqueueTime == 0) {
+        return;
+    }
+    auto* hist = transmitLatency.get(rid.baseValue());
+    if (hist != nullptr) {
+        hist->record(sendTime - enqueueTime);
+    }
+}
+
+static Json::Value histogramJson(const LatencyHistogram& hist)
+{
+    Json::Value result;
+    result["count"] = static_cast<Json::UInt64>(hist.count());
+    result["mean"] = hist.mean();
+    result["p50"] = static_cast<Json::Int64>(hist.percentile(0.5));
+    result["p90"] = static_cast<Json::Int64>(hist.percentile(0.9));
+    result["p99"] = static_cast<Json::Int64>(hist.percentile(0.99));
+    result["p999"] = static_cast<Json::Int64>(hist.percentile(0.999));
+    result["max"] = static_cast<Json::Int64>(hist.max());
+    return result;
+}
+
+void LatencyTracker::loadJson(Json::Value& base) const
+{
+    base["units"] = "ns";
+    auto loadActions = [](Json::Value& section, const LatencyHistogramSet& set) {
+        section = Json::objectValue;
+        set.forEach([&section](std::int32_t key, const LatencyHistogram& hist) {
+            if (hist.count() > 0) {
+                section[actionMessageType(static_cast<action_message_def::action_t>(key))] =
+                    histogramJson(hist);
+            }
+        });
+    };
+    loadActions(base["queue"], queueLatency);
+    loadActions(base["processing"], processingLatency);
+    auto& transmit = base["transmit"];
+    transmit = Json::objectValue;
+    transmitLatency.forEach([&transmit](std::int32_t key, const LatencyHistogram& hist) {
+        if (hist.count() > 0) {
+            transmit[std::to_string(key)] = histogramJson(hist);
+        }
+    });
+}
+
+void LatencyTracker::reset() noexcept
+{
+    queueLatency.reset();
+    processingLatency.reset();
+    transmitLatency.reset();
+}
+
+}  // namespace helics
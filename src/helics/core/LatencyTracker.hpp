@@ -0,0 +1,130 @@
+/*
+Copyright (c) 2017-2022,
+Battelle Memorial Institute; Lawrence Livermore National Security, LLC; Alliance for Sustainable
+Energy, LLC.  See the top-level NOTICE for additional details. All rights reserved.
+SPDX-License-Identifier: BSD-3-Clause
+*/
+#pragma once
+
+#include "ActionMessageDefintions.hpp"
+#include "GlobalFederateId.hpp"
+
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+
+/** forward declare Json::Value*/
+namespace Json {
+class Value;
+}
+
+namespace helics {
+/** lock free histogram of latencies in nanoseconds
+@details values are grouped into buckets with 16 linear sub buckets for each power of 2 so the
+reported percentiles have a relative error of less than 7%*/
+class LatencyHistogram {
+  public:
+    static constexpr unsigned int subBucketBits{4};
+    static constexpr unsigned int subBucketCount{1U << subBucketBits};
+    /// values of 2^maxExponent ns (about 73 minutes) or more are recorded in the last bucket
+    static constexpr unsigned int maxExponent{42};
+    static constexpr std::size_t bucketCount{(maxExponent - subBucketBits + 1) * subBucketCount};
+
+    /** record a single latency value*/
+    void record(std::int64_t nanoseconds) noexcept;
+    /** get the number of recorded values*/
+    std::uint64_t count() const noexcept { return total.load(std::memory_order_relaxed); }
+    /** get the largest recorded value*/
+    std::int64_t max() const noexcept
+    {
+        return static_cast<std::int64_t>(maxValue.load(std::memory_order_relaxed));
+    }
+    /** get the mean of the recorded values*/
+    double mean() const noexcept;
+    /** get the value below which the given fraction of recorded values fall
+    @param fraction a value between 0 and 1
+    @return the upper bound of the bucket containing the percentile*/
+    std::int64_t percentile(double fraction) const noexcept;
+    /** clear all recorded values*/
+    void reset() noexcept;
+
+    /** get the bucket index for a value*/
+    static std::size_t bucketIndex(std::uint64_t value) noexcept;
+    /** get the largest value recorded in a bucket*/
+    static std::uint64_t bucketUpperBound(std::size_t index) noexcept;
+
+  private:
+    std::array<std::atomic<std::uint64_t>, bucketCount> buckets{};
+    std::atomic<std::uint64_t> total{0};
+    std::atomic<std::uint64_t> sum{0};
+    std::atomic<std::uint64_t> maxValue{0};
+};
+
+/** a fixed size set of histograms indexed by an integer key
+@details histograms are created on first use, the set is lock free for both recording and
+reading*/
+class LatencyHistogramSet {
+  public:
+    static constexpr std::size_t maxKeys{256};
+
+    LatencyHistogramSet() noexcept;
+    ~LatencyHistogramSet();
+    LatencyHistogramSet(const LatencyHistogramSet&) = delete;
+    LatencyHistogramSet& operator=(const LatencyHistogramSet&) = delete;
+
+    /** get the histogram for a key, creating it if needed
+    @return nullptr if the set is full*/
+    LatencyHistogram* get(std::int32_t key);
+    /** call a function with each key and histogram in the set*/
+    template<class Callable>
+    void forEach(Callable&& func) const
+    {
+        for (std::size_t ii = 0; ii < maxKeys; ++ii) {
+            auto* hist = histograms[ii].load(std::memory_order_acquire);
+            if (hist != nullptr) {
+                func(static_cast<std::int32_t>(keys[ii].load(std::memory_order_relaxed)), *hist);
+            }
+        }
+    }
+    /** clear the values in all the histograms*/
+    void reset() noexcept;
+
+  private:
+    static constexpr std::int64_t emptyKey{(std::numeric_limits<std::int64_t>::min)()};
+    std::array<std::atomic<std::int64_t>, maxKeys> keys;
+    std::array<std::atomic<LatencyHistogram*>, maxKeys> histograms;
+};
+
+/** collection of latency histograms for the messages passing through a broker or core
+@details latencies are recorded for the time messages wait in the action queue and the time taken
+to process them by action type, and for the time outgoing messages wait for the transmit thread of
+the comms by route*/
+class LatencyTracker {
+  public:
+    /** get a timestamp for use with the tracker in ns*/
+    static std::int64_t now() noexcept;
+
+    /** record the time a message spent in the action queue*/
+    void recordQueue(action_message_def::action_t action,
+                     std::int64_t enqueueTime,
+                     std::int64_t dequeueTime);
+    /** record the time taken to process a message*/
+    void recordProcessing(action_message_def::action_t action,
+                          std::int64_t startTime,
+                          std::int64_t endTime);
+    /** record the time a message spent waiting in the transmit queue for a route*/
+    void recordTransmit(route_id rid, std::int64_t enqueueTime, std::int64_t sendTime);
+
+    /** load the histogram summaries into a json object*/
+    void loadJson(Json::Value& base) const;
+    /** clear all the recorded latencies*/
+    void reset() noexcept;
+
+  private:
+    LatencyHistogramSet queueLatency;
+    LatencyHistogramSet processingLatency;
+    LatencyHistogramSet transmitLatency;
+};
+}  // namespace helics
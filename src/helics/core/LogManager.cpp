@@ -20,10 +20,13 @@ SPDX-License-Identifier: BSD-3-Clause
 #include "ActionMessage.hpp"
 
 #include <iostream>
+#include <map>
 
 namespace helics {
 LogManager::~LogManager()
 {
+    // write out the queued messages while the loggers are still available
+    asyncQueue.reset();
     consoleLogger.reset();
     if (fileLogger) {
         spdlog::drop(logIdentifier);
@@ -54,13 +57,24 @@ void LogManager::initializeLogging(const std::string& identifier)
                 fileLogger = spdlog::basic_logger_mt(identifier, logFile);
             }
             if (fileLogger) {
-                fileLogger->flush_on(spdlog::level::info);
+                // the asynchronous writer flushes once per batch of messages
+                fileLogger->flush_on((asyncQueueSize > 0) ? spdlog::level::off :
+                                                            spdlog::level::info);
                 fileLogger->set_level(spdlog::level::trace);
             }
         }
         catch (const spdlog::spdlog_ex& ex) {
             std::cerr << "Log init failed in " << identifier << " : " << ex.what() << std::endl;
         }
+        if (asyncQueueSize > 0) {
+            asyncQueue = std::make_unique<AsyncLogQueue>(
+                asyncQueueSize,
+                overflowPolicy,
+                [this](const LogRecord& record) {
+                    writeLog(record.level, record.header, record.message, record.alwaysLog);
+                },
+                [this]() { flushLoggers(); });
+        }
     }
 }
 
@@ -118,38 +132,59 @@ bool LogManager::sendToLogger(int logLevel,
         }
     }
 
-    if (loggerFunction) {
+    const bool customLogger{static_cast<bool>(std::atomic_load(&loggerFunction))};
+    if (!customLogger && !initialized.load()) {
+        return false;
+    }
+    if (asyncQueue) {
+        asyncQueue->push(logLevel, header, message, alwaysLog);
+    } else {
+        writeLog(logLevel, header, message, alwaysLog);
+    }
+    return !customLogger;
+}
+
+void LogManager::writeLog(int logLevel,
+                          std::string_view header,
+                          std::string_view message,
+                          bool alwaysLog) const
+{
+    auto logFunction = std::atomic_load(&loggerFunction);
+    if (logFunction) {
         if (consoleLogLevel >= logLevel || fileLogLevel >= logLevel || alwaysLog) {
-            loggerFunction(logLevel, header, message);
+            (*logFunction)(logLevel, header, message);
+        }
+        return;
+    }
+    if (consoleLogLevel >= logLevel || alwaysLog) {
+        if (logLevel == HELICS_LOG_LEVEL_DUMPLOG) {  // dumplog
+            consoleLogger->log(spdlog::level::trace, "{}", message);
+        } else {
+            consoleLogger->log(getSpdLogLevel(logLevel), "{}::{}", header, message);
         }
-    } else if (initialized.load()) {
-        if (consoleLogLevel >= logLevel || alwaysLog) {
-            if (logLevel == HELICS_LOG_LEVEL_DUMPLOG) {  // dumplog
-                consoleLogger->log(spdlog::level::trace, "{}", message);
-            } else {
-                consoleLogger->log(getSpdLogLevel(logLevel), "{}::{}", header, message);
-            }
 
-            if (forceLoggingFlush) {
-                consoleLogger->flush();
-            }
+        if (forceLoggingFlush) {
+            consoleLogger->flush();
+        }
+    }
+    if (fileLogger && (fileLogLevel >= logLevel || alwaysLog)) {
+        if (logLevel == HELICS_LOG_LEVEL_DUMPLOG) {  // dumplog
+            fileLogger->log(spdlog::level::trace, "{}", message);
+        } else {
+            fileLogger->log(getSpdLogLevel(logLevel), "{}::{}", header, message);
         }
-        if (fileLogger && (fileLogLevel >= logLevel || alwaysLog)) {
-            if (logLevel == HELICS_LOG_LEVEL_DUMPLOG) {  // dumplog
-                fileLogger->log(spdlog::level::trace, "{}", message);
-            } else {
-                fileLogger->log(getSpdLogLevel(logLevel), "{}::{}", header, message);
-            }
 
-            if (forceLoggingFlush) {
-                fileLogger->flush();
-            }
+        if (forceLoggingFlush) {
+            fileLogger->flush();
         }
-        return true;
     }
-    return false;
 }
 
+static const std::map<std::string, LogOverflowPolicy> overflowPolicyMap{
+    {"block", LogOverflowPolicy::block},
+    {"drop_oldest", LogOverflowPolicy::drop_oldest},
+    {"drop_newest", LogOverflowPolicy::drop_newest}};
+
 void LogManager::addLoggingCLI(std::shared_ptr<helicsCLI11App>& app)
 {
     auto* logging_group =
@@ -196,13 +231,37 @@ void LogManager::addLoggingCLI(std::shared_ptr<helicsCLI11App>& app)
             "optionally specify the size of the circular buffer for storing log messages for later retrieval ")
         ->expected(0, 1)
         ->multi_option_policy(CLI::MultiOptionPolicy::TakeLast);
+    logging_group
+        ->add_flag_function(
+            fmt::format("--async_logging{{{}}}", AsyncLogQueue::cDefaultQueueSize),
+            [this](std::int64_t val) {
+                asyncQueueSize = (val > 0) ? static_cast<std::size_t>(val) : 0;
+            },
+            "write the log messages on a background thread, optionally specify the number of messages the queue holds")
+        ->expected(0, 1)
+        ->multi_option_policy(CLI::MultiOptionPolicy::TakeLast);
+    logging_group
+        ->add_option("--log_overflow_policy",
+                     overflowPolicy,
+                     "the action taken if the asynchronous log queue is full")
+        ->transform(
+            CLI::CheckedTransformer(&overflowPolicyMap, CLI::ignore_case, CLI::ignore_underscore));
     logging_group->callback([this]() { updateMaxLogLevel(); });
 }
 
 void LogManager::setLoggerFunction(
     std::function<void(int, std::string_view, std::string_view)> logFunction)
 {
-    loggerFunction = std::move(logFunction);
+    if (asyncQueue) {
+        // messages already queued go to the previous logging function
+        asyncQueue->flush();
+    }
+    std::shared_ptr<const LoggerFunction> newFunction;
+    if (logFunction) {
+        newFunction = std::make_shared<const LoggerFunction>(std::move(logFunction));
+    }
+    // the writer thread may be reading the function so it is swapped atomically
+    std::atomic_store(&loggerFunction, std::move(newFunction));
 }
 
 void LogManager::setLogLevel(int32_t level)
@@ -211,6 +270,16 @@ void LogManager::setLogLevel(int32_t level)
 }
 
 void LogManager::logFlush()
+{
+    if (asyncQueue) {
+        // the writer thread flushes the loggers once the queued messages are written
+        asyncQueue->flush();
+        return;
+    }
+    flushLoggers();
+}
+
+void LogManager::flushLoggers() const
 {
     if (consoleLogger) {
         consoleLogger->flush();
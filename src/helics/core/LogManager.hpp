@@ -11,6 +11,7 @@ SPDX-License-Identifier: BSD-3-Clause
 helper class for managing logging information
 */
 
+#include "../common/AsyncLogQueue.hpp"
 #include "../common/LogBuffer.hpp"
 #include "../helics_enums.h"
 #include "FederateIdExtra.hpp"
@@ -48,10 +49,18 @@ class LogManager {
     std::shared_ptr<spdlog::logger> fileLogger;
     std::atomic<bool> initialized{false};
     mutable LogBuffer mLogBuffer;  //!< object for buffering a set of log messages
-    /** a logging function for logging or printing messages*/
-    std::function<void(int, std::string_view, std::string_view)> loggerFunction;
+    using LoggerFunction = std::function<void(int, std::string_view, std::string_view)>;
+    /** a logging function for logging or printing messages, read by the asynchronous writer
+    thread through atomic loads*/
+    std::shared_ptr<const LoggerFunction> loggerFunction;
     std::function<void(ActionMessage&& mm)> mTransmit;
     std::string logFile;  //!< the file to log messages to
+    /// the size of the asynchronous log queue, 0 to write log messages on the calling thread
+    std::size_t asyncQueueSize{0};
+    /// the action taken if the asynchronous log queue is full
+    LogOverflowPolicy overflowPolicy{LogOverflowPolicy::block};
+    /// queue of log messages written out by a background thread
+    std::unique_ptr<AsyncLogQueue> asyncQueue;
 
   public:
     /// force the log to flush after every message
@@ -101,9 +110,18 @@ the source name and a string with the message
     void setLoggingFile(std::string_view lfile, const std::string& identifier);
     LogBuffer& getLogBuffer() { return mLogBuffer; }
     void updateRemote(GlobalFederateId destination, int level);
+    /** get the number of log messages dropped by the asynchronous log queue*/
+    std::uint64_t getDroppedLogCount() const { return asyncQueue ? asyncQueue->dropped() : 0; }
 
   private:
     void updateMaxLogLevel();
+    /** write a log message to the logging callback or the console and file loggers*/
+    void writeLog(int logLevel,
+                  std::string_view header,
+                  std::string_view message,
+                  bool alwaysLog) const;
+    /** flush the console and file loggers*/
+    void flushLoggers() const;
 };
 
 }  // namespace helics
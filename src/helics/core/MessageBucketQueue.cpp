@@ -0,0 +1,96 @@
+/*
+Copyright (c) 2017-2022,
+Battelle Memorial Institute; Lawrence Livermore National Security, LLC; Alliance for Sustainable
+Energy, LLC.  See the top-level NOTICE for additional details. All rights reserved.
+SPDX-License-Identifier: BSD-3-Clause
+*/
+#include "MessageBucketQueue.hpp"
+
+#include <algorithm>
+#include <utility>
+
+namespace helics {
+// messages with the same time are ordered by original source
+static bool sourceOrder(const std::unique_ptr<Message>& m1, const std::unique_ptr<Message>& m2)
+{
+    return m1->original_source < m2->original_source;
+}
+
+void MessageBucketQueue::push(std::unique_ptr<Message> message)
+{
+    auto& bucket = buckets[message->time];
+    auto& messages = bucket.messages;
+    if (bucket.size() > 0 && !bucket.unsorted && sourceOrder(message, messages.back())) {
+        if (bucket.head == 0) {
+            bucket.unsorted = true;
+            messages.push_back(std::move(message));
+        } else {
+            // messages were already taken from the bucket so it is sorted and must stay that way
+            auto location = std::upper_bound(messages.begin() + bucket.head,
+                                             messages.end(),
+                                             message,
+                                             sourceOrder);
+            messages.insert(location, std::move(message));
+        }
+    } else {
+        messages.push_back(std::move(message));
+    }
+    ++count;
+}
+
+std::unique_ptr<Message> MessageBucketQueue::pop()
+{
+    if (buckets.empty()) {
+        return nullptr;
+    }
+    auto first = buckets.begin();
+    auto& bucket = first->second;
+    if (bucket.unsorted) {
+        std::stable_sort(bucket.messages.begin(), bucket.messages.end(), sourceOrder);
+        bucket.unsorted = false;
+    }
+    auto message = std::move(bucket.messages[bucket.head]);
+    ++bucket.head;
+    --count;
+    if (bucket.head >= bucket.messages.size()) {
+        buckets.erase(first);
+    }
+    return message;
+}
+
+int32_t MessageBucketQueue::countThrough(Time maxTime) const
+{
+    if (buckets.empty() || maxTime >= buckets.rbegin()->first) {
+        return count;
+    }
+    int32_t total{0};
+    for (const auto& bucket : buckets) {
+        if (bucket.first > maxTime) {
+            break;
+        }
+        total += bucket.second.size();
+    }
+    return total;
+}
+
+int32_t MessageBucketQueue::countBefore(Time maxTime) const
+{
+    if (buckets.empty() || maxTime > buckets.rbegin()->first) {
+        return count;
+    }
+    int32_t total{0};
+    for (const auto& bucket : buckets) {
+        if (bucket.first >= maxTime) {
+            break;
+        }
+        total += bucket.second.size();
+    }
+    return total;
+}
+
+void MessageBucketQueue::clear()
+{
+    buckets.clear();
+    count = 0;
+}
+}  // namespace helics
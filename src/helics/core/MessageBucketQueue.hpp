@@ -0,0 +1,61 @@
+/*
+Copyright (c) 2017-2022,
+Battelle Memorial Institute; Lawrence Livermore National Security, LLC; Alliance for Sustainable
+Energy, LLC.  See the top-level NOTICE for additional details. All rights reserved.
+SPDX-License-Identifier: BSD-3-Clause
+*/
+#pragma once
+
+#include "core-data.hpp"
+
+#include <cstddef>
+#include <cstdint>
+#include <map>
+#include <memory>
+#include <vector>
+
+namespace helics {
+/** a queue of messages ordered by time then by original source
+@details messages are stored in a bucket for each distinct time, so adding a message costs a
+lookup of its time and the earliest message time and the size of the queue are known directly.
+Messages with the same time and original source stay in the order they were added.  The messages
+of a bucket are only sorted by original source when the first message is taken from it, which is
+a single sort for the usual case of all the messages for a time arriving before that time is
+granted.  The queue is not thread safe.
+*/
+class MessageBucketQueue {
+  public:
+    /** add a message to the queue*/
+    void push(std::unique_ptr<Message> message);
+    /** remove and return the first message, nullptr if the queue is empty*/
+    std::unique_ptr<Message> pop();
+    /** get the time of the first message, Time::maxVal() if the queue is empty*/
+    Time firstTime() const
+    {
+        return buckets.empty() ? Time::maxVal() : buckets.begin()->first;
+    }
+    /** get the number of messages with a time less than or equal to maxTime*/
+    int32_t countThrough(Time maxTime) const;
+    /** get the number of messages with a time less than maxTime*/
+    int32_t countBefore(Time maxTime) const;
+    /** get the number of messages in the queue*/
+    int32_t size() const { return count; }
+    /** check if the queue is empty*/
+    bool empty() const { return count == 0; }
+    /** remove all the messages*/
+    void clear();
+
+  private:
+    /** the messages with a single time*/
+    struct Bucket {
+        std::vector<std::unique_ptr<Message>> messages;
+        /// the index of the first message that has not been taken
+        std::size_t head{0};
+        /// the messages were not added in order of original source
+        bool unsorted{false};
+        int32_t size() const { return static_cast<int32_t>(messages.size() - head); }
+    };
+    std::map<Time, Bucket> buckets;
+    int32_t count{0};
+};
+}  // namespace helics
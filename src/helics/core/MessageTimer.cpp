@@ -12,19 +12,33 @@ SPDX-License-Identifier: BSD-3-Clause
 
 namespace helics {
 MessageTimer::MessageTimer(std::function<void(ActionMessage&&)> sFunction):
-    sendFunction(std::move(sFunction)),
+    wheel(std::chrono::milliseconds(1)), sendFunction(std::move(sFunction)),
     contextPtr(gmlc::networking::AsioContextManager::getContextPointer()),
-    loopHandle(contextPtr->startContextLoop())
+    loopHandle(contextPtr->startContextLoop()), timer(contextPtr->getBaseContext())
 {
 }
 
-static void processTimerCallback(const std::shared_ptr<MessageTimer>& mtimer,
-                                 int32_t index,
-                                 const std::error_code& ec)
+void MessageTimer::processTimers(const std::error_code& ec)
 {
-    if (ec != asio::error::operation_aborted) {
+    if (ec == asio::error::operation_aborted) {
+        return;
+    }
+    std::vector<ActionMessage> ready;
+    std::unique_lock<std::mutex> lock(timerLock);
+    wakeTime = time_type::max();
+    expired.clear();
+    wheel.advance(std::chrono::steady_clock::now(), expired);
+    for (auto index : expired) {
+        if (buffers[index].action() != CMD_IGNORE) {
+            ready.push_back(std::move(buffers[index]));
+            buffers[index].setAction(CMD_IGNORE);  // clear out the action
+        }
+    }
+    scheduleWake();
+    lock.unlock();  // don't keep a lock while calling a callback
+    for (auto& mess : ready) {
         try {
-            mtimer->sendMessage(index);
+            sendFunction(std::move(mess));
         }
         catch (std::exception& e) {
             std::cerr << "exception caught from sendMessage:" << e.what() << std::endl;
@@ -32,6 +46,27 @@ static void processTimerCallback(const std::shared_ptr<MessageTimer>& mtimer,
     }
 }
 
+void MessageTimer::scheduleWake()
+{
+    auto next = wheel.nextWakeTime();
+    if (next == time_type::max()) {
+        if (wakeTime != time_type::max()) {
+            // release the reference held by the pending wait
+            timer.cancel();
+            wakeTime = time_type::max();
+        }
+        return;
+    }
+    if (next >= wakeTime) {
+        // an earlier wake up will reschedule the timer
+        return;
+    }
+    wakeTime = next;
+    timer.expires_at(next);
+    timer.async_wait(
+        [ptr = shared_from_this()](const std::error_code& ec) { ptr->processTimers(ec); });
+}
+
 int32_t MessageTimer::addTimerFromNow(std::chrono::nanoseconds time, ActionMessage mess)
 {
     return addTimer(std::chrono::steady_clock::now() + time, std::move(mess));
@@ -39,24 +74,29 @@ int32_t MessageTimer::addTimerFromNow(std::chrono::nanoseconds time, ActionMessa
 
 int32_t MessageTimer::addTimer(time_type expirationTime, ActionMessage mess)
 {
-    // these two calls need to be before the lock
-    auto timer = std::make_shared<asio::steady_timer>(contextPtr->getBaseContext());
-    timer->expires_at(expirationTime);
-
     std::unique_lock<std::mutex> lock(timerLock);
-
-    auto index = static_cast<int32_t>(timers.size());
-    auto timerCallback = [ptr = shared_from_this(), index](const std::error_code& ec) {
-        processTimerCallback(ptr, index, ec);
-    };
-    buffers.push_back(std::move(mess));
-    expirationTimes.push_back(expirationTime);
-    timers.push_back(std::move(timer));
+    if (wheel.scheduledCount() == 0) {
+        // bring an idle wheel up to date so the new timer lands in the lowest level possible
+        expired.clear();
+        wheel.advance(std::chrono::steady_clock::now(), expired);
+    }
+    auto index = wheel.add(expirationTime);
+    if (index >= static_cast<int32_t>(buffers.size())) {
+        buffers.resize(static_cast<std::size_t>(index) + 1);
+    }
     if (expirationTime > std::chrono::steady_clock::now()) {
-        timers.back()->async_wait(timerCallback);
+        buffers[index] = std::move(mess);
+        scheduleWake();
     } else {
+        wheel.cancel(index);
+        buffers[index].setAction(CMD_IGNORE);
         lock.unlock();
-        timerCallback(std::error_code{});
+        try {
+            sendFunction(std::move(mess));
+        }
+        catch (std::exception& e) {
+            std::cerr << "exception caught from sendMessage:" << e.what() << std::endl;
+        }
     }
 
     return index;
@@ -65,36 +105,40 @@ int32_t MessageTimer::addTimer(time_type expirationTime, ActionMessage mess)
 void MessageTimer::cancelTimer(int32_t index)
 {
     std::lock_guard<std::mutex> lock(timerLock);
-    if ((index >= 0) && (index < static_cast<int32_t>(timers.size()))) {
+    if (wheel.isValid(index)) {
         buffers[index].setAction(CMD_IGNORE);
-        timers[index]->cancel();
+        wheel.cancel(index);
+        scheduleWake();
     }
 }
 
-void MessageTimer::cancelAll()
+void MessageTimer::releaseTimer(int32_t index)
 {
     std::lock_guard<std::mutex> lock(timerLock);
-    for (auto& buf : buffers) {
-        buf.setAction(CMD_IGNORE);
+    if (wheel.isValid(index)) {
+        buffers[index].setAction(CMD_IGNORE);
+        wheel.release(index);
+        scheduleWake();
     }
-    for (auto& tmr : timers) {
-        tmr->cancel();
+}
+
+void MessageTimer::cancelAll()
+{
+    std::lock_guard<std::mutex> lock(timerLock);
+    for (std::size_t index = 0; index < buffers.size(); ++index) {
+        buffers[index].setAction(CMD_IGNORE);
+        wheel.cancel(static_cast<int32_t>(index));
     }
+    scheduleWake();
 }
 
 void MessageTimer::updateTimer(int32_t timerIndex, time_type expirationTime, ActionMessage mess)
 {
     std::lock_guard<std::mutex> lock(timerLock);
-    if ((timerIndex >= 0) && (timerIndex < static_cast<int32_t>(timers.size()))) {
-        timers[timerIndex]->expires_at(expirationTime);
-        expirationTimes[timerIndex] = expirationTime;
+    if (wheel.isValid(timerIndex)) {
         buffers[timerIndex] = std::move(mess);
-
-        auto timerCallback = [ptr = shared_from_this(), timerIndex](const std::error_code& ec) {
-            processTimerCallback(ptr, timerIndex, ec);
-        };
-
-        timers[timerIndex]->async_wait(timerCallback);
+        wheel.update(timerIndex, expirationTime);
+        scheduleWake();
     }
 }
 
@@ -108,16 +152,10 @@ void MessageTimer::updateTimerFromNow(int32_t timerIndex,
 bool MessageTimer::addTimeToTimer(int32_t timerIndex, std::chrono::nanoseconds time)
 {
     std::lock_guard<std::mutex> lock(timerLock);
-    if ((timerIndex >= 0) && (timerIndex < static_cast<int32_t>(timers.size()))) {
-        auto newTime = timers[timerIndex]->expires_at() + time;
-        timers[timerIndex]->expires_at(newTime);
-        auto timerCallback = [ptr = shared_from_this(), timerIndex](const std::error_code& ec) {
-            processTimerCallback(ptr, timerIndex, ec);
-        };
-        expirationTimes[timerIndex] = newTime;
-        auto ret = (buffers[timerIndex].action() != CMD_IGNORE);
-        timers[timerIndex]->async_wait(timerCallback);
-        return ret;
+    if (wheel.isValid(timerIndex)) {
+        wheel.update(timerIndex, wheel.expiration(timerIndex) + time);
+        scheduleWake();
+        return (buffers[timerIndex].action() != CMD_IGNORE);
     }
     return false;
 }
@@ -125,15 +163,10 @@ bool MessageTimer::addTimeToTimer(int32_t timerIndex, std::chrono::nanoseconds t
 bool MessageTimer::updateTimer(int32_t timerIndex, time_type expirationTime)
 {
     std::lock_guard<std::mutex> lock(timerLock);
-    if ((timerIndex >= 0) && (timerIndex < static_cast<int32_t>(timers.size()))) {
-        timers[timerIndex]->expires_at(expirationTime);
-        auto timerCallback = [ptr = shared_from_this(), timerIndex](const std::error_code& ec) {
-            processTimerCallback(ptr, timerIndex, ec);
-        };
-        expirationTimes[timerIndex] = expirationTime;
-        auto ret = (buffers[timerIndex].action() != CMD_IGNORE);
-        timers[timerIndex]->async_wait(timerCallback);
-        return ret;
+    if (wheel.isValid(timerIndex)) {
+        wheel.update(timerIndex, expirationTime);
+        scheduleWake();
+        return (buffers[timerIndex].action() != CMD_IGNORE);
     }
     return false;
 }
@@ -142,7 +175,7 @@ bool MessageTimer::updateTimer(int32_t timerIndex, time_type expirationTime)
 void MessageTimer::updateMessage(int32_t timerIndex, ActionMessage mess)
 {
     std::lock_guard<std::mutex> lock(timerLock);
-    if ((timerIndex >= 0) && (timerIndex < static_cast<int32_t>(timers.size()))) {
+    if (wheel.isValid(timerIndex)) {
         buffers[timerIndex] = std::move(mess);
     }
 }
@@ -150,11 +183,12 @@ void MessageTimer::updateMessage(int32_t timerIndex, ActionMessage mess)
 void MessageTimer::sendMessage(int32_t timerIndex)
 {
     std::unique_lock<std::mutex> lock(timerLock);
-    if ((timerIndex >= 0) && (timerIndex < static_cast<int32_t>(timers.size()))) {
-        if (std::chrono::steady_clock::now() >= expirationTimes[timerIndex]) {
+    if (wheel.isValid(timerIndex)) {
+        if (std::chrono::steady_clock::now() >= wheel.expiration(timerIndex)) {
             if (buffers[timerIndex].action() != CMD_IGNORE) {
                 ActionMessage buf = std::move(buffers[timerIndex]);
                 buffers[timerIndex].setAction(CMD_IGNORE);  // clear out the action
+                wheel.cancel(timerIndex);
                 lock.unlock();  // don't keep a lock while calling a callback
                 sendFunction(std::move(buf));
             }
@@ -6,6 +6,7 @@ SPDX-License-Identifier: BSD-3-Clause
 */
 #pragma once
 
+#include "../common/TimerWheel.hpp"
 #include "ActionMessage.hpp"
 #include "gmlc/networking/AsioContextManager.h"
 
@@ -16,7 +17,9 @@ SPDX-License-Identifier: BSD-3-Clause
 
 namespace helics {
 /** class containing a message timer for sending messages at particular points in time
- */
+@details the timers are kept in a timer wheel with a resolution of 1 ms driven by a single asio
+timer, so adding, updating, and cancelling a timer takes constant time, messages are sent no more
+than 1 ms after their expiration time*/
 class MessageTimer: public std::enable_shared_from_this<MessageTimer> {
   public:
     using time_type = decltype(std::chrono::steady_clock::now());
@@ -29,6 +32,8 @@ class MessageTimer: public std::enable_shared_from_this<MessageTimer> {
     int32_t addTimer(time_type expirationTime, ActionMessage mess);
     /** cancel a timer by index*/
     void cancelTimer(int32_t index);
+    /** cancel a timer and allow its index to be reused by a later timer*/
+    void releaseTimer(int32_t index);
     /** cancel all timers*/
     void cancelAll();
     /** update the message time of a timer and its message*/
@@ -47,17 +52,24 @@ class MessageTimer: public std::enable_shared_from_this<MessageTimer> {
     void updateMessage(int32_t timerIndex, ActionMessage mess);
     /** execute the send function associated with a message*/
     void sendMessage(int32_t timerIndex);
+    /** process the timers that have expired, called from the asio timer*/
+    void processTimers(const std::error_code& ec);
 
   private:
-    std::mutex timerLock;  //!< lock protecting the timer buffers
+    /** set the asio timer for the next time the wheel needs to advance, the lock must be held*/
+    void scheduleWake();
+
+    std::mutex timerLock;  //!< lock protecting the timer wheel and buffers
+    TimerWheel wheel;
     std::vector<ActionMessage> buffers;
-    std::vector<time_type> expirationTimes;
+    std::vector<std::int32_t> expired;  //!< scratch space for the expired timers
     /** the callback to use when sending a message */
     const std::function<void(ActionMessage&&)> sendFunction;
-    std::vector<std::shared_ptr<asio::steady_timer>> timers;
     /** context manager to use for handling real time operations */
     std::shared_ptr<gmlc::networking::AsioContextManager> contextPtr;
     /** loop controller for async real time operations */
     decltype(contextPtr->startContextLoop()) loopHandle;
+    asio::steady_timer timer;  //!< the timer driving the wheel
+    time_type wakeTime{time_type::max()};  //!< the time the asio timer is set for
 };
 }  // namespace helics
@@ -7,6 +7,10 @@ SPDX-License-Identifier: BSD-3-Clause
 
 #include "PublicationInfo.hpp"
 
+#include "ActionMessage.hpp"
+#include "DeltaEncoding.hpp"
+#include "flagOperations.hpp"
+
 #include <algorithm>
 #include <string_view>
 
@@ -28,6 +32,8 @@ bool PublicationInfo::addSubscriber(GlobalHandle newSubscriber)
         }
     }
     subscribers.push_back(newSubscriber);
+    // the new subscriber has no value to apply a patch to
+    delta_resync = true;
     return true;
 }
 
@@ -37,4 +43,32 @@ void PublicationInfo::removeSubscriber(GlobalHandle subscriberToRemove)
                       subscribers.end());
 }
 
+void PublicationInfo::setDeltaEncoding(bool enabled)
+{
+    delta_encoding = enabled;
+    delta_resync = true;
+    if (!enabled) {
+        delta_base = SmallBuffer();
+    }
+}
+
+bool PublicationInfo::encodeDelta(std::string_view value, ActionMessage& mv)
+{
+    const bool patched = !delta_resync &&
+        encodeValuePatch(delta_base.to_string(), value, delta_sequence, mv.payload);
+    ++delta_sequence;
+    mv.messageID = static_cast<int32_t>(delta_sequence);
+    if (patched) {
+        // updating the stored value with the patch only touches the words that changed
+        applyValuePatch(delta_base, mv.payload.to_string());
+        setActionFlag(mv, delta_patch_flag);
+        return true;
+    }
+    mv.payload = value;
+    delta_base = value;
+    delta_resync = false;
+    setActionFlag(mv, delta_base_flag);
+    return false;
+}
+
 }  // namespace helics
@@ -7,12 +7,16 @@ SPDX-License-Identifier: BSD-3-Clause
 #pragma once
 
 #include "GlobalFederateId.hpp"
+#include "SmallBuffer.hpp"
 
 #include <cstdint>
 #include <string>
+#include <string_view>
 #include <vector>
 
 namespace helics {
+class ActionMessage;
+
 /** data class containing the information about a publication*/
 class PublicationInfo {
   public:
@@ -35,6 +39,7 @@ class PublicationInfo {
     bool only_update_on_change{false};
     bool required{false};  //!< indicator that it is required to be output someplace
     bool buffer_data{false};  //!< indicator that the publication should buffer data
+    bool delta_encoding{false};  //!< indicator that values are sent as patches when smaller
     int32_t required_connections{0};  //!< the number of required connections 0 is no requirement
     /** check the value if it is the same as the most recent data and if changed, store it*/
     bool CheckSetValue(const char* dataToCheck, uint64_t len);
@@ -45,5 +50,21 @@ class PublicationInfo {
 
     /** remove a subscriber*/
     void removeSubscriber(GlobalHandle subscriberToRemove);
+    /** turn the delta encoding of the values on or off*/
+    void setDeltaEncoding(bool enabled);
+    /** generate the payload to transmit a value with delta encoding
+    @details sets the payload, the delta encoding flag and the sequence number of the value on
+    the message
+    @param value the new value of the publication
+    @param mv the message to place the patch or the full value in
+    @return true if the payload is a patch against the previously transmitted value*/
+    bool encodeDelta(std::string_view value, ActionMessage& mv);
+    /** send the next value in full, used when a subscriber could not apply a patch*/
+    void requestDeltaResync() { delta_resync = true; }
+
+  private:
+    SmallBuffer delta_base;  //!< the last value transmitted with delta encoding
+    std::uint32_t delta_sequence{0};  //!< the sequence number of the last value transmitted
+    bool delta_resync{true};  //!< indicator that the next value must be sent in full
 };
 }  // namespace helics
@@ -6,6 +6,12 @@ SPDX-License-Identifier: BSD-3-Clause
 */
 #pragma once
 
+#include "helics/helics-config.h"
+
+#ifdef HELICS_ENABLE_BUFFER_POOL
+#    include "BufferPool.hpp"
+#endif
+
 #include <array>
 #include <cstddef>
 #include <cstring>
@@ -77,7 +83,7 @@ class SmallBuffer {
     ~SmallBuffer()
     {
         if (usingAllocatedBuffer && !nonOwning) {
-            delete[] heap;
+            freeHeap();
         }
     }
     SmallBuffer& operator=(const SmallBuffer& sb)
@@ -103,7 +109,7 @@ class SmallBuffer {
                     bufferSize = sb.bufferSize;
                     return *this;
                 }
-                delete[] heap;
+                freeHeap();
             }
         }
         if (sb.usingAllocatedBuffer) {
@@ -245,7 +251,7 @@ class SmallBuffer {
         auto* newHeap = reinterpret_cast<std::byte*>(data);
         if (usingAllocatedBuffer && !nonOwning) {
             if (newHeap != heap) {
-                delete[] heap;
+                freeHeap();
             }
         }
         heap = newHeap;
@@ -267,7 +273,7 @@ class SmallBuffer {
                 bufferCapacity = capacity;
                 return;
             }
-            delete[] heap;
+            freeHeap();
         }
         locked = false;
         heap = newHeap;
@@ -296,15 +302,21 @@ class SmallBuffer {
             if (size > bigSize || locked) {
                 throw(std::bad_alloc());
             }
-            auto* ndata = new std::byte[size + 8];
+#ifdef HELICS_ENABLE_BUFFER_POOL
+            std::size_t newCapacity{0};
+            auto* ndata = pool::allocateBlock(size + 8, newCapacity);
+#else
+            const std::size_t newCapacity{size + 8};
+            auto* ndata = new std::byte[newCapacity];
+#endif
             std::memcpy(ndata, heap, bufferSize);
             if (usingAllocatedBuffer && !nonOwning) {
-                delete[] heap;
+                freeHeap();
             }
             heap = ndata;
             nonOwning = false;
             usingAllocatedBuffer = true;
-            bufferCapacity = size + 8;
+            bufferCapacity = newCapacity;
         }
     }
     void lock(bool lockStatus = true) { locked = lockStatus; }
@@ -373,6 +385,16 @@ class SmallBuffer {
     }
 
   private:
+    /** free the owned heap memory, the caller is responsible for resetting the pointer*/
+    void freeHeap() noexcept
+    {
+#ifdef HELICS_ENABLE_BUFFER_POOL
+        pool::releaseBlock(heap, bufferCapacity);
+#else
+        delete[] heap;
+#endif
+    }
+
     std::array<std::byte, 64> buffer{{std::byte{0}}};
     std::size_t bufferSize{0};
     std::size_t bufferCapacity{64};
@@ -153,6 +153,7 @@ static DependencyProcessingResult processMessage(const ActionMessage& m, Depende
             break;
         case CMD_SEND_MESSAGE:
         case CMD_PUB:
+        case CMD_PUB_FANOUT:
             dep.hasData = true;
             break;
         case CMD_REQUEST_CURRENT_TIME:
@@ -338,16 +339,69 @@ DependencyInfo* TimeDependencies::getDependencyInfo(GlobalFederateId id)
     if ((res == dependencies.end()) || (res->fedID != id)) {
         return nullptr;
     }
-
+    markModified(static_cast<std::size_t>(res - dependencies.begin()));
     return &(*res);
 }
 
+void TimeDependencies::markModified(std::size_t index) const
+{
+    if (mIndices.empty()) {
+        return;
+    }
+    if (mModified.size() >= dependencies.size()) {
+        // rebuilding is cheaper than a large number of individual updates
+        clearIndices();
+        return;
+    }
+    mModified.push_back(index);
+}
+
+void TimeDependencies::clearIndices() const
+{
+    mIndices.clear();
+    mModified.clear();
+}
+
+bool TimeDependencies::generateIndexedMinTime(TimeData& mTime,
+                                              std::int32_t& sequenceTotal,
+                                              DependencySubset subset,
+                                              GlobalFederateId self,
+                                              GlobalFederateId ignore,
+                                              std::int32_t sequenceCode) const
+{
+    // the number of distinct subset and self combinations is small in practice
+    static constexpr std::size_t maxIndices{6};
+    if (dependencies.size() < mIndexThreshold) {
+        clearIndices();
+        return false;
+    }
+    for (auto index : mModified) {
+        for (auto& depIndex : mIndices) {
+            depIndex.update(dependencies, index);
+        }
+    }
+    mModified.clear();
+    auto match = std::find_if(mIndices.begin(), mIndices.end(), [subset, self](const auto& index) {
+        return index.matches(subset, self);
+    });
+    if (match == mIndices.end()) {
+        if (mIndices.size() >= maxIndices) {
+            mIndices.erase(mIndices.begin());
+        }
+        mIndices.emplace_back(subset, self);
+        mIndices.back().rebuild(dependencies);
+        match = mIndices.end() - 1;
+    }
+    return match->generate(mTime, sequenceTotal, dependencies, ignore, sequenceCode);
+}
+
 bool TimeDependencies::addDependency(GlobalFederateId id)
 
 {
     if (dependencies.empty()) {
         dependencies.emplace_back(id);
         dependencies.back().dependency = true;
+        clearIndices();
         return true;
     }
     auto dep = std::lower_bound(dependencies.begin(), dependencies.end(), id, dependencyCompare);
@@ -358,12 +412,14 @@ bool TimeDependencies::addDependency(GlobalFederateId id)
         if (dep->fedID == id) {
             auto rval = dep->dependency;
             dep->dependency = true;
+            clearIndices();
             // the dependency is already present
             return !rval;
         }
         auto it = dependencies.emplace(dep, id);
         it->dependency = true;
     }
+    clearIndices();
     return true;
 }
 
@@ -376,6 +432,7 @@ void TimeDependencies::removeDependency(GlobalFederateId id)
             if (!dep->dependent) {
                 dependencies.erase(dep);
             }
+            clearIndices();
         }
     }
 }
@@ -386,6 +443,7 @@ bool TimeDependencies::addDependent(GlobalFederateId id)
     if (dependencies.empty()) {
         dependencies.emplace_back(id);
         dependencies.back().dependent = true;
+        clearIndices();
         return true;
     }
     auto dep = std::lower_bound(dependencies.begin(), dependencies.end(), id, dependencyCompare);
@@ -396,12 +454,14 @@ bool TimeDependencies::addDependent(GlobalFederateId id)
         if (dep->fedID == id) {
             auto rval = dep->dependent;
             dep->dependent = true;
+            clearIndices();
             // the dependency is already present
             return !rval;
         }
         auto it = dependencies.emplace(dep, id);
         it->dependent = true;
     }
+    clearIndices();
     return true;
 }
 
@@ -414,6 +474,7 @@ void TimeDependencies::removeDependent(GlobalFederateId id)
             if (!dep->dependency) {
                 dependencies.erase(dep);
             }
+            clearIndices();
         }
     }
 }
@@ -424,6 +485,7 @@ void TimeDependencies::removeInterdependence(GlobalFederateId id)
     if (dep != dependencies.end()) {
         if (dep->fedID == id) {
             dependencies.erase(dep);
+            clearIndices();
         }
     }
 }
@@ -614,8 +676,10 @@ GlobalFederateId TimeDependencies::getMinDependency() const
 
 void TimeDependencies::resetIteratingExecRequests()
 {
-    for (auto& dep : dependencies) {
+    for (std::size_t ii = 0; ii < dependencies.size(); ++ii) {
+        auto& dep = dependencies[ii];
         if (dep.dependency && dep.mTimeState <= TimeState::exec_requested_iterative) {
+            markModified(ii);
             dep.mTimeState = TimeState::initialized;
             dep.grantedIteration = dep.sequenceCounter;
             dep.sequenceCounter = 0;
@@ -628,9 +692,11 @@ void TimeDependencies::resetIteratingExecRequests()
 
 void TimeDependencies::resetIteratingTimeRequests(helics::Time requestTime)
 {
-    for (auto& dep : dependencies) {
+    for (std::size_t ii = 0; ii < dependencies.size(); ++ii) {
+        auto& dep = dependencies[ii];
         if (dep.dependency && dep.mTimeState == TimeState::time_requested_iterative) {
             if (dep.next == requestTime) {
+                markModified(ii);
                 dep.mTimeState = TimeState::time_granted;
                 dep.Te = requestTime;
                 dep.minDe = requestTime;
@@ -647,6 +713,7 @@ void TimeDependencies::resetDependentEvents(helics::Time grantTime)
             dep.minDe = dep.Te;
         }
     }
+    clearIndices();
 }
 
 std::pair<int, std::string> TimeDependencies::checkForIssues(bool waiting) const
@@ -725,7 +792,7 @@ static void generateMinTimeImplementation(TimeData& mTime,
         } else {
             // this minimum dependent event time received was invalid and can't be trusted
             // therefore it can't be used to determine a time grant
-            mTime.minDe = -1;
+            mTime.minDe = invalidDependentEvent;
         }
     } else if (dep.responseSequenceCounter == sequenceCode && dep.dependent) {
         if (dep.minDe >= dep.next && dep.minDe < mTime.minDe) {
@@ -819,18 +886,21 @@ TimeData generateMinTimeUpstream(const TimeDependencies& dependencies,
 {
     TimeData mTime(Time::maxVal(), TimeState::error);
     std::int32_t iterationCount{0};
-    for (const auto& dep : dependencies) {
-        if (!dep.dependency) {
-            continue;
-        }
-        if (dep.connection == ConnectionType::parent) {
-            continue;
-        }
-        if (self.isValid() && dep.minFedActual == self) {
-            continue;
+    if (!dependencies.generateIndexedMinTime(
+            mTime, iterationCount, DependencySubset::upstream, self, ignore, responseCode)) {
+        for (const auto& dep : dependencies) {
+            if (!dep.dependency) {
+                continue;
+            }
+            if (dep.connection == ConnectionType::parent) {
+                continue;
+            }
+            if (self.isValid() && dep.minFedActual == self) {
+                continue;
+            }
+            iterationCount += dep.sequenceCounter;
+            generateMinTimeImplementation(mTime, dep, ignore, responseCode);
         }
-        iterationCount += dep.sequenceCounter;
-        generateMinTimeImplementation(mTime, dep, ignore, responseCode);
     }
     if (mTime.Te < mTime.minDe) {
         mTime.minDe = mTime.Te;
@@ -857,17 +927,21 @@ TimeData generateMinTimeDownstream(const TimeDependencies& dependencies,
                                    std::int32_t responseCode)
 {
     TimeData mTime(Time::maxVal(), TimeState::error);
-    for (const auto& dep : dependencies) {
-        if (!dep.dependency) {
-            continue;
-        }
-        if (dep.connection != ConnectionType::parent) {
-            continue;
-        }
-        if (self.isValid() && dep.minFedActual == self) {
-            continue;
+    std::int32_t iterationCount{0};
+    if (!dependencies.generateIndexedMinTime(
+            mTime, iterationCount, DependencySubset::downstream, self, ignore, responseCode)) {
+        for (const auto& dep : dependencies) {
+            if (!dep.dependency) {
+                continue;
+            }
+            if (dep.connection != ConnectionType::parent) {
+                continue;
+            }
+            if (self.isValid() && dep.minFedActual == self) {
+                continue;
+            }
+            generateMinTimeImplementation(mTime, dep, ignore, responseCode);
         }
-        generateMinTimeImplementation(mTime, dep, ignore, responseCode);
     }
     if (mTime.Te < mTime.minDe) {
         mTime.minDe = mTime.Te;
@@ -899,15 +973,19 @@ TimeData generateMinTimeTotal(const TimeDependencies& dependencies,
                               std::int32_t responseCode)
 {
     TimeData mTime(Time::maxVal(), TimeState::error);
-    for (const auto& dep : dependencies) {
-        if (!dep.dependency) {
-            continue;
-        }
+    std::int32_t iterationCount{0};
+    if (!dependencies.generateIndexedMinTime(
+            mTime, iterationCount, DependencySubset::total, self, ignore, responseCode)) {
+        for (const auto& dep : dependencies) {
+            if (!dep.dependency) {
+                continue;
+            }
 
-        if (self.isValid() && dep.minFedActual == self) {
-            continue;
+            if (self.isValid() && dep.minFedActual == self) {
+                continue;
+            }
+            generateMinTimeImplementation(mTime, dep, ignore, responseCode);
         }
-        generateMinTimeImplementation(mTime, dep, ignore, responseCode);
     }
 
     if (mTime.Te < mTime.minDe) {
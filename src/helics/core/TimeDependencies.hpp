@@ -6,6 +6,7 @@ SPDX-License-Identifier: BSD-3-Clause
 */
 #pragma once
 
+#include "TimeDependencyIndex.hpp"
 #include "basic_CoreTypes.hpp"
 
 #include "json/forwards.h"
@@ -116,6 +117,11 @@ class TimeDependencies {
   private:
     std::vector<DependencyInfo> dependencies;  //!< container
     mutable GlobalFederateId mDelayedDependency{};
+    /// incremental indices of the minimum times for large dependency sets
+    mutable std::vector<TimeDependencyIndex> mIndices;
+    /// positions of dependencies modified since the indices were last updated
+    mutable std::vector<std::size_t> mModified;
+    std::size_t mIndexThreshold{64};  //!< the number of dependencies before using the indices
 
   public:
     /** default constructor*/
@@ -140,10 +146,6 @@ class TimeDependencies {
     DependencyProcessingResult updateTime(const ActionMessage& m);
     /** get the number of dependencies*/
     auto size() const { return dependencies.size(); }
-    /** iterator to first dependency*/
-    auto begin() { return dependencies.begin(); }
-    /** iterator to end point*/
-    auto end() { return dependencies.end(); }
     /**  const iterator to first dependency*/
     auto begin() const { return dependencies.cbegin(); }
     /** const iterator to end point*/
@@ -158,7 +160,9 @@ class TimeDependencies {
     /** get a pointer to the dependency information for a particular object*/
     const DependencyInfo* getDependencyInfo(GlobalFederateId id) const;
 
-    /** get a pointer to the dependency information for a particular object*/
+    /** get a pointer to the dependency information for a particular object
+    @details the dependency is assumed to be modified through the pointer before the next minimum
+    time generation*/
     DependencyInfo* getDependencyInfo(GlobalFederateId id);
 
     /** check if the dependencies would allow entry to exec mode*/
@@ -189,13 +193,38 @@ class TimeDependencies {
     /** get a count of the active dependencies*/
     GlobalFederateId getMinDependency() const;
 
-    void setDependencyVector(const std::vector<DependencyInfo>& deps) { dependencies = deps; }
+    void setDependencyVector(const std::vector<DependencyInfo>& deps)
+    {
+        dependencies = deps;
+        clearIndices();
+    }
+    /** set the number of dependencies at which the minimum times are generated from incrementally
+    updated indices instead of a scan of all the dependencies*/
+    void setIndexThreshold(std::size_t threshold) { mIndexThreshold = threshold; }
+    /** generate the aggregate time data of a subset of dependencies from the incremental indices
+    @details the results are identical to a scan of the dependencies through
+    generateMinTimeImplementation
+    @param mTime the time data to load
+    @param sequenceTotal loaded with the sum of the sequence counters in the subset
+    @return false if the indices are not used for the current dependencies*/
+    bool generateIndexedMinTime(TimeData& mTime,
+                                std::int32_t& sequenceTotal,
+                                DependencySubset subset,
+                                GlobalFederateId self,
+                                GlobalFederateId ignore,
+                                std::int32_t sequenceCode) const;
     /** check the dependency set for any issues
     @return an error code and string containing an error description */
     std::pair<int, std::string> checkForIssues(bool waiting) const;
 
     bool hasDelayedDependency() const { return mDelayedDependency.isValid(); }
     GlobalFederateId delayedDependency() const { return mDelayedDependency; }
+
+  private:
+    /** drop the indices after a change in the structure of the dependencies*/
+    void clearIndices() const;
+    /** record a modification to a dependency for the next update of the indices*/
+    void markModified(std::size_t index) const;
 };
 
 inline bool checkSequenceCounter(const DependencyInfo& dep, Time tmin, std::int32_t sq)
@@ -0,0 +1,382 @@
+/*
+Copyright (c) 2017-2022,
+Battelle Memorial Institute; Lawrence Livermore National Security, LLC; Alliance for Sustainable
+Energy, LLC.  See the top-level NOTICE for additional details. All rights reserved.
+SPDX-License-Identifier: BSD-3-Clause
+*/
+
+#include "TimeDependencyIndex.hpp"
+
+#include "TimeDependencies.hpp"
+
+#include <algorithm>
+
+namespace helics {
+
+TimeDependencyIndex::TimeDependencyIndex(DependencySubset subset, GlobalFederateId self):
+    mSubset(subset), mSelf(self)
+{
+}
+
+bool TimeDependencyIndex::isIncluded(const DependencyInfo& dep) const
+{
+    if (!dep.dependency) {
+        return false;
+    }
+    if (mSelf.isValid() && dep.minFedActual == mSelf) {
+        return false;
+    }
+    switch (mSubset) {
+        case DependencySubset::upstream:
+            return dep.connection != ConnectionType::parent;
+        case DependencySubset::downstream:
+            return dep.connection == ConnectionType::parent;
+        case DependencySubset::total:
+        default:
+            return true;
+    }
+}
+
+TimeDependencyIndex::Node TimeDependencyIndex::makeLeaf(const DependencyInfo& dep,
+                                                        std::size_t index)
+{
+    Node leaf;
+    leaf.empty = false;
+    leaf.next = dep.next;
+    leaf.nextFirst = static_cast<std::uint32_t>(index);
+    leaf.nextGranted = (dep.mTimeState == TimeState::time_granted);
+    leaf.nextFirstInterrupted = (!leaf.nextGranted && dep.interrupted);
+    leaf.nextRestInterrupted = true;
+    leaf.Te = dep.Te;
+    leaf.TeFirst = static_cast<std::uint32_t>(index);
+    leaf.hasRecord = dep.minFed.isValid();
+    leaf.recordTe = dep.Te;
+    leaf.recordFed = dep.minFed;
+    return leaf;
+}
+
+TimeDependencyIndex::Node TimeDependencyIndex::combine(const Node& left, const Node& right)
+{
+    if (left.empty) {
+        return right;
+    }
+    if (right.empty) {
+        return left;
+    }
+    Node res;
+    res.empty = false;
+    // the next time takes the first minimum and tracks the granted and interrupted states of the
+    // following equal times
+    if (right.next < left.next) {
+        res.next = right.next;
+        res.nextFirst = right.nextFirst;
+        res.nextGranted = right.nextGranted;
+        res.nextFirstInterrupted = right.nextFirstInterrupted;
+        res.nextRestInterrupted = right.nextRestInterrupted;
+    } else if (left.next < right.next) {
+        res.next = left.next;
+        res.nextFirst = left.nextFirst;
+        res.nextGranted = left.nextGranted;
+        res.nextFirstInterrupted = left.nextFirstInterrupted;
+        res.nextRestInterrupted = left.nextRestInterrupted;
+    } else {
+        res.next = left.next;
+        res.nextFirst = left.nextFirst;
+        res.nextGranted = left.nextGranted || right.nextGranted;
+        res.nextFirstInterrupted = left.nextFirstInterrupted;
+        res.nextRestInterrupted = left.nextRestInterrupted && right.nextFirstInterrupted &&
+            right.nextRestInterrupted;
+    }
+    // the event time tracks the minimum before the first minimum for the alternate event time
+    if (right.Te < left.Te) {
+        res.Te = right.Te;
+        res.TeFirst = right.TeFirst;
+        res.TeTie = right.TeTie;
+        res.hasPrefix = true;
+        res.TePrefix = right.hasPrefix ? (std::min)(left.Te, right.TePrefix) : left.Te;
+    } else {
+        res.Te = left.Te;
+        res.TeFirst = left.TeFirst;
+        res.TeTie = left.TeTie || (left.Te == right.Te);
+        res.hasPrefix = left.hasPrefix;
+        res.TePrefix = left.TePrefix;
+    }
+    if (right.hasRecord && right.recordTe < left.Te) {
+        res.hasRecord = true;
+        res.recordTe = right.recordTe;
+        res.recordFed = right.recordFed;
+    } else {
+        res.hasRecord = left.hasRecord;
+        res.recordTe = left.recordTe;
+        res.recordFed = left.recordFed;
+    }
+    return res;
+}
+
+void TimeDependencyIndex::setLeaf(std::size_t index, const Node& leaf)
+{
+    auto pos = leafCount + index;
+    tree[pos] = leaf;
+    while (pos > 1) {
+        pos /= 2;
+        tree[pos] = combine(tree[2 * pos], tree[2 * pos + 1]);
+    }
+}
+
+TimeDependencyIndex::EventEntry TimeDependencyIndex::makeEntry(const DependencyInfo& dep) const
+{
+    EventEntry entry;
+    if (!isIncluded(dep)) {
+        return entry;
+    }
+    entry.included = true;
+    entry.sequenceCounter = dep.sequenceCounter;
+    if (dep.mTimeState < TimeState::time_granted) {
+        entry.category = EventCategory::initializing;
+        return entry;
+    }
+    entry.value = (dep.minDe >= dep.next) ? dep.minDe : invalidDependentEvent;
+    entry.next = dep.next;
+    entry.group = dep.responseSequenceCounter;
+    if (dep.connection == ConnectionType::self) {
+        entry.category = EventCategory::self;
+    } else if (dep.timingVersion == 0 || !dep.dependent) {
+        entry.category = EventCategory::insensitive;
+    } else {
+        entry.category = EventCategory::sensitive;
+    }
+    return entry;
+}
+
+void TimeDependencyIndex::insertEntry(std::size_t index, const EventEntry& entry)
+{
+    entries[index] = entry;
+    if (entry.included) {
+        sequenceSum += entry.sequenceCounter;
+    }
+    switch (entry.category) {
+        case EventCategory::initializing:
+            ++initializingCount;
+            break;
+        case EventCategory::insensitive:
+            insensitiveEvents.insert(entry.value);
+            break;
+        case EventCategory::sensitive: {
+            sensitiveEvents.insert(entry.value);
+            auto& group = groups[entry.group];
+            if (!group.nexts.empty()) {
+                if (entry.next < *group.nexts.begin()) {
+                    groupNext.erase({*group.nexts.begin(), entry.group});
+                    groupNext.emplace(entry.next, entry.group);
+                }
+            } else {
+                groupNext.emplace(entry.next, entry.group);
+            }
+            group.values.insert(entry.value);
+            group.nexts.insert(entry.next);
+        } break;
+        case EventCategory::self:
+            selfDependencies.push_back(index);
+            break;
+        case EventCategory::none:
+        default:
+            break;
+    }
+}
+
+void TimeDependencyIndex::removeEntry(std::size_t index)
+{
+    const auto& entry = entries[index];
+    if (entry.included) {
+        sequenceSum -= entry.sequenceCounter;
+    }
+    switch (entry.category) {
+        case EventCategory::initializing:
+            --initializingCount;
+            break;
+        case EventCategory::insensitive:
+            insensitiveEvents.erase(insensitiveEvents.find(entry.value));
+            break;
+        case EventCategory::sensitive: {
+            sensitiveEvents.erase(sensitiveEvents.find(entry.value));
+            auto grp = groups.find(entry.group);
+            auto& group = grp->second;
+            auto oldMin = *group.nexts.begin();
+            group.values.erase(group.values.find(entry.value));
+            group.nexts.erase(group.nexts.find(entry.next));
+            if (group.nexts.empty()) {
+                groupNext.erase({oldMin, entry.group});
+                groups.erase(grp);
+            } else if (*group.nexts.begin() != oldMin) {
+                groupNext.erase({oldMin, entry.group});
+                groupNext.emplace(*group.nexts.begin(), entry.group);
+            }
+        } break;
+        case EventCategory::self:
+            selfDependencies.erase(
+                std::find(selfDependencies.begin(), selfDependencies.end(), index));
+            break;
+        case EventCategory::none:
+        default:
+            break;
+    }
+    entries[index] = EventEntry{};
+}
+
+void TimeDependencyIndex::rebuild(const std::vector<DependencyInfo>& deps)
+{
+    leafCount = 1;
+    while (leafCount < deps.size()) {
+        leafCount *= 2;
+    }
+    tree.assign(2 * leafCount, Node{});
+    entries.assign(deps.size(), EventEntry{});
+    initializingCount = 0;
+    sequenceSum = 0;
+    insensitiveEvents.clear();
+    sensitiveEvents.clear();
+    groups.clear();
+    groupNext.clear();
+    selfDependencies.clear();
+    for (std::size_t ii = 0; ii < deps.size(); ++ii) {
+        auto entry = makeEntry(deps[ii]);
+        if (entry.category > EventCategory::initializing) {
+            tree[leafCount + ii] = makeLeaf(deps[ii], ii);
+        }
+        insertEntry(ii, entry);
+    }
+    for (auto pos = leafCount - 1; pos > 0; --pos) {
+        tree[pos] = combine(tree[2 * pos], tree[2 * pos + 1]);
+    }
+}
+
+void TimeDependencyIndex::update(const std::vector<DependencyInfo>& deps, std::size_t index)
+{
+    if (deps.size() != entries.size()) {
+        rebuild(deps);
+        return;
+    }
+    removeEntry(index);
+    auto entry = makeEntry(deps[index]);
+    insertEntry(index, entry);
+    setLeaf(index,
+            (entry.category > EventCategory::initializing) ? makeLeaf(deps[index], index) :
+                                                              Node{});
+}
+
+Time TimeDependencyIndex::minDependentEvent(const std::vector<DependencyInfo>& deps,
+                                            std::size_t ignoreIndex,
+                                            std::int32_t sequenceCode) const
+{
+    Time minDe{Time::maxVal()};
+    if (!insensitiveEvents.empty()) {
+        minDe = *insensitiveEvents.begin();
+    }
+    if (sequenceCode == 0) {
+        if (!sensitiveEvents.empty()) {
+            minDe = (std::min)(minDe, *sensitiveEvents.begin());
+        }
+    } else {
+        // the matching group contributes the dependent events, all others the next times
+        auto grp = groups.find(sequenceCode);
+        if (grp != groups.end()) {
+            minDe = (std::min)(minDe, *grp->second.values.begin());
+        }
+        for (const auto& gnext : groupNext) {
+            if (gnext.second != sequenceCode) {
+                minDe = (std::min)(minDe, gnext.first);
+                break;
+            }
+        }
+    }
+    for (auto index : selfDependencies) {
+        if (index == ignoreIndex) {
+            continue;
+        }
+        const auto& dep = deps[index];
+        if (dep.responseSequenceCounter == sequenceCode && dep.dependent) {
+            if (dep.minDe >= dep.next) {
+                minDe = (std::min)(minDe, dep.minDe);
+            }
+        } else {
+            minDe = (std::min)(minDe, dep.next);
+        }
+    }
+    return minDe;
+}
+
+bool TimeDependencyIndex::generate(TimeData& mTime,
+                                   std::int32_t& sequenceTotal,
+                                   const std::vector<DependencyInfo>& deps,
+                                   GlobalFederateId ignore,
+                                   std::int32_t sequenceCode)
+{
+    std::size_t ignoreIndex{deps.size()};
+    if (ignore.isValid()) {
+        auto res = std::lower_bound(
+            deps.begin(), deps.end(), ignore, [](const auto& dep, GlobalFederateId target) {
+                return dep.fedID < target;
+            });
+        if (res != deps.end() && res->fedID == ignore) {
+            ignoreIndex = static_cast<std::size_t>(res - deps.begin());
+        }
+    }
+    EventEntry ignored;
+    if (ignoreIndex < deps.size()) {
+        ignored = entries[ignoreIndex];
+    }
+    auto initializing = initializingCount;
+    if (ignored.category == EventCategory::initializing) {
+        --initializing;
+    }
+    if (initializing > 0) {
+        return false;
+    }
+    sequenceTotal = static_cast<std::int32_t>(sequenceSum);
+
+    const bool removeIgnored = ignored.category > EventCategory::initializing;
+    if (removeIgnored) {
+        removeEntry(ignoreIndex);
+        setLeaf(ignoreIndex, Node{});
+    }
+    const auto& root = tree[1];
+    if (!root.empty) {
+        const auto& first = deps[root.nextFirst];
+        if (root.next < mTime.next) {
+            mTime.next = root.next;
+            mTime.mTimeState = root.nextGranted ? TimeState::time_granted : first.mTimeState;
+            mTime.interrupted = (first.responseSequenceCounter == sequenceCode && first.dependent) ?
+                (first.interrupted && root.nextRestInterrupted) :
+                false;
+        } else {
+            if (root.nextGranted) {
+                mTime.mTimeState = TimeState::time_granted;
+            }
+            mTime.interrupted = false;
+        }
+        if (root.Te < mTime.Te) {
+            const auto& minDep = deps[root.TeFirst];
+            mTime.TeAlt = root.TeTie ? root.Te : (std::min)(mTime.Te, root.TePrefix);
+            mTime.Te = root.Te;
+            mTime.minFed = root.TeTie ? GlobalFederateId{} : minDep.fedID;
+            mTime.sequenceCounter = minDep.sequenceCounter;
+            mTime.responseSequenceCounter = minDep.sequenceCounter;
+        } else {
+            mTime.minFed = GlobalFederateId{};
+            mTime.TeAlt = mTime.Te;
+        }
+        if (root.hasRecord && root.recordTe < Time::maxVal()) {
+            mTime.minFedActual = root.recordFed;
+        }
+    }
+    mTime.minDe = (std::min)(mTime.minDe, minDependentEvent(deps, ignoreIndex, sequenceCode));
+    if (removeIgnored) {
+        insertEntry(ignoreIndex, ignored);
+        setLeaf(ignoreIndex, makeLeaf(deps[ignoreIndex], ignoreIndex));
+        if (ignore.isBroker() && deps[ignoreIndex].Te < mTime.minDe) {
+            mTime.minDe = deps[ignoreIndex].Te;
+        }
+    }
+    return true;
+}
+}  // namespace helics
@@ -0,0 +1,126 @@
+/*
+Copyright (c) 2017-2022,
+Battelle Memorial Institute; Lawrence Livermore National Security, LLC; Alliance for Sustainable
+Energy, LLC.  See the top-level NOTICE for additional details. All rights reserved.
+SPDX-License-Identifier: BSD-3-Clause
+*/
+#pragma once
+
+#include "GlobalFederateId.hpp"
+#include "helicsTime.hpp"
+
+#include <cstddef>
+#include <cstdint>
+#include <map>
+#include <set>
+#include <utility>
+#include <vector>
+
+namespace helics {
+class TimeData;
+class DependencyInfo;
+
+/** the minimum dependent event time marking a dependent event time that can't be trusted*/
+constexpr Time invalidDependentEvent{-1.0};
+
+/** the subset of dependencies used in generating a minimum time*/
+enum class DependencySubset : std::uint8_t {
+    total = 0,  //!< all dependencies
+    upstream = 1,  //!< all dependencies except parents
+    downstream = 2  //!< only parent dependencies
+};
+
+/** class maintaining the aggregate minimum time information of a set of dependencies
+@details a tournament tree over the dependency positions holds the minimum next and event times
+with enough information to reproduce the order dependent results of a linear scan. The dependent
+event contributions which depend on the requested sequence code are kept in ordered sets grouped by
+the response sequence counter so a single dependency update and a query are both O(log N)*/
+class TimeDependencyIndex {
+  public:
+    TimeDependencyIndex(DependencySubset subset, GlobalFederateId self);
+    /** check if the index generates the times for a particular subset and self id*/
+    bool matches(DependencySubset subset, GlobalFederateId self) const
+    {
+        return subset == mSubset && self == mSelf;
+    }
+    /** regenerate the index from the full dependency set*/
+    void rebuild(const std::vector<DependencyInfo>& deps);
+    /** update the index after the dependency at the given position changed*/
+    void update(const std::vector<DependencyInfo>& deps, std::size_t index);
+    /** generate the minimum time data equivalent to a linear scan of the dependencies
+    @param mTime the time data to fill in, it should be initialized as for a linear scan
+    @param sequenceTotal loaded with the sum of the sequence counters of the included dependencies
+    @return false if the result can't be generated from the index since some dependency has not
+    been granted*/
+    bool generate(TimeData& mTime,
+                  std::int32_t& sequenceTotal,
+                  const std::vector<DependencyInfo>& deps,
+                  GlobalFederateId ignore,
+                  std::int32_t sequenceCode);
+
+  private:
+    /** node of the tournament tree*/
+    struct Node {
+        Time next{Time::maxVal()};  //!< the minimum next time
+        Time Te{Time::maxVal()};  //!< the minimum event time
+        Time TePrefix{Time::maxVal()};  //!< the minimum event time before the first minimum
+        Time recordTe{Time::maxVal()};  //!< the event time of the last forwarded minimum
+        GlobalFederateId recordFed{};  //!< the forwarded federate of the last forwarded minimum
+        std::uint32_t nextFirst{0};  //!< position of the first minimum next time
+        std::uint32_t TeFirst{0};  //!< position of the first minimum event time
+        bool empty{true};
+        bool nextGranted{false};  //!< any minimum next time dependency is granted
+        bool nextFirstInterrupted{false};  //!< the first minimum is interrupted and not granted
+        bool nextRestInterrupted{true};  //!< all the other minimums are interrupted not granted
+        bool TeTie{false};  //!< the minimum event time occurs more than once
+        bool hasPrefix{false};  //!< there is an event time before the first minimum
+        bool hasRecord{false};  //!< there is a forwarded minimum record
+    };
+    /** the category of a dependency for the dependent event time*/
+    enum class EventCategory : std::uint8_t {
+        none = 0,  //!< not included in the index
+        initializing = 1,  //!< included but not granted yet
+        insensitive = 2,  //!< contribution does not depend on the sequence code
+        sensitive = 3,  //!< contribution depends on the sequence code
+        self = 4  //!< a self dependency
+    };
+    /** the dependent event information inserted for a dependency*/
+    struct EventEntry {
+        Time value{Time::maxVal()};
+        Time next{Time::maxVal()};
+        std::int32_t group{0};
+        EventCategory category{EventCategory::none};
+        bool included{false};
+        std::int32_t sequenceCounter{0};
+    };
+    /** the dependent event contributions from a group of dependencies with the same response*/
+    struct EventGroup {
+        std::multiset<Time> values;
+        std::multiset<Time> nexts;
+    };
+
+    bool isIncluded(const DependencyInfo& dep) const;
+    static Node makeLeaf(const DependencyInfo& dep, std::size_t index);
+    static Node combine(const Node& left, const Node& right);
+    void setLeaf(std::size_t index, const Node& leaf);
+    EventEntry makeEntry(const DependencyInfo& dep) const;
+    void insertEntry(std::size_t index, const EventEntry& entry);
+    void removeEntry(std::size_t index);
+    Time minDependentEvent(const std::vector<DependencyInfo>& deps,
+                           std::size_t ignoreIndex,
+                           std::int32_t sequenceCode) const;
+
+    DependencySubset mSubset;
+    GlobalFederateId mSelf;
+    std::size_t leafCount{0};
+    std::vector<Node> tree;
+    std::vector<EventEntry> entries;
+    std::size_t initializingCount{0};
+    std::int64_t sequenceSum{0};
+    std::multiset<Time> insensitiveEvents;
+    std::multiset<Time> sensitiveEvents;
+    std::map<std::int32_t, EventGroup> groups;
+    std::set<std::pair<Time, std::int32_t>> groupNext;  //!< the minimum next time of each group
+    std::vector<std::size_t> selfDependencies;
+};
+}  // namespace helics
@@ -0,0 +1,109 @@
+/*
+Copyright (c) 2017-2022,
+Battelle Memorial Institute; Lawrence Livermore National Security, LLC; Alliance for Sustainable
+Energy, LLC.  See the top-level NOTICE for additional details. All rights reserved.
+SPDX-License-Identifier: BSD-3-Clause
+*/
+#include "TimingCoalescer.hpp"
+
+#include "json/json.h"
+#include <algorithm>
+
+namespace helics {
+
+static std::uint64_t routeKey(const ActionMessage& command) noexcept
+{
+    return (static_cast<std::uint64_t>(static_cast<std::uint32_t>(command.source_id.baseValue()))
+            << 32U) |
+        static_cast<std::uint32_t>(command.dest_id.baseValue());
+}
+
+bool TimingCoalescer::isTimingMessage(const ActionMessage& command) noexcept
+{
+    switch (command.action()) {
+        case CMD_TIME_REQUEST:
+        case CMD_EXEC_REQUEST:
+            return true;
+        default:
+            return false;
+    }
+}
+
+bool TimingCoalescer::supersedes(const ActionMessage& newer, const ActionMessage& older) noexcept
+{
+    if (!isTimingMessage(older) || newer.action() != older.action()) {
+        return false;
+    }
+    if (newer.source_id != older.source_id || newer.dest_id != older.dest_id) {
+        return false;
+    }
+    // the flags carry the iteration state and the sticky timing modes
+    if (newer.flags != older.flags) {
+        return false;
+    }
+    // the sequence counters must match so no iteration or grant response is skipped
+    if (newer.counter != older.counter || newer.getExtraDestData() != older.getExtraDestData()) {
+        return false;
+    }
+    if (newer.messageID != older.messageID) {
+        return false;
+    }
+    return newer.payload.empty() && older.payload.empty() && newer.getStringData().empty() &&
+        older.getStringData().empty();
+}
+
+std::size_t TimingCoalescer::coalesce(std::vector<ActionMessage>& batch)
+{
+    batches.fetch_add(1, std::memory_order_relaxed);
+    latest.clear();
+    dropped.assign(batch.size(), false);
+    std::uint64_t timingCount{0};
+    std::size_t removed{0};
+    // walk backwards so each message is compared to the next kept message on its route
+    for (auto index = batch.size(); index-- > 0;) {
+        const auto& command = batch[index];
+        const bool timing = isTimingMessage(command);
+        if (timing) {
+            ++timingCount;
+        }
+        const auto key = routeKey(command);
+        auto entry = std::find_if(latest.begin(), latest.end(), [key](const auto& item) {
+            return item.first == key;
+        });
+        if (entry == latest.end()) {
+            latest.emplace_back(key, index);
+            continue;
+        }
+        if (timing && supersedes(batch[entry->second], command)) {
+            dropped[index] = true;
+            ++removed;
+            continue;
+        }
+        entry->second = index;
+    }
+    if (removed > 0) {
+        std::size_t next{0};
+        for (std::size_t index = 0; index < batch.size(); ++index) {
+            if (dropped[index]) {
+                continue;
+            }
+            if (next != index) {
+                batch[next] = std::move(batch[index]);
+            }
+            ++next;
+        }
+        batch.resize(next);
+    }
+    timingMessages.fetch_add(timingCount, std::memory_order_relaxed);
+    coalesced.fetch_add(removed, std::memory_order_relaxed);
+    return removed;
+}
+
+void TimingCoalescer::loadJson(Json::Value& base) const
+{
+    base["batches"] = static_cast<Json::UInt64>(batches.load(std::memory_order_relaxed));
+    base["timing_messages"] = static_cast<Json::UInt64>(timingMessageCount());
+    base["coalesced"] = static_cast<Json::UInt64>(coalescedCount());
+}
+
+}  // namespace helics
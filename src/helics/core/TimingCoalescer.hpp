@@ -0,0 +1,67 @@
+/*
+Copyright (c) 2017-2022,
+Battelle Memorial Institute; Lawrence Livermore National Security, LLC; Alliance for Sustainable
+Energy, LLC.  See the top-level NOTICE for additional details. All rights reserved.
+SPDX-License-Identifier: BSD-3-Clause
+*/
+#pragma once
+
+#include "ActionMessage.hpp"
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <utility>
+#include <vector>
+
+/** forward declare Json::Value*/
+namespace Json {
+class Value;
+}
+
+namespace helics {
+/** collapse timing messages in a batch taken from the action queue that are superseded by a later
+message from the same source
+@details a time or exec request replaces the entire timing state of a dependency so when a later
+request in the same batch carries the same flags, iteration sequence, and response sequence, and no
+other message between the same source and destination comes between them, only the later request
+needs to be processed.  Requests carrying any payload or string data are never collapsed.*/
+class TimingCoalescer {
+  public:
+    /// the largest number of messages taken from the queue into a single batch
+    static constexpr std::size_t maxBatchSize{64};
+
+    /** check if a message is a timing message that can be collapsed*/
+    static bool isTimingMessage(const ActionMessage& command) noexcept;
+    /** check if a message makes an earlier message unnecessary
+    @param newer the later message
+    @param older the earlier message between the same source and destination*/
+    static bool supersedes(const ActionMessage& newer, const ActionMessage& older) noexcept;
+
+    /** remove the superseded timing messages from a batch, the order of the remaining messages is
+    not changed
+    @return the number of messages removed*/
+    std::size_t coalesce(std::vector<ActionMessage>& batch);
+
+    /** get the number of timing messages examined*/
+    std::uint64_t timingMessageCount() const noexcept
+    {
+        return timingMessages.load(std::memory_order_relaxed);
+    }
+    /** get the number of timing messages removed*/
+    std::uint64_t coalescedCount() const noexcept
+    {
+        return coalesced.load(std::memory_order_relaxed);
+    }
+    /** load the counters into a json object*/
+    void loadJson(Json::Value& base) const;
+
+  private:
+    std::atomic<std::uint64_t> timingMessages{0};
+    std::atomic<std::uint64_t> coalesced{0};
+    std::atomic<std::uint64_t> batches{0};
+    /// the latest kept message for each source and destination, used by the processing thread
+    std::vector<std::pair<std::uint64_t, std::size_t>> latest;
+    std::vector<bool> dropped;
+};
+}  // namespace helics
@@ -93,6 +93,18 @@ void TranslatorFederate::executeTranslator(ActionMessage& command, TranslatorInf
             }
         } break;
         case CMD_PUB: {
+            if (!trans->getInputInfo()->delta_values.decode(command)) {
+                if (mLogger) {
+                    mLogger(HELICS_LOG_LEVEL_WARNING,
+                            mName,
+                            "unable to apply value patch to translator " + trans->key);
+                }
+                ActionMessage resync(CMD_DELTA_RESYNC);
+                resync.setSource(trans->getInputInfo()->id);
+                resync.setDestination(command.getSource());
+                mSendMessage(resync);
+                break;
+            }
             auto message = trans->tranOp->convertToMessage(command.payload);
             if (message) {
                 auto targets = trans->getEndpointInfo()->getTargets();
@@ -49,6 +49,27 @@ void UnknownHandleManager::addEndpointLink(const std::string& source, const std:
     unknown_endpoint_links.emplace(source, target);
 }
 
+void UnknownHandleManager::addPublicationPattern(const std::string& pattern,
+                                                 GlobalHandle target,
+                                                 uint16_t flags,
+                                                 std::size_t existingInterfaces)
+{
+    publication_patterns.matcher.addPattern(pattern);
+    publication_patterns.targets.push_back(
+        {pattern, std::make_pair(target, flags), existingInterfaces});
+    ++publication_patterns.pendingCount;
+}
+
+void UnknownHandleManager::addInputPattern(const std::string& pattern,
+                                           GlobalHandle target,
+                                           uint16_t flags,
+                                           std::size_t existingInterfaces)
+{
+    input_patterns.matcher.addPattern(pattern);
+    input_patterns.targets.push_back({pattern, std::make_pair(target, flags), existingInterfaces});
+    ++input_patterns.pendingCount;
+}
+
 void UnknownHandleManager::addSourceFilterLink(const std::string& filter,
                                                const std::string& endpoint)
 {
@@ -105,6 +126,82 @@ std::vector<UnknownHandleManager::targetInfo>
     return getTargets(unknown_publications, newPublication);
 }
 
+std::vector<UnknownHandleManager::targetInfo>
+    UnknownHandleManager::checkPatterns(PatternSet& patterns, std::string_view name)
+{
+    std::vector<targetInfo> targets;
+    if (patterns.matcher.empty()) {
+        return targets;
+    }
+    patterns.matches.clear();
+    patterns.matcher.match(name, patterns.matches);
+    for (auto index : patterns.matches) {
+        auto& pattern = patterns.targets[index];
+        if (pattern.active) {
+            ++pattern.matches;
+            targets.push_back(pattern.target);
+        }
+    }
+    return targets;
+}
+
+std::vector<UnknownHandleManager::targetInfo> UnknownHandleManager::checkPendingPatterns(
+    PatternSet& patterns,
+    std::string_view name,
+    std::size_t index)
+{
+    std::vector<targetInfo> targets;
+    if (patterns.pendingCount == 0) {
+        return targets;
+    }
+    patterns.matches.clear();
+    patterns.matcher.match(name, patterns.matches);
+    for (auto patternIndex : patterns.matches) {
+        auto& pattern = patterns.targets[patternIndex];
+        // interfaces registered after the pattern were matched as they were registered
+        if (pattern.active && pattern.pending && index < pattern.existingInterfaces) {
+            ++pattern.matches;
+            targets.push_back(pattern.target);
+        }
+    }
+    return targets;
+}
+
+std::vector<UnknownHandleManager::targetInfo>
+    UnknownHandleManager::checkForPublicationPatterns(std::string_view newPublication)
+{
+    return checkPatterns(publication_patterns, newPublication);
+}
+
+std::vector<UnknownHandleManager::targetInfo>
+    UnknownHandleManager::checkForInputPatterns(std::string_view newInput)
+{
+    return checkPatterns(input_patterns, newInput);
+}
+
+std::vector<UnknownHandleManager::targetInfo>
+    UnknownHandleManager::checkPendingPublicationPatterns(std::string_view publication,
+                                                          std::size_t index)
+{
+    return checkPendingPatterns(publication_patterns, publication, index);
+}
+
+std::vector<UnknownHandleManager::targetInfo>
+    UnknownHandleManager::checkPendingInputPatterns(std::string_view input, std::size_t index)
+{
+    return checkPendingPatterns(input_patterns, input, index);
+}
+
+void UnknownHandleManager::clearPendingPatterns()
+{
+    for (auto* patterns : {&publication_patterns, &input_patterns}) {
+        for (auto& pattern : patterns->targets) {
+            pattern.pending = false;
+        }
+        patterns->pendingCount = 0;
+    }
+}
+
 std::vector<std::string> UnknownHandleManager::checkForLinks(const std::string& newSource) const
 {
     return getTargets(unknown_links, newSource);
@@ -142,8 +239,43 @@ std::vector<std::string>
     return getTargets(unknown_dest_filters, newFilter);
 }
 
+bool UnknownHandleManager::hasUnmatchedPatterns(uint16_t flag, bool flagValue) const
+{
+    for (const auto* patterns : {&publication_patterns, &input_patterns}) {
+        for (const auto& pattern : patterns->targets) {
+            if (pattern.active && pattern.matches == 0 &&
+                ((pattern.target.second & flag) != 0) == flagValue) {
+                return true;
+            }
+        }
+    }
+    return false;
+}
+
+void UnknownHandleManager::processUnmatchedPatterns(
+    uint16_t flag,
+    bool flagValue,
+    const std::function<void(const std::string&, char, GlobalHandle handle)>& cfunc) const
+{
+    for (const auto& pattern : publication_patterns.targets) {
+        if (pattern.active && pattern.matches == 0 &&
+            ((pattern.target.second & flag) != 0) == flagValue) {
+            cfunc(pattern.pattern, 'p', pattern.target.first);
+        }
+    }
+    for (const auto& pattern : input_patterns.targets) {
+        if (pattern.active && pattern.matches == 0 &&
+            ((pattern.target.second & flag) != 0) == flagValue) {
+            cfunc(pattern.pattern, 'i', pattern.target.first);
+        }
+    }
+}
+
 bool UnknownHandleManager::hasUnknowns() const
 {
+    if (hasUnmatchedPatterns(0, false)) {
+        return true;
+    }
     return (!(unknown_publications.empty() && unknown_endpoints.empty() && unknown_inputs.empty() &&
               unknown_filters.empty() && unknown_links.empty() && unknown_endpoint_links.empty() &&
               unknown_dest_filters.empty() && unknown_src_filters.empty()));
@@ -155,6 +287,9 @@ bool UnknownHandleManager::hasNonOptionalUnknowns() const
           unknown_src_filters.empty())) {
         return true;
     }
+    if (hasUnmatchedPatterns(make_flags(optional_flag), false)) {
+        return true;
+    }
     for (const auto& upub : unknown_publications) {
         if ((upub.second.second & make_flags(optional_flag)) != 0) {
             continue;
@@ -185,6 +320,9 @@ bool UnknownHandleManager::hasNonOptionalUnknowns() const
 
 bool UnknownHandleManager::hasRequiredUnknowns() const
 {
+    if (hasUnmatchedPatterns(make_flags(required_flag), true)) {
+        return true;
+    }
     for (const auto& upub : unknown_publications) {
         if ((upub.second.second & make_flags(required_flag)) != 0) {
             return true;
@@ -237,6 +375,7 @@ void UnknownHandleManager::processNonOptionalUnknowns(
         }
         cfunc(ufilt.first, 'f', ufilt.second.first);
     }
+    processUnmatchedPatterns(make_flags(optional_flag), false, cfunc);
 }
 
 void UnknownHandleManager::processRequiredUnknowns(
@@ -263,6 +402,7 @@ void UnknownHandleManager::processRequiredUnknowns(
             cfunc(ufilt.first, 'f', ufilt.second.first);
         }
     }
+    processUnmatchedPatterns(make_flags(required_flag), true, cfunc);
 }
 
 /** specify a found input*/
@@ -325,6 +465,13 @@ void UnknownHandleManager::clearFederateUnknowns(GlobalFederateId id)
             ++it;
         }
     }
+    for (auto* patterns : {&publication_patterns, &input_patterns}) {
+        for (auto& pattern : patterns->targets) {
+            if (pattern.target.first.fed_id == id) {
+                pattern.active = false;
+            }
+        }
+    }
 }
 
 }  // namespace helics
@@ -6,8 +6,11 @@ SPDX-License-Identifier: BSD-3-Clause
 */
 #pragma once
 #include "GlobalFederateId.hpp"
+#include "WildcardMatcher.hpp"
 
+#include <functional>
 #include <string>
+#include <string_view>
 #include <unordered_map>
 #include <utility>
 #include <vector>
@@ -21,6 +24,24 @@ class UnknownHandleManager {
     using targetInfo = std::pair<GlobalHandle, uint16_t>;
 
   private:
+    /** an interface targeting all the publications or inputs matching a pattern*/
+    struct PatternTarget {
+        std::string pattern;
+        targetInfo target;
+        /// the number of interfaces that existed when the pattern was added
+        std::size_t existingInterfaces{0};
+        int matches{0};  //!< the number of interfaces the pattern has matched
+        bool active{true};  //!< false if the federate of the target was removed
+        /// the pattern has not been matched against the interfaces existing before it
+        bool pending{true};
+    };
+    /** the patterns of one interface type along with their compiled form*/
+    struct PatternSet {
+        WildcardMatcher matcher;
+        std::vector<PatternTarget> targets;
+        std::size_t pendingCount{0};  //!< the number of pending patterns
+        std::vector<std::size_t> matches;  //!< scratch space for the match results
+    };
     std::unordered_multimap<std::string, targetInfo>
         unknown_publications;  //!< map of all unknown publications
     std::unordered_multimap<std::string, targetInfo>
@@ -37,6 +58,18 @@ class UnknownHandleManager {
         unknown_src_filters;  //!< map connecting source filters to endpoints
     std::unordered_multimap<std::string, std::string>
         unknown_dest_filters;  //!< map connecting destination filters to endpoints
+    PatternSet publication_patterns;  //!< patterns targeting publications
+    PatternSet input_patterns;  //!< patterns targeting inputs
+
+    bool hasUnmatchedPatterns(uint16_t flag, bool flagValue) const;
+    void processUnmatchedPatterns(
+        uint16_t flag,
+        bool flagValue,
+        const std::function<void(const std::string& name, char type, GlobalHandle)>& cfunc) const;
+    static std::vector<targetInfo> checkPatterns(PatternSet& patterns, std::string_view name);
+    static std::vector<targetInfo>
+        checkPendingPatterns(PatternSet& patterns, std::string_view name, std::size_t index);
+
   public:
     /** default constructor*/
     UnknownHandleManager() = default;
@@ -54,6 +87,22 @@ class UnknownHandleManager {
     /** add an endpoint link where neither side is known*/
     void addEndpointLink(const std::string& source, const std::string& target);
 
+    /** add an interface targeting all publications matching a pattern
+    @param pattern the pattern with '*' or '?' wildcards
+    @param target the interface the matching publications connect to
+    @param flags the flags of the connection
+    @param existingInterfaces the number of interfaces already registered which are matched
+    through checkPendingPublicationPatterns*/
+    void addPublicationPattern(const std::string& pattern,
+                               GlobalHandle target,
+                               uint16_t flags,
+                               std::size_t existingInterfaces);
+    /** add an interface targeting all inputs matching a pattern*/
+    void addInputPattern(const std::string& pattern,
+                         GlobalHandle target,
+                         uint16_t flags,
+                         std::size_t existingInterfaces);
+
     void addSourceFilterLink(const std::string& filter, const std::string& endpoint);
     void addDestinationFilterLink(const std::string& filter, const std::string& endpoint);
     /** specify a found input*/
@@ -66,6 +115,25 @@ class UnknownHandleManager {
     /** specify a found Source Filter*/
     std::vector<targetInfo> checkForFilters(const std::string& newFilter) const;
 
+    /** get the targets of all the patterns matching a new publication*/
+    std::vector<targetInfo> checkForPublicationPatterns(std::string_view newPublication);
+    /** get the targets of all the patterns matching a new input*/
+    std::vector<targetInfo> checkForInputPatterns(std::string_view newInput);
+    /** check if any patterns still need to be matched against the interfaces existing before them*/
+    bool hasPendingPatterns() const
+    {
+        return publication_patterns.pendingCount > 0 || input_patterns.pendingCount > 0;
+    }
+    /** get the targets of the pending patterns matching an existing publication
+    @param publication the name of the publication
+    @param index the registration index of the publication*/
+    std::vector<targetInfo> checkPendingPublicationPatterns(std::string_view publication,
+                                                            std::size_t index);
+    /** get the targets of the pending patterns matching an existing input*/
+    std::vector<targetInfo> checkPendingInputPatterns(std::string_view input, std::size_t index);
+    /** mark all the pending patterns as matched against the existing interfaces*/
+    void clearPendingPatterns();
+
     /** specify found data links*/
     std::vector<std::string> checkForLinks(const std::string& newSource) const;
 
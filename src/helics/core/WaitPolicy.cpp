@@ -0,0 +1,36 @@
+/*
+Copyright (c) 2017-2022,
+Battelle Memorial Institute; Lawrence Livermore National Security, LLC; Alliance for Sustainable
+Energy, LLC.  See the top-level NOTICE for additional details. All rights reserved.
+SPDX-License-Identifier: BSD-3-Clause
+*/
+#include "WaitPolicy.hpp"
+
+namespace helics {
+bool WaitPolicy::setPolicy(int newPolicy)
+{
+    switch (newPolicy) {
+        case HELICS_WAIT_POLICY_BLOCK:
+        case HELICS_WAIT_POLICY_SPIN:
+        case HELICS_WAIT_POLICY_SPIN_YIELD:
+        case HELICS_WAIT_POLICY_ADAPTIVE:
+            policy.store(newPolicy, std::memory_order_relaxed);
+            return true;
+        default:
+            return false;
+    }
+}
+
+void WaitPolicy::recordWait(std::chrono::nanoseconds waited)
+{
+    // exponentially weighted average of the recent waits
+    averageWait += (waited - averageWait) / 8;
+    auto budget = averageWait * 2;
+    if (budget > maxSpinBudget) {
+        // the waits are long enough that the wake up latency of parking does not matter
+        spinBudget = minSpinBudget;
+    } else {
+        spinBudget = (budget < minSpinBudget) ? minSpinBudget : budget;
+    }
+}
+}  // namespace helics
@@ -0,0 +1,101 @@
+/*
+Copyright (c) 2017-2022,
+Battelle Memorial Institute; Lawrence Livermore National Security, LLC; Alliance for Sustainable
+Energy, LLC.  See the top-level NOTICE for additional details. All rights reserved.
+SPDX-License-Identifier: BSD-3-Clause
+*/
+#pragma once
+
+#include "../helics_enums.h"
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <thread>
+#include <utility>
+
+namespace helics {
+/** the strategy a federate uses to wait for messages on its queue while blocked
+@details the default parks the thread on the queue immediately.  Busy spinning and yielding trade
+processor time for lower wake up latency, and the adaptive policy spins for twice the average of
+the recent waits as long as that stays under a limit, otherwise it parks quickly.  Only a single
+thread may call pop at a time.
+*/
+class WaitPolicy {
+  public:
+    using clock = std::chrono::steady_clock;
+    /// the longest period the adaptive policy spins before parking
+    static constexpr std::chrono::nanoseconds maxSpinBudget{std::chrono::microseconds(200)};
+    /// the shortest period the adaptive policy spins before parking
+    static constexpr std::chrono::nanoseconds minSpinBudget{std::chrono::microseconds(2)};
+    /// the period the spin then yield policy spins before yielding
+    static constexpr std::chrono::nanoseconds yieldDelay{std::chrono::microseconds(20)};
+
+    /** set the policy from one of the HelicsWaitPolicies values
+    @return false if the policy is not recognized*/
+    bool setPolicy(int newPolicy);
+    /** get the current policy*/
+    int getPolicy() const { return policy.load(std::memory_order_relaxed); }
+    /** get the period the adaptive policy currently spins before parking*/
+    std::chrono::nanoseconds getSpinBudget() const { return spinBudget; }
+
+    /** get the next element from a queue waiting according to the policy
+    @details the queue must have a blocking pop and a try_pop returning an optional*/
+    template<class Queue>
+    auto pop(Queue& queue) -> decltype(queue.pop())
+    {
+        auto currentPolicy = policy.load(std::memory_order_relaxed);
+        if (currentPolicy == HELICS_WAIT_POLICY_BLOCK) {
+            return queue.pop();
+        }
+        auto start = clock::now();
+        std::uint32_t loops{0};
+        while (true) {
+            auto val = queue.try_pop();
+            if (val) {
+                recordWait(clock::now() - start);
+                return std::move(*val);
+            }
+            // only check the clock periodically
+            if ((++loops & 0x0FU) != 0) {
+                cpuRelax();
+                continue;
+            }
+            auto waited = clock::now() - start;
+            switch (currentPolicy) {
+                case HELICS_WAIT_POLICY_SPIN:
+                    break;
+                case HELICS_WAIT_POLICY_SPIN_YIELD:
+                    if (waited > yieldDelay) {
+                        std::this_thread::yield();
+                    }
+                    break;
+                default:
+                    if (waited >= spinBudget) {
+                        auto parkedVal = queue.pop();
+                        recordWait(clock::now() - start);
+                        return parkedVal;
+                    }
+                    break;
+            }
+        }
+    }
+
+  private:
+    /** update the average wait and the spin budget of the adaptive policy*/
+    void recordWait(std::chrono::nanoseconds waited);
+    /** hint to the processor that the thread is spinning*/
+    static void cpuRelax()
+    {
+#if defined(__x86_64__) || defined(__i386__)
+        __builtin_ia32_pause();
+#elif defined(__aarch64__)
+        asm volatile("yield");
+#endif
+    }
+
+    std::atomic<int> policy{HELICS_WAIT_POLICY_BLOCK};
+    std::chrono::nanoseconds averageWait{std::chrono::microseconds(20)};
+    std::chrono::nanoseconds spinBudget{std::chrono::microseconds(40)};
+};
+}  // namespace helics
@@ -0,0 +1,123 @@
+/*
+Copyright (c) 2017-2022,
+Battelle Memorial Institute; Lawrence Livermore National Security, LLC; Alliance for Sustainable
+Energy, LLC.  See the top-level NOTICE for additional details. All rights reserved.
+SPDX-License-Identifier: BSD-3-Clause
+*/
+
+#include "WildcardMatcher.hpp"
+
+#include <algorithm>
+
+namespace helics {
+
+static bool charLess(const std::pair<char, std::int32_t>& child, char character)
+{
+    return child.first < character;
+}
+
+std::int32_t WildcardMatcher::literalChild(std::int32_t node, char character) const
+{
+    const auto& children = nodes[node].children;
+    auto loc = std::lower_bound(children.begin(), children.end(), character, charLess);
+    return (loc != children.end() && loc->first == character) ? loc->second : noNode;
+}
+
+std::int32_t WildcardMatcher::addLiteralChild(std::int32_t node, char character)
+{
+    auto& children = nodes[node].children;
+    auto loc = std::lower_bound(children.begin(), children.end(), character, charLess);
+    if (loc != children.end() && loc->first == character) {
+        return loc->second;
+    }
+    auto newNode = static_cast<std::int32_t>(nodes.size());
+    children.emplace(loc, character, newNode);
+    nodes.emplace_back();
+    return newNode;
+}
+
+std::size_t WildcardMatcher::addPattern(std::string_view pattern)
+{
+    std::int32_t node{0};
+    char previous{'\0'};
+    for (auto character : pattern) {
+        switch (character) {
+            case '*':
+                if (previous == '*') {
+                    // consecutive stars match the same as a single star
+                    break;
+                }
+                if (nodes[node].starChild == noNode) {
+                    nodes[node].starChild = static_cast<std::int32_t>(nodes.size());
+                    nodes.emplace_back();
+                    nodes.back().star = true;
+                }
+                node = nodes[node].starChild;
+                break;
+            case '?':
+                if (nodes[node].anyChild == noNode) {
+                    nodes[node].anyChild = static_cast<std::int32_t>(nodes.size());
+                    nodes.emplace_back();
+                }
+                node = nodes[node].anyChild;
+                break;
+            default:
+                node = addLiteralChild(node, character);
+                break;
+        }
+        previous = character;
+    }
+    nodes[node].patterns.push_back(patternCount);
+    marks.resize(nodes.size(), 0);
+    return patternCount++;
+}
+
+void WildcardMatcher::addState(std::int32_t node, std::vector<std::int32_t>& states)
+{
+    while (node != noNode && marks[node] != generation) {
+        marks[node] = generation;
+        states.push_back(node);
+        // a star can match an empty sequence so the node following it is active as well
+        node = nodes[node].starChild;
+    }
+}
+
+void WildcardMatcher::match(std::string_view name, std::vector<std::size_t>& matches)
+{
+    if (patternCount == 0) {
+        return;
+    }
+    // the marks are only reset when the generation counter wraps around
+    if (generation > 0xFFFFFFFFU - name.size() - 2) {
+        std::fill(marks.begin(), marks.end(), 0);
+        generation = 0;
+    }
+    ++generation;
+    current.clear();
+    addState(0, current);
+    for (auto character : name) {
+        ++generation;
+        next.clear();
+        for (auto state : current) {
+            const auto& node = nodes[state];
+            if (node.star) {
+                addState(state, next);
+            }
+            if (node.anyChild != noNode) {
+                addState(node.anyChild, next);
+            }
+            if (!node.children.empty()) {
+                addState(literalChild(state, character), next);
+            }
+        }
+        current.swap(next);
+        if (current.empty()) {
+            return;
+        }
+    }
+    for (auto state : current) {
+        const auto& patterns = nodes[state].patterns;
+        matches.insert(matches.end(), patterns.begin(), patterns.end());
+    }
+}
+}  // namespace helics
@@ -0,0 +1,63 @@
+/*
+Copyright (c) 2017-2022,
+Battelle Memorial Institute; Lawrence Livermore National Security, LLC; Alliance for Sustainable
+Energy, LLC.  See the top-level NOTICE for additional details. All rights reserved.
+SPDX-License-Identifier: BSD-3-Clause
+*/
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+namespace helics {
+/** class matching names against a set of wildcard patterns
+@details patterns may contain '*' matching any sequence of characters and '?' matching a single
+character.  All the patterns are compiled into a single trie so patterns sharing a prefix share the
+matching work and a name is checked against every pattern in a single pass over its characters.
+The matcher keeps scratch space for the matching so it is not thread safe*/
+class WildcardMatcher {
+  public:
+    /** check if a name contains any wildcard characters*/
+    static bool isPattern(std::string_view name)
+    {
+        return name.find_first_of("*?") != std::string_view::npos;
+    }
+    /** add a pattern to the matcher
+    @return the index of the pattern used in the match results*/
+    std::size_t addPattern(std::string_view pattern);
+    /** find all the patterns matching a name
+    @param name the name to check
+    @param matches the indices of the matching patterns are appended to this vector*/
+    void match(std::string_view name, std::vector<std::size_t>& matches);
+    /** get the number of patterns in the matcher*/
+    std::size_t size() const { return patternCount; }
+    /** check if the matcher has no patterns*/
+    bool empty() const { return patternCount == 0; }
+
+  private:
+    static constexpr std::int32_t noNode{-1};
+    /** a single step in the trie*/
+    struct Node {
+        /// the literal character transitions sorted by character
+        std::vector<std::pair<char, std::int32_t>> children;
+        std::int32_t anyChild{noNode};  //!< the transition for a '?'
+        std::int32_t starChild{noNode};  //!< the transition for a '*'
+        bool star{false};  //!< the node is a '*' so it consumes any character and remains active
+        std::vector<std::size_t> patterns;  //!< the patterns ending at this node
+    };
+    std::int32_t literalChild(std::int32_t node, char character) const;
+    std::int32_t addLiteralChild(std::int32_t node, char character);
+    void addState(std::int32_t node, std::vector<std::int32_t>& states);
+
+    std::vector<Node> nodes{1};
+    std::size_t patternCount{0};
+    /// the generation in which each node was last added to a state set
+    std::vector<std::uint32_t> marks{0};
+    std::uint32_t generation{0};
+    std::vector<std::int32_t> current;
+    std::vector<std::int32_t> next;
+};
+}  // namespace helics
@@ -10,8 +10,10 @@ SPDX-License-Identifier: BSD-3-Clause
 #include "helics/helics-config.h"
 #include "helicsTime.hpp"
 
+#include <atomic>
 #include <memory>
 #include <string>
+#include <string_view>
 #include <utility>
 #include <vector>
 
@@ -77,6 +79,14 @@ class Message {
     }
 };
 
+/** the description of a publication or input used in bulk registration*/
+struct ValueInterfaceDefinition {
+    bool input{false};  //!< true for an input, false for a publication
+    std::string key;  //!< the name of the interface
+    std::string type;  //!< the type of data the interface produces or accepts
+    std::string units;  //!< the units associated with the interface
+};
+
 /**
  * FilterOperator abstract class
  @details FilterOperators will transform a message in some way in a direct fashion
@@ -109,6 +119,14 @@ class FilterOperator {
     /** indicator if the filter Operator has the capability of generating completely new messages or
      * redirecting messages*/
     virtual bool isMessageGenerating() const { return false; }
+    /** indicator that the filter Operator keeps no state between messages and can process
+    messages from several threads at once, which allows it to run on the filter workers of a core*/
+    bool isStateless() const { return stateless.load(); }
+    /** declare the filter Operator to be stateless*/
+    void setStateless(bool value = true) { stateless.store(value); }
+
+  private:
+    std::atomic<bool> stateless{false};
 };
 
 /** special filter operator defining no operation the original message is simply returned
@@ -162,6 +180,33 @@ class NullTranslatorOperator final: public TranslatorOperator {
     }
 };
 
+/**
+ * FederateOperator abstract class
+ @details FederateOperators are called by the core to run the steps of a federate that has no
+ thread of its own, the calls come from the threads of the core callback pool
+ */
+class FederateOperator {
+  public:
+    /** default constructor*/
+    FederateOperator() = default;
+    /**virtual destructor*/
+    virtual ~FederateOperator() = default;
+    /** called after the federate enters initializing mode and after each iteration in
+    initializing mode
+    @return the iteration request to make for entering executing mode*/
+    virtual IterationRequest initializeOperations() = 0;
+    /** called after each time grant
+    @param newTime the granted time and the iteration state of the grant
+    @return the next time and iteration to request, a time of Time::maxVal() finalizes the
+    federate*/
+    virtual std::pair<Time, IterationRequest> operate(iteration_time newTime) = 0;
+    /** called once the federate has finished*/
+    virtual void finalize() {}
+    /** called with the error code and message when the federate encounters an error, before
+    finalize*/
+    virtual void error_handler(int /*code*/, std::string_view /*message*/) {}
+};
+
 /** helper template to check whether an index is actually valid for a particular vector
 @tparam SizedDataType a vector like data type that must have a size function
 @param testSize an index to test
@@ -46,6 +46,8 @@ std::string to_string(CoreType type)
             return "nng_";
         case CoreType::INPROC:
             return "inproc_";
+        case CoreType::SHM:
+            return "shm_";
         case CoreType::WEBSOCKET:
             return "websocket_";
         case CoreType::NULLCORE:
@@ -57,7 +59,7 @@ std::string to_string(CoreType type)
     }
 }
 
-static constexpr frozen::unordered_map<frozen::string, CoreType, 53> coreTypes{
+static constexpr frozen::unordered_map<frozen::string, CoreType, 56> coreTypes{
     {"default", CoreType::DEFAULT},
     {"def", CoreType::DEFAULT},
     {"mpi", CoreType::MPI},
@@ -102,6 +104,9 @@ static constexpr frozen::unordered_map<frozen::string, CoreType, 53> coreTypes{
     {"websocket", CoreType::WEBSOCKET},
     {"web", CoreType::WEBSOCKET},
     {"inproc", CoreType::INPROC},
+    {"shm", CoreType::SHM},
+    {"SHM", CoreType::SHM},
+    {"shared_memory", CoreType::SHM},
     {"nng", CoreType::NNG},
     {"null", CoreType::NULLCORE},
     {"nullcore", CoreType::NULLCORE},
@@ -159,6 +164,9 @@ CoreType coreTypeFromString(std::string type) noexcept
     if (type.compare(0, 6, "inproc") == 0) {
         return CoreType::INPROC;
     }
+    if (type.compare(0, 3, "shm") == 0) {
+        return CoreType::SHM;
+    }
     if (type.compare(0, 3, "web") == 0) {
         return CoreType::WEBSOCKET;
     }
@@ -210,6 +218,12 @@ static bool constexpr inproc_availability{false};
 static bool constexpr inproc_availability{true};
 #endif
 
+#ifndef HELICS_ENABLE_SHM_CORE
+static bool constexpr shm_availability{false};
+#else
+static bool constexpr shm_availability{true};
+#endif
+
 bool isCoreTypeAvailable(CoreType type) noexcept
 {
     bool available{false};
@@ -242,6 +256,9 @@ bool isCoreTypeAvailable(CoreType type) noexcept
         case CoreType::INPROC:
             available = inproc_availability;
             break;
+        case CoreType::SHM:
+            available = shm_availability;
+            break;
         case CoreType::HTTP:
         case CoreType::WEBSOCKET:
         case CoreType::NULLCORE:
@@ -69,6 +69,12 @@ constexpr uint16_t nameless_interface_flag = empty_flag;
 /// overload of optional_flag to mark an interrupted event
 constexpr uint16_t interrupted_flag = optional_flag;
 
+/// overload of extra_flag2 indicating a value payload is a patch against the previous value
+constexpr uint16_t delta_patch_flag = extra_flag2;
+
+/// overload of extra_flag3 indicating a full value from a publication using delta encoding
+constexpr uint16_t delta_base_flag = extra_flag3;
+
 /** template function to set a flag in an object containing a flags field
 @tparam FlagContainer an object with a .flags field
 @tparam FlagIndex a type that can be used as part of a shift to index into a flag object
@@ -131,7 +131,8 @@ namespace defs {
         LOG_LEVEL = HELICS_PROPERTY_INT_LOG_LEVEL,
         FILE_LOG_LEVEL = HELICS_PROPERTY_INT_FILE_LOG_LEVEL,
         CONSOLE_LOG_LEVEL = HELICS_PROPERTY_INT_CONSOLE_LOG_LEVEL,
-        LOG_BUFFER = HELICS_PROPERTY_INT_LOG_BUFFER
+        LOG_BUFFER = HELICS_PROPERTY_INT_LOG_BUFFER,
+        WAIT_POLICY = HELICS_PROPERTY_INT_WAIT_POLICY
     };
 
     /** options for handles */
@@ -149,7 +150,8 @@ namespace defs {
         MULTI_INPUT_HANDLING_METHOD = HELICS_HANDLE_OPTION_MULTI_INPUT_HANDLING_METHOD,
         INPUT_PRIORITY_LOCATION = HELICS_HANDLE_OPTION_INPUT_PRIORITY_LOCATION,
         CLEAR_PRIORITY_LIST = HELICS_HANDLE_OPTION_CLEAR_PRIORITY_LIST,
-        CONNECTIONS = HELICS_HANDLE_OPTION_CONNECTIONS
+        CONNECTIONS = HELICS_HANDLE_OPTION_CONNECTIONS,
+        DELTA_ENCODING = HELICS_HANDLE_OPTION_DELTA_ENCODING
     };
 
 }  // namespace defs
@@ -11,6 +11,7 @@
 # and app library for public headers
 set(helics_shared_public_headers
     ${HELICS_LIBRARY_SOURCE_DIR}/application_api/CombinationFederate.hpp
+    ${HELICS_LIBRARY_SOURCE_DIR}/application_api/CallbackFederate.hpp
     ${HELICS_LIBRARY_SOURCE_DIR}/application_api/Publications.hpp
     ${HELICS_LIBRARY_SOURCE_DIR}/application_api/Subscriptions.hpp
     ${HELICS_LIBRARY_SOURCE_DIR}/application_api/Endpoints.hpp
@@ -19,6 +20,7 @@ set(helics_shared_public_headers
     ${HELICS_LIBRARY_SOURCE_DIR}/application_api/Federate.hpp
     ${HELICS_LIBRARY_SOURCE_DIR}/application_api/helicsTypes.hpp
     ${HELICS_LIBRARY_SOURCE_DIR}/application_api/data_view.hpp
+    ${HELICS_LIBRARY_SOURCE_DIR}/application_api/array_view.hpp
     ${HELICS_LIBRARY_SOURCE_DIR}/application_api/MessageFederate.hpp
     ${HELICS_LIBRARY_SOURCE_DIR}/application_api/MessageOperators.hpp
     ${HELICS_LIBRARY_SOURCE_DIR}/application_api/ValueConverter.hpp
@@ -39,6 +41,7 @@ set(helics_shared_private_headers
     ${HELICS_LIBRARY_SOURCE_DIR}/application_api/AsyncFedCallInfo.hpp
     ${HELICS_LIBRARY_SOURCE_DIR}/application_api/FilterOperations.hpp
     ${HELICS_LIBRARY_SOURCE_DIR}/application_api/TranslatorOperations.hpp
+    ${HELICS_LIBRARY_SOURCE_DIR}/application_api/reductionOperations.hpp
     ${HELICS_LIBRARY_SOURCE_DIR}/application_api/ConnectorFederateManager.hpp
 )
 
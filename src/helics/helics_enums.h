@@ -52,6 +52,8 @@ typedef enum {
                                      memory it is pretty similar to the test core but stripped from
                                      the "test" components*/
     HELICS_CORE_TYPE_INPROC = 18,
+    /** a core using lock free rings in POSIX shared memory for federates on the same machine*/
+    HELICS_CORE_TYPE_SHM = 19,
     /** an explicit core type that is recognized but explicitly doesn't
                                   exist, for testing and a few other assorted reasons*/
     HELICS_CORE_TYPE_NULL = 66,
@@ -278,12 +280,27 @@ typedef enum {
        HelicsLogLevels*/
     HELICS_PROPERTY_INT_CONSOLE_LOG_LEVEL = 274,
     /** integer property controlling the size of the log buffer*/
-    HELICS_PROPERTY_INT_LOG_BUFFER = 276
+    HELICS_PROPERTY_INT_LOG_BUFFER = 276,
+    /** integer property selecting how a federate waits for messages while blocked in a time or
+       mode request see \ref HelicsWaitPolicies*/
+    HELICS_PROPERTY_INT_WAIT_POLICY = 278
 } HelicsProperties;
 
 /** result returned for requesting the value of an invalid/unknown property */
 const int HELICS_INVALID_PROPERTY_VALUE = -972;
 
+/** enumeration of the ways a federate can wait for messages while blocked*/
+typedef enum {
+    /** park the waiting thread until a message arrives*/
+    HELICS_WAIT_POLICY_BLOCK = 0,
+    /** busy spin on the message queue, lowest latency but occupies a processor while waiting*/
+    HELICS_WAIT_POLICY_SPIN = 1,
+    /** spin briefly then yield the processor between checks of the message queue*/
+    HELICS_WAIT_POLICY_SPIN_YIELD = 2,
+    /** spin for a period learned from recent waits then park the thread*/
+    HELICS_WAIT_POLICY_ADAPTIVE = 3
+} HelicsWaitPolicies;
+
 /** enumeration of the multi_input operations*/
 typedef enum {
     /** time and priority order the inputs from the core library*/
@@ -339,7 +356,10 @@ typedef enum {
     /** specify that the priority list should be cleared or question if it is cleared*/
     HELICS_HANDLE_OPTION_CLEAR_PRIORITY_LIST = 512,
     /** specify the required number of connections or get the actual number of connections*/
-    HELICS_HANDLE_OPTION_CONNECTIONS = 522
+    HELICS_HANDLE_OPTION_CONNECTIONS = 522,
+    /** specify that a publication sends patches against the previous value when it is smaller
+       than the full value*/
+    HELICS_HANDLE_OPTION_DELTA_ENCODING = 525
 } HelicsHandleOptions;
 
 /** enumeration of the predefined filter types*/
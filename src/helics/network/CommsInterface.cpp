@@ -6,6 +6,7 @@ SPDX-License-Identifier: BSD-3-Clause
 */
 #include "CommsInterface.hpp"
 
+#include "../core/LatencyTracker.hpp"
 #include "../core/core-exceptions.hpp"
 #include "NetworkBrokerData.hpp"
 #include "gmlc/utilities/stringOps.h"
@@ -169,6 +170,12 @@ void CommsInterface::propertyUnLock()
 
 void CommsInterface::transmit(route_id rid, const ActionMessage& cmd)
 {
+    if (latencyTracker) {
+        ActionMessage stamped(cmd);
+        stamped.trackingTime = LatencyTracker::now();
+        transmit(rid, std::move(stamped));
+        return;
+    }
     if (isPriorityCommand(cmd)) {
         txQueue.emplacePriority(rid, cmd);
     } else {
@@ -178,6 +185,9 @@ void CommsInterface::transmit(route_id rid, const ActionMessage& cmd)
 
 void CommsInterface::transmit(route_id rid, ActionMessage&& cmd)
 {
+    if (latencyTracker) {
+        cmd.trackingTime = LatencyTracker::now();
+    }
     if (isPriorityCommand(cmd)) {
         txQueue.emplacePriority(rid, std::move(cmd));
     } else {
@@ -515,6 +525,28 @@ void CommsInterface::setLoggingCallback(
     }
 }
 
+void CommsInterface::setLatencyTracker(std::shared_ptr<LatencyTracker> tracker)
+{
+    if (propertyLock()) {
+        latencyTracker = std::move(tracker);
+        propertyUnLock();
+    }
+}
+
+std::pair<route_id, ActionMessage> CommsInterface::popTransmit()
+{
+    auto message = txQueue.pop();
+    recordTransmitLatency(message.first, message.second);
+    return message;
+}
+
+void CommsInterface::recordTransmitLatency(route_id rid, const ActionMessage& cmd) const
+{
+    if (latencyTracker) {
+        latencyTracker->recordTransmit(rid, cmd.trackingTime, LatencyTracker::now());
+    }
+}
+
 void CommsInterface::setMessageSize(int maxMsgSize, int maxCount)
 {
     if (propertyLock()) {
@@ -19,6 +19,7 @@ SPDX-License-Identifier: BSD-3-Clause
 #include <utility>
 
 namespace helics {
+class LatencyTracker;
 
 /** implementation of a generic communications interface
  */
@@ -79,6 +80,9 @@ class CommsInterface {
     void setLoggingCallback(
         std::function<void(int level, const std::string& name, const std::string& message)>
             callback);
+    /** set the tracker to record the time messages wait for transmission
+     */
+    void setLatencyTracker(std::shared_ptr<LatencyTracker> tracker);
     /** set the max message size and max Queue size
      */
     void setMessageSize(int maxMsgSize, int maxCount);
@@ -152,6 +156,8 @@ class CommsInterface {
         loggingCallback;  //!< callback for logging
     gmlc::containers::BlockingPriorityQueue<std::pair<route_id, ActionMessage>>
         txQueue;  //!< set of messages waiting to be transmitted
+    /// tracker for transmit latencies, null if latency tracking is not active
+    std::shared_ptr<LatencyTracker> latencyTracker;
     // closing the files or connection can take some time so there is a need for inter-thread
     // communication to not spit out warning messages if it is in the process of disconnecting
     std::atomic<bool> disconnecting{
@@ -180,6 +186,13 @@ class CommsInterface {
     void propertyUnLock();
     /** function to join the processing threads*/
     void join_tx_rx_thread();
+    /** remove the next message from the transmit queue, waiting if it is empty, and record the
+    time it waited in the queue if latency tracking is active*/
+    std::pair<route_id, ActionMessage> popTransmit();
+    /** record the time a message waited in the transmit queue if latency tracking is active
+    @details should be called by transmit loops that remove messages from the queue without
+    popTransmit*/
+    void recordTransmitLatency(route_id rid, const ActionMessage& cmd) const;
     /** get the generated randomID for this comm interface*/
     const std::string& getRandomID() const { return randomID; }
 
@@ -83,6 +83,24 @@ std::shared_ptr<helicsCLI11App>
         ->check(CLI::PositiveNumber);
     nbparser->add_option("--networkretries", maxRetries, "the maximum number of network retries")
         ->capture_default_str();
+    nbparser
+        ->add_option("--tx_batch",
+                     txBatchSize,
+                     "coalesce outgoing messages into socket writes of up to this many bytes (tcp "
+                     "cores only, 0 to disable)")
+        ->capture_default_str()
+        ->check(CLI::NonNegativeNumber);
+    nbparser
+        ->add_option("--tx_batch_delay",
+                     txBatchDelay,
+                     "the maximum time in microseconds a partial transmit batch is held waiting "
+                     "for additional messages")
+        ->capture_default_str()
+        ->check(CLI::NonNegativeNumber);
+    nbparser->add_flag("--compact_serialization",
+                       useCompactSerialization,
+                       "send messages using the compact serialization with interned strings (tcp "
+                       "cores only, all connected brokers must be able to read it)");
     nbparser->add_flag("--useosport",
                        use_os_port,
                        "specify that the ports should be allocated by the host operating system");
@@ -43,6 +43,9 @@ class NetworkBrokerData {
     int maxMessageSize{16 * 256};  //!< maximum message size
     int maxMessageCount{256};  //!< maximum message count
     int maxRetries{5};  //!< the maximum number of retries to establish a network connection
+    /// the number of bytes to coalesce into a single socket write (0 to disable)
+    int txBatchSize{0};
+    int txBatchDelay{0};  //!< the maximum time in microseconds to hold a partial batch
     gmlc::networking::InterfaceNetworks interfaceNetwork{
         gmlc::networking::InterfaceNetworks::LOCAL};
     bool reuse_address{false};  //!< allow reuse of binding address
@@ -54,6 +57,7 @@ class NetworkBrokerData {
     bool noAckConnection{false};  //!< flag indicating that a connection ack message is not required
                                   //!< for broker connections
     bool useJsonSerialization{false};  //!< for message serialization use JSON
+    bool useCompactSerialization{false};  //!< send messages in the compact serialization
     bool observer{false};  //!< specify that the network connection is used for observation only
     ServerModeOptions server_mode{ServerModeOptions::UNSPECIFIED};  //!< setup a server mode
     bool encrypted{false};  // enable encryption
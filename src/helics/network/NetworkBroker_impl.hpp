@@ -78,6 +78,7 @@ bool NetworkBroker<COMMS, baseline, tcode>::brokerConnect()
     CommsBroker<COMMS, CoreBroker>::comms->setName(CoreBroker::getIdentifier());
     CommsBroker<COMMS, CoreBroker>::comms->loadNetworkInfo(netInfo);
     CommsBroker<COMMS, CoreBroker>::comms->setTimeout(BrokerBase::networkTimeout.to_ms());
+    CommsBroker<COMMS, CoreBroker>::comms->setLatencyTracker(BrokerBase::latencyTracker);
 
     auto res = CommsBroker<COMMS, CoreBroker>::comms->connect();
     if (res) {
@@ -152,7 +152,7 @@ namespace inproc {
             route_id rid;
             ActionMessage cmd;
 
-            std::tie(rid, cmd) = txQueue.pop();
+            std::tie(rid, cmd) = popTransmit();
             bool processed = false;
             if (isProtocolCommand(cmd)) {
                 if (rid == control_route) {
@@ -211,7 +211,7 @@ namespace ipc {
         while (continueLoop) {
             route_id rid;
             ActionMessage cmd;
-            std::tie(rid, cmd) = txQueue.pop();
+            std::tie(rid, cmd) = popTransmit();
             if (isProtocolCommand(cmd)) {
                 if (rid == control_route) {
                     switch (cmd.messageID) {
@@ -18,6 +18,12 @@ SPDX-License-Identifier: BSD-3-Clause
 #    include "ipc/IpcCore.h"
 #endif
 
+#ifdef HELICS_ENABLE_SHM_CORE
+#    include "shm/ShmBroker.h"
+#    include "shm/ShmComms.h"
+#    include "shm/ShmCore.h"
+#endif
+
 #ifdef HELICS_ENABLE_UDP_CORE
 #    include "udp/UdpBroker.h"
 #    include "udp/UdpComms.h"
@@ -123,6 +129,16 @@ static auto ipccomm2 =
 
 #endif
 
+#ifdef HELICS_ENABLE_SHM_CORE
+static auto shmc = CoreFactory::addCoreType<shm::ShmCore>("shm", static_cast<int>(CoreType::SHM));
+static auto shmb =
+    BrokerFactory::addBrokerType<shm::ShmBroker>("shm", static_cast<int>(CoreType::SHM));
+
+static auto shmcomm =
+    CommFactory::addCommType<shm::ShmComms>("shm", static_cast<int>(CoreType::SHM));
+
+#endif
+
 #ifdef HELICS_ENABLE_INPROC_CORE
 static auto iprcc =
     CoreFactory::addCoreType<inproc::InprocCore>("inproc", static_cast<int>(CoreType::INPROC));
@@ -111,7 +111,7 @@ namespace mpi {
             route_id rid;
             ActionMessage cmd;
 
-            std::tie(rid, cmd) = txQueue.pop();
+            std::tie(rid, cmd) = popTransmit();
             bool processed = false;
             if (isProtocolCommand(cmd)) {
                 if (control_route == rid) {
@@ -0,0 +1,215 @@
+/*
+Copyright (c) 2017-2022,
+Battelle Memorial Institute; Lawrence Livermore National Security, LLC; Alliance for Sustainable
+Energy, LLC.  See the top-level NOTICE for additional details. All rights reserved.
+SPDX-License-Identifier: BSD-3-Clause
+*/
+#include "ShmComms.h"
+
+#include "../../common/fmt_format.h"
+#include "../../core/ActionMessage.hpp"
+#include "../../core/helics_definitions.hpp"
+#include "../NetworkBrokerData.hpp"
+#include "ShmRing.h"
+
+#include <map>
+#include <string>
+#include <thread>
+#include <tuple>
+#include <utility>
+
+namespace helics {
+namespace shm {
+    ShmComms::ShmComms()
+    {
+        // override the default value for this comm system
+        maxMessageCount = 256;
+    }
+    /** destructor*/
+    ShmComms::~ShmComms()
+    {
+        disconnect();
+    }
+
+    void ShmComms::loadNetworkInfo(const NetworkBrokerData& netInfo)
+    {
+        CommsInterface::loadNetworkInfo(netInfo);
+        if (!propertyLock()) {
+            return;
+        }
+        if (localTargetAddress.empty()) {
+            if (serverMode) {
+                // matches the default broker address used by the network cores for this interface
+                localTargetAddress = "_ipc_broker";
+            } else {
+                localTargetAddress = name;
+            }
+        }
+        propertyUnLock();
+    }
+
+    void ShmComms::queue_rx_function()
+    {
+        ShmRingReceiver rxRing;
+        bool connected = rxRing.connect(localTargetAddress, maxMessageCount, maxMessageSize);
+        if (!connected) {
+            disconnecting = true;
+            ActionMessage err(CMD_ERROR);
+            err.messageID = defs::Errors::CONNECTION_FAILURE;
+            err.payload = rxRing.getError();
+            ActionCallback(std::move(err));
+            setRxStatus(connection_status::error);  // the connection has failed
+            return;
+        }
+        setRxStatus(
+            connection_status::connected);  // this is a atomic indicator that the rx queue is ready
+        while (true) {
+            auto cmdopt = rxRing.getMessage(std::chrono::milliseconds(2000));
+            if (!cmdopt) {
+                continue;
+            }
+            if (isProtocolCommand(*cmdopt)) {
+                if (cmdopt->messageID == CLOSE_RECEIVER) {
+                    disconnecting = true;
+                    break;
+                }
+                continue;
+            }
+            ActionCallback(std::move(*cmdopt));
+        }
+        rxRing.close();
+        setRxStatus(connection_status::terminated);
+    }
+
+    void ShmComms::queue_tx_function()
+    {
+        ShmRingSender brokerRing;  //!< the ring of the broker
+        ShmRingSender rxRing;
+        std::map<route_id, ShmRingSender> routes;  //!< table of the routes to other brokers
+        bool hasBroker = false;
+
+        if (!brokerTargetAddress.empty()) {
+            bool conn = brokerRing.connect(brokerTargetAddress, 20);
+            if (!conn) {
+                std::this_thread::sleep_for(connectionTimeout);
+                conn = brokerRing.connect(brokerTargetAddress, 20);
+                if (!conn) {
+                    ActionMessage err(CMD_ERROR);
+                    err.payload = fmt::format("Unable to open broker connection -> {}",
+                                              brokerRing.getError());
+                    err.messageID = defs::Errors::CONNECTION_FAILURE;
+                    ActionCallback(std::move(err));
+                    setTxStatus(connection_status::error);
+                    return;
+                }
+            }
+            hasBroker = true;
+        }
+        // wait for the receiver to startup
+        if (!rxTrigger.wait_forActivation(connectionTimeout)) {
+            ActionMessage err(CMD_ERROR);
+            err.messageID = defs::Errors::CONNECTION_FAILURE;
+            err.payload = "Unable to link with receiver";
+            ActionCallback(std::move(err));
+            setTxStatus(connection_status::error);
+            return;
+        }
+        if (getRxStatus() == connection_status::error) {
+            setTxStatus(connection_status::error);
+            return;
+        }
+        if (!rxRing.connect(localTargetAddress, 5)) {
+            ActionMessage err(CMD_ERROR);
+            err.messageID = defs::Errors::CONNECTION_FAILURE;
+            err.payload = fmt::format("Unable to open receiver connection -> {}", rxRing.getError());
+            ActionCallback(std::move(err));
+            setTxStatus(connection_status::error);
+            return;
+        }
+        brokerRing.setTimeout(connectionTimeout);
+        rxRing.setTimeout(connectionTimeout);
+
+        setTxStatus(connection_status::connected);
+        auto sendTo = [this](ShmRingSender& ring, const ActionMessage& cmd) {
+            if (!ring.sendMessage(cmd)) {
+                if (!isDisconnectCommand(cmd)) {
+                    logError(std::string("unable to send ") + actionMessageType(cmd.action()) +
+                             "::" + ring.getError());
+                }
+            }
+        };
+        bool continueLoop{true};
+        while (continueLoop) {
+            route_id rid;
+            ActionMessage cmd;
+            std::tie(rid, cmd) = popTransmit();
+            if (isProtocolCommand(cmd)) {
+                if (rid == control_route) {
+                    switch (cmd.messageID) {
+                        case NEW_ROUTE: {
+                            ShmRingSender newRing;
+                            if (newRing.connect(std::string(cmd.payload.to_string()), 3)) {
+                                newRing.setTimeout(connectionTimeout);
+                                routes.emplace(route_id{cmd.getExtraData()}, std::move(newRing));
+                            } else {
+                                logWarning(std::string("unable to create route ") +
+                                           std::string(cmd.payload.to_string()) +
+                                           "::" + newRing.getError());
+                            }
+                            continue;
+                        }
+                        case REMOVE_ROUTE:
+                            routes.erase(route_id{cmd.getExtraData()});
+                            continue;
+                        case DISCONNECT:
+                            continueLoop = false;
+                            continue;
+                    }
+                }
+            }
+            if (rid == parent_route_id) {
+                if (hasBroker) {
+                    sendTo(brokerRing, cmd);
+                }
+            } else if (rid == control_route) {
+                sendTo(rxRing, cmd);
+            } else {
+                auto routeFnd = routes.find(rid);
+                if (routeFnd != routes.end()) {
+                    sendTo(routeFnd->second, cmd);
+                } else {
+                    if (hasBroker) {
+                        sendTo(brokerRing, cmd);
+                    }
+                }
+            }
+        }
+        routes.clear();
+        setTxStatus(connection_status::terminated);
+    }
+
+    void ShmComms::closeReceiver()
+    {
+        if ((getRxStatus() == connection_status::error) ||
+            (getRxStatus() == connection_status::terminated)) {
+            return;
+        }
+        ActionMessage cmd(CMD_PROTOCOL);
+        cmd.messageID = CLOSE_RECEIVER;
+        if (getTxStatus() == connection_status::connected) {
+            transmit(control_route, cmd);
+        } else if (!disconnecting) {
+            ShmRingSender rxRing;
+            if (rxRing.connect(localTargetAddress, 0)) {
+                rxRing.sendMessage(cmd);
+            }
+        }
+    }
+
+    std::string ShmComms::getAddress() const
+    {
+        return localTargetAddress;
+    }
+
+}  // namespace shm
+}  // namespace helics
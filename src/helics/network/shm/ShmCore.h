@@ -0,0 +1,18 @@
+/*
+Copyright (c) 2017-2022,
+Battelle Memorial Institute; Lawrence Livermore National Security, LLC; Alliance for Sustainable
+Energy, LLC.  See the top-level NOTICE for additional details. All rights reserved.
+SPDX-License-Identifier: BSD-3-Clause
+*/
+#pragma once
+
+#include "../NetworkCore.hpp"
+
+namespace helics {
+namespace shm {
+    class ShmComms;
+    /** implementation for the core that uses shared memory rings to communicate*/
+    using ShmCore = NetworkCore<ShmComms, InterfaceTypes::IPC>;
+
+}  // namespace shm
+}  // namespace helics
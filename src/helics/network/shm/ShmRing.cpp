@@ -0,0 +1,487 @@
+/*
+Copyright (c) 2017-2022,
+Battelle Memorial Institute; Lawrence Livermore National Security, LLC; Alliance for Sustainable
+Energy, LLC.  See the top-level NOTICE for additional details. All rights reserved.
+SPDX-License-Identifier: BSD-3-Clause
+*/
+#include "ShmRing.h"
+
+#include <algorithm>
+#include <atomic>
+#include <cctype>
+#include <cerrno>
+#include <csignal>
+#include <cstring>
+#include <fcntl.h>
+#include <functional>
+#include <new>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <thread>
+#include <unistd.h>
+#include <utility>
+
+#ifdef __linux__
+#    include <linux/futex.h>
+#    include <sys/syscall.h>
+#endif
+
+namespace helics {
+namespace shm {
+    constexpr std::uint32_t cRingMagic{0x48534D52};
+    constexpr std::uint32_t cRingVersion{2};
+    constexpr int cSpinCount{2000};
+
+    enum class ring_state_t : std::int32_t {
+        startup = 0,
+        connected = 1,
+        closing = 3,
+    };
+
+    static_assert(std::atomic<std::uint64_t>::is_always_lock_free,
+                  "shared memory rings require lock free 64 bit atomics");
+    static_assert(std::atomic<std::uint32_t>::is_always_lock_free,
+                  "shared memory rings require lock free 32 bit atomics");
+
+    /** the control block at the start of the shared memory segment*/
+    struct RingHeader {
+        std::atomic<std::uint32_t> magic{0};
+        std::uint32_t version{cRingVersion};
+        std::uint64_t slotCount{0};
+        std::atomic<std::int32_t> state{static_cast<std::int32_t>(ring_state_t::startup)};
+        std::int32_t ownerPid{0};  //!< the process id of the receiver that created the ring
+        alignas(64) std::atomic<std::uint64_t> enqueuePos{0};
+        /// counter used as the futex word for waking the receiver
+        alignas(64) std::atomic<std::uint32_t> signal{0};
+        std::atomic<std::uint32_t> waiters{0};
+    };
+
+    /** the descriptor for a single slot in the ring*/
+    struct SlotHeader {
+        std::atomic<std::uint64_t> sequence{0};
+        std::uint32_t frameBytes{0};
+        /// the number of slots used by the frame starting in this slot (0 for continuation slots)
+        std::uint32_t slotsUsed{0};
+    };
+
+    static std::size_t headerBytes()
+    {
+        return (sizeof(RingHeader) + 63U) & ~std::size_t{63U};
+    }
+
+    static std::size_t segmentBytes(std::uint64_t slotCount)
+    {
+        return headerBytes() +
+            ((static_cast<std::size_t>(slotCount) * sizeof(SlotHeader) + 63U) &
+             ~std::size_t{63U}) +
+            static_cast<std::size_t>(slotCount) * cShmSlotSize;
+    }
+
+#ifdef __linux__
+    static void futexWait(std::atomic<std::uint32_t>* word,
+                          std::uint32_t expected,
+                          std::chrono::nanoseconds timeout)
+    {
+        timespec tspec{};
+        tspec.tv_sec = static_cast<time_t>(timeout.count() / 1000000000);
+        tspec.tv_nsec = static_cast<long>(timeout.count() % 1000000000);
+        // the segment is shared between processes so the private futex operations cannot be used
+        syscall(SYS_futex, reinterpret_cast<std::uint32_t*>(word), FUTEX_WAIT, expected, &tspec,
+                nullptr, 0);
+    }
+
+    static void futexWake(std::atomic<std::uint32_t>* word)
+    {
+        syscall(SYS_futex, reinterpret_cast<std::uint32_t*>(word), FUTEX_WAKE, 1, nullptr,
+                nullptr, 0);
+    }
+#else
+    static void futexWait(std::atomic<std::uint32_t>* word,
+                          std::uint32_t expected,
+                          std::chrono::nanoseconds timeout)
+    {
+        // no process shared wait primitive so poll at a fine granularity
+        auto deadline = std::chrono::steady_clock::now() + timeout;
+        while (word->load(std::memory_order_acquire) == expected &&
+               std::chrono::steady_clock::now() < deadline) {
+            std::this_thread::sleep_for(std::chrono::microseconds(50));
+        }
+    }
+
+    static void futexWake(std::atomic<std::uint32_t>* /*word*/) {}
+#endif
+
+    std::string shmSegmentName(const std::string& name)
+    {
+        std::string segment{"/helics_shm_"};
+        // segment names are limited in length so use a hash for long names
+        if (name.size() > 200) {
+            segment.append(std::to_string(std::hash<std::string>{}(name)));
+            return segment;
+        }
+        segment.reserve(segment.size() + name.size());
+        for (auto chr : name) {
+            segment.push_back((std::isalnum(static_cast<unsigned char>(chr)) != 0) ? chr : '_');
+        }
+        return segment;
+    }
+
+    /** remove a segment left over from a previous ring if the process that created it is gone
+    @return false if the segment belongs to a running process*/
+    static bool removeStaleSegment(const std::string& name)
+    {
+        int fd = shm_open(name.c_str(), O_RDONLY, 0600);
+        if (fd < 0) {
+            // the segment was removed in the meantime
+            return errno == ENOENT;
+        }
+        std::int32_t ownerPid{0};
+        struct stat sbuf {
+        };
+        if (fstat(fd, &sbuf) == 0 && static_cast<std::size_t>(sbuf.st_size) >= sizeof(RingHeader)) {
+            void* mem = mmap(nullptr, sizeof(RingHeader), PROT_READ, MAP_SHARED, fd, 0);
+            if (mem != MAP_FAILED) {
+                const auto* hdr = static_cast<const RingHeader*>(mem);
+                if (hdr->magic.load(std::memory_order_acquire) == cRingMagic &&
+                    hdr->version == cRingVersion) {
+                    ownerPid = hdr->ownerPid;
+                }
+                munmap(mem, sizeof(RingHeader));
+            }
+        }
+        ::close(fd);
+        // EPERM means the process exists but belongs to another user
+        if (ownerPid > 0 && (kill(static_cast<pid_t>(ownerPid), 0) == 0 || errno == EPERM)) {
+            return false;
+        }
+        shm_unlink(name.c_str());
+        return true;
+    }
+
+    ShmRingMapping::~ShmRingMapping()
+    {
+        unmap();
+    }
+
+    ShmRingMapping::ShmRingMapping(ShmRingMapping&& mp) noexcept:
+        mapping(std::exchange(mp.mapping, nullptr)), mappedSize(std::exchange(mp.mappedSize, 0)),
+        header(std::exchange(mp.header, nullptr)), slots(std::exchange(mp.slots, nullptr)),
+        data(std::exchange(mp.data, nullptr)), mask(std::exchange(mp.mask, 0)),
+        segmentName(std::move(mp.segmentName)), errorString(std::move(mp.errorString))
+    {
+    }
+
+    ShmRingMapping& ShmRingMapping::operator=(ShmRingMapping&& mp) noexcept
+    {
+        if (this != &mp) {
+            unmap();
+            mapping = std::exchange(mp.mapping, nullptr);
+            mappedSize = std::exchange(mp.mappedSize, 0);
+            header = std::exchange(mp.header, nullptr);
+            slots = std::exchange(mp.slots, nullptr);
+            data = std::exchange(mp.data, nullptr);
+            mask = std::exchange(mp.mask, 0);
+            segmentName = std::move(mp.segmentName);
+            errorString = std::move(mp.errorString);
+        }
+        return *this;
+    }
+
+    void ShmRingMapping::loadLayout()
+    {
+        auto* base = static_cast<std::byte*>(mapping);
+        header = reinterpret_cast<RingHeader*>(base);
+        slots = reinterpret_cast<SlotHeader*>(base + headerBytes());
+        data = base + segmentBytes(header->slotCount) -
+            static_cast<std::size_t>(header->slotCount) * cShmSlotSize;
+        mask = header->slotCount - 1;
+    }
+
+    void ShmRingMapping::unmap()
+    {
+        if (mapping != nullptr) {
+            munmap(mapping, mappedSize);
+        }
+        mapping = nullptr;
+        mappedSize = 0;
+        header = nullptr;
+        slots = nullptr;
+        data = nullptr;
+        mask = 0;
+    }
+
+    ShmRingReceiver::~ShmRingReceiver()
+    {
+        close();
+    }
+
+    bool ShmRingReceiver::connect(const std::string& connection, int maxMessages, int maxSize)
+    {
+        close();
+        segmentName = shmSegmentName(connection);
+        // the ring is sized for an average message of 16 slots and at least two of the largest
+        auto requested = std::max<std::uint64_t>(
+            static_cast<std::uint64_t>(std::max(maxMessages, 1)) * 16U,
+            2U * ((static_cast<std::uint64_t>(std::max(maxSize, 1)) + cShmSlotSize - 1) /
+                  cShmSlotSize));
+        std::uint64_t slotCount{64};
+        while (slotCount < requested) {
+            slotCount <<= 1U;
+        }
+        int fd = shm_open(segmentName.c_str(), O_CREAT | O_EXCL | O_RDWR, 0600);
+        if (fd < 0 && errno == EEXIST) {
+            if (!removeStaleSegment(segmentName)) {
+                errorString = "shared memory ring " + connection +
+                    " is already in use by a running process";
+                return false;
+            }
+            fd = shm_open(segmentName.c_str(), O_CREAT | O_EXCL | O_RDWR, 0600);
+        }
+        if (fd < 0) {
+            errorString =
+                std::string("Unable to create shared memory ring:") + std::strerror(errno);
+            return false;
+        }
+        auto size = segmentBytes(slotCount);
+        if (ftruncate(fd, static_cast<off_t>(size)) != 0) {
+            errorString = std::string("Unable to size shared memory ring:") + std::strerror(errno);
+            ::close(fd);
+            shm_unlink(segmentName.c_str());
+            return false;
+        }
+        void* mem = mmap(nullptr, size, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+        ::close(fd);
+        if (mem == MAP_FAILED) {
+            errorString = std::string("Unable to map shared memory ring:") + std::strerror(errno);
+            shm_unlink(segmentName.c_str());
+            return false;
+        }
+        mapping = mem;
+        mappedSize = size;
+        owner = true;
+
+        auto* hdr = new (mapping) RingHeader;
+        hdr->slotCount = slotCount;
+        hdr->ownerPid = static_cast<std::int32_t>(getpid());
+        loadLayout();
+        for (std::uint64_t ii = 0; ii < slotCount; ++ii) {
+            auto* slot = new (&slots[ii]) SlotHeader;
+            slot->sequence.store(ii, std::memory_order_relaxed);
+        }
+        dequeuePos = 0;
+        header->state.store(static_cast<std::int32_t>(ring_state_t::connected),
+                            std::memory_order_relaxed);
+        // publishing the magic number makes the ring visible to senders
+        header->magic.store(cRingMagic, std::memory_order_release);
+        return true;
+    }
+
+    std::optional<ActionMessage> ShmRingReceiver::tryGetMessage()
+    {
+        if (header == nullptr) {
+            return std::nullopt;
+        }
+        auto& first = slots[dequeuePos & mask];
+        if (first.sequence.load(std::memory_order_acquire) != dequeuePos + 1) {
+            return std::nullopt;
+        }
+        // continuation slots are published before the first slot so the whole frame is visible
+        const std::uint64_t used = std::max<std::uint32_t>(first.slotsUsed, 1U);
+        const std::size_t bytes = first.frameBytes;
+        const auto start = static_cast<std::size_t>(dequeuePos & mask);
+        std::optional<ActionMessage> cmd;
+        if (used <= mask + 1 && bytes <= used * cShmSlotSize) {
+            cmd.emplace();
+            if (start + used <= mask + 1) {
+                // the frame is contiguous so decode it from the segment without staging it in
+                // the local buffer, the message still makes its own copy of the payload
+                cmd->fromByteArray(data + start * cShmSlotSize, bytes);
+            } else {
+                auto firstPart = (static_cast<std::size_t>(mask + 1) - start) * cShmSlotSize;
+                buffer.resize(bytes);
+                std::memcpy(buffer.data(), data + start * cShmSlotSize, firstPart);
+                std::memcpy(buffer.data() + firstPart, data, bytes - firstPart);
+                cmd->fromByteArray(buffer.data(), bytes);
+            }
+        }
+        const std::uint64_t consumed = (used <= mask + 1) ? used : 1U;
+        for (std::uint64_t ii = 0; ii < consumed; ++ii) {
+            slots[(dequeuePos + ii) & mask].sequence.store(dequeuePos + ii + mask + 1,
+                                                           std::memory_order_release);
+        }
+        dequeuePos += consumed;
+        if (!cmd) {
+            // a corrupted frame, skip it and try the next one
+            return tryGetMessage();
+        }
+        return cmd;
+    }
+
+    std::optional<ActionMessage> ShmRingReceiver::getMessage(std::chrono::milliseconds timeout)
+    {
+        for (int ii = 0; ii < cSpinCount; ++ii) {
+            auto cmd = tryGetMessage();
+            if (cmd || header == nullptr) {
+                return cmd;
+            }
+            if ((ii & 0x3F) == 0x3F) {
+                std::this_thread::yield();
+            }
+        }
+        auto deadline = std::chrono::steady_clock::now() + timeout;
+        while (true) {
+            auto sig = header->signal.load(std::memory_order_acquire);
+            header->waiters.fetch_add(1, std::memory_order_seq_cst);
+            auto cmd = tryGetMessage();
+            if (!cmd) {
+                auto remaining = deadline - std::chrono::steady_clock::now();
+                if (remaining > std::chrono::nanoseconds::zero()) {
+                    futexWait(&header->signal, sig, remaining);
+                }
+            }
+            header->waiters.fetch_sub(1, std::memory_order_seq_cst);
+            if (!cmd) {
+                cmd = tryGetMessage();
+            }
+            if (cmd || std::chrono::steady_clock::now() >= deadline) {
+                return cmd;
+            }
+        }
+    }
+
+    void ShmRingReceiver::close()
+    {
+        if (header != nullptr) {
+            header->state.store(static_cast<std::int32_t>(ring_state_t::closing),
+                                std::memory_order_release);
+        }
+        unmap();
+        if (owner) {
+            shm_unlink(segmentName.c_str());
+            owner = false;
+        }
+    }
+
+    bool ShmRingSender::connect(const std::string& connection, int retries)
+    {
+        unmap();
+        segmentName = shmSegmentName(connection);
+        int tries{0};
+        while (true) {
+            int fd = shm_open(segmentName.c_str(), O_RDWR, 0600);
+            if (fd >= 0) {
+                struct stat sbuf {
+                };
+                if (fstat(fd, &sbuf) == 0 &&
+                    static_cast<std::size_t>(sbuf.st_size) > segmentBytes(64)) {
+                    auto size = static_cast<std::size_t>(sbuf.st_size);
+                    void* mem = mmap(nullptr, size, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+                    if (mem != MAP_FAILED) {
+                        auto* hdr = static_cast<RingHeader*>(mem);
+                        if (hdr->magic.load(std::memory_order_acquire) == cRingMagic &&
+                            hdr->version == cRingVersion &&
+                            segmentBytes(hdr->slotCount) <= size) {
+                            ::close(fd);
+                            mapping = mem;
+                            mappedSize = size;
+                            loadLayout();
+                            return true;
+                        }
+                        munmap(mem, size);
+                    }
+                }
+                ::close(fd);
+                errorString = "shared memory ring " + connection + " is not initialized";
+            } else {
+                errorString =
+                    std::string("Unable to open shared memory ring:") + std::strerror(errno);
+            }
+            if (tries >= retries) {
+                return false;
+            }
+            ++tries;
+            std::this_thread::sleep_for(std::chrono::milliseconds(200));
+        }
+    }
+
+    bool ShmRingSender::sendMessage(const ActionMessage& cmd)
+    {
+        if (header == nullptr) {
+            return false;
+        }
+        const auto bytes = static_cast<std::size_t>(cmd.serializedByteCount());
+        const std::uint64_t needed =
+            std::max<std::uint64_t>(1U, (bytes + cShmSlotSize - 1) / cShmSlotSize);
+        if (needed > mask + 1) {
+            errorString = "message of " + std::to_string(bytes) + " bytes too large for ring";
+            return false;
+        }
+        auto pos = header->enqueuePos.load(std::memory_order_relaxed);
+        std::chrono::steady_clock::time_point deadline{};
+        int waits{0};
+        while (true) {
+            // the consumer frees slots in order so if the last slot is free the whole span is
+            const auto last = pos + needed - 1;
+            const auto seq = slots[last & mask].sequence.load(std::memory_order_acquire);
+            const auto diff = static_cast<std::int64_t>(seq - last);
+            if (diff == 0) {
+                if (header->enqueuePos.compare_exchange_weak(pos,
+                                                             pos + needed,
+                                                             std::memory_order_relaxed)) {
+                    break;
+                }
+            } else if (diff < 0) {
+                // the ring is full so wait for the receiver to catch up
+                if (header->state.load(std::memory_order_acquire) ==
+                    static_cast<std::int32_t>(ring_state_t::closing)) {
+                    errorString = "shared memory ring is closing";
+                    return false;
+                }
+                if (waits == 0) {
+                    deadline = std::chrono::steady_clock::now() + sendTimeout;
+                } else if (std::chrono::steady_clock::now() > deadline) {
+                    errorString = "timeout waiting for space in shared memory ring";
+                    return false;
+                }
+                ++waits;
+                if (waits < 64) {
+                    std::this_thread::yield();
+                } else {
+                    std::this_thread::sleep_for(std::chrono::microseconds(100));
+                }
+                pos = header->enqueuePos.load(std::memory_order_relaxed);
+            } else {
+                pos = header->enqueuePos.load(std::memory_order_relaxed);
+            }
+        }
+        const auto start = static_cast<std::size_t>(pos & mask);
+        if (start + needed <= mask + 1) {
+            // serialize directly into the shared segment
+            cmd.toByteArray(data + start * cShmSlotSize, bytes);
+        } else {
+            buffer.resize(bytes);
+            cmd.toByteArray(buffer.data(), bytes);
+            auto firstPart = (static_cast<std::size_t>(mask + 1) - start) * cShmSlotSize;
+            std::memcpy(data + start * cShmSlotSize, buffer.data(), firstPart);
+            std::memcpy(data, buffer.data() + firstPart, bytes - firstPart);
+        }
+        for (std::uint64_t ii = 1; ii < needed; ++ii) {
+            auto& slot = slots[(pos + ii) & mask];
+            slot.slotsUsed = 0;
+            slot.frameBytes = 0;
+            slot.sequence.store(pos + ii + 1, std::memory_order_release);
+        }
+        auto& first = slots[start];
+        first.frameBytes = static_cast<std::uint32_t>(bytes);
+        first.slotsUsed = static_cast<std::uint32_t>(needed);
+        first.sequence.store(pos + 1, std::memory_order_release);
+
+        header->signal.fetch_add(1, std::memory_order_seq_cst);
+        if (header->waiters.load(std::memory_order_seq_cst) > 0) {
+            futexWake(&header->signal);
+        }
+        return true;
+    }
+
+}  // namespace shm
+}  // namespace helics
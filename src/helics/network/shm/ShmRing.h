@@ -0,0 +1,104 @@
+/*
+Copyright (c) 2017-2022,
+Battelle Memorial Institute; Lawrence Livermore National Security, LLC; Alliance for Sustainable
+Energy, LLC.  See the top-level NOTICE for additional details. All rights reserved.
+SPDX-License-Identifier: BSD-3-Clause
+*/
+#pragma once
+
+#include "helics/core/ActionMessage.hpp"
+
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <optional>
+#include <string>
+#include <vector>
+
+namespace helics {
+namespace shm {
+    struct RingHeader;
+    struct SlotHeader;
+
+    /** the size of a single slot in a ring, messages larger than this span multiple slots*/
+    constexpr std::size_t cShmSlotSize{256};
+
+    /** generate the name of the shared memory segment used for a named ring*/
+    std::string shmSegmentName(const std::string& name);
+
+    /** base class for a mapping of a ring segment into the current process*/
+    class ShmRingMapping {
+      protected:
+        void* mapping{nullptr};  //!< the start of the mapped segment
+        std::size_t mappedSize{0};  //!< the size of the mapped segment
+        RingHeader* header{nullptr};  //!< the ring header at the start of the segment
+        SlotHeader* slots{nullptr};  //!< the array of slot descriptors
+        std::byte* data{nullptr};  //!< the contiguous slot data
+        std::uint64_t mask{0};  //!< mask for converting a position into a slot index
+        std::string segmentName;  //!< the name of the shared memory segment
+        std::string errorString;  //!< description of the last error
+
+        ShmRingMapping() = default;
+        ~ShmRingMapping();
+        ShmRingMapping(ShmRingMapping&& mp) noexcept;
+        ShmRingMapping& operator=(ShmRingMapping&& mp) noexcept;
+        /** set the pointers into the segment after mapping*/
+        void loadLayout();
+        /** release the mapping*/
+        void unmap();
+
+      public:
+        ShmRingMapping(const ShmRingMapping&) = delete;
+        ShmRingMapping& operator=(const ShmRingMapping&) = delete;
+        const std::string& getError() const { return errorString; }
+        /** get the number of slots in the ring*/
+        std::size_t slotCount() const { return static_cast<std::size_t>(mask + 1); }
+    };
+
+    /** a ring owned by the receiving side of a connection
+    @details any number of processes may write into the ring, only the owner reads from it*/
+    class ShmRingReceiver final: public ShmRingMapping {
+      private:
+        std::uint64_t dequeuePos{0};
+        std::vector<std::byte> buffer;  //!< storage for frames that wrap around the ring
+        bool owner{false};
+
+      public:
+        ShmRingReceiver() = default;
+        ~ShmRingReceiver();
+        /** create the shared ring
+        @param connection the name of the ring
+        @param maxMessages the typical number of messages the ring should be able to store
+        @param maxSize the largest message the ring should be able to store*/
+        bool connect(const std::string& connection, int maxMessages, int maxSize);
+        /** get a message if one is immediately available*/
+        std::optional<ActionMessage> tryGetMessage();
+        /** get a message waiting up to timeout for one to become available*/
+        std::optional<ActionMessage> getMessage(std::chrono::milliseconds timeout);
+        /** mark the ring as closing and remove the shared memory segment*/
+        void close();
+    };
+
+    /** a connection for writing messages into a ring owned by another object*/
+    class ShmRingSender final: public ShmRingMapping {
+      private:
+        std::vector<std::byte> buffer;  //!< storage for frames that wrap around the ring
+        std::chrono::milliseconds sendTimeout{4000};
+
+      public:
+        ShmRingSender() = default;
+        ShmRingSender(ShmRingSender&& sender) = default;
+        ShmRingSender& operator=(ShmRingSender&& sender) = default;
+        /** connect to an existing ring
+        @param connection the name of the ring
+        @param retries the number of times to retry if the ring does not exist yet*/
+        bool connect(const std::string& connection, int retries);
+        /** write a message into the ring
+        @return false if the message could not be written*/
+        bool sendMessage(const ActionMessage& cmd);
+        /** set the maximum time to wait for space in a full ring*/
+        void setTimeout(std::chrono::milliseconds timeout) { sendTimeout = timeout; }
+    };
+
+}  // namespace shm
+}  // namespace helics
@@ -7,6 +7,7 @@ SPDX-License-Identifier: BSD-3-Clause
 #include "TcpComms.h"
 
 #include "../../core/ActionMessage.hpp"
+#include "../../core/CompactStringTable.hpp"
 #include "../NetworkBrokerData.hpp"
 #include "../networkDefaults.hpp"
 #include "TcpCommsCommon.h"
@@ -14,6 +15,8 @@ SPDX-License-Identifier: BSD-3-Clause
 #include "gmlc/networking/TcpHelperClasses.h"
 #include "gmlc/networking/TcpOperations.h"
 
+#include <algorithm>
+#include <chrono>
 #include <map>
 #include <memory>
 #include <utility>
@@ -24,6 +27,15 @@ using asio::ip::tcp;
 
 using gmlc::networking::TcpConnection;
 
+namespace {
+    /** packetized data waiting to be written to a single connection*/
+    struct TxBatch {
+        TcpConnection::pointer connection;
+        std::string data;
+        int count{0};
+    };
+}  // namespace
+
 TcpComms::TcpComms() noexcept: NetworkCommsInterface(gmlc::networking::InterfaceTypes::TCP) {}
 
 int TcpComms::getDefaultBrokerPort() const
@@ -40,6 +52,9 @@ void TcpComms::loadNetworkInfo(const NetworkBrokerData& netInfo)
     }
     reuse_address = netInfo.reuse_address;
     encryption_config = netInfo.encryptionConfig;
+    txBatchSize = netInfo.txBatchSize;
+    txBatchDelay = std::chrono::microseconds(netInfo.txBatchDelay);
+    useCompactSerialization = netInfo.useCompactSerialization;
     propertyUnLock();
 }
 
@@ -85,10 +100,22 @@ size_t TcpComms::dataReceive(gmlc::networking::TcpConnection* connection,
                              size_t bytes_received)
 {
     size_t used_total = 0;
+    CompactStringTable* table{nullptr};
+    {
+        // data from a single connection is delivered sequentially so the table itself is only
+        // accessed from one thread at a time
+        std::lock_guard<std::mutex> lock(rxTableLock);
+        auto& tableRef = rxStringTables[connection];
+        if (!tableRef) {
+            tableRef = std::make_unique<CompactStringTable>();
+        }
+        table = tableRef.get();
+    }
     while (used_total < bytes_received) {
         ActionMessage m;
         auto used = m.depacketize(reinterpret_cast<const std::byte*>(data) + used_total,
-                                  bytes_received - used_total);
+                                  bytes_received - used_total,
+                                  table);
         if (used == 0) {
             break;
         }
@@ -176,10 +203,15 @@ void TcpComms::queue_rx_function()
         [this](const TcpConnection::pointer& connection, const char* data, size_t datasize) {
             return dataReceive(connection.get(), data, datasize);
         });
-    CommsInterface* ci = this;
     server->setErrorCall(
-        [ci](const TcpConnection::pointer& connection, const std::error_code& error) {
-            return commErrorHandler(ci, connection.get(), error);
+        [this](const TcpConnection::pointer& connection, const std::error_code& error) {
+            if (commErrorHandler(this, connection.get(), error)) {
+                return true;
+            }
+            // the connection is closing so its string table won't be used again
+            std::lock_guard<std::mutex> lock(rxTableLock);
+            rxStringTables.erase(connection.get());
+            return false;
         });
     server->start();
     setRxStatus(connection_status::connected);
@@ -199,6 +231,10 @@ void TcpComms::queue_rx_function()
     disconnecting = true;
     std::this_thread::sleep_for(std::chrono::milliseconds(50));
     server->close();
+    {
+        std::lock_guard<std::mutex> lock(rxTableLock);
+        rxStringTables.clear();
+    }
     setRxStatus(connection_status::terminated);
 }
 
@@ -417,16 +453,102 @@ void TcpComms::queue_tx_function()
     }
     setTxStatus(connection_status::connected);
 
-    //  std::vector<ActionMessage> txlist;
+    // pending data for each connection when transmit batching is enabled
+    std::vector<TxBatch> batches;
+    std::string packet;
+    // string tables for the compact serialization on each connection
+    std::map<const TcpConnection*, CompactStringTable> txStringTables;
+
+    auto encode = [&](const TcpConnection::pointer& connection, const ActionMessage& cmd) {
+        if (useCompactSerialization) {
+            cmd.packetize_compact(packet, &txStringTables[connection.get()]);
+        } else {
+            cmd.packetize(packet);
+        }
+    };
+    std::size_t pendingBytes{0};
+    auto batchStart = std::chrono::steady_clock::now();
+
+    auto flushBatches = [this, &batches, &pendingBytes]() {
+        for (auto& batch : batches) {
+            if (batch.data.empty()) {
+                continue;
+            }
+            try {
+                batch.connection->send(batch.data);
+            }
+            catch (const std::system_error& se) {
+                if (se.code() != asio::error::connection_aborted) {
+                    logError(std::string("batch send of ") + std::to_string(batch.count) +
+                             " messages::" + se.what());
+                }
+            }
+            batch.data.clear();
+            batch.count = 0;
+        }
+        pendingBytes = 0;
+    };
+    // add a message to the batch for a connection, returns false if batching is disabled
+    auto batchMessage = [&](const TcpConnection::pointer& connection, const ActionMessage& cmd) {
+        if (txBatchSize <= 0) {
+            return false;
+        }
+        auto bfind = std::find_if(batches.begin(), batches.end(), [&connection](const auto& bt) {
+            return bt.connection == connection;
+        });
+        if (bfind == batches.end()) {
+            batches.push_back(TxBatch{connection, std::string{}, 0});
+            batches.back().data.reserve(static_cast<std::size_t>(txBatchSize));
+            bfind = std::prev(batches.end());
+        }
+        if (pendingBytes == 0) {
+            batchStart = std::chrono::steady_clock::now();
+        }
+        encode(connection, cmd);
+        bfind->data.append(packet);
+        ++bfind->count;
+        pendingBytes += packet.size();
+        if (bfind->data.size() >= static_cast<std::size_t>(txBatchSize) ||
+            (txBatchDelay.count() > 0 &&
+             std::chrono::steady_clock::now() - batchStart >= txBatchDelay)) {
+            flushBatches();
+        }
+        return true;
+    };
+
     bool processing{true};
     while (processing) {
         route_id rid;
         ActionMessage cmd;
 
-        std::tie(rid, cmd) = txQueue.pop();
+        if (pendingBytes > 0) {
+            // wait for more messages until the batch delay expires then flush the partial batch,
+            // the queue waits in whole milliseconds so the wait never runs past the delay
+            auto next = txQueue.try_pop();
+            if (!next) {
+                auto remaining = std::chrono::duration_cast<std::chrono::milliseconds>(
+                    txBatchDelay - (std::chrono::steady_clock::now() - batchStart));
+                if (remaining.count() > 0) {
+                    next = txQueue.pop(remaining);
+                }
+            }
+            if (next) {
+                std::tie(rid, cmd) = std::move(*next);
+            } else {
+                flushBatches();
+                std::tie(rid, cmd) = txQueue.pop();
+            }
+        } else {
+            std::tie(rid, cmd) = txQueue.pop();
+        }
+        recordTransmitLatency(rid, cmd);
         bool processed = false;
         if (isProtocolCommand(cmd)) {
             if (rid == control_route) {
+                if (pendingBytes > 0) {
+                    // route changes and disconnects must not overtake queued data
+                    flushBatches();
+                }
                 switch (cmd.messageID) {
                     case NEW_ROUTE: {
                         std::string newroute(cmd.payload.to_string());
@@ -447,10 +569,15 @@ void TcpComms::queue_tx_function()
                         }
                         processed = true;
                     } break;
-                    case REMOVE_ROUTE:
-                        routes.erase(route_id{cmd.getExtraData()});
+                    case REMOVE_ROUTE: {
+                        batches.clear();
+                        auto rt_remove = routes.find(route_id{cmd.getExtraData()});
+                        if (rt_remove != routes.end()) {
+                            txStringTables.erase(rt_remove->second.get());
+                            routes.erase(rt_remove);
+                        }
                         processed = true;
-                        break;
+                    } break;
                     case CLOSE_RECEIVER:
                         rxMessageQueue.push(cmd);
                         processed = true;
@@ -467,9 +594,10 @@ void TcpComms::queue_tx_function()
         }
 
         if (rid == parent_route_id) {
-            if (hasBroker) {
+            if (hasBroker && !batchMessage(brokerConnection, cmd)) {
                 try {
-                    brokerConnection->send(cmd.packetize());
+                    encode(brokerConnection, cmd);
+                    brokerConnection->send(packet);
                 }
                 catch (const std::system_error& se) {
                     if (se.code() != asio::error::connection_aborted) {
@@ -492,8 +620,12 @@ void TcpComms::queue_tx_function()
             //  txlist.push_back(cmd);
             auto rt_find = routes.find(rid);
             if (rt_find != routes.end()) {
+                if (batchMessage(rt_find->second, cmd)) {
+                    continue;
+                }
                 try {
-                    rt_find->second->send(cmd.packetize());
+                    encode(rt_find->second, cmd);
+                    rt_find->second->send(packet);
                 }
                 catch (const std::system_error& se) {
                     if (se.code() != asio::error::connection_aborted) {
@@ -505,8 +637,12 @@ void TcpComms::queue_tx_function()
                 }
             } else {
                 if (hasBroker) {
+                    if (batchMessage(brokerConnection, cmd)) {
+                        continue;
+                    }
                     try {
-                        brokerConnection->send(cmd.packetize());
+                        encode(brokerConnection, cmd);
+                        brokerConnection->send(packet);
                     }
                     catch (const std::system_error& se) {
                         if (se.code() != asio::error::connection_aborted) {
@@ -526,6 +662,8 @@ void TcpComms::queue_tx_function()
             }
         }
     }
+    flushBatches();
+    batches.clear();
     for (auto& rt : routes) {
         rt.second->close();
     }
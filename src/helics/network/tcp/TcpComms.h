@@ -10,7 +10,10 @@ SPDX-License-Identifier: BSD-3-Clause
 #include "gmlc/containers/BlockingQueue.hpp"
 
 #include <atomic>
+#include <chrono>
+#include <map>
 #include <memory>
+#include <mutex>
 #include <set>
 #include <string>
 
@@ -19,6 +22,10 @@ class AsioContextManager;
 class TcpConnection;
 }  // namespace gmlc::networking
 
+namespace helics {
+class CompactStringTable;
+}  // namespace helics
+
 namespace helics::tcp {
 
 /** implementation for the communication interface that uses TCP messages to communicate*/
@@ -36,6 +43,16 @@ class TcpComms final: public NetworkCommsInterface {
   private:
     bool reuse_address{false};
     std::string encryption_config;
+    /// the number of bytes to coalesce into a single write on a connection (0 to disable)
+    int txBatchSize{0};
+    /// the maximum time a partially filled batch is held waiting for more messages
+    std::chrono::microseconds txBatchDelay{0};
+    /// send messages using the compact serialization with a string table per connection
+    bool useCompactSerialization{false};
+    /// lock protecting the rxStringTables map
+    std::mutex rxTableLock;
+    /// string tables for compact messages arriving on each connection
+    std::map<gmlc::networking::TcpConnection*, std::unique_ptr<CompactStringTable>> rxStringTables;
     virtual int getDefaultBrokerPort() const override;
     virtual void queue_rx_function() override;  //!< the functional loop for the receive queue
     virtual void queue_tx_function() override;  //!< the loop for transmitting data
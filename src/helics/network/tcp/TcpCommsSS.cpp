@@ -274,7 +274,7 @@ void TcpCommsSS::queue_tx_function()
         route_id rid;
         ActionMessage cmd;
 
-        std::tie(rid, cmd) = txQueue.pop();
+        std::tie(rid, cmd) = popTransmit();
         bool processed = false;
         if (isProtocolCommand(cmd)) {
             if (rid == control_route) {
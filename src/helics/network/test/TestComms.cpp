@@ -166,6 +166,7 @@ namespace testcore {
             } else {
                 std::tie(rid, cmd) = txQueue.pop();
             }
+            recordTransmitLatency(rid, cmd);
             if (preProcCallback) {
                 preProcCallback(cmd);
             }
@@ -353,7 +353,7 @@ void UdpComms::queue_tx_function()
         route_id rid;
         ActionMessage cmd;
 
-        std::tie(rid, cmd) = txQueue.pop();
+        std::tie(rid, cmd) = popTransmit();
         bool processed = false;
         if (isProtocolCommand(cmd)) {
             if (rid == control_route) {
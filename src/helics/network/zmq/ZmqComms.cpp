@@ -461,7 +461,7 @@ void ZmqComms::queue_tx_function()
         route_id rid;
         ActionMessage cmd;
 
-        std::tie(rid, cmd) = txQueue.pop();
+        std::tie(rid, cmd) = popTransmit();
         bool processed = false;
         if (isProtocolCommand(cmd)) {
             if (control_route == rid) {
@@ -371,6 +371,7 @@ void ZmqCommsSS::queue_tx_function()
             bool processed{false};
             cmd = std::move(tx_msg->second);
             rid = tx_msg->first;
+            recordTransmitLatency(rid, cmd);
             if (isProtocolCommand(cmd)) {
                 if (rid == control_route) {
                     processed = true;
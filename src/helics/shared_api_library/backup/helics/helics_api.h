@@ -23,6 +23,7 @@ typedef enum {
     HELICS_CORE_TYPE_HTTP = 12,
     HELICS_CORE_TYPE_WEBSOCKET = 14,
     HELICS_CORE_TYPE_INPROC = 18,
+    HELICS_CORE_TYPE_SHM = 19,
     HELICS_CORE_TYPE_NULL = 66,
     HELICS_CORE_TYPE_EMPTY = 77
 } HelicsCoreTypes;
@@ -129,11 +130,19 @@ typedef enum {
     HELICS_PROPERTY_INT_LOG_LEVEL = 271,
     HELICS_PROPERTY_INT_FILE_LOG_LEVEL = 272,
     HELICS_PROPERTY_INT_CONSOLE_LOG_LEVEL = 274,
-    HELICS_PROPERTY_INT_LOG_BUFFER = 276
+    HELICS_PROPERTY_INT_LOG_BUFFER = 276,
+    HELICS_PROPERTY_INT_WAIT_POLICY = 278
 } HelicsProperties;
 
 const int HELICS_INVALID_PROPERTY_VALUE = -972;
 
+typedef enum {
+    HELICS_WAIT_POLICY_BLOCK = 0,
+    HELICS_WAIT_POLICY_SPIN = 1,
+    HELICS_WAIT_POLICY_SPIN_YIELD = 2,
+    HELICS_WAIT_POLICY_ADAPTIVE = 3
+} HelicsWaitPolicies;
+
 typedef enum {
     HELICS_MULTI_INPUT_NO_OP = 0,
     HELICS_MULTI_INPUT_VECTORIZE_OPERATION = 1,
@@ -160,7 +169,8 @@ typedef enum {
     HELICS_HANDLE_OPTION_MULTI_INPUT_HANDLING_METHOD = 507,
     HELICS_HANDLE_OPTION_INPUT_PRIORITY_LOCATION = 510,
     HELICS_HANDLE_OPTION_CLEAR_PRIORITY_LIST = 512,
-    HELICS_HANDLE_OPTION_CONNECTIONS = 522
+    HELICS_HANDLE_OPTION_CONNECTIONS = 522,
+    HELICS_HANDLE_OPTION_DELTA_ENCODING = 525
 } HelicsHandleOptions;
 
 typedef enum {
@@ -5,6 +5,7 @@ Energy, LLC.  See the top-level NOTICE for additional details. All rights reserv
 SPDX-License-Identifier: BSD-3-Clause
 */
 
+#include "helics/application_api/CallbackFederate.hpp"
 #include "helics/application_api/CombinationFederate.hpp"
 #include "helics/application_api/CoreApp.hpp"
 #include "helics/application_api/Endpoints.hpp"
@@ -16,6 +17,8 @@ SPDX-License-Identifier: BSD-3-Clause
 #include "testFixtures.hpp"
 
 #include <future>
+#include <stdexcept>
+#include <vector>
 #include <gtest/gtest.h>
 
 class combofed_single_type_tests:
@@ -343,3 +346,153 @@ TEST(comboFederate, constructor3)
     mf1.disconnect();
     EXPECT_TRUE(cr.waitForDisconnect(std::chrono::milliseconds(500)));
 }
+
+TEST(comboFederate, publication_fanout)
+{
+    auto brk = helics::BrokerFactory::create(helics::CoreType::TEST, "fanout_broker", "-f 3");
+    helics::FederateInfo fi(helics::CoreType::TEST);
+    fi.setProperty(HELICS_PROPERTY_INT_LOG_LEVEL, HELICS_LOG_LEVEL_ERROR);
+    fi.coreName = "fanout_core1";
+    fi.coreInitString = "-f 2 --broker=fanout_broker";
+    helics::CombinationFederate fed1("fed1", fi);
+    helics::CombinationFederate fed2("fed2", fi);
+    fi.coreName = "fanout_core2";
+    fi.coreInitString = "-f 1 --broker=fanout_broker";
+    helics::CombinationFederate fed3("fed3", fi);
+
+    auto& pub = fed1.registerGlobalPublication<double>("fanout_pub");
+    // local inputs and endpoint share one fanout, the remote inputs another
+    auto& in1 = fed2.registerSubscription("fanout_pub");
+    auto& in2 = fed2.registerSubscription("fanout_pub");
+    auto& ept = fed2.registerGlobalEndpoint("fanout_ept");
+    ept.subscribe("fanout_pub");
+    auto& rin1 = fed3.registerSubscription("fanout_pub");
+    auto& rin2 = fed3.registerSubscription("fanout_pub");
+
+    auto f1exec = std::async(std::launch::async, [&]() { fed1.enterExecutingMode(); });
+    auto f3exec = std::async(std::launch::async, [&]() { fed3.enterExecutingMode(); });
+    fed2.enterExecutingMode();
+    f1exec.get();
+    f3exec.get();
+
+    auto f1ops = std::async(std::launch::async, [&]() {
+        fed1.requestTime(1.0);
+        pub.publish(2.5);
+        fed1.requestTime(4.0);
+        fed1.finalize();
+    });
+    auto f3time = std::async(std::launch::async, [&]() { return fed3.requestTime(5.0); });
+    EXPECT_EQ(fed2.requestTime(5.0), 1.0);
+    EXPECT_EQ(f3time.get(), 1.0);
+
+    EXPECT_TRUE(in1.isUpdated());
+    EXPECT_DOUBLE_EQ(in1.getValue<double>(), 2.5);
+    EXPECT_TRUE(in2.isUpdated());
+    EXPECT_DOUBLE_EQ(in2.getValue<double>(), 2.5);
+    EXPECT_TRUE(rin1.isUpdated());
+    EXPECT_DOUBLE_EQ(rin1.getValue<double>(), 2.5);
+    EXPECT_TRUE(rin2.isUpdated());
+    EXPECT_DOUBLE_EQ(rin2.getValue<double>(), 2.5);
+    EXPECT_EQ(ept.pendingMessageCount(), 1U);
+    auto mess = ept.getMessage();
+    ASSERT_TRUE(mess);
+    EXPECT_EQ(mess->time, 1.0);
+
+    // the value is delivered only once and the next grant is not held back by the fanout
+    f3time = std::async(std::launch::async, [&]() { return fed3.requestTime(5.0); });
+    EXPECT_EQ(fed2.requestTime(5.0), 5.0);
+    EXPECT_EQ(f3time.get(), 5.0);
+    f1ops.get();
+    EXPECT_FALSE(in1.isUpdated());
+    EXPECT_FALSE(rin1.isUpdated());
+    EXPECT_EQ(ept.pendingMessageCount(), 0U);
+
+    fed2.finalize();
+    fed3.finalize();
+    brk->waitForDisconnect();
+}
+
+TEST(callbackFederate, value_exchange)
+{
+    auto cr = helics::CoreFactory::create(helics::CoreType::TEST,
+                                          "--name=cbcore --autobroker --federates=2");
+    helics::FederateInfo fi(helics::CoreType::TEST);
+    fi.setProperty(HELICS_PROPERTY_INT_LOG_LEVEL, HELICS_LOG_LEVEL_ERROR);
+    helics::CallbackFederate fed1("fed1", cr, fi);
+    helics::CallbackFederate fed2("fed2", cr, fi);
+
+    auto& pub = fed1.registerGlobalPublication<double>("pub1");
+    auto& sub = fed2.registerSubscription("pub1");
+
+    int initCount{0};
+    fed1.setInitializeCallback([&]() {
+        pub.publish(1.0);
+        return (++initCount < 2) ? helics::IterationRequest::ITERATE_IF_NEEDED :
+                                   helics::IterationRequest::NO_ITERATIONS;
+    });
+    fed1.setNextTimeCallback([&](helics::Time t) {
+        pub.publish(static_cast<double>(t) + 2.0);
+        return (t < 5.0) ? t + 1.0 : helics::Time::maxVal();
+    });
+    std::vector<double> received;
+    fed2.setNextTimeCallback([&](helics::Time t) {
+        if (sub.isUpdated()) {
+            received.push_back(sub.getValue<double>());
+        }
+        return (t < 6.0) ? t + 1.0 : helics::Time::maxVal();
+    });
+    bool finalized{false};
+    fed2.setFinalizeCallback([&finalized]() { finalized = true; });
+
+    fed1.startOperations();
+    fed2.startOperations();
+    EXPECT_THROW(fed1.startOperations(), helics::InvalidFunctionCall);
+    fed1.waitForCompletion();
+    fed2.waitForCompletion();
+    EXPECT_TRUE(fed1.isCompleted());
+    EXPECT_TRUE(fed2.isCompleted());
+    EXPECT_TRUE(finalized);
+    EXPECT_EQ(initCount, 2);
+    ASSERT_GE(received.size(), 2U);
+    EXPECT_DOUBLE_EQ(received.front(), 1.0);
+    EXPECT_DOUBLE_EQ(received.back(), 7.0);
+    EXPECT_TRUE(fed1.getCurrentMode() == helics::Federate::Modes::FINISHED);
+    cr->waitForDisconnect(std::chrono::milliseconds(500));
+    cr.reset();
+}
+
+TEST(callbackFederate, callback_error)
+{
+    auto cr = helics::CoreFactory::create(helics::CoreType::TEST, "--name=cbcore2 --autobroker");
+    helics::FederateInfo fi(helics::CoreType::TEST);
+    fi.setProperty(HELICS_PROPERTY_INT_LOG_LEVEL, HELICS_LOG_LEVEL_ERROR);
+    helics::CallbackFederate fed1("fed1", cr, fi);
+    fed1.setNextTimeCallback([](helics::Time t) -> helics::Time {
+        if (t >= 2.0) {
+            throw(std::runtime_error("callback failure"));
+        }
+        return t + 1.0;
+    });
+    EXPECT_THROW(fed1.waitForCompletion(), helics::InvalidFunctionCall);
+    fed1.startOperations();
+    EXPECT_THROW(fed1.waitForCompletion(), std::runtime_error);
+    EXPECT_TRUE(fed1.isCompleted());
+    cr->waitForDisconnect(std::chrono::milliseconds(500));
+    cr.reset();
+}
+
+TEST(callbackFederate, realtime_rejected)
+{
+    auto cr = helics::CoreFactory::create(helics::CoreType::TEST, "--name=cbcore3 --autobroker");
+    helics::FederateInfo fi(helics::CoreType::TEST);
+    fi.setProperty(HELICS_PROPERTY_INT_LOG_LEVEL, HELICS_LOG_LEVEL_ERROR);
+    helics::CallbackFederate fed1("fed1", cr, fi);
+    EXPECT_THROW(fed1.setFlagOption(HELICS_FLAG_REALTIME), helics::InvalidParameter);
+    EXPECT_FALSE(fed1.getFlagOption(HELICS_FLAG_REALTIME));
+
+    fi.setFlagOption(HELICS_FLAG_REALTIME);
+    EXPECT_THROW(helics::CallbackFederate("fed2", cr, fi), helics::InvalidParameter);
+    fed1.finalize();
+    cr->waitForDisconnect(std::chrono::milliseconds(500));
+    cr.reset();
+}
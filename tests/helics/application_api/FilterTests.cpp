@@ -1274,6 +1274,71 @@ TEST_F(filter, reroute_separate_dest_target)
     filt->finalize();
 }
 
+TEST_F(filter, filter_workers)
+{
+    extraCoreArgs = " --filter_workers=2 ";
+    auto broker = AddBroker("test", 2);
+    AddFederates<helics::MessageFederate>("test", 2, broker, 1.0, "fed");
+
+    auto send = GetFederateAs<helics::MessageFederate>(0);
+    auto rec = GetFederateAs<helics::MessageFederate>(1);
+
+    auto& p1 = send->registerGlobalEndpoint("send");
+    auto& p2 = rec->registerGlobalEndpoint("rec");
+    p1.setDefaultDestination("rec");
+
+    // the delay and destination filters run on the workers, the other filter on the core
+    auto& f1 = helics::make_filter(helics::FilterTypes::DELAY, send.get(), "delay");
+    f1.set("delay", 0.5);
+    f1.addSourceTarget("send");
+    auto& f2 = send->registerFilter("mark");
+    auto op2 = std::make_shared<helics::MessageDataOperator>();
+    op2->setDataFunction([](helics::SmallBuffer& db) { db.push_back('s'); });
+    f2.setOperator(op2);
+    f2.addSourceTarget("send");
+    auto& f3 = rec->registerFilter("dmark");
+    auto op3 = std::make_shared<helics::MessageDataOperator>();
+    op3->setDataFunction([](helics::SmallBuffer& db) { db.push_back('d'); });
+    op3->setStateless();
+    f3.setOperator(op3);
+    f3.addDestinationTarget("rec");
+
+    auto act1 = [&p1, &send]() {
+        send->enterExecutingMode();
+        int count{0};
+        helics::Time tr = helics::timeZero;
+        while (tr < 5.0) {
+            for (int ii = 0; ii < 50; ++ii) {
+                p1.send(std::to_string(count++));
+            }
+            tr = send->requestTimeAdvance(1.0);
+        }
+        send->finalize();
+    };
+    int mcnt{0};
+    auto act2 = [&rec, &mcnt, &p2]() {
+        rec->enterExecutingMode();
+        helics::Time tr = helics::timeZero;
+        while (tr < 10.0) {
+            tr = rec->requestTimeAdvance(1.0);
+            while (p2.hasMessage()) {
+                auto m = p2.getMessage();
+                // the messages arrive in the order they were sent
+                EXPECT_EQ(m->data.to_string(), std::to_string(mcnt) + "sd");
+                EXPECT_EQ(m->time, static_cast<double>(mcnt / 50) + 0.5);
+                ++mcnt;
+            }
+        }
+        rec->finalize();
+    };
+
+    auto t1 = std::thread(act1);
+    auto t2 = std::thread(act2);
+    t1.join();
+    t2.join();
+    EXPECT_EQ(mcnt, 250);
+}
+
 TEST_F(filter, separate_slow_filter_ci_skip)
 {
     auto broker = AddBroker(rerouteType, 3);
@@ -874,6 +874,52 @@ TEST(logging, log_buffer_core2)
     cr.reset();
 }
 
+TEST(logging, async_logging_core)
+{
+    helics::FederateInfo fi(CORE_TYPE_TO_TEST);
+    fi.coreName = "asynclogcore";
+    fi.coreInitString =
+        "--autobroker --loglevel=timing --async_logging=64 --log_overflow_policy=block";
+    auto Fed1 = std::make_shared<helics::Federate>("monitor1", fi);
+    auto cr = Fed1->getCorePointer();
+    // the core can outlive the test so the log storage is shared with the callback
+    auto mlog =
+        std::make_shared<gmlc::libguarded::guarded<std::vector<std::pair<int, std::string>>>>();
+    cr->setLoggingCallback(
+        helics::gLocalCoreId,
+        [mlog](int level, std::string_view /*unused*/, std::string_view message) {
+            mlog->lock()->emplace_back(level, message);
+        });
+
+    Fed1->enterExecutingMode();
+    for (int ii = 1; ii <= 10; ++ii) {
+        cr->logMessage(helics::gLocalCoreId, HELICS_LOG_LEVEL_SUMMARY, "async MEXAGE");
+        auto rtime = Fed1->requestTime(ii);
+        EXPECT_EQ(rtime, ii);
+    }
+    auto str =
+        cr->query("core", "dropped_logs", HelicsSequencingModes::HELICS_SEQUENCING_MODE_ORDERED);
+    EXPECT_EQ(str, "0");
+    Fed1->finalize();
+    cr->waitForDisconnect();
+
+    // the messages are written by a background thread
+    int count{0};
+    for (int ii = 0; ii < 20 && count < 10; ++ii) {
+        count = 0;
+        for (const auto& message : *mlog->lock()) {
+            if (message.second.find("MEXAGE") != std::string::npos) {
+                ++count;
+            }
+        }
+        if (count < 10) {
+            std::this_thread::sleep_for(std::chrono::milliseconds(50));
+        }
+    }
+    EXPECT_EQ(count, 10);
+    cr.reset();
+}
+
 TEST(logging, remote_log_broker)
 {
     auto broker = helics::BrokerFactory::create(helics::CoreType::TEST, "--name=broker8");
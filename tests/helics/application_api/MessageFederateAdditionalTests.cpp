@@ -5,10 +5,13 @@ Energy, LLC.  See the top-level NOTICE for additional details. All rights reserv
 SPDX-License-Identifier: BSD-3-Clause
 */
 
+#include "helics/application_api/CombinationFederate.hpp"
 #include "helics/application_api/CoreApp.hpp"
 #include "helics/application_api/Endpoints.hpp"
 #include "helics/application_api/Filters.hpp"
+#include "helics/application_api/Inputs.hpp"
 #include "helics/application_api/MessageFederate.hpp"
+#include "helics/application_api/Publications.hpp"
 #include "helics/core/core-exceptions.hpp"
 #include "helics/core/flagOperations.hpp"
 #include "testFixtures.hpp"
@@ -578,6 +581,57 @@ TEST_F(mfed_tests, send_message1)
     mFed1->finalize();
 }
 
+TEST_F(mfed_tests, endpoint_location_cache)
+{
+    SetupTest<helics::CombinationFederate>("test_2", 2);
+    auto cFed1 = GetFederateAs<helics::CombinationFederate>(0);
+    auto cFed2 = GetFederateAs<helics::CombinationFederate>(1);
+
+    auto& ep1 = cFed1->registerGlobalEndpoint("ep1");
+    auto& ep2 = cFed2->registerGlobalEndpoint("ep2");
+    // the subscription makes fed1 depend on fed2 so its core hears about the disconnect
+    auto& pub = cFed2->registerGlobalPublication<double>("pub");
+    cFed1->registerSubscription("pub");
+
+    cFed1->enterExecutingModeAsync();
+    cFed2->enterExecutingMode();
+    cFed1->enterExecutingModeComplete();
+
+    const std::string message1{"message1"};
+    ep1.sendTo(message1, "ep2");
+    pub.publish(1.0);
+    cFed1->requestTimeAsync(1.0);
+    cFed2->requestTime(1.0);
+    cFed1->requestTimeComplete();
+    EXPECT_EQ(ep2.pendingMessageCount(), 1U);
+
+    // the first message goes through the broker which returns the location of ep2
+    auto res = cFed1->query("core", "endpoint_locations", HELICS_SEQUENCING_MODE_ORDERED);
+    EXPECT_NE(res.find("\"routed_by_name\" : 1"), std::string::npos);
+    EXPECT_NE(res.find("\"ep2\""), std::string::npos);
+
+    // the second message uses the cached location
+    ep1.sendTo(message1, "ep2");
+    cFed1->requestTimeAsync(2.0);
+    cFed2->requestTime(2.0);
+    cFed1->requestTimeComplete();
+    EXPECT_EQ(ep2.pendingMessageCount(), 2U);
+    res = cFed1->query("core", "endpoint_locations", HELICS_SEQUENCING_MODE_ORDERED);
+    EXPECT_NE(res.find("\"routed_by_name\" : 1"), std::string::npos);
+
+    // the location is evicted when the federate holding the endpoint disconnects
+    cFed2->finalize();
+    cFed1->requestTime(3.0);
+    res = cFed1->query("core", "endpoint_locations", HELICS_SEQUENCING_MODE_ORDERED);
+    EXPECT_EQ(res.find("\"ep2\""), std::string::npos);
+
+    // and messages fall back to the broker
+    ep1.sendTo(message1, "ep2");
+    res = cFed1->query("core", "endpoint_locations", HELICS_SEQUENCING_MODE_ORDERED);
+    EXPECT_NE(res.find("\"routed_by_name\" : 2"), std::string::npos);
+    cFed1->finalize();
+}
+
 TEST(messageFederate, constructor1)
 {
     helics::MessageFederate mf1("fed1", "--coretype=test --autobroker --corename=mfc");
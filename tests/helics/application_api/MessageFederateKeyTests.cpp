@@ -229,6 +229,53 @@ TEST_F(mfed_tests, send_receive_2fed_extra)
     EXPECT_TRUE(mFed2->getCurrentMode() == helics::Federate::Modes::FINALIZE);
 }
 
+TEST_F(mfed_tests, send_receive_2fed_get_messages)
+{
+    SetupTest<helics::MessageFederate>("test_7", 2);
+    auto mFed1 = GetFederateAs<helics::MessageFederate>(0);
+    auto mFed2 = GetFederateAs<helics::MessageFederate>(1);
+    auto epid = mFed1->registerEndpoint("ep1");
+    auto epid3 = mFed1->registerEndpoint("ep3");
+    auto epid2 = mFed2->registerGlobalEndpoint("ep2", "random");
+
+    mFed1->setProperty(HELICS_PROPERTY_TIME_DELTA, 1.0);
+    mFed2->setProperty(HELICS_PROPERTY_TIME_DELTA, 1.0);
+    auto f1finish = std::async(std::launch::async, [&]() { mFed1->enterExecutingMode(); });
+    mFed2->enterExecutingMode();
+    f1finish.wait();
+    EXPECT_TRUE(epid2.getMessages(10).empty());
+
+    for (int ii = 0; ii < 5; ++ii) {
+        epid3.sendTo(std::to_string(ii), "ep2");
+        epid.sendTo(std::to_string(ii), "ep2");
+    }
+    auto f1time = std::async(std::launch::async, [&]() { return mFed1->requestTime(1.0); });
+    auto gtime = mFed2->requestTime(1.0);
+    EXPECT_EQ(gtime, 1.0);
+    EXPECT_EQ(f1time.get(), 1.0);
+    EXPECT_EQ(epid2.pendingMessageCount(), 10U);
+
+    auto messages = epid2.getMessages(7);
+    ASSERT_EQ(messages.size(), 7U);
+    EXPECT_EQ(epid2.pendingMessageCount(), 3U);
+    // messages at the same time are ordered by source then by the order they were sent
+    for (int ii = 0; ii < 5; ++ii) {
+        EXPECT_EQ(messages[ii]->original_source, "fed0/ep1");
+        EXPECT_EQ(messages[ii]->to_string(), std::to_string(ii));
+    }
+    EXPECT_EQ(messages[5]->original_source, "fed0/ep3");
+    EXPECT_EQ(messages[5]->to_string(), "0");
+
+    messages = mFed2->getMessages(epid2, 10);
+    ASSERT_EQ(messages.size(), 3U);
+    EXPECT_EQ(messages[2]->to_string(), "4");
+    EXPECT_FALSE(epid2.hasMessage());
+
+    mFed1->finalizeAsync();
+    mFed2->finalize();
+    mFed1->finalizeComplete();
+}
+
 TEST_P(mfed_type_tests, send_receive_2fed_obj)
 {
     using namespace helics;
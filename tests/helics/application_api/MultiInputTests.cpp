@@ -10,9 +10,12 @@ SPDX-License-Identifier: BSD-3-Clause
 #include "helics/application_api/Inputs.hpp"
 #include "helics/application_api/Publications.hpp"
 #include "helics/application_api/ValueFederate.hpp"
+#include "helics/application_api/reductionOperations.hpp"
 #include "helics/common/JsonProcessingFunctions.hpp"
 #include "helics/core/helics_definitions.hpp"
 
+#include <algorithm>
+#include <cmath>
 #include <future>
 #include <gtest/gtest.h>
 #ifndef HELICS_SHARED_LIBRARY
@@ -179,6 +182,45 @@ TEST_F(multiInput, max)
     vFed1->finalize();
 }
 
+TEST_F(multiInput, pattern_target)
+{
+    using namespace helics;
+    SetupTest<ValueFederate>("test", 2, 1.0);
+    auto vFed1 = GetFederateAs<ValueFederate>(0);
+    auto vFed2 = GetFederateAs<ValueFederate>(1);
+
+    auto& pub1 = vFed1->registerGlobalPublication<double>("feeder_1/voltage");
+    auto& pub2 = vFed1->registerGlobalPublication<double>("feeder_2/voltage");
+    auto& pubc = vFed1->registerGlobalPublication<double>("feeder_1/current");
+
+    auto& in1 = vFed2->registerInput<double>("");
+    in1.addTarget("feeder_*/voltage");
+    in1.setOption(helics::defs::Options::MULTI_INPUT_HANDLING_METHOD,
+                  helics::MultiInputHandlingMethod::SUM_OPERATION);
+    auto& in2 = vFed2->registerInput<double>("");
+    in2.addTarget("feeder_?/current");
+    // a publication registered after the pattern target
+    auto& pub3 = vFed1->registerGlobalPublication<double>("feeder_10/voltage");
+
+    vFed1->enterExecutingModeAsync();
+    vFed2->enterExecutingMode();
+    vFed1->enterExecutingModeComplete();
+    EXPECT_EQ(in1.getOption(helics::defs::Options::CONNECTIONS), 3);
+    EXPECT_EQ(in2.getOption(helics::defs::Options::CONNECTIONS), 1);
+
+    pub1.publish(1.0);
+    pub2.publish(2.0);
+    pub3.publish(4.0);
+    pubc.publish(10.0);
+    vFed1->requestNextStepAsync();
+    vFed2->requestNextStep();
+    vFed1->requestNextStepComplete();
+    EXPECT_DOUBLE_EQ(in1.getValue<double>(), 7.0);
+    EXPECT_DOUBLE_EQ(in2.getValue<double>(), 10.0);
+    vFed1->finalize();
+    vFed2->finalize();
+}
+
 TEST_F(multiInput, min)
 {
     using namespace helics;
@@ -377,6 +419,53 @@ TEST_F(multiInput, average)
     vFed1->finalize();
 }
 
+TEST_F(multiInput, sum_many)
+{
+    using namespace helics;
+    SetupTest<ValueFederate>("test", 1, 1.0);
+    auto vFed1 = GetFederateAs<ValueFederate>(0);
+
+    std::vector<Publication*> pubs;
+    auto& in1 = vFed1->registerInput<double>("");
+    for (int ii = 0; ii < 40; ++ii) {
+        auto name = "pub" + std::to_string(ii);
+        if (ii % 2 == 0) {
+            pubs.push_back(&vFed1->registerGlobalPublication<double>(name));
+        } else {
+            pubs.push_back(&vFed1->registerGlobalPublication(name, "vector"));
+        }
+        in1.addTarget(name);
+    }
+    in1.setOption(helics::defs::Options::MULTI_INPUT_HANDLING_METHOD,
+                  helics::MultiInputHandlingMethod::SUM_OPERATION);
+    vFed1->enterExecutingMode();
+
+    double expected{0.0};
+    for (int ii = 0; ii < 40; ++ii) {
+        if (ii % 2 == 0) {
+            pubs[ii]->publish(static_cast<double>(ii));
+            expected += static_cast<double>(ii);
+        } else {
+            pubs[ii]->publish(std::vector<double>{1.0, -0.5, static_cast<double>(ii)});
+            expected += 0.5 + static_cast<double>(ii);
+        }
+    }
+    vFed1->requestNextStep();
+    EXPECT_DOUBLE_EQ(in1.getValue<double>(), expected);
+
+    in1.setOption(helics::defs::Options::MULTI_INPUT_HANDLING_METHOD,
+                  helics::MultiInputHandlingMethod::VECTORIZE_OPERATION);
+    pubs[1]->publish(std::vector<double>{2.0});
+    vFed1->requestNextStep();
+    auto val = in1.getValue<std::vector<double>>();
+    ASSERT_EQ(val.size(), 78U);
+    EXPECT_DOUBLE_EQ(val[0], 0.0);
+    EXPECT_DOUBLE_EQ(val[1], 2.0);
+    EXPECT_DOUBLE_EQ(val[2], 2.0);
+    EXPECT_DOUBLE_EQ(val.back(), 39.0);
+    vFed1->finalize();
+}
+
 TEST_F(multiInput, diff)
 {
     using namespace helics;
@@ -611,3 +700,41 @@ TEST_F(multiInput, file_config_toml)
 
     vFed.finalize();
 }
+
+TEST(reductionKernels, sum)
+{
+    std::vector<double> data;
+    double expected{0.0};
+    for (int ii = 0; ii < 45; ++ii) {
+        EXPECT_DOUBLE_EQ(helics::reduction::sum(data.data(), data.size()), expected);
+        data.push_back(static_cast<double>(ii) * 0.25 - 3.0);
+        expected += data.back();
+    }
+}
+
+TEST(reductionKernels, max_min)
+{
+    std::vector<double> data;
+    EXPECT_EQ(helics::reduction::max(data.data(), data.size()), helics::invalidDouble);
+    EXPECT_EQ(helics::reduction::min(data.data(), data.size()), helics::invalidDouble);
+    for (int ii = 0; ii < 45; ++ii) {
+        data.push_back(static_cast<double>((ii * 17) % 45) - 20.0);
+        auto bounds = std::minmax_element(data.begin(), data.end());
+        EXPECT_EQ(helics::reduction::max(data.data(), data.size()), *bounds.second);
+        EXPECT_EQ(helics::reduction::min(data.data(), data.size()), *bounds.first);
+    }
+    // NaN values after the first are skipped
+    data[13] = std::nan("");
+    EXPECT_EQ(helics::reduction::max(data.data(), data.size()), 24.0);
+    EXPECT_EQ(helics::reduction::min(data.data(), data.size()), -20.0);
+}
+
+TEST(reductionKernels, append)
+{
+    std::vector<double> buffer{1.0};
+    auto vectorData = helics::ValueConverter<std::vector<double>>::convert({2.0, 3.0, 4.0});
+    helics::reduction::appendVectorData(vectorData, buffer);
+    auto doubleData = helics::ValueConverter<double>::convert(5.0);
+    helics::reduction::appendVectorData(doubleData, buffer);
+    EXPECT_EQ(buffer, std::vector<double>({1.0, 2.0, 3.0, 4.0, 5.0}));
+}
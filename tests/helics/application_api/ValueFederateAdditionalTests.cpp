@@ -10,6 +10,7 @@ SPDX-License-Identifier: BSD-3-Clause
 #include "helics/application_api/Publications.hpp"
 #include "helics/application_api/Subscriptions.hpp"
 #include "helics/application_api/ValueFederate.hpp"
+#include "helics/common/JsonProcessingFunctions.hpp"
 #include "helics/core/BrokerFactory.hpp"
 #include "helics/core/CoreFactory.hpp"
 #include "testFixtures.hpp"
@@ -34,6 +35,8 @@ class valuefed_add_type_tests_ci_skip:
 
 class valuefed_add_tests_ci_skip: public ::testing::Test, public FederateTestFixture {};
 
+class valuefed_add_tests: public ::testing::Test, public FederateTestFixture {};
+
 /** test simple creation and destruction*/
 TEST_P(valuefed_add_single_type_tests_ci_skip, initialize)
 {
@@ -1227,3 +1230,189 @@ TEST(valuefederate, duplicate_targets)
 
     Fed1->finalize();
 }
+
+TEST(valuefederate, processing_shards)
+{
+    const int fedCount{4};
+    const int stepCount{20};
+    helics::FederateInfo fi(helics::CoreType::TEST);
+    fi.coreName = "core_shards";
+    fi.coreInitString = "-f 4 --autobroker --processing_shards=2";
+    fi.setProperty(HELICS_PROPERTY_TIME_PERIOD, 1.0);
+
+    std::vector<std::shared_ptr<helics::ValueFederate>> feds;
+    for (int ii = 0; ii < fedCount; ++ii) {
+        feds.push_back(std::make_shared<helics::ValueFederate>("vfed" + std::to_string(ii), fi));
+        feds.back()->registerGlobalPublication<int64_t>("pub" + std::to_string(ii));
+    }
+    for (int ii = 0; ii < fedCount; ++ii) {
+        feds[ii]->registerSubscription("pub" + std::to_string((ii + 1) % fedCount));
+    }
+    std::vector<std::future<int>> results;
+    for (int ii = 0; ii < fedCount; ++ii) {
+        results.push_back(std::async(std::launch::async, [fed = feds[ii], stepCount]() {
+            auto& pub = fed->getPublication(0);
+            auto& sub = fed->getInput(0);
+            int errors{0};
+            fed->enterExecutingMode();
+            for (int64_t step = 1; step <= stepCount; ++step) {
+                pub.publish(step);
+                auto granted = fed->requestTime(static_cast<double>(step));
+                if (granted != static_cast<double>(step) || sub.getValue<int64_t>() != step) {
+                    ++errors;
+                }
+            }
+            fed->finalize();
+            return errors;
+        }));
+    }
+    for (auto& result : results) {
+        EXPECT_EQ(result.get(), 0);
+    }
+}
+
+TEST(valuefederate, processing_shards_fanout)
+{
+    const int fedCount{4};
+    const int stepCount{20};
+    helics::FederateInfo fi(helics::CoreType::TEST);
+    fi.coreName = "core_shards_fanout";
+    fi.coreInitString = "-f 4 --autobroker --processing_shards=2";
+    fi.setProperty(HELICS_PROPERTY_TIME_PERIOD, 1.0);
+
+    std::vector<std::shared_ptr<helics::ValueFederate>> feds;
+    for (int ii = 0; ii < fedCount; ++ii) {
+        feds.push_back(std::make_shared<helics::ValueFederate>("vfed" + std::to_string(ii), fi));
+        feds.back()->registerGlobalPublication<int64_t>("pub" + std::to_string(ii));
+    }
+    // each publication has two subscribers so the values are sent as fanout publications
+    for (int ii = 0; ii < fedCount; ++ii) {
+        feds[ii]->registerSubscription("pub" + std::to_string((ii + 1) % fedCount));
+        feds[ii]->registerSubscription("pub" + std::to_string((ii + 2) % fedCount));
+    }
+    std::vector<std::future<int>> results;
+    for (int ii = 0; ii < fedCount; ++ii) {
+        results.push_back(std::async(std::launch::async, [fed = feds[ii], stepCount]() {
+            auto& pub = fed->getPublication(0);
+            auto& sub1 = fed->getInput(0);
+            auto& sub2 = fed->getInput(1);
+            int errors{0};
+            fed->enterExecutingMode();
+            for (int64_t step = 1; step <= stepCount; ++step) {
+                pub.publish(step);
+                auto granted = fed->requestTime(static_cast<double>(step));
+                if (granted != static_cast<double>(step) || sub1.getValue<int64_t>() != step ||
+                    sub2.getValue<int64_t>() != step) {
+                    ++errors;
+                }
+            }
+            fed->finalize();
+            return errors;
+        }));
+    }
+    for (auto& result : results) {
+        EXPECT_EQ(result.get(), 0);
+    }
+}
+
+TEST_F(valuefed_add_tests_ci_skip, bulk_registration)
+{
+    SetupTest<helics::ValueFederate>("test", 2);
+    auto vFed1 = GetFederateAs<helics::ValueFederate>(0);
+    auto vFed2 = GetFederateAs<helics::ValueFederate>(1);
+    const int interfaceCount{20};
+
+    std::vector<helics::ValueInterfaceDefinition> pubDefs;
+    std::vector<helics::ValueInterfaceDefinition> inpDefs;
+    for (int ii = 0; ii < interfaceCount; ++ii) {
+        pubDefs.push_back({false, "bpub" + std::to_string(ii), "double", "V"});
+        inpDefs.push_back({true, "binp" + std::to_string(ii), "double", "V"});
+    }
+    // an unnamed input in the block
+    inpDefs.push_back({true, std::string{}, "double", std::string{}});
+    auto pubs = vFed1->registerGlobalValueInterfaces(pubDefs);
+    auto inps = vFed2->registerGlobalValueInterfaces(inpDefs);
+    ASSERT_EQ(pubs.size(), pubDefs.size());
+    ASSERT_EQ(inps.size(), inpDefs.size());
+    EXPECT_EQ(vFed1->getPublicationCount(), interfaceCount);
+    EXPECT_EQ(vFed2->getInputCount(), interfaceCount + 1);
+    for (int ii = 0; ii < interfaceCount; ++ii) {
+        EXPECT_EQ(pubs[ii]->getName(), "bpub" + std::to_string(ii));
+        inps[ii]->addTarget("bpub" + std::to_string(ii));
+    }
+    inps.back()->addTarget("bpub0");
+
+    // duplicates are rejected whether they are already registered or within the block
+    std::vector<helics::ValueInterfaceDefinition> dupDefs{{false, "bpub2", "double", ""}};
+    EXPECT_THROW(vFed1->registerGlobalValueInterfaces(dupDefs), helics::RegistrationFailure);
+    dupDefs = {{false, "bnew", "double", ""}, {false, "bnew", "double", ""}};
+    EXPECT_THROW(vFed1->registerGlobalValueInterfaces(dupDefs), helics::RegistrationFailure);
+
+    vFed1->enterExecutingModeAsync();
+    vFed2->enterExecutingMode();
+    vFed1->enterExecutingModeComplete();
+    // the unnamed input is registered with the broker like a single registration would be
+    auto counts = helics::fileops::loadJsonStr(vFed2->query("root", "counts"));
+    EXPECT_EQ(counts["interfaces"].asInt(), 2 * interfaceCount + 1);
+    for (int ii = 0; ii < interfaceCount; ++ii) {
+        static_cast<helics::Publication*>(pubs[ii])->publish(static_cast<double>(ii) + 0.5);
+    }
+    vFed1->requestTimeAsync(1.0);
+    vFed2->requestTime(1.0);
+    vFed1->requestTimeComplete();
+    for (int ii = 0; ii < interfaceCount; ++ii) {
+        auto* inp = static_cast<helics::Input*>(inps[ii]);
+        EXPECT_TRUE(inp->isUpdated());
+        EXPECT_DOUBLE_EQ(inp->getValue<double>(), static_cast<double>(ii) + 0.5);
+    }
+    EXPECT_DOUBLE_EQ(static_cast<helics::Input*>(inps.back())->getValue<double>(), 0.5);
+    vFed1->finalize();
+    vFed2->finalize();
+}
+
+TEST_F(valuefed_add_tests, delta_encoding)
+{
+    SetupTest<helics::ValueFederate>("test", 2);
+    auto vFed1 = GetFederateAs<helics::ValueFederate>(0);
+    auto vFed2 = GetFederateAs<helics::ValueFederate>(1);
+
+    auto& pub = vFed1->registerGlobalPublication<std::vector<double>>("dpub");
+    // the dead band follows the option even when it is not set through the publication
+    vFed1->getCorePointer()->setHandleOption(pub.getHandle(),
+                                             HELICS_HANDLE_OPTION_DELTA_ENCODING,
+                                             1);
+    pub.setMinimumChange(0.01);
+    EXPECT_EQ(pub.getOption(HELICS_HANDLE_OPTION_DELTA_ENCODING), 1);
+    // two inputs on the same federate receive a shared payload
+    auto& inp1 = vFed2->registerSubscription("dpub");
+    auto& inp2 = vFed2->registerSubscription("dpub");
+
+    vFed1->enterExecutingModeAsync();
+    vFed2->enterExecutingMode();
+    vFed1->enterExecutingModeComplete();
+
+    std::vector<double> value(500, 1.0);
+    pub.publish(value);
+    vFed1->requestTimeAsync(1.0);
+    vFed2->requestTime(1.0);
+    vFed1->requestTimeComplete();
+    EXPECT_EQ(inp1.getValue<std::vector<double>>(), value);
+
+    std::vector<double> expected(value);
+    for (int step = 2; step <= 10; ++step) {
+        for (std::size_t ii = static_cast<std::size_t>(step); ii < value.size(); ii += 50) {
+            value[ii] += static_cast<double>(step);
+            expected[ii] = value[ii];
+        }
+        // changes within the dead band are not transmitted
+        value[0] += 0.001;
+        pub.publish(value);
+        vFed1->requestTimeAsync(static_cast<double>(step));
+        vFed2->requestTime(static_cast<double>(step));
+        vFed1->requestTimeComplete();
+        EXPECT_EQ(inp1.getValue<std::vector<double>>(), expected);
+        EXPECT_EQ(inp2.getValue<std::vector<double>>(), expected);
+    }
+    vFed1->finalize();
+    vFed2->finalize();
+}
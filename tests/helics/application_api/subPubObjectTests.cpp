@@ -378,6 +378,60 @@ TEST(subscriptionObject, VectorSize_tests)
     vFed->finalize();
 }
 
+TEST(subscriptionObject, VectorView_tests)
+{
+    helics::FederateInfo fi(CORE_TYPE_TO_TEST);
+    fi.coreInitString = "--autobroker";
+
+    auto vFed = std::make_shared<helics::ValueFederate>("test1", fi);
+    // register the publications
+    auto& pubObj = vFed->registerGlobalPublication<std::vector<double>>("pub1");
+    auto& pubObj2 = vFed->registerGlobalPublication<double>("pub2");
+    auto& pubObj3 = vFed->registerGlobalPublication<std::vector<std::complex<double>>>("pub3");
+    auto& pubObj4 = vFed->registerGlobalPublication<std::string>("pub4");
+
+    auto& subObj = vFed->registerSubscription("pub1");
+    auto& subObj2 = vFed->registerSubscription("pub2");
+    auto& subObj3 = vFed->registerSubscription("pub3");
+    auto& subObj4 = vFed->registerSubscription("pub4");
+
+    vFed->setProperty(HELICS_PROPERTY_TIME_DELTA, 1.0);
+    vFed->enterExecutingMode();
+    std::vector<double> tvec{5, 7, 234.23, 99.1, 1e7, 0.0};
+    std::vector<std::complex<double>> cvec{{1.0, -2.0}, {3.5, 0.25}};
+    pubObj.publish(tvec);
+    pubObj2.publish(45.7);
+    pubObj3.publish(cvec);
+    pubObj4.publish("test string");
+    vFed->requestTime(1.0);
+
+    EXPECT_TRUE(subObj.isUpdated());
+    auto view = subObj.getVectorView();
+    EXPECT_FALSE(subObj.isUpdated());
+    EXPECT_EQ(view.to_vector(), tvec);
+    // the value should still be available through the regular calls
+    EXPECT_EQ(subObj.getValue<std::vector<double>>(), tvec);
+    EXPECT_EQ(subObj.getVectorSize(), tvec.size());
+
+    // a double publication is converted
+    auto view2 = subObj2.getVectorView();
+    ASSERT_EQ(view2.size(), 1U);
+    EXPECT_EQ(view2[0], 45.7);
+
+    auto view3 = subObj3.getComplexVectorView();
+    EXPECT_EQ(view3.to_vector(), cvec);
+    EXPECT_EQ(subObj4.getStringView(), "test string");
+
+    tvec.push_back(-18.3);
+    pubObj.publish(tvec);
+    vFed->requestTime(2.0);
+    EXPECT_EQ(subObj.getValue<std::vector<double>>(), tvec);
+    view = subObj.getVectorView();
+    EXPECT_EQ(view.size(), tvec.size());
+    EXPECT_EQ(view.back(), -18.3);
+    vFed->finalize();
+}
+
 TEST(subscriptionObject, Defaults_test)
 {
     helics::FederateInfo fi(CORE_TYPE_TO_TEST);
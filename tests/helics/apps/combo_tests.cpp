@@ -384,6 +384,120 @@ TEST(combo_tests, save_load_file_binary)
     useFileBinary("ccore7", filename2.string());
 }
 
+static void generateRecordFile(const ghc::filesystem::path& f1)
+{
+    helics::FederateInfo fi(helics::CoreType::TEST);
+    fi.coreName = "ccore8";
+    fi.coreInitString = "-f 3 --autobroker";
+    helics::apps::Recorder rec1("rec1", fi);
+    rec1.setOutputFile(f1.string());
+    fi.setProperty(HELICS_PROPERTY_TIME_PERIOD, 1.0);
+
+    helics::CombinationFederate mfed("block1", fi);
+
+    helics::MessageFederate mfed2("block2", fi);
+    helics::Endpoint e1(helics::InterfaceVisibility::GLOBAL, &mfed, "d1");
+    helics::Endpoint e2(helics::InterfaceVisibility::GLOBAL, &mfed2, "d2");
+
+    rec1.addDestEndpointClone("d1");
+    rec1.addSourceEndpointClone("d1");
+    rec1.addSubscription("pub1");
+
+    helics::Publication pub1(helics::InterfaceVisibility::GLOBAL,
+                             &mfed,
+                             "pub1",
+                             helics::DataType::HELICS_DOUBLE);
+
+    auto fut = std::async(std::launch::async, [&rec1]() { rec1.runTo(5.0); });
+    mfed2.enterExecutingModeAsync();
+    mfed.enterExecutingMode();
+    mfed2.enterExecutingModeComplete();
+    pub1.publish(3.4);
+
+    mfed2.requestTimeAsync(1.0);
+    auto retTime = mfed.requestTime(1.0);
+    mfed2.requestTimeComplete();
+
+    e1.sendTo(Message1, "d2");
+    pub1.publish(4.7);
+    EXPECT_EQ(retTime, 1.0);
+
+    e2.sendTo(Message2, "d1");
+
+    mfed2.requestTimeAsync(2.0);
+    retTime = mfed.requestTime(2.0);
+    EXPECT_EQ(retTime, 2.0);
+
+    mfed2.requestTimeComplete();
+    pub1.publish(5.9);
+
+    mfed2.requestTimeAsync(4.0);
+    retTime = mfed.requestTime(4.0);
+    EXPECT_EQ(retTime, 4.0);
+    mfed2.requestTimeComplete();
+
+    mfed2.requestTimeAsync(6.0);
+    retTime = mfed.requestTime(6.0);
+    EXPECT_EQ(retTime, 6.0);
+    mfed2.requestTimeComplete();
+
+    fut.get();
+
+    mfed.finalize();
+    mfed2.finalize();
+
+    // the captures are streamed to the file and not retained
+    EXPECT_EQ(rec1.messageCount(), 2U);
+    EXPECT_EQ(rec1.pointCount(), 3U);
+    EXPECT_EQ(std::get<2>(rec1.getValue(0)), std::string());
+    rec1.saveFile(f1.string());
+}
+
+static void playRecordFile(const std::string& corename, const std::string& file)
+{
+    helics::FederateInfo fi(helics::CoreType::TEST);
+    fi.coreName = corename;
+    fi.coreInitString = "-f 2 --autobroker";
+    fi.setProperty(HELICS_PROPERTY_TIME_PERIOD, 1.0);
+
+    helics::apps::Player play1("play1", fi);
+    play1.loadFile(file);
+
+    helics::ValueFederate vfed("block1", fi);
+    auto& sub1 = vfed.registerSubscription("pub1");
+
+    EXPECT_EQ(play1.pointCount(), 3U);
+    EXPECT_EQ(play1.messageCount(), 2U);
+    if (play1.messageCount() == 2U) {
+        EXPECT_EQ(play1.getMessage(0).mess.data.to_string(), Message1);
+        EXPECT_EQ(play1.getMessage(1).mess.data.to_string(), Message2);
+    }
+
+    auto fut = std::async(std::launch::async, [&play1]() { play1.run(); });
+    vfed.enterExecutingMode();
+    auto retTime = vfed.requestTime(1.0);
+    EXPECT_EQ(retTime, 1.0);
+    EXPECT_DOUBLE_EQ(sub1.getValue<double>(), 4.7);
+    retTime = vfed.requestTime(5.0);
+    EXPECT_EQ(retTime, 2.0);
+    EXPECT_DOUBLE_EQ(sub1.getValue<double>(), 5.9);
+    vfed.finalize();
+    fut.get();
+    EXPECT_EQ(play1.publicationCount(), 1U);
+    EXPECT_EQ(play1.endpointCount(), 2U);
+    ghc::filesystem::remove(file);
+}
+
+TEST(combo_tests, save_load_record_file)
+{
+    auto filename = ghc::filesystem::temp_directory_path() / "savefile_stream.hrec";
+
+    generateRecordFile(filename);
+    ASSERT_TRUE(ghc::filesystem::exists(filename));
+
+    playRecordFile("ccore9", filename.string());
+}
+
 TEST(combo_tests, check_combination_file_load)
 {
     helics::FederateInfo fi(helics::CoreType::TEST);
@@ -0,0 +1,162 @@
+/*
+Copyright (c) 2017-2022,
+Battelle Memorial Institute; Lawrence Livermore National Security, LLC; Alliance for Sustainable
+Energy, LLC.  See the top-level NOTICE for additional details. All rights reserved.
+SPDX-License-Identifier: BSD-3-Clause
+*/
+
+#include <gtest/gtest.h>
+
+/** these test cases test the AsyncLogQueue
+ */
+
+#include "helics/common/AsyncLogQueue.hpp"
+
+#include <atomic>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+using namespace helics;
+
+TEST(async_log_queue_tests, basic)
+{
+    std::vector<std::string> messages;
+    std::atomic<int> flushes{0};
+    AsyncLogQueue queue(
+        16,
+        LogOverflowPolicy::block,
+        [&messages](const LogRecord& record) {
+            messages.push_back(record.header + "::" + record.message);
+        },
+        [&flushes]() { ++flushes; });
+    EXPECT_EQ(queue.capacity(), 16U);
+    EXPECT_TRUE(queue.push(3, "test", "message1", false));
+    EXPECT_TRUE(queue.push(3, "test", "message2", false));
+    queue.flush();
+    ASSERT_EQ(messages.size(), 2U);
+    EXPECT_EQ(messages[0], "test::message1");
+    EXPECT_EQ(messages[1], "test::message2");
+    EXPECT_GE(flushes.load(), 1);
+    EXPECT_EQ(queue.dropped(), 0U);
+}
+
+TEST(async_log_queue_tests, stop_writes_queued)
+{
+    std::atomic<int> count{0};
+    AsyncLogQueue queue(
+        1024, LogOverflowPolicy::block, [&count](const LogRecord&) { ++count; }, nullptr);
+    for (int ii = 0; ii < 500; ++ii) {
+        queue.push(3, "test", std::to_string(ii), false);
+    }
+    queue.stop();
+    EXPECT_EQ(count.load(), 500);
+    // records pushed after stopping are written directly
+    queue.push(3, "test", "late", false);
+    EXPECT_EQ(count.load(), 501);
+}
+
+TEST(async_log_queue_tests, push_during_stop)
+{
+    constexpr int producers{4};
+    constexpr int messageCount{2000};
+    std::atomic<int> count{0};
+    AsyncLogQueue queue(
+        64, LogOverflowPolicy::block, [&count](const LogRecord&) { ++count; }, nullptr);
+    std::vector<std::thread> threads;
+    for (int ii = 0; ii < producers; ++ii) {
+        threads.emplace_back([&queue]() {
+            for (int jj = 0; jj < messageCount; ++jj) {
+                queue.push(3, "producer", std::to_string(jj), false);
+            }
+        });
+    }
+    queue.stop();
+    for (auto& thread : threads) {
+        thread.join();
+    }
+    // no record is lost whether it was pushed before, during, or after stopping
+    EXPECT_EQ(count.load(), producers * messageCount);
+    EXPECT_EQ(queue.dropped(), 0U);
+}
+
+static void runProducers(LogOverflowPolicy policy, bool expectAll)
+{
+    constexpr int producers{4};
+    constexpr int messageCount{10000};
+    std::mutex recordLock;
+    std::vector<std::vector<int>> received(producers);
+    AsyncLogQueue queue(
+        32,
+        policy,
+        [&](const LogRecord& record) {
+            std::lock_guard<std::mutex> lock(recordLock);
+            received[record.level].push_back(std::stoi(record.message));
+            if (received[record.level].size() % 16 == 0) {
+                // slow the writer down so the queue fills up
+                std::this_thread::yield();
+            }
+        },
+        nullptr);
+    std::vector<std::thread> threads;
+    for (int ii = 0; ii < producers; ++ii) {
+        threads.emplace_back([&queue, ii]() {
+            for (int jj = 0; jj < messageCount; ++jj) {
+                queue.push(ii, "producer", std::to_string(jj), false);
+            }
+        });
+    }
+    for (auto& thread : threads) {
+        thread.join();
+    }
+    queue.flush();
+    std::size_t total{0};
+    for (const auto& values : received) {
+        total += values.size();
+        for (std::size_t ii = 1; ii < values.size(); ++ii) {
+            EXPECT_LT(values[ii - 1], values[ii]);
+        }
+    }
+    EXPECT_EQ(total + queue.dropped(), static_cast<std::size_t>(producers * messageCount));
+    if (expectAll) {
+        EXPECT_EQ(queue.dropped(), 0U);
+    }
+}
+
+TEST(async_log_queue_tests, block_policy)
+{
+    runProducers(LogOverflowPolicy::block, true);
+}
+
+TEST(async_log_queue_tests, drop_oldest_policy)
+{
+    runProducers(LogOverflowPolicy::drop_oldest, false);
+}
+
+TEST(async_log_queue_tests, drop_newest_policy)
+{
+    runProducers(LogOverflowPolicy::drop_newest, false);
+}
+
+TEST(async_log_queue_tests, drop_newest_full)
+{
+    std::mutex writeLock;
+    writeLock.lock();
+    AsyncLogQueue queue(
+        4,
+        LogOverflowPolicy::drop_newest,
+        [&writeLock](const LogRecord&) { std::lock_guard<std::mutex> lock(writeLock); },
+        nullptr);
+    int accepted{0};
+    for (int ii = 0; ii < 20; ++ii) {
+        if (queue.push(3, "test", std::to_string(ii), false)) {
+            ++accepted;
+        }
+    }
+    // the writer holds at most one record while blocked
+    EXPECT_LE(accepted, 5);
+    EXPECT_EQ(queue.dropped(), static_cast<std::uint64_t>(20 - accepted));
+    writeLock.unlock();
+    queue.flush();
+}
@@ -0,0 +1,98 @@
+/*
+Copyright (c) 2017-2022,
+Battelle Memorial Institute; Lawrence Livermore National Security, LLC; Alliance for Sustainable
+Energy, LLC.  See the top-level NOTICE for additional details. All rights reserved.
+SPDX-License-Identifier: BSD-3-Clause
+*/
+
+#include <gtest/gtest.h>
+
+/** these test cases test the MpscQueue
+ */
+
+#include "helics/common/MpscQueue.hpp"
+
+#include <string>
+#include <thread>
+#include <vector>
+
+using namespace helics;
+
+TEST(mpsc_queue_tests, basic)
+{
+    MpscQueue<int> queue;
+    EXPECT_TRUE(queue.empty());
+    EXPECT_FALSE(queue.try_pop());
+    queue.push(45);
+    queue.push(65);
+    EXPECT_FALSE(queue.empty());
+    EXPECT_EQ(queue.pop(), 45);
+    auto val = queue.try_pop();
+    ASSERT_TRUE(val);
+    EXPECT_EQ(*val, 65);
+    EXPECT_TRUE(queue.empty());
+}
+
+TEST(mpsc_queue_tests, capacity)
+{
+    MpscQueue<int> queue(100);
+    EXPECT_EQ(queue.capacity(), 128U);
+}
+
+TEST(mpsc_queue_tests, overflow_order)
+{
+    MpscQueue<std::string> queue(4);
+    for (int ii = 0; ii < 50; ++ii) {
+        queue.push(std::to_string(ii));
+    }
+    for (int ii = 0; ii < 20; ++ii) {
+        EXPECT_EQ(queue.pop(), std::to_string(ii));
+    }
+    // additional pushes after the overflow was taken by the consumer
+    for (int ii = 50; ii < 60; ++ii) {
+        queue.emplace(std::to_string(ii));
+    }
+    for (int ii = 20; ii < 60; ++ii) {
+        EXPECT_EQ(queue.pop(), std::to_string(ii));
+    }
+    EXPECT_TRUE(queue.empty());
+}
+
+TEST(mpsc_queue_tests, clear)
+{
+    MpscQueue<int> queue(8);
+    for (int ii = 0; ii < 20; ++ii) {
+        queue.push(ii);
+    }
+    queue.clear();
+    EXPECT_TRUE(queue.empty());
+    queue.push(3);
+    EXPECT_EQ(queue.pop(), 3);
+}
+
+TEST(mpsc_queue_tests, multi_producer)
+{
+    MpscQueue<std::pair<int, int>> queue(64);
+    queue.setSpinCount(10);
+    constexpr int producers{4};
+    constexpr int count{20000};
+    std::vector<std::thread> threads;
+    for (int ii = 0; ii < producers; ++ii) {
+        threads.emplace_back([&queue, ii]() {
+            for (int jj = 0; jj < count; ++jj) {
+                queue.push(std::make_pair(ii, jj));
+            }
+        });
+    }
+    // each producer's elements must come out in the order they were pushed
+    std::vector<int> last(producers, -1);
+    for (int ii = 0; ii < producers * count; ++ii) {
+        auto val = queue.pop();
+        EXPECT_EQ(val.second, last[val.first] + 1);
+        last[val.first] = val.second;
+    }
+    for (auto& thrd : threads) {
+        thrd.join();
+    }
+    EXPECT_TRUE(queue.empty());
+}
@@ -10,8 +10,13 @@ SPDX-License-Identifier: BSD-3-Clause
 /** these test cases test SmallBuffer
  */
 
+#include "helics/core/BufferPool.hpp"
 #include "helics/core/SmallBuffer.hpp"
 
+#include <string>
+#include <thread>
+#include <vector>
+
 using namespace helics;
 
 TEST(small_buffer_tests, empty)
@@ -523,3 +528,76 @@ TEST(small_buffer_tests, release)
     EXPECT_EQ(buffer[13], std::byte{'r'});
     delete[] buffer;
 }
+
+TEST(buffer_pool_tests, size_classes)
+{
+    std::size_t capacity{0};
+    auto* block = pool::allocateBlock(1, capacity);
+    EXPECT_EQ(capacity, pool::minBlockSize);
+    pool::releaseBlock(block, capacity);
+
+    block = pool::allocateBlock(pool::minBlockSize + 1, capacity);
+    EXPECT_EQ(capacity, 2 * pool::minBlockSize);
+    pool::releaseBlock(block, capacity);
+
+    block = pool::allocateBlock(pool::maxBlockSize + 1, capacity);
+    EXPECT_EQ(capacity, pool::maxBlockSize + 1);
+    pool::releaseBlock(block, capacity);
+}
+
+TEST(buffer_pool_tests, block_reuse)
+{
+    pool::resetStatistics();
+    std::size_t capacity{0};
+    auto* block = pool::allocateBlock(1000, capacity);
+    block[999] = std::byte{'a'};
+    pool::releaseBlock(block, capacity);
+
+    std::size_t capacity2{0};
+    auto* block2 = pool::allocateBlock(900, capacity2);
+    EXPECT_EQ(block2, block);
+    EXPECT_EQ(capacity2, capacity);
+    pool::releaseBlock(block2, capacity2);
+
+    // blocks not matching a size class are deleted instead of being pooled
+    pool::releaseBlock(new std::byte[1000], 1000);
+    auto stats = pool::getStatistics();
+    EXPECT_EQ(stats.poolAllocations, 1U);
+    EXPECT_EQ(stats.poolReleases, 2U);
+    EXPECT_EQ(stats.heapReleases, 1U);
+}
+
+TEST(buffer_pool_tests, cross_thread)
+{
+    std::size_t capacity{0};
+    std::vector<std::byte*> blocks;
+    for (int ii = 0; ii < 200; ++ii) {
+        blocks.push_back(pool::allocateBlock(300, capacity));
+    }
+    std::thread release([&blocks, capacity]() {
+        for (auto* block : blocks) {
+            pool::releaseBlock(block, capacity);
+        }
+    });
+    release.join();
+    // blocks released on the other thread were moved to the shared depot
+    pool::resetStatistics();
+    auto* block = pool::allocateBlock(300, capacity);
+    EXPECT_EQ(pool::getStatistics().poolAllocations, 1U);
+    pool::releaseBlock(block, capacity);
+}
+
+TEST(buffer_pool_tests, strings)
+{
+    std::vector<std::string> strings{"string1", "string2"};
+    pool::releaseStrings(strings);
+    EXPECT_TRUE(strings.empty());
+    auto reused = pool::acquireStrings();
+    ASSERT_EQ(reused.size(), 2U);
+    EXPECT_EQ(reused[1], "string2");
+
+    std::vector<std::string> large{std::string(5000, 'a')};
+    pool::releaseStrings(large);
+    // too large to be kept
+    EXPECT_EQ(large.size(), 1U);
+}
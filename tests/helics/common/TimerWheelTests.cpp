@@ -0,0 +1,160 @@
+/*
+Copyright (c) 2017-2022,
+Battelle Memorial Institute; Lawrence Livermore National Security, LLC; Alliance for Sustainable
+Energy, LLC.  See the top-level NOTICE for additional details. All rights reserved.
+SPDX-License-Identifier: BSD-3-Clause
+*/
+
+#include "helics/common/TimerWheel.hpp"
+
+#include "gtest/gtest.h"
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <random>
+#include <vector>
+
+using helics::TimerWheel;
+using namespace std::literals::chrono_literals;
+
+TEST(timer_wheel_tests, expire)
+{
+    auto start = std::chrono::steady_clock::now();
+    TimerWheel wheel(1ms, start);
+    auto t1 = wheel.add(start + 5ms);
+    auto t2 = wheel.add(start + 300ms);
+    auto t3 = wheel.add(start + 20s);
+    EXPECT_EQ(wheel.scheduledCount(), 3U);
+    EXPECT_EQ(wheel.nextWakeTime(), start + 5ms);
+
+    std::vector<std::int32_t> expired;
+    wheel.advance(start + 4ms, expired);
+    EXPECT_TRUE(expired.empty());
+    wheel.advance(start + 5ms, expired);
+    ASSERT_EQ(expired.size(), 1U);
+    EXPECT_EQ(expired[0], t1);
+    EXPECT_FALSE(wheel.isScheduled(t1));
+    EXPECT_TRUE(wheel.isValid(t1));
+
+    expired.clear();
+    wheel.advance(start + 299ms, expired);
+    EXPECT_TRUE(expired.empty());
+    wheel.advance(start + 300ms, expired);
+    ASSERT_EQ(expired.size(), 1U);
+    EXPECT_EQ(expired[0], t2);
+
+    expired.clear();
+    wheel.advance(start + 19999ms, expired);
+    EXPECT_TRUE(expired.empty());
+    wheel.advance(start + 20s, expired);
+    ASSERT_EQ(expired.size(), 1U);
+    EXPECT_EQ(expired[0], t3);
+    EXPECT_EQ(wheel.scheduledCount(), 0U);
+    EXPECT_EQ(wheel.nextWakeTime(), TimerWheel::time_type::max());
+}
+
+TEST(timer_wheel_tests, update_cancel)
+{
+    auto start = std::chrono::steady_clock::now();
+    TimerWheel wheel(1ms, start);
+    auto t1 = wheel.add(start + 10ms);
+    auto t2 = wheel.add(start + 10ms);
+    wheel.update(t1, start + 2s);
+    wheel.cancel(t2);
+    EXPECT_FALSE(wheel.isScheduled(t2));
+    EXPECT_EQ(wheel.expiration(t1), start + 2s);
+
+    std::vector<std::int32_t> expired;
+    wheel.advance(start + 1s, expired);
+    EXPECT_TRUE(expired.empty());
+    // a cancelled timer can be rescheduled
+    wheel.update(t2, start + 1500ms);
+    wheel.advance(start + 2s, expired);
+    ASSERT_EQ(expired.size(), 2U);
+    EXPECT_EQ(expired[0], t2);
+    EXPECT_EQ(expired[1], t1);
+}
+
+TEST(timer_wheel_tests, release_reuse)
+{
+    auto start = std::chrono::steady_clock::now();
+    TimerWheel wheel(1ms, start);
+    auto t1 = wheel.add(start + 10ms);
+    auto t2 = wheel.add(start + 20ms);
+    wheel.release(t1);
+    EXPECT_FALSE(wheel.isValid(t1));
+    EXPECT_EQ(wheel.scheduledCount(), 1U);
+    auto t3 = wheel.add(start + 30ms);
+    EXPECT_EQ(t3, t1);
+    EXPECT_EQ(wheel.capacity(), 2U);
+    std::vector<std::int32_t> expired;
+    wheel.advance(start + 30ms, expired);
+    EXPECT_EQ(expired, (std::vector<std::int32_t>{t2, t3}));
+}
+
+TEST(timer_wheel_tests, past_and_far)
+{
+    auto start = std::chrono::steady_clock::now();
+    TimerWheel wheel(1ms, start);
+    std::vector<std::int32_t> expired;
+    wheel.advance(start + 100ms, expired);
+    // a timer in the past expires on the next tick
+    auto t1 = wheel.add(start);
+    // beyond the span of the wheel
+    auto t2 = wheel.add(start + 30h);
+    wheel.advance(start + 101ms, expired);
+    ASSERT_EQ(expired.size(), 1U);
+    EXPECT_EQ(expired[0], t1);
+    expired.clear();
+    wheel.advance(start + 29h, expired);
+    EXPECT_TRUE(expired.empty());
+    EXPECT_TRUE(wheel.isScheduled(t2));
+    EXPECT_LE(wheel.nextWakeTime(), start + 30h);
+    wheel.advance(start + 30h, expired);
+    ASSERT_EQ(expired.size(), 1U);
+    EXPECT_EQ(expired[0], t2);
+}
+
+TEST(timer_wheel_tests, random_operations)
+{
+    auto start = std::chrono::steady_clock::now();
+    TimerWheel wheel(1ms, start);
+    std::mt19937 gen(0x5eed);
+    std::uniform_int_distribution<int> delay(0, 200000);
+    std::uniform_int_distribution<int> operation(0, 9);
+    std::vector<std::int32_t> ids;
+    std::vector<std::int32_t> expired;
+    auto now = start;
+    for (int ii = 0; ii < 2000; ++ii) {
+        ids.push_back(wheel.add(now + std::chrono::microseconds(delay(gen) * 100LL)));
+    }
+    for (int round = 0; round < 500; ++round) {
+        for (auto id : ids) {
+            auto op = operation(gen);
+            if (op == 0 && round < 400) {
+                wheel.update(id, now + std::chrono::microseconds(delay(gen) * 10LL));
+            } else if (op == 1 && wheel.isScheduled(id)) {
+                wheel.cancel(id);
+            }
+        }
+        auto wake = wheel.nextWakeTime();
+        ASSERT_GT(wake, now);
+        now += std::chrono::milliseconds(std::uniform_int_distribution<int>(1, 2000)(gen));
+        expired.clear();
+        wheel.advance(now, expired);
+        for (auto id : expired) {
+            EXPECT_LE(wheel.expiration(id), now);
+            EXPECT_FALSE(wheel.isScheduled(id));
+        }
+        // nothing that should have expired is left behind
+        for (auto id : ids) {
+            if (wheel.isScheduled(id)) {
+                EXPECT_GT(wheel.expiration(id), now - 1ms);
+                EXPECT_GE(wheel.expiration(id) + 1ms, wake);
+            }
+        }
+    }
+    expired.clear();
+    wheel.advance(now + 1h, expired);
+    EXPECT_EQ(wheel.scheduledCount(), 0U);
+}
@@ -0,0 +1,103 @@
+/*
+Copyright (c) 2017-2022,
+Battelle Memorial Institute; Lawrence Livermore National Security, LLC; Alliance for Sustainable
+Energy, LLC.  See the top-level NOTICE for additional details. All rights reserved.
+SPDX-License-Identifier: BSD-3-Clause
+*/
+
+#include <gtest/gtest.h>
+
+/** these test cases test the WorkStealingPool
+ */
+
+#include "helics/common/WorkStealingPool.hpp"
+
+#include <atomic>
+#include <chrono>
+#include <thread>
+
+using namespace helics;
+
+TEST(work_stealing_pool_tests, run_tasks)
+{
+    std::atomic<int> count{0};
+    WorkStealingPool pool(4);
+    EXPECT_EQ(pool.size(), 4U);
+    for (int ii = 0; ii < 1000; ++ii) {
+        EXPECT_TRUE(pool.submit([&count]() { ++count; }));
+    }
+    pool.stop();
+    EXPECT_EQ(count.load(), 1000);
+    // tasks submitted after stopping are not run
+    EXPECT_FALSE(pool.submit([&count]() { ++count; }));
+    EXPECT_EQ(count.load(), 1000);
+}
+
+TEST(work_stealing_pool_tests, default_size)
+{
+    WorkStealingPool pool(0);
+    EXPECT_GE(pool.size(), 1U);
+}
+
+TEST(work_stealing_pool_tests, nested_submit)
+{
+    std::atomic<int> count{0};
+    WorkStealingPool pool(4);
+    // each task queues two more until the depth is reached, all on the pool threads
+    std::function<void(int)> spawn = [&](int depth) {
+        ++count;
+        if (depth > 0) {
+            pool.submit([&spawn, depth]() { spawn(depth - 1); });
+            pool.submit([&spawn, depth]() { spawn(depth - 1); });
+        }
+    };
+    pool.submit([&spawn]() { spawn(10); });
+    int wait{0};
+    while (count.load() < 2047 && wait++ < 500) {
+        std::this_thread::sleep_for(std::chrono::milliseconds(10));
+    }
+    pool.stop();
+    EXPECT_EQ(count.load(), 2047);
+}
+
+TEST(work_stealing_pool_tests, steal_from_busy_worker)
+{
+    std::atomic<int> count{0};
+    std::atomic<bool> release{false};
+    WorkStealingPool pool(2);
+    // a task on the pool queues work behind itself then blocks, so the other thread has to take it
+    pool.submit([&]() {
+        for (int ii = 0; ii < 20; ++ii) {
+            pool.submit([&count]() { ++count; });
+        }
+        while (!release.load()) {
+            std::this_thread::yield();
+        }
+    });
+    int wait{0};
+    while (count.load() < 20 && wait++ < 500) {
+        std::this_thread::sleep_for(std::chrono::milliseconds(10));
+    }
+    EXPECT_EQ(count.load(), 20);
+    EXPECT_GE(pool.stolenCount(), 20U);
+    release.store(true);
+    pool.stop();
+}
+
+TEST(work_stealing_pool_tests, parked_workers_wake)
+{
+    std::atomic<int> count{0};
+    WorkStealingPool pool(3);
+    for (int jj = 0; jj < 5; ++jj) {
+        // let the workers park between bursts
+        std::this_thread::sleep_for(std::chrono::milliseconds(20));
+        for (int ii = 0; ii < 10; ++ii) {
+            pool.submit([&count]() { ++count; });
+        }
+    }
+    int wait{0};
+    while (count.load() < 50 && wait++ < 500) {
+        std::this_thread::sleep_for(std::chrono::milliseconds(10));
+    }
+    EXPECT_EQ(count.load(), 50);
+}
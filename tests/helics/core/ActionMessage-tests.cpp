@@ -5,6 +5,7 @@ Energy, LLC.  See the top-level NOTICE for additional details. All rights reserv
 SPDX-License-Identifier: BSD-3-Clause
 */
 #include "helics/core/ActionMessage.hpp"
+#include "helics/core/CompactStringTable.hpp"
 #include "helics/core/flagOperations.hpp"
 
 #include "gtest/gtest.h"
@@ -450,6 +451,93 @@ TEST(ActionMessage, check_json_packetization)
     EXPECT_TRUE(cmd.getStringData() == cmd2.getStringData());
 }
 
+TEST(ActionMessage, compact_conversion)
+{
+    helics::ActionMessage cmd(helics::CMD_TIME_REQUEST);
+    cmd.source_id = GlobalFederateId(131074);
+    cmd.dest_id = GlobalFederateId(-5);
+    cmd.counter = 3;
+    cmd.actionTime = 45.7;
+    cmd.Te = Time::maxVal();
+    cmd.Tdemin = -1.5;
+    setActionFlag(cmd, iteration_requested_flag);
+
+    auto compactString = cmd.to_compact_string();
+    // default fields are omitted so this is much smaller than the full format
+    EXPECT_LT(compactString.size(), cmd.to_string().size() / 2);
+    helics::ActionMessage cmd2(helics::CMD_SEND_MESSAGE);
+    cmd2.payload = "data to overwrite";
+    cmd2.Tso = 10.0;
+    auto res = cmd2.from_string(compactString);
+    EXPECT_EQ(res, compactString.size());
+    EXPECT_TRUE(cmd.action() == cmd2.action());
+    EXPECT_EQ(cmd.source_id, cmd2.source_id);
+    EXPECT_EQ(cmd.dest_id, cmd2.dest_id);
+    EXPECT_EQ(cmd.source_handle, cmd2.source_handle);
+    EXPECT_EQ(cmd.dest_handle, cmd2.dest_handle);
+    EXPECT_EQ(cmd.counter, cmd2.counter);
+    EXPECT_EQ(cmd.flags, cmd2.flags);
+    EXPECT_EQ(cmd.actionTime, cmd2.actionTime);
+    EXPECT_EQ(cmd.Te, cmd2.Te);
+    EXPECT_EQ(cmd.Tdemin, cmd2.Tdemin);
+    EXPECT_EQ(cmd2.Tso, timeZero);
+    EXPECT_TRUE(cmd2.payload.empty());
+
+    // truncated data is rejected
+    helics::ActionMessage cmd3;
+    res = cmd3.from_string(std::string_view(compactString).substr(0, compactString.size() - 2));
+    EXPECT_EQ(res, 0U);
+    EXPECT_TRUE(cmd3.action() == CMD_INVALID);
+}
+
+TEST(ActionMessage, compact_packetization_string_table)
+{
+    helics::ActionMessage cmd(helics::CMD_SEND_MESSAGE);
+    cmd.source_id = GlobalFederateId(1);
+    cmd.source_handle = InterfaceHandle(2);
+    cmd.dest_id = GlobalFederateId(3);
+    cmd.dest_handle = InterfaceHandle(4);
+    cmd.actionTime = 45.7;
+    cmd.payload = "hello world";
+    cmd.setStringData("fed1/target_endpoint", "fed2/source_endpoint", "fed2/source_endpoint");
+
+    helics::CompactStringTable txTable;
+    helics::CompactStringTable rxTable;
+    std::string first;
+    cmd.packetize_compact(first, &txTable);
+    EXPECT_EQ(txTable.size(), 2U);
+    std::string second;
+    cmd.packetize_compact(second, &txTable);
+    // the second message refers to the interned strings instead of repeating them
+    EXPECT_LT(second.size() + 30, first.size());
+
+    for (auto* packet : {&first, &second}) {
+        helics::ActionMessage cmd2;
+        auto res = cmd2.depacketize(packet->data(), packet->size(), &rxTable);
+        EXPECT_EQ(res, packet->size());
+        EXPECT_TRUE(cmd.action() == cmd2.action());
+        EXPECT_EQ(cmd.actionTime, cmd2.actionTime);
+        EXPECT_EQ(cmd.source_handle, cmd2.source_handle);
+        EXPECT_EQ(cmd.dest_handle, cmd2.dest_handle);
+        EXPECT_EQ(cmd.payload, cmd2.payload);
+        EXPECT_TRUE(cmd.getStringData() == cmd2.getStringData());
+    }
+    EXPECT_EQ(rxTable.size(), 2U);
+
+    // interned references can't be read without the table
+    helics::ActionMessage cmd3;
+    EXPECT_EQ(cmd3.depacketize(second.data(), second.size()), 0U);
+
+    // a new sender table resets the receiving table
+    helics::CompactStringTable txTable2;
+    cmd.setStringData("another/endpoint");
+    cmd.packetize_compact(first, &txTable2);
+    helics::ActionMessage cmd4;
+    EXPECT_EQ(cmd4.depacketize(first.data(), first.size(), &rxTable), first.size());
+    EXPECT_EQ(cmd4.getString(0), "another/endpoint");
+    EXPECT_EQ(rxTable.size(), 1U);
+}
+
 TEST(ActionMessage, jsonconversion_test)
 {
     helics::ActionMessage cmd(helics::CMD_SEND_MESSAGE);
@@ -571,3 +659,25 @@ TEST(ActionMessage, jsonconversion_test_binary_strings2)
     EXPECT_EQ(cmd.flags, cmd2.flags);
     EXPECT_TRUE(cmd.getStringData() == cmd2.getStringData());
 }
+
+TEST(ActionMessage, fanout_targets)
+{
+    helics::ActionMessage cmd(helics::CMD_PUB_FANOUT);
+    cmd.source_id = GlobalFederateId(1);
+    cmd.source_handle = InterfaceHandle(2);
+    cmd.payload = "fanout data";
+    std::vector<GlobalHandle> targets;
+    for (int ii = 0; ii < 300; ++ii) {
+        targets.emplace_back(GlobalFederateId(131072 + ii / 10), InterfaceHandle(ii));
+    }
+    targets.emplace_back(GlobalFederateId(-5), InterfaceHandle(-1));
+    setFanoutTargets(cmd, targets);
+    EXPECT_EQ(cmd.dest_id, targets.front().fed_id);
+
+    helics::ActionMessage cmd2(cmd.to_string());
+    EXPECT_TRUE(cmd2.action() == helics::CMD_PUB_FANOUT);
+    EXPECT_EQ(cmd2.payload, cmd.payload);
+    auto targets2 = getFanoutTargets(cmd2);
+    ASSERT_EQ(targets2.size(), targets.size());
+    EXPECT_TRUE(targets2 == targets);
+}
@@ -108,3 +108,65 @@ TEST(broker_tests, broker_log_command_failures)
                                                "--fileloglevel=-4 --root"),
                  std::exception);
 }
+
+TEST(broker_tests, latency_query)
+{
+    auto brk = helics::BrokerFactory::create(helics::CoreType::TEST,
+                                             "lbroker",
+                                             "-f1 --root --latency_tracking");
+    auto cr1 = helics::CoreFactory::create(helics::CoreType::TEST, "lcore", "--broker=lbroker");
+    helics::CoreFederateInfo cf1;
+    cr1->registerFederate("fed1", cf1);
+
+    auto res = brk->query("root", "latency");
+    EXPECT_NE(res.find("\"enabled\""), std::string::npos);
+    EXPECT_NE(res.find("\"queue\""), std::string::npos);
+    EXPECT_NE(res.find("\"p99\""), std::string::npos);
+    // the core was not started with latency tracking
+    res = cr1->query("core", "latency", HELICS_SEQUENCING_MODE_FAST);
+    EXPECT_NE(res.find("\"enabled\""), std::string::npos);
+    EXPECT_EQ(res.find("\"queue\""), std::string::npos);
+    cr1->disconnect();
+    brk->disconnect();
+}
+
+TEST(broker_tests, flight_recorder_query)
+{
+    auto brk = helics::BrokerFactory::create(helics::CoreType::TEST,
+                                             "frbroker",
+                                             "-f1 --root --dumplog --dumplog_size=32");
+    auto cr1 = helics::CoreFactory::create(helics::CoreType::TEST, "frcore", "--broker=frbroker");
+    helics::CoreFederateInfo cf1;
+    cr1->registerFederate("fed1", cf1);
+
+    auto res = brk->query("root", "flight_recorder");
+    EXPECT_NE(res.find("\"enabled\" : true"), std::string::npos);
+    EXPECT_NE(res.find("\"capacity\" : 32"), std::string::npos);
+    EXPECT_NE(res.find("\"reg_fed\""), std::string::npos);
+    // the core was not started with the dumplog
+    res = cr1->query("core", "flight_recorder", HELICS_SEQUENCING_MODE_FAST);
+    EXPECT_NE(res.find("\"enabled\" : false"), std::string::npos);
+    EXPECT_EQ(res.find("\"messages\""), std::string::npos);
+    cr1->disconnect();
+    brk->disconnect();
+}
+
+TEST(broker_tests, timing_coalescing_query)
+{
+    auto brk = helics::BrokerFactory::create(helics::CoreType::TEST, "tcbroker", "-f1 --root");
+    auto cr1 = helics::CoreFactory::create(helics::CoreType::TEST,
+                                           "tccore",
+                                           "--broker=tcbroker --no_timing_coalescing");
+    helics::CoreFederateInfo cf1;
+    cr1->registerFederate("fed1", cf1);
+
+    auto res = brk->query("root", "timing_coalescing");
+    EXPECT_NE(res.find("\"enabled\" : true"), std::string::npos);
+    EXPECT_NE(res.find("\"timing_messages\""), std::string::npos);
+    EXPECT_NE(res.find("\"coalesced\""), std::string::npos);
+    res = cr1->query("core", "timing_coalescing", HELICS_SEQUENCING_MODE_FAST);
+    EXPECT_NE(res.find("\"enabled\" : false"), std::string::npos);
+    EXPECT_EQ(res.find("\"coalesced\""), std::string::npos);
+    cr1->disconnect();
+    brk->disconnect();
+}
@@ -0,0 +1,179 @@
+/*
+Copyright (c) 2017-2022,
+Battelle Memorial Institute; Lawrence Livermore National Security, LLC; Alliance for Sustainable
+Energy, LLC.  See the top-level NOTICE for additional details. All rights reserved.
+SPDX-License-Identifier: BSD-3-Clause
+*/
+#include "helics/core/ActionMessage.hpp"
+#include "helics/core/DeltaEncoding.hpp"
+#include "helics/core/PublicationInfo.hpp"
+#include "helics/core/flagOperations.hpp"
+
+#include "gtest/gtest.h"
+#include <cstring>
+#include <string>
+#include <vector>
+
+using namespace helics;
+
+static std::string toBytes(const std::vector<double>& vals)
+{
+    std::string bytes(vals.size() * sizeof(double), '\0');
+    std::memcpy(bytes.data(), vals.data(), bytes.size());
+    return bytes;
+}
+
+TEST(delta_encoding_tests, patch_round_trip)
+{
+    std::vector<double> vals(1000, 2.5);
+    auto previous = toBytes(vals);
+    vals[0] = 1.0;
+    vals[17] = 4.0;
+    vals[18] = 4.5;
+    vals[20] = 6.0;
+    vals[999] = -3.0;
+    auto value = toBytes(vals);
+    SmallBuffer patch;
+    ASSERT_TRUE(encodeValuePatch(previous, value, 0, patch));
+    EXPECT_LT(patch.size(), 100U);
+    SmallBuffer rebuilt(previous);
+    ASSERT_TRUE(applyValuePatch(rebuilt, patch.to_string()));
+    EXPECT_EQ(rebuilt.to_string(), value);
+}
+
+TEST(delta_encoding_tests, partial_word)
+{
+    std::string previous(45, 'a');
+    std::string value(previous);
+    value[44] = 'b';
+    SmallBuffer patch;
+    ASSERT_TRUE(encodeValuePatch(previous, value, 0, patch));
+    SmallBuffer rebuilt(previous);
+    ASSERT_TRUE(applyValuePatch(rebuilt, patch.to_string()));
+    EXPECT_EQ(rebuilt.to_string(), value);
+}
+
+TEST(delta_encoding_tests, full_frame_fallback)
+{
+    std::vector<double> vals(100, 2.5);
+    auto previous = toBytes(vals);
+    SmallBuffer patch;
+    // sizes differ
+    EXPECT_FALSE(encodeValuePatch(previous, toBytes(std::vector<double>(99, 2.5)), 0, patch));
+    // everything changed so the patch would be larger than the value
+    EXPECT_FALSE(encodeValuePatch(previous, toBytes(std::vector<double>(100, 1.5)), 0, patch));
+    // the values are identical
+    ASSERT_TRUE(encodeValuePatch(previous, previous, 0, patch));
+    SmallBuffer rebuilt(previous);
+    ASSERT_TRUE(applyValuePatch(rebuilt, patch.to_string()));
+    EXPECT_EQ(rebuilt.to_string(), previous);
+}
+
+TEST(delta_encoding_tests, bad_patch)
+{
+    std::string previous(64, 'a');
+    std::string value(previous);
+    value[10] = 'c';
+    SmallBuffer patch;
+    ASSERT_TRUE(encodeValuePatch(previous, value, 0, patch));
+    SmallBuffer shorter(std::string(56, 'a'));
+    EXPECT_FALSE(applyValuePatch(shorter, patch.to_string()));
+    SmallBuffer rebuilt(previous);
+    EXPECT_FALSE(applyValuePatch(rebuilt, patch.to_string().substr(0, patch.size() - 1)));
+}
+
+TEST(delta_encoding_tests, publication_decoder)
+{
+    PublicationInfo pub(GlobalHandle(GlobalFederateId(131072), InterfaceHandle(0)), "pub", "", "");
+    GlobalHandle sub1(GlobalFederateId(131073), InterfaceHandle(0));
+    GlobalHandle sub2(GlobalFederateId(131074), InterfaceHandle(0));
+    pub.addSubscriber(sub1);
+    pub.setDeltaEncoding(true);
+    DeltaDecoder decoder1;
+    DeltaDecoder decoder2;
+
+    auto send = [&pub](const std::string& value) {
+        ActionMessage mv(CMD_PUB);
+        mv.setSource(pub.id);
+        pub.encodeDelta(value, mv);
+        return mv;
+    };
+    std::vector<double> vals(200, 1.0);
+    auto mv = send(toBytes(vals));
+    EXPECT_TRUE(checkActionFlag(mv, delta_base_flag));
+    EXPECT_TRUE(decoder1.decode(mv));
+    EXPECT_EQ(mv.payload.to_string(), toBytes(vals));
+    EXPECT_FALSE(DeltaDecoder::isDeltaEncoded(mv.flags));
+
+    vals[50] = 7.0;
+    mv = send(toBytes(vals));
+    EXPECT_TRUE(checkActionFlag(mv, delta_patch_flag));
+    EXPECT_LT(mv.payload.size(), 40U);
+    EXPECT_TRUE(decoder1.decode(mv));
+    EXPECT_EQ(mv.payload.to_string(), toBytes(vals));
+
+    // a receiver without the previous value can't use a patch
+    vals[51] = 8.0;
+    mv = send(toBytes(vals));
+    EXPECT_FALSE(decoder2.decode(mv));
+
+    // a new subscriber forces a full value
+    pub.addSubscriber(sub2);
+    vals[52] = 9.0;
+    mv = send(toBytes(vals));
+    EXPECT_TRUE(checkActionFlag(mv, delta_base_flag));
+    auto copy = mv;
+    EXPECT_TRUE(decoder1.decode(mv));
+    EXPECT_TRUE(decoder2.decode(copy));
+    EXPECT_EQ(mv.payload.to_string(), toBytes(vals));
+    EXPECT_EQ(copy.payload.to_string(), toBytes(vals));
+
+    // values without the delta flags pass through untouched
+    SmallBuffer plain(std::string("plain value"));
+    EXPECT_TRUE(decoder1.decode(pub.id, 0, 0, plain));
+    EXPECT_EQ(plain.to_string(), "plain value");
+}
+
+TEST(delta_encoding_tests, sequence_mismatch)
+{
+    PublicationInfo pub(GlobalHandle(GlobalFederateId(131072), InterfaceHandle(0)), "pub", "", "");
+    pub.addSubscriber(GlobalHandle(GlobalFederateId(131073), InterfaceHandle(0)));
+    pub.setDeltaEncoding(true);
+    DeltaDecoder decoder;
+
+    auto send = [&pub](const std::vector<double>& vals) {
+        ActionMessage mv(CMD_PUB);
+        mv.setSource(pub.id);
+        pub.encodeDelta(toBytes(vals), mv);
+        return mv;
+    };
+    std::vector<double> vals(200, 1.0);
+    auto mv = send(vals);
+    EXPECT_TRUE(decoder.decode(mv));
+
+    // a lost patch leaves the receiver one value behind
+    vals[10] = 2.0;
+    mv = send(vals);
+    EXPECT_TRUE(checkActionFlag(mv, delta_patch_flag));
+    vals[20] = 3.0;
+    mv = send(vals);
+    EXPECT_TRUE(checkActionFlag(mv, delta_patch_flag));
+    EXPECT_FALSE(decoder.decode(mv));
+
+    // the patch is not applied against the wrong value and later patches are dropped until the
+    // publication sends a full value
+    vals[30] = 4.0;
+    mv = send(vals);
+    EXPECT_FALSE(decoder.decode(mv));
+    pub.requestDeltaResync();
+    vals[40] = 5.0;
+    mv = send(vals);
+    EXPECT_TRUE(checkActionFlag(mv, delta_base_flag));
+    EXPECT_TRUE(decoder.decode(mv));
+    EXPECT_EQ(mv.payload.to_string(), toBytes(vals));
+    vals[50] = 6.0;
+    mv = send(vals);
+    EXPECT_TRUE(checkActionFlag(mv, delta_patch_flag));
+    EXPECT_TRUE(decoder.decode(mv));
+    EXPECT_EQ(mv.payload.to_string(), toBytes(vals));
+}
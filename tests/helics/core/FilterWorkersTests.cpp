@@ -0,0 +1,149 @@
+/*
+Copyright (c) 2017-2022,
+Battelle Memorial Institute; Lawrence Livermore National Security, LLC; Alliance for Sustainable
+Energy, LLC.  See the top-level NOTICE for additional details. All rights reserved.
+SPDX-License-Identifier: BSD-3-Clause
+*/
+#include "helics/core/FilterWorkers.hpp"
+#include "helics/core/core-data.hpp"
+
+#include "gtest/gtest.h"
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+
+using namespace helics;
+
+/** operator appending a character to the message data or dropping messages with empty data*/
+class AppendOperator: public FilterOperator {
+  public:
+    virtual std::unique_ptr<Message> process(std::unique_ptr<Message> message) override
+    {
+        if (message->data.empty()) {
+            return nullptr;
+        }
+        message->data.push_back('f');
+        return message;
+    }
+};
+
+/** operator sending every message to a new destination*/
+class RerouteOperator: public FilterOperator {
+  public:
+    virtual std::unique_ptr<Message> process(std::unique_ptr<Message> message) override
+    {
+        message->dest = "other";
+        return message;
+    }
+};
+
+/** collect the results of the workers*/
+struct ResultCollector {
+    std::mutex lock;
+    std::vector<ActionMessage> results;
+    void add(ActionMessage&& result)
+    {
+        std::lock_guard<std::mutex> guard(lock);
+        results.push_back(std::move(result));
+    }
+};
+
+static ActionMessage
+    filterCommand(action_message_def::action_t action, InterfaceHandle endpoint, std::string data)
+{
+    ActionMessage command(action);
+    command.setSource(GlobalHandle(GlobalFederateId(131073), endpoint));
+    command.setStringData("dest", "source", "source", "dest");
+    command.payload = data;
+    return command;
+}
+
+TEST(FilterWorkersTests, endpoint_order)
+{
+    ResultCollector collector;
+    auto op = std::make_shared<AppendOperator>();
+    GlobalHandle filterHandle(GlobalFederateId(131072), InterfaceHandle(4));
+    {
+        FilterWorkers workers(4, [&collector](ActionMessage&& result) {
+            collector.add(std::move(result));
+        });
+        EXPECT_EQ(workers.size(), 4U);
+        for (int ii = 0; ii < 1000; ++ii) {
+            auto command = filterCommand(CMD_SEND_FOR_FILTER_AND_RETURN,
+                                         InterfaceHandle(ii % 7),
+                                         std::to_string(ii));
+            command.sequenceID = static_cast<uint32_t>(ii);
+            command.counter = 2;
+            EXPECT_TRUE(workers.addMessage(filterHandle, op, std::move(command)));
+        }
+        workers.stop();
+        EXPECT_EQ(workers.processedCount(), 1000U);
+        EXPECT_FALSE(workers.addMessage(filterHandle, op, ActionMessage(CMD_SEND_MESSAGE)));
+    }
+    ASSERT_EQ(collector.results.size(), 1000U);
+    std::vector<int32_t> lastSequence(7, -1);
+    for (auto& result : collector.results) {
+        EXPECT_EQ(result.action(), CMD_FILTER_RESULT);
+        EXPECT_EQ(result.getSource(), filterHandle);
+        EXPECT_EQ(result.dest_id, GlobalFederateId(131073));
+        EXPECT_EQ(result.counter, 2);
+        auto sequence = static_cast<int32_t>(result.sequenceID);
+        EXPECT_EQ(result.payload.to_string(), std::to_string(sequence) + "f");
+        auto endpoint = result.dest_handle.baseValue();
+        EXPECT_EQ(endpoint, sequence % 7);
+        // the messages of each endpoint come back in the order they were sent
+        EXPECT_GT(sequence, lastSequence[endpoint]);
+        lastSequence[endpoint] = sequence;
+    }
+}
+
+TEST(FilterWorkersTests, dropped_messages)
+{
+    ResultCollector collector;
+    FilterWorkers workers(2, [&collector](ActionMessage&& result) {
+        collector.add(std::move(result));
+    });
+    auto op = std::make_shared<AppendOperator>();
+    GlobalHandle filterHandle(GlobalFederateId(131072), InterfaceHandle(4));
+    auto command = filterCommand(CMD_SEND_FOR_FILTER_AND_RETURN, InterfaceHandle(1), "");
+    command.sequenceID = 57;
+    workers.addMessage(filterHandle, op, std::move(command));
+    command = filterCommand(CMD_SEND_FOR_DEST_FILTER_AND_RETURN, InterfaceHandle(1), "");
+    command.sequenceID = 58;
+    workers.addMessage(filterHandle, op, std::move(command));
+    command = filterCommand(CMD_SEND_FOR_DEST_FILTER_AND_RETURN, InterfaceHandle(1), "data");
+    command.sequenceID = 59;
+    workers.addMessage(filterHandle, op, std::move(command));
+    workers.stop();
+    ASSERT_EQ(collector.results.size(), 3U);
+    EXPECT_EQ(collector.results[0].action(), CMD_NULL_MESSAGE);
+    EXPECT_EQ(collector.results[0].sequenceID, 57U);
+    EXPECT_EQ(collector.results[1].action(), CMD_NULL_DEST_MESSAGE);
+    EXPECT_EQ(collector.results[1].sequenceID, 58U);
+    EXPECT_EQ(collector.results[2].action(), CMD_DEST_FILTER_RESULT);
+    EXPECT_EQ(collector.results[2].sequenceID, 59U);
+    EXPECT_EQ(collector.results[2].dest_handle, InterfaceHandle(1));
+    EXPECT_EQ(collector.results[2].payload.to_string(), "dataf");
+}
+
+TEST(FilterWorkersTests, destination_reroute)
+{
+    ResultCollector collector;
+    FilterWorkers workers(1, [&collector](ActionMessage&& result) {
+        collector.add(std::move(result));
+    });
+    GlobalHandle filterHandle(GlobalFederateId(131072), InterfaceHandle(4));
+    auto command = filterCommand(CMD_SEND_FOR_DEST_FILTER_AND_RETURN, InterfaceHandle(3), "data");
+    command.sequenceID = 61;
+    workers.addMessage(filterHandle, std::make_shared<RerouteOperator>(), std::move(command));
+    workers.stop();
+    // the rerouted message is delivered again before the original destination is released
+    ASSERT_EQ(collector.results.size(), 2U);
+    EXPECT_EQ(collector.results[0].action(), CMD_SEND_MESSAGE);
+    EXPECT_EQ(collector.results[0].dest_id, parent_broker_id);
+    EXPECT_EQ(collector.results[0].getString(targetStringLoc), "other");
+    EXPECT_EQ(collector.results[1].action(), CMD_NULL_DEST_MESSAGE);
+    EXPECT_EQ(collector.results[1].sequenceID, 61U);
+    EXPECT_EQ(collector.results[1].dest_handle, InterfaceHandle(3));
+}
@@ -0,0 +1,158 @@
+/*
+Copyright (c) 2017-2022,
+Battelle Memorial Institute; Lawrence Livermore National Security, LLC; Alliance for Sustainable
+Energy, LLC.  See the top-level NOTICE for additional details. All rights reserved.
+SPDX-License-Identifier: BSD-3-Clause
+*/
+#include "helics/core/FlightRecorder.hpp"
+
+#include "gtest/gtest.h"
+#include <atomic>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <vector>
+
+using namespace helics;
+
+static ActionMessage makeMessage(int index)
+{
+    ActionMessage cmd(CMD_SEND_MESSAGE);
+    cmd.source_id = GlobalFederateId(131072 + index);
+    cmd.dest_id = GlobalFederateId(131073);
+    cmd.messageID = index;
+    cmd.actionTime = Time(index, time_units::ms);
+    cmd.payload = "message " + std::to_string(index);
+    cmd.setStringData("dest");
+    return cmd;
+}
+
+static void checkMessage(const ActionMessage& cmd, const ActionMessage& expected)
+{
+    EXPECT_EQ(cmd.action(), expected.action());
+    EXPECT_EQ(cmd.messageID, expected.messageID);
+    EXPECT_EQ(cmd.source_id, expected.source_id);
+    EXPECT_EQ(cmd.dest_id, expected.dest_id);
+    EXPECT_EQ(cmd.actionTime, expected.actionTime);
+    EXPECT_EQ(cmd.payload.to_string(), expected.payload.to_string());
+    EXPECT_EQ(cmd.getStringData(), expected.getStringData());
+}
+
+TEST(flight_recorder_tests, record)
+{
+    FlightRecorder recorder(64);
+    EXPECT_EQ(recorder.capacity(), 64U);
+    EXPECT_TRUE(recorder.records().empty());
+    for (int ii = 0; ii < 10; ++ii) {
+        recorder.record(makeMessage(ii));
+    }
+    EXPECT_EQ(recorder.recordedCount(), 10U);
+    auto records = recorder.records();
+    ASSERT_EQ(records.size(), 10U);
+    for (int ii = 0; ii < 10; ++ii) {
+        EXPECT_EQ(records[ii].sequence, static_cast<std::uint64_t>(ii));
+        EXPECT_FALSE(records[ii].truncated);
+        EXPECT_GT(records[ii].timestamp, 0);
+        checkMessage(records[ii].message, makeMessage(ii));
+    }
+}
+
+TEST(flight_recorder_tests, bounded)
+{
+    FlightRecorder recorder(16);
+    for (int ii = 0; ii < 100; ++ii) {
+        recorder.record(makeMessage(ii));
+    }
+    EXPECT_EQ(recorder.recordedCount(), 100U);
+    auto records = recorder.records();
+    // only the most recent messages are kept
+    ASSERT_EQ(records.size(), 16U);
+    EXPECT_EQ(records.front().sequence, 84U);
+    EXPECT_EQ(records.front().message.messageID, 84);
+    EXPECT_EQ(records.back().sequence, 99U);
+    EXPECT_EQ(records.back().message.messageID, 99);
+}
+
+TEST(flight_recorder_tests, truncated)
+{
+    FlightRecorder recorder(4, 128);
+    EXPECT_EQ(recorder.slotSize(), 128U);
+    auto cmd = makeMessage(1);
+    cmd.payload = std::string(1000, 'a');
+    recorder.record(cmd);
+    auto records = recorder.records();
+    ASSERT_EQ(records.size(), 1U);
+    EXPECT_TRUE(records[0].truncated);
+    EXPECT_EQ(records[0].message.action(), CMD_SEND_MESSAGE);
+    EXPECT_EQ(records[0].message.messageID, 1);
+    EXPECT_GT(records[0].message.payload.size(), 0U);
+    EXPECT_LT(records[0].message.payload.size(), 128U);
+    EXPECT_TRUE(records[0].message.getStringData().empty());
+}
+
+TEST(flight_recorder_tests, truncated_string_data)
+{
+    FlightRecorder recorder(4, 128);
+    auto cmd = makeMessage(2);
+    // the payload fits but the endpoint names alone are larger than the slot
+    cmd.setString(0, std::string(100, 's'));
+    cmd.setString(1, std::string(100, 'd'));
+    cmd.setString(2, std::string(100, 'o'));
+    cmd.setString(3, std::string(100, 'r'));
+    ASSERT_GT(static_cast<std::size_t>(cmd.serializedByteCount()), recorder.slotSize());
+    recorder.record(cmd);
+    recorder.record(makeMessage(3));
+    auto records = recorder.records();
+    ASSERT_EQ(records.size(), 2U);
+    EXPECT_TRUE(records[0].truncated);
+    EXPECT_EQ(records[0].message.messageID, 2);
+    EXPECT_EQ(records[0].message.payload.to_string(), cmd.payload.to_string());
+    EXPECT_TRUE(records[0].message.getStringData().empty());
+    EXPECT_FALSE(records[1].truncated);
+    checkMessage(records[1].message, makeMessage(3));
+}
+
+TEST(flight_recorder_tests, dump_decode)
+{
+    FlightRecorder recorder(32);
+    for (int ii = 0; ii < 50; ++ii) {
+        recorder.record(makeMessage(ii));
+    }
+    auto dump = recorder.dump();
+    auto decoded = FlightRecorder::decode(dump);
+    auto records = recorder.records();
+    ASSERT_EQ(decoded.size(), records.size());
+    for (std::size_t ii = 0; ii < decoded.size(); ++ii) {
+        EXPECT_EQ(decoded[ii].sequence, records[ii].sequence);
+        EXPECT_EQ(decoded[ii].timestamp, records[ii].timestamp);
+        checkMessage(decoded[ii].message, records[ii].message);
+    }
+    EXPECT_THROW(FlightRecorder::decode("not a dump"), std::invalid_argument);
+    EXPECT_THROW(FlightRecorder::decode(dump.substr(0, dump.size() - 10)), std::invalid_argument);
+}
+
+TEST(flight_recorder_tests, concurrent_read)
+{
+    FlightRecorder recorder(128);
+    std::atomic<bool> done{false};
+    std::thread writer([&]() {
+        for (int ii = 0; ii < 100000; ++ii) {
+            recorder.record(makeMessage(ii));
+        }
+        done.store(true);
+    });
+    int reads{0};
+    while (!done.load() || reads == 0) {
+        auto records = recorder.records();
+        for (std::size_t ii = 0; ii < records.size(); ++ii) {
+            // messages overwritten during the read are skipped, the rest must be intact
+            EXPECT_EQ(records[ii].message.messageID, static_cast<int>(records[ii].sequence));
+            if (ii > 0) {
+                EXPECT_GT(records[ii].sequence, records[ii - 1].sequence);
+            }
+        }
+        ++reads;
+    }
+    writer.join();
+    EXPECT_EQ(recorder.records().size(), 128U);
+}
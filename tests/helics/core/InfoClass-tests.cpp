@@ -7,6 +7,7 @@ SPDX-License-Identifier: BSD-3-Clause
 #include "helics/core/BasicHandleInfo.hpp"
 #include "helics/core/EndpointInfo.hpp"
 #include "helics/core/FilterInfo.hpp"
+#include "helics/core/InputDataRing.hpp"
 #include "helics/core/InputInfo.hpp"
 
 #include "gtest/gtest.h"
@@ -332,3 +333,75 @@ TEST(InfoClass_tests, inputinfo_test)
     ret_data = subI.getData(0);
     EXPECT_EQ(ret_data->to_string(), "time one");
 }
+
+TEST(InfoClass_tests, inputdataring_test)
+{
+    helics::InputDataRing ring;
+    EXPECT_TRUE(ring.empty());
+    ring.insert(1.0, 0, helics::SmallBuffer("one"));
+    ring.insert(3.0, 0, helics::SmallBuffer("three"));
+    ring.insert(2.0, 0, helics::SmallBuffer("two"));
+    ring.insert(2.0, 1, helics::SmallBuffer("two repeat"));
+    ASSERT_EQ(ring.size(), 4U);
+    EXPECT_EQ(ring[0].data.to_string(), "one");
+    EXPECT_EQ(ring[1].data.to_string(), "two");
+    EXPECT_EQ(ring[2].data.to_string(), "two repeat");
+    EXPECT_EQ(ring.back().data.to_string(), "three");
+
+    // wrap around the end of the slots and grow while wrapped
+    ring.popFront(3);
+    auto capacity = ring.capacity();
+    for (int ii = 4; ii < 20; ++ii) {
+        ring.insert(static_cast<double>(ii), 0, helics::SmallBuffer(std::to_string(ii)));
+    }
+    EXPECT_GT(ring.capacity(), capacity);
+    ASSERT_EQ(ring.size(), 17U);
+    EXPECT_EQ(ring.front().data.to_string(), "three");
+    for (std::size_t ii = 1; ii < ring.size(); ++ii) {
+        EXPECT_EQ(ring[ii].data.to_string(), std::to_string(ii + 3));
+    }
+    ring.popBack();
+    EXPECT_EQ(ring.back().data.to_string(), "18");
+    ring.clear();
+    EXPECT_TRUE(ring.empty());
+}
+
+TEST(InfoClass_tests, inputinfo_ring_storage_test)
+{
+    helics::InputInfo subI(helics::GlobalHandle(helics::GlobalFederateId(5),
+                                                helics::InterfaceHandle(13)),
+                           "key",
+                           "type",
+                           "units");
+    subI.ring_storage = true;
+    helics::GlobalHandle testHandle(helics::GlobalFederateId(5), helics::InterfaceHandle(45));
+    subI.addSource(testHandle, "", "double", std::string());
+
+    subI.addData(testHandle, helics::timeZero, 0, helics::SmallBuffer("hello world"));
+    EXPECT_EQ(subI.nextValueTime(), helics::timeZero);
+    EXPECT_TRUE(subI.updateTimeInclusive(helics::timeZero));
+    auto ret_data = subI.getData(0);
+    EXPECT_EQ(ret_data->to_string(), "hello world");
+
+    subI.addData(testHandle, 1, 0, helics::SmallBuffer("time one"));
+    subI.addData(testHandle, 1, 0, std::make_shared<helics::SmallBuffer>("time one repeat"));
+    EXPECT_FALSE(subI.updateTimeUpTo(1.0));
+    EXPECT_TRUE(subI.updateTimeInclusive(1.0));
+    EXPECT_EQ(subI.getData(0)->to_string(), "time one repeat");
+    // a value still held outside the input is not overwritten by later updates
+    EXPECT_EQ(ret_data->to_string(), "hello world");
+
+    subI.addData(testHandle, 2, 0, helics::SmallBuffer("time one"));
+    subI.addData(testHandle, 2, 1, helics::SmallBuffer("time one repeat"));
+    EXPECT_TRUE(subI.updateTimeNextIteration(2.0));
+    EXPECT_EQ(subI.getData(0)->to_string(), "time one");
+    EXPECT_TRUE(subI.updateTimeNextIteration(2.0));
+    EXPECT_EQ(subI.getData(0)->to_string(), "time one repeat");
+
+    subI.only_update_on_change = true;
+    subI.addData(testHandle, 3, 0, helics::SmallBuffer("time one repeat"));
+    EXPECT_FALSE(subI.updateTimeInclusive(3.0));
+    subI.addData(testHandle, 4, 0, helics::SmallBuffer("time four"));
+    subI.removeSource(testHandle, 3.5);
+    EXPECT_EQ(subI.nextValueTime(), helics::Time::maxVal());
+}
@@ -0,0 +1,97 @@
+/*
+Copyright (c) 2017-2022,
+Battelle Memorial Institute; Lawrence Livermore National Security, LLC; Alliance for Sustainable
+Energy, LLC.  See the top-level NOTICE for additional details. All rights reserved.
+SPDX-License-Identifier: BSD-3-Clause
+*/
+#include "helics/common/JsonProcessingFunctions.hpp"
+#include "helics/core/LatencyTracker.hpp"
+
+#include "gtest/gtest.h"
+#include <memory>
+#include <thread>
+#include <vector>
+
+using namespace helics;
+
+TEST(latency_tests, bucket_bounds)
+{
+    for (std::uint64_t value = 0; value < 100000; ++value) {
+        auto index = LatencyHistogram::bucketIndex(value);
+        ASSERT_LT(index, LatencyHistogram::bucketCount);
+        EXPECT_GE(LatencyHistogram::bucketUpperBound(index), value);
+        if (index > 0) {
+            EXPECT_LT(LatencyHistogram::bucketUpperBound(index - 1), value);
+        }
+    }
+    EXPECT_EQ(LatencyHistogram::bucketIndex(std::uint64_t{1} << 50U),
+              LatencyHistogram::bucketCount - 1);
+}
+
+TEST(latency_tests, percentiles)
+{
+    auto hist = std::make_unique<LatencyHistogram>();
+    EXPECT_EQ(hist->percentile(0.5), 0);
+    for (std::int64_t ii = 1; ii <= 10000; ++ii) {
+        hist->record(ii * 100);
+    }
+    EXPECT_EQ(hist->count(), 10000U);
+    EXPECT_EQ(hist->max(), 1000000);
+    EXPECT_NEAR(hist->mean(), 500050.0, 0.1);
+    // buckets have a resolution of 1/16 of the power of 2 range
+    EXPECT_NEAR(static_cast<double>(hist->percentile(0.5)), 500000.0, 500000.0 / 16.0);
+    EXPECT_NEAR(static_cast<double>(hist->percentile(0.99)), 990000.0, 990000.0 / 16.0);
+    EXPECT_EQ(hist->percentile(1.0), 1000000);
+    hist->reset();
+    EXPECT_EQ(hist->count(), 0U);
+}
+
+TEST(latency_tests, histogram_set)
+{
+    LatencyHistogramSet set;
+    std::vector<std::thread> threads;
+    for (int ii = 0; ii < 4; ++ii) {
+        threads.emplace_back([&set]() {
+            for (int jj = 0; jj < 1000; ++jj) {
+                set.get(jj % 50)->record(jj);
+            }
+        });
+    }
+    for (auto& thrd : threads) {
+        thrd.join();
+    }
+    int keys{0};
+    std::uint64_t total{0};
+    set.forEach([&keys, &total](std::int32_t key, const LatencyHistogram& hist) {
+        EXPECT_LT(key, 50);
+        ++keys;
+        total += hist.count();
+    });
+    EXPECT_EQ(keys, 50);
+    EXPECT_EQ(total, 4000U);
+}
+
+TEST(latency_tests, tracker_json)
+{
+    auto tracker = std::make_unique<LatencyTracker>();
+    auto start = LatencyTracker::now();
+    tracker->recordQueue(CMD_PUB, start, start + 2000);
+    // messages without a timestamp are ignored
+    tracker->recordQueue(CMD_PUB, 0, start);
+    tracker->recordProcessing(CMD_PUB, start, start + 500);
+    tracker->recordTransmit(route_id{3}, start, start + 100);
+
+    Json::Value base;
+    tracker->loadJson(base);
+    EXPECT_EQ(base["units"].asString(), "ns");
+    const auto& queue = base["queue"][actionMessageType(CMD_PUB)];
+    EXPECT_EQ(queue["count"].asUInt64(), 1U);
+    EXPECT_EQ(queue["max"].asInt64(), 2000);
+    EXPECT_EQ(base["processing"][actionMessageType(CMD_PUB)]["max"].asInt64(), 500);
+    EXPECT_EQ(base["transmit"]["3"]["p50"].asInt64(), 100);
+
+    tracker->reset();
+    Json::Value cleared;
+    tracker->loadJson(cleared);
+    EXPECT_TRUE(cleared["queue"].empty());
+}
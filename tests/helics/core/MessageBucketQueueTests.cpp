@@ -0,0 +1,127 @@
+/*
+Copyright (c) 2017-2022,
+Battelle Memorial Institute; Lawrence Livermore National Security, LLC; Alliance for Sustainable
+Energy, LLC.  See the top-level NOTICE for additional details. All rights reserved.
+SPDX-License-Identifier: BSD-3-Clause
+*/
+#include "helics/core/MessageBucketQueue.hpp"
+
+#include "gtest/gtest.h"
+#include <algorithm>
+#include <memory>
+#include <random>
+#include <string>
+#include <vector>
+
+using namespace helics;
+
+static std::unique_ptr<Message> makeMessage(Time time, const std::string& source, int32_t id)
+{
+    auto message = std::make_unique<Message>();
+    message->time = time;
+    message->original_source = source;
+    message->messageID = id;
+    return message;
+}
+
+TEST(message_bucket_queue_tests, empty)
+{
+    MessageBucketQueue queue;
+    EXPECT_TRUE(queue.empty());
+    EXPECT_EQ(queue.size(), 0);
+    EXPECT_EQ(queue.firstTime(), Time::maxVal());
+    EXPECT_EQ(queue.countThrough(Time::maxVal()), 0);
+    EXPECT_FALSE(queue.pop());
+}
+
+TEST(message_bucket_queue_tests, time_order)
+{
+    MessageBucketQueue queue;
+    queue.push(makeMessage(3.0, "a", 1));
+    queue.push(makeMessage(1.0, "a", 2));
+    queue.push(makeMessage(2.0, "a", 3));
+    queue.push(makeMessage(1.0, "a", 4));
+    EXPECT_EQ(queue.size(), 4);
+    EXPECT_EQ(queue.firstTime(), 1.0);
+    EXPECT_EQ(queue.countThrough(1.0), 2);
+    EXPECT_EQ(queue.countBefore(1.0), 0);
+    EXPECT_EQ(queue.countBefore(2.5), 3);
+    EXPECT_EQ(queue.countThrough(3.0), 4);
+    EXPECT_EQ(queue.countBefore(3.0), 3);
+
+    std::vector<int32_t> order;
+    while (!queue.empty()) {
+        order.push_back(queue.pop()->messageID);
+    }
+    EXPECT_EQ(order, (std::vector<int32_t>{2, 4, 3, 1}));
+    EXPECT_EQ(queue.firstTime(), Time::maxVal());
+}
+
+TEST(message_bucket_queue_tests, source_order)
+{
+    MessageBucketQueue queue;
+    queue.push(makeMessage(1.0, "c", 1));
+    queue.push(makeMessage(1.0, "a", 2));
+    queue.push(makeMessage(1.0, "b", 3));
+    queue.push(makeMessage(1.0, "a", 4));
+    EXPECT_EQ(queue.pop()->messageID, 2);
+    // messages added to a bucket that has already been read stay in order
+    queue.push(makeMessage(1.0, "b", 5));
+    queue.push(makeMessage(1.0, "a", 6));
+    queue.push(makeMessage(1.0, "d", 7));
+    std::vector<int32_t> order;
+    while (!queue.empty()) {
+        order.push_back(queue.pop()->messageID);
+    }
+    EXPECT_EQ(order, (std::vector<int32_t>{4, 6, 3, 5, 1, 7}));
+}
+
+TEST(message_bucket_queue_tests, matches_sorted_order)
+{
+    std::mt19937 generator(457);
+    std::uniform_int_distribution<int> timeDist(0, 20);
+    std::uniform_int_distribution<int> sourceDist(0, 9);
+    std::uniform_int_distribution<int> actionDist(0, 3);
+
+    MessageBucketQueue queue;
+    std::vector<std::unique_ptr<Message>> reference;
+    auto referenceOrder = [](const auto& m1, const auto& m2) {
+        return (m1->time != m2->time) ? (m1->time < m2->time) :
+                                        (m1->original_source < m2->original_source);
+    };
+    int32_t id{0};
+    for (int ii = 0; ii < 5000; ++ii) {
+        if (actionDist(generator) == 0 && !queue.empty()) {
+            std::stable_sort(reference.begin(), reference.end(), referenceOrder);
+            auto message = queue.pop();
+            ASSERT_TRUE(message);
+            EXPECT_EQ(message->messageID, reference.front()->messageID);
+            reference.erase(reference.begin());
+        } else {
+            auto message = makeMessage(Time(static_cast<double>(timeDist(generator))),
+                                       "source" + std::to_string(sourceDist(generator)),
+                                       ++id);
+            reference.push_back(std::make_unique<Message>(*message));
+            queue.push(std::move(message));
+        }
+        ASSERT_EQ(queue.size(), static_cast<int32_t>(reference.size()));
+    }
+    std::stable_sort(reference.begin(), reference.end(), referenceOrder);
+    EXPECT_EQ(queue.firstTime(), reference.front()->time);
+    for (const auto& message : reference) {
+        auto next = queue.pop();
+        ASSERT_TRUE(next);
+        EXPECT_EQ(next->messageID, message->messageID);
+    }
+    EXPECT_TRUE(queue.empty());
+}
+
+TEST(message_bucket_queue_tests, clear)
+{
+    MessageBucketQueue queue;
+    queue.push(makeMessage(1.0, "a", 1));
+    queue.push(makeMessage(2.0, "a", 2));
+    queue.clear();
+    EXPECT_TRUE(queue.empty());
+    EXPECT_FALSE(queue.pop());
+}
@@ -8,6 +8,7 @@ SPDX-License-Identifier: BSD-3-Clause
 #include "helics/core/MessageTimer.hpp"
 
 #include "gtest/gtest.h"
+#include <atomic>
 #include <thread>
 using namespace helics;
 
@@ -66,6 +67,28 @@ TEST(messageTimer_tests, shorttime_test)
     }
 }
 
+TEST(messageTimer_tests, release_reuse)
+{
+    std::atomic<int> counter{0};
+    auto cback = [&counter](helics::ActionMessage&&) { ++counter; };
+    auto mtimer = std::make_shared<helics::MessageTimer>(cback);
+
+    auto index1 = mtimer->addTimerFromNow(1h, helics::CMD_PROTOCOL);
+    auto index2 = mtimer->addTimerFromNow(1h, helics::CMD_PROTOCOL);
+    EXPECT_NE(index1, index2);
+    // a cancelled timer keeps its slot so it can be updated later
+    mtimer->cancelTimer(index1);
+    auto index3 = mtimer->addTimerFromNow(1h, helics::CMD_PROTOCOL);
+    EXPECT_NE(index3, index1);
+    // a released slot is given to the next timer
+    mtimer->releaseTimer(index2);
+    auto index4 = mtimer->addTimerFromNow(20ms, helics::CMD_PROTOCOL);
+    EXPECT_EQ(index4, index2);
+    std::this_thread::sleep_for(200ms);
+    EXPECT_EQ(counter.load(), 1);
+    mtimer->cancelAll();
+}
+
 TEST(messageTimer_tests_ci_skip, basic_test_update)
 {
     std::mutex mlock;
@@ -6,8 +6,12 @@ SPDX-License-Identifier: BSD-3-Clause
 */
 #include "helics/core/ActionMessage.hpp"
 #include "helics/core/TimeDependencies.hpp"
+#include "helics/core/flagOperations.hpp"
 
 #include "gtest/gtest.h"
+#include <limits>
+#include <random>
+#include <vector>
 
 using namespace helics;
 
@@ -40,3 +44,92 @@ TEST(timeDep_tests, dependency_tests)
     auto total = generateMinTimeTotal(depTest, false, GlobalFederateId{1}, GlobalFederateId{}, 0);
     EXPECT_EQ(total.next, 2.0);
 }
+
+static void checkTimeDataEqual(const TimeData& test, const TimeData& expected)
+{
+    EXPECT_EQ(test.next, expected.next);
+    EXPECT_EQ(test.Te, expected.Te);
+    EXPECT_EQ(test.minDe, expected.minDe);
+    EXPECT_EQ(test.TeAlt, expected.TeAlt);
+    EXPECT_EQ(test.minFed, expected.minFed);
+    EXPECT_EQ(test.minFedActual, expected.minFedActual);
+    EXPECT_EQ(test.mTimeState, expected.mTimeState);
+    EXPECT_EQ(test.interrupted, expected.interrupted);
+    EXPECT_EQ(test.sequenceCounter, expected.sequenceCounter);
+    EXPECT_EQ(test.responseSequenceCounter, expected.responseSequenceCounter);
+}
+
+TEST(timeDep_tests, indexed_min_time)
+{
+    std::mt19937 gen(45);
+    auto rval = [&gen](int count) { return std::uniform_int_distribution<int>(0, count - 1)(gen); };
+    const std::vector<Time> times{timeZero, 1.0, 2.0, 3.0, Time::maxVal()};
+
+    TimeDependencies indexed;
+    TimeDependencies linear;
+    indexed.setIndexThreshold(0);
+    linear.setIndexThreshold(std::numeric_limits<std::size_t>::max());
+
+    std::vector<GlobalFederateId> ids;
+    for (int ii = 0; ii < 200; ++ii) {
+        ids.emplace_back((ii % 4 == 0) ? 1879048192 + ii : 131072 + ii);
+        for (auto* deps : {&indexed, &linear}) {
+            deps->addDependency(ids.back());
+            if (ii % 3 != 0) {
+                deps->addDependent(ids.back());
+            }
+            deps->getDependencyInfo(ids.back())->connection =
+                (ii % 5 == 0) ? ConnectionType::parent : ConnectionType::child;
+        }
+    }
+    for (auto* deps : {&indexed, &linear}) {
+        for (auto id : ids) {
+            ActionMessage grant(CMD_EXEC_GRANT);
+            grant.source_id = id;
+            deps->updateTime(grant);
+        }
+    }
+    for (int step = 0; step < 2000; ++step) {
+        ActionMessage msg(CMD_TIME_REQUEST);
+        switch (rval(10)) {
+            case 0:
+                msg.setAction(CMD_TIME_GRANT);
+                break;
+            case 1:
+                msg.setAction(CMD_TIMING_INFO);
+                break;
+            case 2:
+                msg.setAction(CMD_DISCONNECT);
+                break;
+            default:
+                break;
+        }
+        msg.source_id = ids[rval(static_cast<int>(ids.size()))];
+        msg.actionTime = times[rval(4)];
+        msg.Te = times[rval(5)];
+        msg.Tdemin = times[rval(5)];
+        msg.counter = static_cast<std::uint16_t>(rval(3));
+        msg.setExtraData(rval(2) == 0 ? ids[rval(static_cast<int>(ids.size()))].baseValue() :
+                                        rval(2));
+        msg.setExtraDestData(rval(3));
+        if (rval(4) == 0) {
+            setActionFlag(msg, interrupted_flag);
+        }
+        indexed.updateTime(msg);
+        linear.updateTime(msg);
+
+        auto self = (rval(2) == 0) ? GlobalFederateId{} : ids[rval(static_cast<int>(ids.size()))];
+        auto ignore = (rval(2) == 0) ? GlobalFederateId{} : ids[rval(static_cast<int>(ids.size()))];
+        auto sequence = rval(3);
+        checkTimeDataEqual(generateMinTimeTotal(indexed, false, self, ignore, sequence),
+                           generateMinTimeTotal(linear, false, self, ignore, sequence));
+        checkTimeDataEqual(generateMinTimeUpstream(indexed, true, self, ignore, sequence),
+                           generateMinTimeUpstream(linear, true, self, ignore, sequence));
+        checkTimeDataEqual(generateMinTimeDownstream(indexed, false, self, ignore, sequence),
+                           generateMinTimeDownstream(linear, false, self, ignore, sequence));
+        if (step % 500 == 499) {
+            indexed.resetDependentEvents(times[1]);
+            linear.resetDependentEvents(times[1]);
+        }
+    }
+}
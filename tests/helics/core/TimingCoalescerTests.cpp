@@ -0,0 +1,121 @@
+/*
+Copyright (c) 2017-2022,
+Battelle Memorial Institute; Lawrence Livermore National Security, LLC; Alliance for Sustainable
+Energy, LLC.  See the top-level NOTICE for additional details. All rights reserved.
+SPDX-License-Identifier: BSD-3-Clause
+*/
+#include "helics/core/TimingCoalescer.hpp"
+#include "helics/core/flagOperations.hpp"
+
+#include "gtest/gtest.h"
+#include <vector>
+
+using namespace helics;
+
+static ActionMessage makeRequest(int source, int dest, double time)
+{
+    ActionMessage cmd(CMD_TIME_REQUEST);
+    cmd.source_id = GlobalFederateId(131072 + source);
+    cmd.dest_id = GlobalFederateId(131072 + dest);
+    cmd.actionTime = time;
+    cmd.Te = time;
+    cmd.Tdemin = time;
+    return cmd;
+}
+
+TEST(timing_coalescer_tests, superseded_request)
+{
+    TimingCoalescer coalescer;
+    std::vector<ActionMessage> batch{makeRequest(1, 2, 1.0),
+                                     makeRequest(1, 2, 2.0),
+                                     makeRequest(1, 2, 3.0)};
+    EXPECT_EQ(coalescer.coalesce(batch), 2U);
+    ASSERT_EQ(batch.size(), 1U);
+    EXPECT_EQ(batch[0].actionTime, 3.0);
+    EXPECT_EQ(coalescer.timingMessageCount(), 3U);
+    EXPECT_EQ(coalescer.coalescedCount(), 2U);
+}
+
+TEST(timing_coalescer_tests, different_routes)
+{
+    TimingCoalescer coalescer;
+    std::vector<ActionMessage> batch{makeRequest(1, 2, 1.0),
+                                     makeRequest(3, 2, 1.0),
+                                     makeRequest(1, 4, 1.0),
+                                     makeRequest(1, 2, 2.0)};
+    EXPECT_EQ(coalescer.coalesce(batch), 1U);
+    ASSERT_EQ(batch.size(), 3U);
+    EXPECT_EQ(batch[0].source_id, GlobalFederateId(131075));
+    EXPECT_EQ(batch[1].dest_id, GlobalFederateId(131076));
+    EXPECT_EQ(batch[2].actionTime, 2.0);
+}
+
+TEST(timing_coalescer_tests, intervening_message)
+{
+    TimingCoalescer coalescer;
+    ActionMessage data(CMD_PUB);
+    data.source_id = GlobalFederateId(131073);
+    data.dest_id = GlobalFederateId(131074);
+    ActionMessage grant(CMD_TIME_GRANT);
+    grant.source_id = GlobalFederateId(131073);
+    grant.dest_id = GlobalFederateId(131074);
+    std::vector<ActionMessage> batch{makeRequest(1, 2, 1.0),
+                                     data,
+                                     makeRequest(1, 2, 2.0),
+                                     grant,
+                                     makeRequest(1, 2, 3.0)};
+    // any other message on the same route keeps the earlier request
+    EXPECT_EQ(coalescer.coalesce(batch), 0U);
+    EXPECT_EQ(batch.size(), 5U);
+}
+
+TEST(timing_coalescer_tests, iteration_state)
+{
+    TimingCoalescer coalescer;
+    auto iterating = makeRequest(1, 2, 2.0);
+    setActionFlag(iterating, iteration_requested_flag);
+    auto nextIteration = makeRequest(1, 2, 2.0);
+    setActionFlag(nextIteration, iteration_requested_flag);
+    nextIteration.counter = 1;
+    auto response = makeRequest(1, 2, 2.0);
+    setActionFlag(response, iteration_requested_flag);
+    response.counter = 1;
+    response.setExtraDestData(4);
+    std::vector<ActionMessage> batch{makeRequest(1, 2, 1.0), iterating, nextIteration, response};
+    EXPECT_EQ(coalescer.coalesce(batch), 0U);
+    EXPECT_EQ(batch.size(), 4U);
+
+    // matching iteration state and sequence counters are collapsed
+    auto repeat = response;
+    repeat.Te = 3.0;
+    batch = {response, repeat};
+    EXPECT_EQ(coalescer.coalesce(batch), 1U);
+    ASSERT_EQ(batch.size(), 1U);
+    EXPECT_EQ(batch[0].Te, 3.0);
+}
+
+TEST(timing_coalescer_tests, exec_request)
+{
+    TimingCoalescer coalescer;
+    ActionMessage exec(CMD_EXEC_REQUEST);
+    exec.source_id = GlobalFederateId(131073);
+    exec.dest_id = GlobalFederateId(131074);
+    auto restricted = exec;
+    restricted.messageID = 1;
+    std::vector<ActionMessage> batch{exec, exec, restricted, makeRequest(1, 2, 1.0)};
+    EXPECT_EQ(coalescer.coalesce(batch), 1U);
+    ASSERT_EQ(batch.size(), 3U);
+    EXPECT_EQ(batch[0].action(), CMD_EXEC_REQUEST);
+    EXPECT_EQ(batch[1].messageID, 1);
+    EXPECT_EQ(batch[2].action(), CMD_TIME_REQUEST);
+}
+
+TEST(timing_coalescer_tests, payload)
+{
+    TimingCoalescer coalescer;
+    auto withData = makeRequest(1, 2, 1.0);
+    withData.payload = "info";
+    std::vector<ActionMessage> batch{withData, makeRequest(1, 2, 2.0)};
+    EXPECT_EQ(coalescer.coalesce(batch), 0U);
+    EXPECT_EQ(batch.size(), 2U);
+}
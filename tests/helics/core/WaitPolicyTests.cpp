@@ -0,0 +1,89 @@
+/*
+Copyright (c) 2017-2022,
+Battelle Memorial Institute; Lawrence Livermore National Security, LLC; Alliance for Sustainable
+Energy, LLC.  See the top-level NOTICE for additional details. All rights reserved.
+SPDX-License-Identifier: BSD-3-Clause
+*/
+#include "helics/common/MpscQueue.hpp"
+#include "helics/core/WaitPolicy.hpp"
+
+#include "gtest/gtest.h"
+#include <chrono>
+#include <optional>
+#include <thread>
+
+using namespace helics;
+
+TEST(wait_policy_tests, set_policy)
+{
+    WaitPolicy policy;
+    EXPECT_EQ(policy.getPolicy(), HELICS_WAIT_POLICY_BLOCK);
+    EXPECT_TRUE(policy.setPolicy(HELICS_WAIT_POLICY_ADAPTIVE));
+    EXPECT_EQ(policy.getPolicy(), HELICS_WAIT_POLICY_ADAPTIVE);
+    EXPECT_FALSE(policy.setPolicy(27));
+    EXPECT_EQ(policy.getPolicy(), HELICS_WAIT_POLICY_ADAPTIVE);
+}
+
+class wait_policy_queue_tests: public ::testing::TestWithParam<int> {};
+
+TEST_P(wait_policy_queue_tests, delayed_push)
+{
+    WaitPolicy policy;
+    policy.setPolicy(GetParam());
+    MpscQueue<int> queue;
+    queue.push(1);
+    EXPECT_EQ(policy.pop(queue), 1);
+    std::thread producer([&queue]() {
+        std::this_thread::sleep_for(std::chrono::milliseconds(20));
+        queue.push(2);
+    });
+    EXPECT_EQ(policy.pop(queue), 2);
+    producer.join();
+}
+
+INSTANTIATE_TEST_SUITE_P(wait_policy_tests,
+                         wait_policy_queue_tests,
+                         ::testing::Values(HELICS_WAIT_POLICY_BLOCK,
+                                           HELICS_WAIT_POLICY_SPIN,
+                                           HELICS_WAIT_POLICY_SPIN_YIELD,
+                                           HELICS_WAIT_POLICY_ADAPTIVE));
+
+/** queue with a value that becomes available at a set time*/
+struct DelayedQueue {
+    WaitPolicy::clock::time_point ready;
+    std::optional<int> try_pop()
+    {
+        return (WaitPolicy::clock::now() >= ready) ? std::optional<int>(4) : std::nullopt;
+    }
+    int pop()
+    {
+        while (WaitPolicy::clock::now() < ready) {
+        }
+        return 4;
+    }
+};
+
+TEST(wait_policy_tests, adaptive_budget)
+{
+    WaitPolicy policy;
+    policy.setPolicy(HELICS_WAIT_POLICY_ADAPTIVE);
+    MpscQueue<int> queue;
+    // long waits shrink the spin budget to the minimum
+    for (int ii = 0; ii < 5; ++ii) {
+        std::thread producer([&queue]() {
+            std::this_thread::sleep_for(std::chrono::milliseconds(5));
+            queue.push(3);
+        });
+        EXPECT_EQ(policy.pop(queue), 3);
+        producer.join();
+    }
+    EXPECT_EQ(policy.getSpinBudget(), WaitPolicy::minSpinBudget);
+    // waits a little longer than the minimum raise the budget to cover them
+    DelayedQueue delayed;
+    for (int ii = 0; ii < 100; ++ii) {
+        delayed.ready = WaitPolicy::clock::now() + std::chrono::microseconds(10);
+        EXPECT_EQ(policy.pop(delayed), 4);
+    }
+    EXPECT_GT(policy.getSpinBudget(), WaitPolicy::minSpinBudget);
+    EXPECT_LT(policy.getSpinBudget(), WaitPolicy::maxSpinBudget);
+}
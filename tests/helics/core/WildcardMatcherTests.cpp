@@ -0,0 +1,93 @@
+/*
+Copyright (c) 2017-2022,
+Battelle Memorial Institute; Lawrence Livermore National Security, LLC; Alliance for Sustainable
+Energy, LLC.  See the top-level NOTICE for additional details. All rights reserved.
+SPDX-License-Identifier: BSD-3-Clause
+*/
+#include "helics/core/UnknownHandleManager.hpp"
+#include "helics/core/WildcardMatcher.hpp"
+#include "helics/core/flagOperations.hpp"
+
+#include "gtest/gtest.h"
+#include <algorithm>
+#include <string>
+#include <vector>
+
+using namespace helics;
+
+static std::vector<std::size_t> getMatches(WildcardMatcher& matcher, const std::string& name)
+{
+    std::vector<std::size_t> matches;
+    matcher.match(name, matches);
+    std::sort(matches.begin(), matches.end());
+    return matches;
+}
+
+TEST(wildcard_tests, is_pattern)
+{
+    EXPECT_TRUE(WildcardMatcher::isPattern("feeder_*/voltage"));
+    EXPECT_TRUE(WildcardMatcher::isPattern("bus?"));
+    EXPECT_FALSE(WildcardMatcher::isPattern("feeder_1/voltage"));
+}
+
+TEST(wildcard_tests, matching)
+{
+    WildcardMatcher matcher;
+    EXPECT_TRUE(matcher.empty());
+    auto p0 = matcher.addPattern("feeder_*/voltage");
+    auto p1 = matcher.addPattern("feeder_?/voltage");
+    auto p2 = matcher.addPattern("*");
+    auto p3 = matcher.addPattern("feeder_1**/*");
+    auto p4 = matcher.addPattern("feeder_1/voltage");
+    EXPECT_EQ(matcher.size(), 5U);
+
+    EXPECT_EQ(getMatches(matcher, "feeder_1/voltage"),
+              (std::vector<std::size_t>{p0, p1, p2, p3, p4}));
+    EXPECT_EQ(getMatches(matcher, "feeder_12/voltage"), (std::vector<std::size_t>{p0, p2, p3}));
+    EXPECT_EQ(getMatches(matcher, "feeder_2/current"), (std::vector<std::size_t>{p2}));
+    EXPECT_EQ(getMatches(matcher, "feeder_/voltage"), (std::vector<std::size_t>{p0, p2}));
+    EXPECT_EQ(getMatches(matcher, ""), (std::vector<std::size_t>{p2}));
+}
+
+TEST(wildcard_tests, star_backtracking)
+{
+    WildcardMatcher matcher;
+    auto p0 = matcher.addPattern("a*b*c");
+    auto p1 = matcher.addPattern("*ab");
+    EXPECT_EQ(getMatches(matcher, "abbbc"), (std::vector<std::size_t>{p0}));
+    EXPECT_EQ(getMatches(matcher, "aXbYbZc"), (std::vector<std::size_t>{p0}));
+    EXPECT_EQ(getMatches(matcher, "abababab"), (std::vector<std::size_t>{p1}));
+    EXPECT_TRUE(getMatches(matcher, "abcd").empty());
+}
+
+TEST(wildcard_tests, unknown_handle_patterns)
+{
+    UnknownHandleManager unknowns;
+    GlobalHandle target1{GlobalFederateId{131072}, InterfaceHandle{1}};
+    GlobalHandle target2{GlobalFederateId{131073}, InterfaceHandle{2}};
+    unknowns.addPublicationPattern("feeder_*/voltage", target1, 0, 5);
+    unknowns.addPublicationPattern("load_*", target2, make_flags(optional_flag), 5);
+    EXPECT_TRUE(unknowns.hasPendingPatterns());
+    EXPECT_TRUE(unknowns.hasUnknowns());
+    EXPECT_TRUE(unknowns.hasNonOptionalUnknowns());
+    EXPECT_FALSE(unknowns.hasRequiredUnknowns());
+
+    // only the interfaces existing before the patterns were added match the pending patterns
+    EXPECT_EQ(unknowns.checkPendingPublicationPatterns("feeder_1/voltage", 2).size(), 1U);
+    EXPECT_TRUE(unknowns.checkPendingPublicationPatterns("feeder_2/voltage", 7).empty());
+    unknowns.clearPendingPatterns();
+    EXPECT_FALSE(unknowns.hasPendingPatterns());
+    EXPECT_TRUE(unknowns.checkPendingPublicationPatterns("feeder_1/voltage", 2).empty());
+
+    auto targets = unknowns.checkForPublicationPatterns("feeder_3/voltage");
+    ASSERT_EQ(targets.size(), 1U);
+    EXPECT_EQ(targets[0].first, target1);
+    EXPECT_TRUE(unknowns.checkForInputPatterns("feeder_3/voltage").empty());
+    // the load pattern has not matched but is optional
+    EXPECT_TRUE(unknowns.hasUnknowns());
+    EXPECT_FALSE(unknowns.hasNonOptionalUnknowns());
+
+    unknowns.clearFederateUnknowns(target2.fed_id);
+    EXPECT_FALSE(unknowns.hasUnknowns());
+    EXPECT_TRUE(unknowns.checkForPublicationPatterns("load_1").empty());
+}
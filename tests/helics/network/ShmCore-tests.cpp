@@ -0,0 +1,277 @@
+/*
+Copyright (c) 2017-2022,
+Battelle Memorial Institute; Lawrence Livermore National Security, LLC; Alliance for Sustainable
+Energy, LLC.  See the top-level NOTICE for additional details. All rights reserved.
+SPDX-License-Identifier: BSD-3-Clause
+*/
+
+#include "helics/common/GuardedTypes.hpp"
+#include "helics/core/ActionMessage.hpp"
+#include "helics/core/BrokerFactory.hpp"
+#include "helics/core/Core.hpp"
+#include "helics/core/CoreBroker.hpp"
+#include "helics/core/CoreFactory.hpp"
+#include "helics/core/CoreTypes.hpp"
+#include "helics/network/CommsInterface.hpp"
+#include "helics/network/shm/ShmComms.h"
+#include "helics/network/shm/ShmCore.h"
+#include "helics/network/shm/ShmRing.h"
+
+#include <fcntl.h>
+#include <gtest/gtest.h>
+#include <string>
+#include <sys/mman.h>
+#include <thread>
+#include <unistd.h>
+#include <vector>
+
+using namespace std::literals::chrono_literals;
+
+TEST(ShmCore, ring_send_receive)
+{
+    helics::shm::ShmRingReceiver rx;
+    ASSERT_TRUE(rx.connect("shmRingTest", 16, 1024));
+    EXPECT_GE(rx.slotCount(), 256U);
+
+    helics::shm::ShmRingSender tx;
+    ASSERT_TRUE(tx.connect("shmRingTest", 0));
+
+    helics::ActionMessage cmd(helics::CMD_SEND_MESSAGE);
+    // large enough to span many slots and wrap around the end of the ring
+    cmd.payload = std::string(3000, 'a');
+    for (int ii = 0; ii < 200; ++ii) {
+        cmd.counter = static_cast<std::uint16_t>(ii);
+        ASSERT_TRUE(tx.sendMessage(cmd));
+        auto rM = rx.getMessage(100ms);
+        ASSERT_TRUE(rM);
+        EXPECT_EQ(rM->counter, ii);
+        EXPECT_EQ(rM->payload.size(), 3000U);
+    }
+    EXPECT_FALSE(rx.tryGetMessage());
+    rx.close();
+}
+
+TEST(ShmCore, ring_multi_sender)
+{
+    helics::shm::ShmRingReceiver rx;
+    ASSERT_TRUE(rx.connect("shmRingTest2", 8, 512));
+
+    constexpr int senders{4};
+    constexpr int messages{2000};
+    std::vector<std::thread> threads;
+    for (int ii = 0; ii < senders; ++ii) {
+        threads.emplace_back([ii] {
+            helics::shm::ShmRingSender tx;
+            if (!tx.connect("shmRingTest2", 2)) {
+                return;
+            }
+            helics::ActionMessage cmd(helics::CMD_ACK);
+            cmd.source_id = helics::GlobalFederateId(ii);
+            for (int jj = 0; jj < messages; ++jj) {
+                cmd.counter = static_cast<std::uint16_t>(jj);
+                tx.sendMessage(cmd);
+            }
+        });
+    }
+    std::vector<int> next(senders, 0);
+    int received{0};
+    while (received < senders * messages) {
+        auto rM = rx.getMessage(1000ms);
+        ASSERT_TRUE(rM);
+        auto src = rM->source_id.baseValue();
+        // messages from a single sender must arrive in order
+        EXPECT_EQ(rM->counter, next[src]);
+        next[src] = rM->counter + 1;
+        ++received;
+    }
+    for (auto& thrd : threads) {
+        thrd.join();
+    }
+    rx.close();
+}
+
+TEST(ShmCore, ring_in_use)
+{
+    helics::shm::ShmRingReceiver rx;
+    ASSERT_TRUE(rx.connect("shmRingInUse", 16, 1024));
+    // a ring owned by a running process is not replaced
+    helics::shm::ShmRingReceiver rx2;
+    EXPECT_FALSE(rx2.connect("shmRingInUse", 16, 1024));
+    EXPECT_FALSE(rx2.getError().empty());
+    rx.close();
+    EXPECT_TRUE(rx2.connect("shmRingInUse", 16, 1024));
+    rx2.close();
+}
+
+TEST(ShmCore, ring_stale_segment)
+{
+    // a segment left behind without a valid ring header is removed
+    auto segment = helics::shm::shmSegmentName("shmRingStale");
+    int fd = shm_open(segment.c_str(), O_CREAT | O_RDWR, 0600);
+    ASSERT_GE(fd, 0);
+    EXPECT_EQ(ftruncate(fd, 64), 0);
+    close(fd);
+
+    helics::shm::ShmRingReceiver rx;
+    ASSERT_TRUE(rx.connect("shmRingStale", 16, 1024));
+    helics::shm::ShmRingSender tx;
+    ASSERT_TRUE(tx.connect("shmRingStale", 0));
+    helics::ActionMessage cmd(helics::CMD_ACK);
+    cmd.counter = 5;
+    ASSERT_TRUE(tx.sendMessage(cmd));
+    auto rM = rx.getMessage(100ms);
+    ASSERT_TRUE(rM);
+    EXPECT_EQ(rM->counter, 5);
+    rx.close();
+}
+
+TEST(ShmCore, shmcomms_broker)
+{
+    std::string brokerLoc = "brokerSHM";
+    std::string localLoc = "localSHM";
+    helics::shm::ShmComms comm;
+    comm.loadTargetInfo(localLoc, brokerLoc);
+
+    helics::shm::ShmRingReceiver mq;
+    bool mqConn = mq.connect(brokerLoc, 1024, 1024);
+    ASSERT_TRUE(mqConn);
+
+    comm.setCallback([](const helics::ActionMessage& /*m*/) {});
+
+    bool connected = comm.connect();
+    ASSERT_TRUE(connected);
+    comm.transmit(helics::parent_route_id, helics::CMD_IGNORE);
+
+    auto rM = mq.getMessage(1000ms);
+    ASSERT_TRUE(rM);
+    EXPECT_TRUE(rM->action() == helics::action_message_def::action_t::cmd_ignore);
+    comm.disconnect();
+    mq.close();
+}
+
+TEST(ShmCore, shmcomms_rx)
+{
+    std::atomic<int> counter{0};
+    guarded<helics::ActionMessage> act;
+    std::string brokerLoc;
+    std::string localLoc = "localSHM";
+    helics::shm::ShmComms comm;
+    comm.loadTargetInfo(localLoc, brokerLoc);
+
+    comm.setCallback([&counter, &act](const helics::ActionMessage& m) {
+        ++counter;
+        act = m;
+    });
+
+    bool connected = comm.connect();
+    ASSERT_TRUE(connected);
+    helics::shm::ShmRingSender mq;
+    ASSERT_TRUE(mq.connect(localLoc, 2));
+
+    helics::ActionMessage cmd(helics::CMD_ACK);
+
+    mq.sendMessage(cmd);
+    std::this_thread::sleep_for(100ms);
+    ASSERT_EQ(counter, 1);
+    EXPECT_TRUE(act.lock()->action() == helics::action_message_def::action_t::cmd_ack);
+    comm.disconnect();
+}
+
+TEST(ShmCore, shmComm_transmit_add_route)
+{
+    std::atomic<int> counter{0};
+    std::string brokerLoc = "brokerSHM";
+    std::string localLoc = "localSHM";
+    std::string localLocB = "localSHM2";
+
+    std::atomic<int> counter2{0};
+    std::atomic<int> counter3{0};
+    guarded<helics::ActionMessage> act;
+    guarded<helics::ActionMessage> act2;
+    guarded<helics::ActionMessage> act3;
+
+    helics::shm::ShmComms comm;
+    helics::shm::ShmComms comm2;
+    helics::shm::ShmComms comm3;
+    comm.loadTargetInfo(localLoc, brokerLoc);
+    comm2.loadTargetInfo(brokerLoc, std::string());
+    comm3.loadTargetInfo(localLocB, brokerLoc);
+
+    comm.setCallback([&counter, &act](const helics::ActionMessage& m) {
+        ++counter;
+        act = m;
+    });
+    comm2.setCallback([&counter2, &act2](const helics::ActionMessage& m) {
+        ++counter2;
+        act2 = m;
+    });
+    comm3.setCallback([&counter3, &act3](const helics::ActionMessage& m) {
+        ++counter3;
+        act3 = m;
+    });
+
+    bool connected = comm2.connect();
+    ASSERT_TRUE(connected);
+    connected = comm.connect();
+    ASSERT_TRUE(connected);
+    connected = comm3.connect();
+    ASSERT_TRUE(connected);
+    comm.transmit(helics::parent_route_id, helics::CMD_ACK);
+
+    std::this_thread::sleep_for(100ms);
+    ASSERT_EQ(counter2, 1);
+    EXPECT_TRUE(act2.lock()->action() == helics::action_message_def::action_t::cmd_ack);
+
+    comm3.transmit(helics::parent_route_id, helics::CMD_ACK);
+
+    std::this_thread::sleep_for(100ms);
+    ASSERT_EQ(counter2, 2);
+
+    comm2.addRoute(helics::route_id(3), localLocB);
+    comm2.transmit(helics::route_id(3), helics::CMD_ACK);
+
+    std::this_thread::sleep_for(100ms);
+    ASSERT_EQ(counter3, 1);
+    EXPECT_TRUE(act3.lock()->action() == helics::action_message_def::action_t::cmd_ack);
+
+    comm2.addRoute(helics::route_id(4), localLoc);
+    comm2.transmit(helics::route_id(4), helics::CMD_ACK);
+
+    std::this_thread::sleep_for(100ms);
+    ASSERT_EQ(counter.load(), 1);
+    EXPECT_TRUE(act.lock()->action() == helics::action_message_def::action_t::cmd_ack);
+
+    comm.disconnect();
+    comm2.disconnect();
+    comm3.disconnect();
+}
+
+/** test case checks default values and makes sure they all mesh together*/
+TEST(ShmCore, shmCore_core_broker_default)
+{
+    std::string initializationString = "-f 1";
+
+    auto broker = helics::BrokerFactory::create(helics::CoreType::SHM, initializationString);
+
+    auto core = helics::CoreFactory::create(helics::CoreType::SHM, initializationString);
+    bool connected = broker->isConnected();
+    EXPECT_TRUE(connected);
+    connected = core->connect();
+    EXPECT_TRUE(connected);
+
+    core->disconnect();
+    broker->disconnect();
+    core = nullptr;
+    broker = nullptr;
+    helics::CoreFactory::cleanUpCores(100ms);
+    helics::BrokerFactory::cleanUpBrokers(100ms);
+}
+
+TEST(ShmCore, commFactory)
+{
+    auto comm = helics::CommFactory::create("shm");
+    auto comm2 = helics::CommFactory::create(helics::CoreType::SHM);
+
+    EXPECT_TRUE(dynamic_cast<helics::shm::ShmComms*>(comm.get()) != nullptr);
+    EXPECT_TRUE(dynamic_cast<helics::shm::ShmComms*>(comm2.get()) != nullptr);
+}
@@ -12,6 +12,7 @@ SPDX-License-Identifier: BSD-3-Clause
 #include "helics/core/Core.hpp"
 #include "helics/core/CoreFactory.hpp"
 #include "helics/core/CoreTypes.hpp"
+#include "helics/network/NetworkBrokerData.hpp"
 #include "helics/network/networkDefaults.hpp"
 #include "helics/network/tcp/TcpBroker.h"
 #include "helics/network/tcp/TcpComms.h"
@@ -337,6 +338,65 @@ TEST(TcpCore, tcpComm_transmit_through)
     std::this_thread::sleep_for(100ms);
 }
 
+TEST(TcpCore, tcpComm_transmit_batched)
+{
+    std::this_thread::sleep_for(300ms);
+    std::atomic<int> counter2{0};
+
+    std::string host = "localhost";
+    helics::NetworkBrokerData netInfo;
+    netInfo.brokerAddress = host;
+    netInfo.localInterface = host;
+    netInfo.txBatchSize = 2048;
+    netInfo.txBatchDelay = 500;
+    helics::tcp::TcpComms comm;
+    comm.loadNetworkInfo(netInfo);
+    comm.setFlag("reuse_address", true);
+    helics::tcp::TcpComms comm2;
+    comm2.loadTargetInfo(host, std::string());
+
+    comm.setBrokerPort(helics::network::DEFAULT_TCP_PORT + 1);
+    comm.setName("tests");
+    comm2.setName("test2");
+    comm2.setPortNumber(helics::network::DEFAULT_TCP_PORT + 1);
+    comm2.setFlag("reuse_address", true);
+    comm.setPortNumber(TCP_SECONDARY_PORT);
+
+    comm.setCallback([](const helics::ActionMessage& /*m*/) {});
+    comm2.setCallback([&counter2](const helics::ActionMessage& m) {
+        if (m.action() == helics::CMD_ACK) {
+            ++counter2;
+        }
+    });
+
+    bool connected1 = comm2.connect();
+    ASSERT_TRUE(connected1);
+    bool connected2 = comm.connect();
+    if (!connected2) {  // lets just try again if it is not connected
+        connected2 = comm.connect();
+    }
+    ASSERT_TRUE(connected2);
+
+    // enough messages to span multiple batches along with a trailing partial batch
+    for (int ii = 0; ii < 500; ++ii) {
+        comm.transmit(helics::parent_route_id, helics::CMD_ACK);
+    }
+    int cnt{0};
+    while (counter2 < 500 && cnt < 20) {
+        std::this_thread::sleep_for(100ms);
+        ++cnt;
+    }
+    EXPECT_EQ(counter2, 500);
+
+    comm.disconnect();
+    EXPECT_TRUE(!comm.isConnected());
+
+    comm2.disconnect();
+    EXPECT_TRUE(!comm2.isConnected());
+
+    std::this_thread::sleep_for(100ms);
+}
+
 TEST(TcpCore, tcpComm_transmit_add_route)
 {
     std::this_thread::sleep_for(300ms);
@@ -26,3 +26,22 @@ TEST(networkData_tests, basic_test)
     EXPECT_EQ(bdata.encrypted, true);
     EXPECT_EQ(bdata.encryptionConfig, "openssl.json");
 }
+
+TEST(networkData_tests, tx_batch)
+{
+    helics::NetworkBrokerData bdata;
+    auto parser = bdata.commandLineParser("local");
+    EXPECT_EQ(bdata.txBatchSize, 0);
+    parser->helics_parse("--tx_batch=65536 --tx_batch_delay=200");
+    EXPECT_EQ(bdata.txBatchSize, 65536);
+    EXPECT_EQ(bdata.txBatchDelay, 200);
+}
+
+TEST(networkData_tests, compact_serialization)
+{
+    helics::NetworkBrokerData bdata;
+    auto parser = bdata.commandLineParser("local");
+    EXPECT_FALSE(bdata.useCompactSerialization);
+    parser->helics_parse("--compact_serialization");
+    EXPECT_TRUE(bdata.useCompactSerialization);
+}